@@ -23,6 +23,7 @@
 #include "platform_memory.h"
 
 unsigned int g_maximumHeapAddress;
+volatile unsigned int g_heapAllocations; // every malloc, realloc and new, GcodeDispatch uses it to count the allocations per line
 
 static void fillUnusedRAM(void);
 static void configureStackSizeLimit(unsigned int stackSizeLimit);
@@ -268,6 +269,7 @@ extern "C" __attribute__((naked)) void __wrap_malloc(size_t size)
 
 extern "C" void *mallocWithTag(size_t size, unsigned int tag)
 {
+    g_heapAllocations++;
     void *p = __real_malloc(size + sizeof(tag));
     if (!p && __smoothieHeapBase)
         return p;
@@ -313,6 +315,7 @@ extern "C" __attribute__((naked)) void __wrap_realloc(void *ptr, size_t size)
 
 extern "C" void *reallocWithTag(void *ptr, size_t size, unsigned int tag)
 {
+    g_heapAllocations++;
     void *p = __real_realloc(ptr, size + sizeof(tag));
     if (!p)
         return p;
@@ -363,6 +366,7 @@ extern "C" void *__real_malloc(size_t size);
 extern "C" void *__wrap_malloc(size_t size)
 {
     breakOnHeapOpFromInterruptHandler();
+    g_heapAllocations++;
     return __real_malloc(size);
 }
 
@@ -371,6 +375,7 @@ extern "C" void *__real_realloc(void *ptr, size_t size);
 extern "C" void *__wrap_realloc(void *ptr, size_t size)
 {
     breakOnHeapOpFromInterruptHandler();
+    g_heapAllocations++;
     return __real_realloc(ptr, size);
 }
 
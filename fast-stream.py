@@ -3,16 +3,19 @@
 Stream g-code to Smoothie USB serial connection
 
 Based on GRBL stream.py, but completely different
+
+With -b the G0/G1 moves are sent as binary move frames (see src/modules/communication/utils/MoveFrame.h),
+everything else is still sent as text. With -o the stream is written to a file instead of a device, the simulator
+replays it with smoothiesim -s.
 """
 
 from __future__ import print_function
 import sys
 import argparse
-import serial
 import threading
 import time
 import signal
-import sys
+import re
 
 errorflg = False
 intrflg = False
@@ -26,15 +29,183 @@ def signal_term_handler(signal, frame):
 
 signal.signal(signal.SIGTERM, signal_term_handler)
 
+
+class MoveEncoder:
+    """Turns G0/G1 lines into binary move frames, the other lines are returned to be sent as text"""
+
+    SYNC = 0xFE
+    MAX_PAYLOAD = 120
+    UNITS_PER_MM = 10000
+    F_PER_MM_MIN = 100
+    S_SCALE = 1000
+    word_re = re.compile(r'([A-Z])\s*([-+]?[0-9]*\.?[0-9]+)')
+
+    def __init__(self):
+        self.payload = bytearray()
+        self.position = None        # last XYZ sent, None after a text line as it may have moved
+        self.absolute = True        # G90
+        self.e_absolute = True      # M82
+        self.inch = False           # G20
+        self.modal = 1              # G0 or G1, anything else is not encoded
+        self.e = 0.0                # for absolute E we send the change
+        self.moves = 0
+        self.frames = 0
+        self.texts = 0
+
+    @staticmethod
+    def varint(v):
+        v = (v << 1) if v >= 0 else ((-v) << 1) - 1
+        out = bytearray()
+        while v >= 0x80:
+            out.append((v & 0x7F) | 0x80)
+            v >>= 7
+        out.append(v)
+        return out
+
+    @staticmethod
+    def crc16(data):
+        crc = 0xFFFF
+        for b in data:
+            crc ^= b << 8
+            for _ in range(8):
+                crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+                crc &= 0xFFFF
+        return crc
+
+    def flush(self):
+        """returns the pending moves as a frame"""
+        if not self.payload:
+            return b''
+        body = bytearray([len(self.payload)]) + self.payload
+        crc = self.crc16(body)
+        self.payload = bytearray()
+        self.frames += 1
+        return bytes(bytearray([self.SYNC]) + body + bytearray([crc & 0xFF, crc >> 8]))
+
+    def encode(self, line):
+        """returns the bytes to send for a line, frames are only sent when full or a text line has to be sent"""
+        code = re.sub(r'\(.*?\)|;.*', '', line).strip().upper()
+        if not code:
+            return b''
+        words = [(w, float(v)) for w, v in self.word_re.findall(code)]
+        letters = [w for w, _ in words]
+        gs = [int(v) for w, v in words if w == 'G']
+
+        if (self.absolute and not self.inch and len(gs) <= 1 and (not gs or gs[0] in (0, 1)) and
+                (gs or self.modal in (0, 1)) and len(set(letters)) == len(letters) and
+                set(letters) <= set('GXYZEFS') and len(self.word_re.sub('', code).strip()) == 0):
+            record = self.encode_move(dict(words), gs[0] if gs else self.modal)
+            if record is not None:
+                out = b''
+                if len(self.payload) + len(record) > self.MAX_PAYLOAD:
+                    out = self.flush()
+                self.payload += record
+                self.moves += 1
+                return out
+
+        # a text line, it may change the modes or move in a way we do not follow
+        self.track(words)
+        self.position = None
+        self.texts += 1
+        return self.flush() + (re.sub(r';.*', '', line).strip() + '\n').encode('latin1')
+
+    def encode_move(self, w, g):
+        self.modal = g
+        header = 0x40 if g == 0 else 0
+        fields = bytearray()
+        if self.position is None:
+            self.position = [None, None, None]
+        # positions are sent for an axis we have not sent since the last text line
+        absolute = any(self.position[i] is None for i, a in enumerate('XYZ') if a in w)
+        if absolute:
+            header |= 0x80
+        for i, a in enumerate('XYZ'):
+            if a in w:
+                q = int(round(w[a] * self.UNITS_PER_MM))
+                fields += self.varint(q if absolute else q - self.position[i])
+                self.position[i] = q
+                header |= 1 << i
+        if 'E' in w:
+            q = int(round(w['E'] * self.UNITS_PER_MM))
+            if self.e_absolute:
+                # the change from the last absolute E, rounded the same way so it does not drift
+                last = int(round(self.e * self.UNITS_PER_MM))
+                self.e = w['E']
+                q -= last
+            fields += self.varint(q)
+            header |= 0x08
+        if 'F' in w:
+            fields += self.varint(int(round(w['F'] * self.F_PER_MM_MIN)))
+            header |= 0x10
+        if 'S' in w:
+            fields += self.varint(int(round(w['S'] * self.S_SCALE)))
+            header |= 0x20
+        if header & 0x3F == 0:
+            return None     # G1 on its own
+        return bytearray([header]) + fields
+
+    def track(self, words):
+        w = dict(words)
+        for letter, v in words:
+            if letter == 'G':
+                g = int(v)
+                if g in (0, 1, 2, 3):
+                    self.modal = g
+                elif g == 90:
+                    self.absolute = self.e_absolute = True
+                elif g == 91:
+                    self.absolute = self.e_absolute = False
+                elif g == 20:
+                    self.inch = True
+                elif g == 21:
+                    self.inch = False
+                elif g == 92 and 'E' in w:
+                    self.e = w['E']
+            elif letter == 'M':
+                if int(v) == 82:
+                    self.e_absolute = True
+                elif int(v) == 83:
+                    self.e_absolute = False
+        if 'E' in w and self.modal in (0, 1, 2, 3) and 'M' not in w and not any(int(v) == 92 for l, v in words if l == 'G'):
+            self.e = w['E'] if self.e_absolute else self.e + w['E']
+
+
 # Define command line argument interface
 parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over telnet.')
 parser.add_argument('gcode_file', type=argparse.FileType('r'), help='g-code filename to be streamed')
-parser.add_argument('device', help='Smoothie Serial Device')
+parser.add_argument('device', nargs='?', help='Smoothie Serial Device')
 parser.add_argument('-q', '--quiet', action='store_true', default=False, help='suppress output text')
+parser.add_argument('-b', '--binary', action='store_true', default=False, help='send G0/G1 moves as binary move frames')
+parser.add_argument('-o', '--output', help='write what would be sent to this file instead of a device')
 args = parser.parse_args()
 
 f = args.gcode_file
 verbose = not args.quiet
+encoder = MoveEncoder() if args.binary else None
+
+if args.output:
+    # loopback, the stream is replayed by the simulator
+    with open(args.output, 'wb') as out:
+        nbytes = 0
+        for line in f:
+            o = encoder.encode(line) if encoder else (re.sub(r';.*', '', line).strip() + '\n').encode('latin1')
+            if o.strip():
+                out.write(o)
+                nbytes += len(o)
+        if encoder:
+            o = encoder.flush()
+            out.write(o)
+            nbytes += len(o)
+    if encoder:
+        print("{} bytes, {} moves in {} frames".format(nbytes, encoder.moves, encoder.frames))
+    else:
+        print("{} bytes".format(nbytes))
+    sys.exit(0)
+
+if args.device is None:
+    parser.error('a device or --output is required')
+
+import serial
 
 # Stream g-code to Smoothie
 
@@ -58,7 +229,7 @@ def read_thread():
         n = rep.count("ok")
         if n == 0:
             print("Incoming: " + rep)
-            if "error" in rep or "!!" in rep or "ALARM" in rep or "ERROR" in rep:
+            if "error" in rep or "Error" in rep or "!!" in rep or "ALARM" in rep or "ERROR" in rep:
                 errorflg = True
                 break
         else:
@@ -73,6 +244,13 @@ t = threading.Thread(target=read_thread)
 t.daemon = True
 t.start()
 
+
+def send(o):
+    n = s.write(o)
+    if n != len(o):
+        print("Not entire line was sent: {} - {}".format(n, len(o)))
+
+
 linecnt = 0
 try:
     for line in f:
@@ -81,15 +259,26 @@ try:
         # strip comments
         if line.startswith(';'):
             continue
-        l = line.strip()
-        o = "{}\n".format(l).encode('latin1')
-        n = s.write(o)
-        if n != len(o):
-            print("Not entire line was sent: {} - {}".format(n, len(o)))
-        linecnt += 1
+        if encoder:
+            # each frame and each text line is answered with an ok
+            sent = encoder.frames + encoder.texts
+            o = encoder.encode(line)
+            if o:
+                send(o)
+            linecnt += encoder.frames + encoder.texts - sent
+        else:
+            l = line.strip()
+            send("{}\n".format(l).encode('latin1'))
+            linecnt += 1
         if verbose:
             print("SND " + str(linecnt) + ": " + line.strip() + " - " + str(okcnt))
 
+    if encoder and not errorflg:
+        o = encoder.flush()
+        if o:
+            send(o)
+            linecnt += 1
+
 except KeyboardInterrupt:
     print("Interrupted...")
     intrflg = True
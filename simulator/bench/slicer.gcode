@@ -0,0 +1,4319 @@
+; slicer style output for the gcode parse benchmark, laid out like PrusaSlicer writes it:
+; perimeters and infill with E on every move, retractions, travel, fan and layer change comments
+M107
+M104 S215 ; set temperature
+M140 S60 ; set bed temperature
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M83 ; use relative distances for extrusion
+G92 E0
+G1 Z0.350 F7800.000
+;LAYER_CHANGE
+;Z:0.2
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z0.600 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z0.200 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z0.200 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z0.200 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Solid infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X65.657 Y44.500 E0.01871
+G1 X62.828 Y44.500 E0.10583
+G1 X60.000 Y44.500 E0.10583
+G1 X57.172 Y44.500 E0.10583
+G1 X54.343 Y44.500 E0.10583
+G1 X53.126 Y45.000 E0.01871
+G1 X56.563 Y45.000 E0.12860
+G1 X60.000 Y45.000 E0.12860
+G1 X63.437 Y45.000 E0.12860
+G1 X66.874 Y45.000 E0.12860
+G1 X67.874 Y45.500 E0.01871
+G1 X63.937 Y45.500 E0.14731
+G1 X60.000 Y45.500 E0.14731
+G1 X56.063 Y45.500 E0.14731
+G1 X52.126 Y45.500 E0.14731
+G1 X51.268 Y46.000 E0.01871
+G1 X55.634 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X64.366 Y46.000 E0.16337
+G1 X68.732 Y46.000 E0.16337
+G1 X69.487 Y46.500 E0.01871
+G1 X64.743 Y46.500 E0.17749
+G1 X60.000 Y46.500 E0.17749
+G1 X55.257 Y46.500 E0.17749
+G1 X50.513 Y46.500 E0.17749
+G1 X49.839 Y47.000 E0.01871
+G1 X54.919 Y47.000 E0.19010
+G1 X60.000 Y47.000 E0.19010
+G1 X65.081 Y47.000 E0.19010
+G1 X70.161 Y47.000 E0.19010
+G1 X70.770 Y47.500 E0.01871
+G1 X65.385 Y47.500 E0.20150
+G1 X60.000 Y47.500 E0.20150
+G1 X54.615 Y47.500 E0.20150
+G1 X49.230 Y47.500 E0.20150
+G1 X48.675 Y48.000 E0.01871
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X71.832 Y48.500 E0.01871
+G1 X65.916 Y48.500 E0.22137
+G1 X60.000 Y48.500 E0.22137
+G1 X54.084 Y48.500 E0.22137
+G1 X48.168 Y48.500 E0.22137
+G1 X47.702 Y49.000 E0.01871
+G1 X53.851 Y49.000 E0.23009
+G1 X60.000 Y49.000 E0.23009
+G1 X66.149 Y49.000 E0.23009
+G1 X72.298 Y49.000 E0.23009
+G1 X72.728 Y49.500 E0.01871
+G1 X66.364 Y49.500 E0.23812
+G1 X60.000 Y49.500 E0.23812
+G1 X53.636 Y49.500 E0.23812
+G1 X47.272 Y49.500 E0.23812
+G1 X46.876 Y50.000 E0.01871
+G1 X53.438 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X66.562 Y50.000 E0.24554
+G1 X73.124 Y50.000 E0.24554
+G1 X73.491 Y50.500 E0.01871
+G1 X66.745 Y50.500 E0.25240
+G1 X60.000 Y50.500 E0.25240
+G1 X53.255 Y50.500 E0.25240
+G1 X46.509 Y50.500 E0.25240
+G1 X46.171 Y51.000 E0.01871
+G1 X53.085 Y51.000 E0.25873
+G1 X60.000 Y51.000 E0.25873
+G1 X66.915 Y51.000 E0.25873
+G1 X73.829 Y51.000 E0.25873
+G1 X74.142 Y51.500 E0.01871
+G1 X67.071 Y51.500 E0.26458
+G1 X60.000 Y51.500 E0.26458
+G1 X52.929 Y51.500 E0.26458
+G1 X45.858 Y51.500 E0.26458
+G1 X45.569 Y52.000 E0.01871
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X74.697 Y52.500 E0.01871
+G1 X67.348 Y52.500 E0.27496
+G1 X60.000 Y52.500 E0.27496
+G1 X52.652 Y52.500 E0.27496
+G1 X45.303 Y52.500 E0.27496
+G1 X45.058 Y53.000 E0.01871
+G1 X52.529 Y53.000 E0.27954
+G1 X60.000 Y53.000 E0.27954
+G1 X67.471 Y53.000 E0.27954
+G1 X74.942 Y53.000 E0.27954
+G1 X75.166 Y53.500 E0.01871
+G1 X67.583 Y53.500 E0.28373
+G1 X60.000 Y53.500 E0.28373
+G1 X52.417 Y53.500 E0.28373
+G1 X44.834 Y53.500 E0.28373
+G1 X44.630 Y54.000 E0.01871
+G1 X52.315 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X67.685 Y54.000 E0.28756
+G1 X75.370 Y54.000 E0.28756
+G1 X75.556 Y54.500 E0.01871
+G1 X67.778 Y54.500 E0.29104
+G1 X60.000 Y54.500 E0.29104
+G1 X52.222 Y54.500 E0.29104
+G1 X44.444 Y54.500 E0.29104
+G1 X44.276 Y55.000 E0.01871
+G1 X52.138 Y55.000 E0.29418
+G1 X60.000 Y55.000 E0.29418
+G1 X67.862 Y55.000 E0.29418
+G1 X75.724 Y55.000 E0.29418
+G1 X75.875 Y55.500 E0.01871
+G1 X67.937 Y55.500 E0.29699
+G1 X60.000 Y55.500 E0.29699
+G1 X52.063 Y55.500 E0.29699
+G1 X44.125 Y55.500 E0.29699
+G1 X43.992 Y56.000 E0.01871
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.125 Y56.500 E0.01871
+G1 X68.062 Y56.500 E0.30167
+G1 X60.000 Y56.500 E0.30167
+G1 X51.938 Y56.500 E0.30167
+G1 X43.875 Y56.500 E0.30167
+G1 X43.775 Y57.000 E0.01871
+G1 X51.888 Y57.000 E0.30355
+G1 X60.000 Y57.000 E0.30355
+G1 X68.112 Y57.000 E0.30355
+G1 X76.225 Y57.000 E0.30355
+G1 X76.310 Y57.500 E0.01871
+G1 X68.155 Y57.500 E0.30513
+G1 X60.000 Y57.500 E0.30513
+G1 X51.845 Y57.500 E0.30513
+G1 X43.690 Y57.500 E0.30513
+G1 X43.622 Y58.000 E0.01871
+G1 X51.811 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X68.189 Y58.000 E0.30642
+G1 X76.378 Y58.000 E0.30642
+G1 X76.432 Y58.500 E0.01871
+G1 X68.216 Y58.500 E0.30742
+G1 X60.000 Y58.500 E0.30742
+G1 X51.784 Y58.500 E0.30742
+G1 X43.568 Y58.500 E0.30742
+G1 X43.530 Y59.000 E0.01871
+G1 X51.765 Y59.000 E0.30813
+G1 X60.000 Y59.000 E0.30813
+G1 X68.235 Y59.000 E0.30813
+G1 X76.470 Y59.000 E0.30813
+G1 X76.492 Y59.500 E0.01871
+G1 X68.246 Y59.500 E0.30855
+G1 X60.000 Y59.500 E0.30855
+G1 X51.754 Y59.500 E0.30855
+G1 X43.508 Y59.500 E0.30855
+G1 X43.500 Y60.000 E0.01871
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.492 Y60.500 E0.01871
+G1 X68.246 Y60.500 E0.30855
+G1 X60.000 Y60.500 E0.30855
+G1 X51.754 Y60.500 E0.30855
+G1 X43.508 Y60.500 E0.30855
+G1 X43.530 Y61.000 E0.01871
+G1 X51.765 Y61.000 E0.30813
+G1 X60.000 Y61.000 E0.30813
+G1 X68.235 Y61.000 E0.30813
+G1 X76.470 Y61.000 E0.30813
+G1 X76.432 Y61.500 E0.01871
+G1 X68.216 Y61.500 E0.30742
+G1 X60.000 Y61.500 E0.30742
+G1 X51.784 Y61.500 E0.30742
+G1 X43.568 Y61.500 E0.30742
+G1 X43.622 Y62.000 E0.01871
+G1 X51.811 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X68.189 Y62.000 E0.30642
+G1 X76.378 Y62.000 E0.30642
+G1 X76.310 Y62.500 E0.01871
+G1 X68.155 Y62.500 E0.30513
+G1 X60.000 Y62.500 E0.30513
+G1 X51.845 Y62.500 E0.30513
+G1 X43.690 Y62.500 E0.30513
+G1 X43.775 Y63.000 E0.01871
+G1 X51.888 Y63.000 E0.30355
+G1 X60.000 Y63.000 E0.30355
+G1 X68.112 Y63.000 E0.30355
+G1 X76.225 Y63.000 E0.30355
+G1 X76.125 Y63.500 E0.01871
+G1 X68.062 Y63.500 E0.30167
+G1 X60.000 Y63.500 E0.30167
+G1 X51.938 Y63.500 E0.30167
+G1 X43.875 Y63.500 E0.30167
+G1 X43.992 Y64.000 E0.01871
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.875 Y64.500 E0.01871
+G1 X67.937 Y64.500 E0.29699
+G1 X60.000 Y64.500 E0.29699
+G1 X52.063 Y64.500 E0.29699
+G1 X44.125 Y64.500 E0.29699
+G1 X44.276 Y65.000 E0.01871
+G1 X52.138 Y65.000 E0.29418
+G1 X60.000 Y65.000 E0.29418
+G1 X67.862 Y65.000 E0.29418
+G1 X75.724 Y65.000 E0.29418
+G1 X75.556 Y65.500 E0.01871
+G1 X67.778 Y65.500 E0.29104
+G1 X60.000 Y65.500 E0.29104
+G1 X52.222 Y65.500 E0.29104
+G1 X44.444 Y65.500 E0.29104
+G1 X44.630 Y66.000 E0.01871
+G1 X52.315 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X67.685 Y66.000 E0.28756
+G1 X75.370 Y66.000 E0.28756
+G1 X75.166 Y66.500 E0.01871
+G1 X67.583 Y66.500 E0.28373
+G1 X60.000 Y66.500 E0.28373
+G1 X52.417 Y66.500 E0.28373
+G1 X44.834 Y66.500 E0.28373
+G1 X45.058 Y67.000 E0.01871
+G1 X52.529 Y67.000 E0.27954
+G1 X60.000 Y67.000 E0.27954
+G1 X67.471 Y67.000 E0.27954
+G1 X74.942 Y67.000 E0.27954
+G1 X74.697 Y67.500 E0.01871
+G1 X67.348 Y67.500 E0.27496
+G1 X60.000 Y67.500 E0.27496
+G1 X52.652 Y67.500 E0.27496
+G1 X45.303 Y67.500 E0.27496
+G1 X45.569 Y68.000 E0.01871
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X74.142 Y68.500 E0.01871
+G1 X67.071 Y68.500 E0.26458
+G1 X60.000 Y68.500 E0.26458
+G1 X52.929 Y68.500 E0.26458
+G1 X45.858 Y68.500 E0.26458
+G1 X46.171 Y69.000 E0.01871
+G1 X53.085 Y69.000 E0.25873
+G1 X60.000 Y69.000 E0.25873
+G1 X66.915 Y69.000 E0.25873
+G1 X73.829 Y69.000 E0.25873
+G1 X73.491 Y69.500 E0.01871
+G1 X66.745 Y69.500 E0.25240
+G1 X60.000 Y69.500 E0.25240
+G1 X53.255 Y69.500 E0.25240
+G1 X46.509 Y69.500 E0.25240
+G1 X46.876 Y70.000 E0.01871
+G1 X53.438 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X66.562 Y70.000 E0.24554
+G1 X73.124 Y70.000 E0.24554
+G1 X72.728 Y70.500 E0.01871
+G1 X66.364 Y70.500 E0.23812
+G1 X60.000 Y70.500 E0.23812
+G1 X53.636 Y70.500 E0.23812
+G1 X47.272 Y70.500 E0.23812
+G1 X47.702 Y71.000 E0.01871
+G1 X53.851 Y71.000 E0.23009
+G1 X60.000 Y71.000 E0.23009
+G1 X66.149 Y71.000 E0.23009
+G1 X72.298 Y71.000 E0.23009
+G1 X71.832 Y71.500 E0.01871
+G1 X65.916 Y71.500 E0.22137
+G1 X60.000 Y71.500 E0.22137
+G1 X54.084 Y71.500 E0.22137
+G1 X48.168 Y71.500 E0.22137
+G1 X48.675 Y72.000 E0.01871
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X70.770 Y72.500 E0.01871
+G1 X65.385 Y72.500 E0.20150
+G1 X60.000 Y72.500 E0.20150
+G1 X54.615 Y72.500 E0.20150
+G1 X49.230 Y72.500 E0.20150
+G1 X49.839 Y73.000 E0.01871
+G1 X54.919 Y73.000 E0.19010
+G1 X60.000 Y73.000 E0.19010
+G1 X65.081 Y73.000 E0.19010
+G1 X70.161 Y73.000 E0.19010
+G1 X69.487 Y73.500 E0.01871
+G1 X64.743 Y73.500 E0.17749
+G1 X60.000 Y73.500 E0.17749
+G1 X55.257 Y73.500 E0.17749
+G1 X50.513 Y73.500 E0.17749
+G1 X51.268 Y74.000 E0.01871
+G1 X55.634 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X64.366 Y74.000 E0.16337
+G1 X68.732 Y74.000 E0.16337
+G1 X67.874 Y74.500 E0.01871
+G1 X63.937 Y74.500 E0.14731
+G1 X60.000 Y74.500 E0.14731
+G1 X56.063 Y74.500 E0.14731
+G1 X52.126 Y74.500 E0.14731
+G1 X53.126 Y75.000 E0.01871
+G1 X56.563 Y75.000 E0.12860
+G1 X60.000 Y75.000 E0.12860
+G1 X63.437 Y75.000 E0.12860
+G1 X66.874 Y75.000 E0.12860
+G1 X65.657 Y75.500 E0.01871
+G1 X62.828 Y75.500 E0.10583
+G1 X60.000 Y75.500 E0.10583
+G1 X57.172 Y75.500 E0.10583
+G1 X54.343 Y75.500 E0.10583
+G1 X55.969 Y76.000 E0.01871
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 1 of 8
+;LAYER_CHANGE
+;Z:0.4
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z0.800 F7800.000
+M106 S255
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z0.400 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z0.400 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z0.400 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Internal infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X68.732 Y46.000 E0.07484
+G1 X64.366 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X55.634 Y46.000 E0.16337
+G1 X51.268 Y46.000 E0.16337
+G1 X48.675 Y48.000 E0.07484
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X73.124 Y50.000 E0.07484
+G1 X66.562 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X53.438 Y50.000 E0.24554
+G1 X46.876 Y50.000 E0.24554
+G1 X45.569 Y52.000 E0.07484
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X75.370 Y54.000 E0.07484
+G1 X67.685 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X52.315 Y54.000 E0.28756
+G1 X44.630 Y54.000 E0.28756
+G1 X43.992 Y56.000 E0.07484
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.378 Y58.000 E0.07484
+G1 X68.189 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X51.811 Y58.000 E0.30642
+G1 X43.622 Y58.000 E0.30642
+G1 X43.500 Y60.000 E0.07484
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.378 Y62.000 E0.07484
+G1 X68.189 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X51.811 Y62.000 E0.30642
+G1 X43.622 Y62.000 E0.30642
+G1 X43.992 Y64.000 E0.07484
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.370 Y66.000 E0.07484
+G1 X67.685 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X52.315 Y66.000 E0.28756
+G1 X44.630 Y66.000 E0.28756
+G1 X45.569 Y68.000 E0.07484
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X73.124 Y70.000 E0.07484
+G1 X66.562 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X53.438 Y70.000 E0.24554
+G1 X46.876 Y70.000 E0.24554
+G1 X48.675 Y72.000 E0.07484
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X68.732 Y74.000 E0.07484
+G1 X64.366 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X55.634 Y74.000 E0.16337
+G1 X51.268 Y74.000 E0.16337
+G1 X55.969 Y76.000 E0.07484
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 2 of 8
+;LAYER_CHANGE
+;Z:0.6
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z1.000 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z0.600 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z0.600 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z0.600 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Internal infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X68.732 Y46.000 E0.07484
+G1 X64.366 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X55.634 Y46.000 E0.16337
+G1 X51.268 Y46.000 E0.16337
+G1 X48.675 Y48.000 E0.07484
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X73.124 Y50.000 E0.07484
+G1 X66.562 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X53.438 Y50.000 E0.24554
+G1 X46.876 Y50.000 E0.24554
+G1 X45.569 Y52.000 E0.07484
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X75.370 Y54.000 E0.07484
+G1 X67.685 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X52.315 Y54.000 E0.28756
+G1 X44.630 Y54.000 E0.28756
+G1 X43.992 Y56.000 E0.07484
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.378 Y58.000 E0.07484
+G1 X68.189 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X51.811 Y58.000 E0.30642
+G1 X43.622 Y58.000 E0.30642
+G1 X43.500 Y60.000 E0.07484
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.378 Y62.000 E0.07484
+G1 X68.189 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X51.811 Y62.000 E0.30642
+G1 X43.622 Y62.000 E0.30642
+G1 X43.992 Y64.000 E0.07484
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.370 Y66.000 E0.07484
+G1 X67.685 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X52.315 Y66.000 E0.28756
+G1 X44.630 Y66.000 E0.28756
+G1 X45.569 Y68.000 E0.07484
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X73.124 Y70.000 E0.07484
+G1 X66.562 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X53.438 Y70.000 E0.24554
+G1 X46.876 Y70.000 E0.24554
+G1 X48.675 Y72.000 E0.07484
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X68.732 Y74.000 E0.07484
+G1 X64.366 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X55.634 Y74.000 E0.16337
+G1 X51.268 Y74.000 E0.16337
+G1 X55.969 Y76.000 E0.07484
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 3 of 8
+;LAYER_CHANGE
+;Z:0.8
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z1.200 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z0.800 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z0.800 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z0.800 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Internal infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X68.732 Y46.000 E0.07484
+G1 X64.366 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X55.634 Y46.000 E0.16337
+G1 X51.268 Y46.000 E0.16337
+G1 X48.675 Y48.000 E0.07484
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X73.124 Y50.000 E0.07484
+G1 X66.562 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X53.438 Y50.000 E0.24554
+G1 X46.876 Y50.000 E0.24554
+G1 X45.569 Y52.000 E0.07484
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X75.370 Y54.000 E0.07484
+G1 X67.685 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X52.315 Y54.000 E0.28756
+G1 X44.630 Y54.000 E0.28756
+G1 X43.992 Y56.000 E0.07484
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.378 Y58.000 E0.07484
+G1 X68.189 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X51.811 Y58.000 E0.30642
+G1 X43.622 Y58.000 E0.30642
+G1 X43.500 Y60.000 E0.07484
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.378 Y62.000 E0.07484
+G1 X68.189 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X51.811 Y62.000 E0.30642
+G1 X43.622 Y62.000 E0.30642
+G1 X43.992 Y64.000 E0.07484
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.370 Y66.000 E0.07484
+G1 X67.685 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X52.315 Y66.000 E0.28756
+G1 X44.630 Y66.000 E0.28756
+G1 X45.569 Y68.000 E0.07484
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X73.124 Y70.000 E0.07484
+G1 X66.562 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X53.438 Y70.000 E0.24554
+G1 X46.876 Y70.000 E0.24554
+G1 X48.675 Y72.000 E0.07484
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X68.732 Y74.000 E0.07484
+G1 X64.366 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X55.634 Y74.000 E0.16337
+G1 X51.268 Y74.000 E0.16337
+G1 X55.969 Y76.000 E0.07484
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 4 of 8
+;LAYER_CHANGE
+;Z:1.0
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z1.400 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z1.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z1.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z1.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Internal infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X68.732 Y46.000 E0.07484
+G1 X64.366 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X55.634 Y46.000 E0.16337
+G1 X51.268 Y46.000 E0.16337
+G1 X48.675 Y48.000 E0.07484
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X73.124 Y50.000 E0.07484
+G1 X66.562 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X53.438 Y50.000 E0.24554
+G1 X46.876 Y50.000 E0.24554
+G1 X45.569 Y52.000 E0.07484
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X75.370 Y54.000 E0.07484
+G1 X67.685 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X52.315 Y54.000 E0.28756
+G1 X44.630 Y54.000 E0.28756
+G1 X43.992 Y56.000 E0.07484
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.378 Y58.000 E0.07484
+G1 X68.189 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X51.811 Y58.000 E0.30642
+G1 X43.622 Y58.000 E0.30642
+G1 X43.500 Y60.000 E0.07484
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.378 Y62.000 E0.07484
+G1 X68.189 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X51.811 Y62.000 E0.30642
+G1 X43.622 Y62.000 E0.30642
+G1 X43.992 Y64.000 E0.07484
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.370 Y66.000 E0.07484
+G1 X67.685 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X52.315 Y66.000 E0.28756
+G1 X44.630 Y66.000 E0.28756
+G1 X45.569 Y68.000 E0.07484
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X73.124 Y70.000 E0.07484
+G1 X66.562 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X53.438 Y70.000 E0.24554
+G1 X46.876 Y70.000 E0.24554
+G1 X48.675 Y72.000 E0.07484
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X68.732 Y74.000 E0.07484
+G1 X64.366 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X55.634 Y74.000 E0.16337
+G1 X51.268 Y74.000 E0.16337
+G1 X55.969 Y76.000 E0.07484
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 5 of 8
+;LAYER_CHANGE
+;Z:1.2
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z1.600 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z1.200 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z1.200 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z1.200 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Internal infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X68.732 Y46.000 E0.07484
+G1 X64.366 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X55.634 Y46.000 E0.16337
+G1 X51.268 Y46.000 E0.16337
+G1 X48.675 Y48.000 E0.07484
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X73.124 Y50.000 E0.07484
+G1 X66.562 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X53.438 Y50.000 E0.24554
+G1 X46.876 Y50.000 E0.24554
+G1 X45.569 Y52.000 E0.07484
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X75.370 Y54.000 E0.07484
+G1 X67.685 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X52.315 Y54.000 E0.28756
+G1 X44.630 Y54.000 E0.28756
+G1 X43.992 Y56.000 E0.07484
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.378 Y58.000 E0.07484
+G1 X68.189 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X51.811 Y58.000 E0.30642
+G1 X43.622 Y58.000 E0.30642
+G1 X43.500 Y60.000 E0.07484
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.378 Y62.000 E0.07484
+G1 X68.189 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X51.811 Y62.000 E0.30642
+G1 X43.622 Y62.000 E0.30642
+G1 X43.992 Y64.000 E0.07484
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.370 Y66.000 E0.07484
+G1 X67.685 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X52.315 Y66.000 E0.28756
+G1 X44.630 Y66.000 E0.28756
+G1 X45.569 Y68.000 E0.07484
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X73.124 Y70.000 E0.07484
+G1 X66.562 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X53.438 Y70.000 E0.24554
+G1 X46.876 Y70.000 E0.24554
+G1 X48.675 Y72.000 E0.07484
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X68.732 Y74.000 E0.07484
+G1 X64.366 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X55.634 Y74.000 E0.16337
+G1 X51.268 Y74.000 E0.16337
+G1 X55.969 Y76.000 E0.07484
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 6 of 8
+;LAYER_CHANGE
+;Z:1.4
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z1.800 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z1.400 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z1.400 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z1.400 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Internal infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X68.732 Y46.000 E0.07484
+G1 X64.366 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X55.634 Y46.000 E0.16337
+G1 X51.268 Y46.000 E0.16337
+G1 X48.675 Y48.000 E0.07484
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X73.124 Y50.000 E0.07484
+G1 X66.562 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X53.438 Y50.000 E0.24554
+G1 X46.876 Y50.000 E0.24554
+G1 X45.569 Y52.000 E0.07484
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X75.370 Y54.000 E0.07484
+G1 X67.685 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X52.315 Y54.000 E0.28756
+G1 X44.630 Y54.000 E0.28756
+G1 X43.992 Y56.000 E0.07484
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.378 Y58.000 E0.07484
+G1 X68.189 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X51.811 Y58.000 E0.30642
+G1 X43.622 Y58.000 E0.30642
+G1 X43.500 Y60.000 E0.07484
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.378 Y62.000 E0.07484
+G1 X68.189 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X51.811 Y62.000 E0.30642
+G1 X43.622 Y62.000 E0.30642
+G1 X43.992 Y64.000 E0.07484
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.370 Y66.000 E0.07484
+G1 X67.685 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X52.315 Y66.000 E0.28756
+G1 X44.630 Y66.000 E0.28756
+G1 X45.569 Y68.000 E0.07484
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X73.124 Y70.000 E0.07484
+G1 X66.562 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X53.438 Y70.000 E0.24554
+G1 X46.876 Y70.000 E0.24554
+G1 X48.675 Y72.000 E0.07484
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X68.732 Y74.000 E0.07484
+G1 X64.366 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X55.634 Y74.000 E0.16337
+G1 X51.268 Y74.000 E0.16337
+G1 X55.969 Y76.000 E0.07484
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 7 of 8
+;LAYER_CHANGE
+;Z:1.6
+;HEIGHT:0.2
+G1 E-0.80000 F2100.00000
+G1 Z2.000 F7800.000
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 X78.000 Y60.000 F7800.000
+G1 Z1.600 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X78.130 Y60.950 E0.03589
+G1 X78.200 Y61.913 E0.03612
+G1 X78.197 Y62.882 E0.03627
+G1 X78.115 Y63.850 E0.03636
+G1 X77.946 Y64.809 E0.03641
+G1 X77.690 Y65.748 E0.03642
+G1 X77.346 Y66.658 E0.03642
+G1 X76.919 Y67.533 E0.03641
+G1 X76.416 Y68.364 E0.03636
+G1 X75.848 Y69.150 E0.03627
+G1 X75.226 Y69.888 E0.03612
+G1 X74.562 Y70.580 E0.03589
+G1 X73.868 Y71.230 E0.03559
+G1 X73.154 Y71.844 E0.03523
+G1 X72.428 Y72.428 E0.03486
+G1 X71.697 Y72.990 E0.03452
+G1 X70.963 Y73.538 E0.03426
+G1 X70.227 Y74.077 E0.03411
+G1 X69.488 Y74.610 E0.03411
+G1 X68.740 Y75.138 E0.03426
+G1 X67.979 Y75.660 E0.03452
+G1 X67.199 Y76.170 E0.03486
+G1 X66.395 Y76.659 E0.03523
+G1 X65.562 Y77.119 E0.03559
+G1 X64.699 Y77.537 E0.03589
+G1 X63.805 Y77.900 E0.03612
+G1 X62.882 Y78.197 E0.03627
+G1 X61.936 Y78.418 E0.03636
+G1 X60.972 Y78.554 E0.03641
+G1 X60.000 Y78.600 E0.03642
+G1 X59.028 Y78.554 E0.03642
+G1 X58.064 Y78.418 E0.03641
+G1 X57.118 Y78.197 E0.03636
+G1 X56.195 Y77.900 E0.03627
+G1 X55.301 Y77.537 E0.03612
+G1 X54.438 Y77.119 E0.03589
+G1 X53.605 Y76.659 E0.03559
+G1 X52.801 Y76.170 E0.03523
+G1 X52.021 Y75.660 E0.03486
+G1 X51.260 Y75.138 E0.03452
+G1 X50.512 Y74.610 E0.03426
+G1 X49.773 Y74.077 E0.03411
+G1 X49.037 Y73.538 E0.03411
+G1 X48.303 Y72.990 E0.03426
+G1 X47.572 Y72.428 E0.03452
+G1 X46.846 Y71.844 E0.03486
+G1 X46.132 Y71.230 E0.03523
+G1 X45.438 Y70.580 E0.03559
+G1 X44.774 Y69.888 E0.03589
+G1 X44.152 Y69.150 E0.03612
+G1 X43.584 Y68.364 E0.03627
+G1 X43.081 Y67.533 E0.03636
+G1 X42.654 Y66.658 E0.03641
+G1 X42.310 Y65.748 E0.03642
+G1 X42.054 Y64.809 E0.03642
+G1 X41.885 Y63.850 E0.03641
+G1 X41.803 Y62.882 E0.03636
+G1 X41.800 Y61.913 E0.03627
+G1 X41.870 Y60.950 E0.03612
+G1 X42.000 Y60.000 E0.03589
+G1 X42.180 Y59.066 E0.03559
+G1 X42.397 Y58.150 E0.03523
+G1 X42.641 Y57.251 E0.03486
+G1 X42.902 Y56.366 E0.03452
+G1 X43.173 Y55.491 E0.03426
+G1 X43.452 Y54.623 E0.03411
+G1 X43.737 Y53.757 E0.03411
+G1 X44.031 Y52.890 E0.03426
+G1 X44.340 Y52.021 E0.03452
+G1 X44.671 Y51.150 E0.03486
+G1 X45.034 Y50.281 E0.03523
+G1 X45.438 Y49.420 E0.03559
+G1 X45.891 Y48.575 E0.03589
+G1 X46.400 Y47.755 E0.03612
+G1 X46.972 Y46.972 E0.03627
+G1 X47.608 Y46.237 E0.03636
+G1 X48.308 Y45.561 E0.03641
+G1 X49.067 Y44.952 E0.03642
+G1 X49.881 Y44.418 E0.03642
+G1 X50.740 Y43.962 E0.03641
+G1 X51.636 Y43.584 E0.03636
+G1 X52.557 Y43.282 E0.03627
+G1 X53.494 Y43.051 E0.03612
+G1 X54.438 Y42.881 E0.03589
+G1 X55.381 Y42.763 E0.03559
+G1 X56.320 Y42.687 E0.03523
+G1 X57.251 Y42.641 E0.03486
+G1 X58.173 Y42.615 E0.03452
+G1 X59.088 Y42.603 E0.03426
+G1 X60.000 Y42.600 E0.03411
+G1 X60.912 Y42.603 E0.03411
+G1 X61.827 Y42.615 E0.03426
+G1 X62.749 Y42.641 E0.03452
+G1 X63.680 Y42.687 E0.03486
+G1 X64.619 Y42.763 E0.03523
+G1 X65.562 Y42.881 E0.03559
+G1 X66.506 Y43.051 E0.03589
+G1 X67.443 Y43.282 E0.03612
+G1 X68.364 Y43.584 E0.03627
+G1 X69.260 Y43.962 E0.03636
+G1 X70.119 Y44.418 E0.03641
+G1 X70.933 Y44.952 E0.03642
+G1 X71.692 Y45.561 E0.03642
+G1 X72.392 Y46.237 E0.03641
+G1 X73.028 Y46.972 E0.03636
+G1 X73.600 Y47.755 E0.03627
+G1 X74.109 Y48.575 E0.03612
+G1 X74.562 Y49.420 E0.03589
+G1 X74.966 Y50.281 E0.03559
+G1 X75.329 Y51.150 E0.03523
+G1 X75.660 Y52.021 E0.03486
+G1 X75.969 Y52.890 E0.03452
+G1 X76.263 Y53.757 E0.03426
+G1 X76.548 Y54.623 E0.03411
+G1 X76.827 Y55.491 E0.03411
+G1 X77.098 Y56.366 E0.03426
+G1 X77.359 Y57.251 E0.03452
+G1 X77.603 Y58.150 E0.03486
+G1 X77.820 Y59.066 E0.03523
+G1 X78.000 Y60.000 E0.03559
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.550 Y60.000 F7800.000
+G1 Z1.600 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.681 Y60.927 E0.03502
+G1 X77.752 Y61.866 E0.03524
+G1 X77.753 Y62.812 E0.03540
+G1 X77.675 Y63.757 E0.03548
+G1 X77.512 Y64.692 E0.03553
+G1 X77.262 Y65.609 E0.03554
+G1 X76.925 Y66.497 E0.03554
+G1 X76.507 Y67.350 E0.03553
+G1 X76.015 Y68.160 E0.03548
+G1 X75.459 Y68.925 E0.03540
+G1 X74.849 Y69.643 E0.03524
+G1 X74.198 Y70.316 E0.03502
+G1 X73.518 Y70.947 E0.03472
+G1 X72.819 Y71.543 E0.03436
+G1 X72.110 Y72.110 E0.03399
+G1 X71.396 Y72.656 E0.03364
+G1 X70.680 Y73.189 E0.03338
+G1 X69.963 Y73.713 E0.03323
+G1 X69.243 Y74.233 E0.03323
+G1 X68.515 Y74.749 E0.03338
+G1 X67.775 Y75.259 E0.03364
+G1 X67.016 Y75.759 E0.03399
+G1 X66.234 Y76.239 E0.03436
+G1 X65.423 Y76.691 E0.03472
+G1 X64.582 Y77.102 E0.03502
+G1 X63.711 Y77.460 E0.03524
+G1 X62.812 Y77.753 E0.03540
+G1 X61.889 Y77.971 E0.03548
+G1 X60.949 Y78.105 E0.03553
+G1 X60.000 Y78.150 E0.03554
+G1 X59.051 Y78.105 E0.03554
+G1 X58.111 Y77.971 E0.03553
+G1 X57.188 Y77.753 E0.03548
+G1 X56.289 Y77.460 E0.03540
+G1 X55.418 Y77.102 E0.03524
+G1 X54.577 Y76.691 E0.03502
+G1 X53.766 Y76.239 E0.03472
+G1 X52.984 Y75.759 E0.03436
+G1 X52.225 Y75.259 E0.03399
+G1 X51.485 Y74.749 E0.03364
+G1 X50.757 Y74.233 E0.03338
+G1 X50.037 Y73.713 E0.03323
+G1 X49.320 Y73.189 E0.03323
+G1 X48.604 Y72.656 E0.03338
+G1 X47.890 Y72.110 E0.03364
+G1 X47.181 Y71.543 E0.03399
+G1 X46.482 Y70.947 E0.03436
+G1 X45.802 Y70.316 E0.03472
+G1 X45.151 Y69.643 E0.03502
+G1 X44.541 Y68.925 E0.03524
+G1 X43.985 Y68.160 E0.03540
+G1 X43.493 Y67.350 E0.03548
+G1 X43.075 Y66.497 E0.03553
+G1 X42.738 Y65.609 E0.03554
+G1 X42.488 Y64.692 E0.03554
+G1 X42.325 Y63.757 E0.03553
+G1 X42.247 Y62.812 E0.03548
+G1 X42.248 Y61.866 E0.03540
+G1 X42.319 Y60.927 E0.03524
+G1 X42.450 Y60.000 E0.03502
+G1 X42.629 Y59.090 E0.03472
+G1 X42.844 Y58.197 E0.03436
+G1 X43.085 Y57.321 E0.03399
+G1 X43.342 Y56.459 E0.03364
+G1 X43.608 Y55.608 E0.03338
+G1 X43.880 Y54.762 E0.03323
+G1 X44.157 Y53.918 E0.03323
+G1 X44.442 Y53.073 E0.03338
+G1 X44.741 Y52.225 E0.03364
+G1 X45.061 Y51.375 E0.03399
+G1 X45.412 Y50.526 E0.03436
+G1 X45.802 Y49.684 E0.03472
+G1 X46.240 Y48.858 E0.03502
+G1 X46.735 Y48.056 E0.03524
+G1 X47.290 Y47.290 E0.03540
+G1 X47.909 Y46.572 E0.03548
+G1 X48.591 Y45.911 E0.03553
+G1 X49.332 Y45.316 E0.03554
+G1 X50.126 Y44.795 E0.03554
+G1 X50.965 Y44.351 E0.03553
+G1 X51.840 Y43.985 E0.03548
+G1 X52.740 Y43.693 E0.03540
+G1 X53.655 Y43.471 E0.03524
+G1 X54.577 Y43.309 E0.03502
+G1 X55.498 Y43.198 E0.03472
+G1 X56.414 Y43.127 E0.03436
+G1 X57.321 Y43.085 E0.03399
+G1 X58.220 Y43.063 E0.03364
+G1 X59.112 Y43.053 E0.03338
+G1 X60.000 Y43.050 E0.03323
+G1 X60.888 Y43.053 E0.03323
+G1 X61.780 Y43.063 E0.03338
+G1 X62.679 Y43.085 E0.03364
+G1 X63.586 Y43.127 E0.03399
+G1 X64.502 Y43.198 E0.03436
+G1 X65.423 Y43.309 E0.03472
+G1 X66.345 Y43.471 E0.03502
+G1 X67.260 Y43.693 E0.03524
+G1 X68.160 Y43.985 E0.03540
+G1 X69.035 Y44.351 E0.03548
+G1 X69.874 Y44.795 E0.03553
+G1 X70.668 Y45.316 E0.03554
+G1 X71.409 Y45.911 E0.03554
+G1 X72.091 Y46.572 E0.03553
+G1 X72.710 Y47.290 E0.03548
+G1 X73.265 Y48.056 E0.03540
+G1 X73.760 Y48.858 E0.03524
+G1 X74.198 Y49.684 E0.03502
+G1 X74.588 Y50.526 E0.03472
+G1 X74.939 Y51.375 E0.03436
+G1 X75.259 Y52.225 E0.03399
+G1 X75.558 Y53.073 E0.03364
+G1 X75.843 Y53.918 E0.03338
+G1 X76.120 Y54.762 E0.03323
+G1 X76.392 Y55.608 E0.03323
+G1 X76.658 Y56.459 E0.03338
+G1 X76.915 Y57.321 E0.03364
+G1 X77.156 Y58.197 E0.03399
+G1 X77.371 Y59.090 E0.03436
+G1 X77.550 Y60.000 E0.03472
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 X77.100 Y60.000 F7800.000
+G1 Z1.600 F7800.000
+G1 E0.80000 F2100.00000
+G1 F1800
+G1 X77.232 Y60.903 E0.03415
+G1 X77.305 Y61.819 E0.03437
+G1 X77.309 Y62.741 E0.03452
+G1 X77.235 Y63.663 E0.03461
+G1 X77.077 Y64.576 E0.03465
+G1 X76.834 Y65.470 E0.03466
+G1 X76.505 Y66.336 E0.03466
+G1 X76.096 Y67.167 E0.03465
+G1 X75.614 Y67.956 E0.03461
+G1 X75.069 Y68.700 E0.03452
+G1 X74.472 Y69.398 E0.03437
+G1 X73.834 Y70.051 E0.03415
+G1 X73.169 Y70.664 E0.03385
+G1 X72.485 Y71.241 E0.03349
+G1 X71.792 Y71.792 E0.03312
+G1 X71.094 Y72.322 E0.03277
+G1 X70.397 Y72.839 E0.03250
+G1 X69.698 Y73.349 E0.03235
+G1 X68.998 Y73.855 E0.03235
+G1 X68.290 Y74.359 E0.03250
+G1 X67.571 Y74.858 E0.03277
+G1 X66.833 Y75.348 E0.03312
+G1 X66.072 Y75.819 E0.03349
+G1 X65.284 Y76.263 E0.03385
+G1 X64.466 Y76.667 E0.03415
+G1 X63.618 Y77.020 E0.03437
+G1 X62.741 Y77.309 E0.03452
+G1 X61.842 Y77.523 E0.03461
+G1 X60.925 Y77.655 E0.03465
+G1 X60.000 Y77.700 E0.03466
+G1 X59.075 Y77.655 E0.03466
+G1 X58.158 Y77.523 E0.03465
+G1 X57.259 Y77.309 E0.03461
+G1 X56.382 Y77.020 E0.03452
+G1 X55.534 Y76.667 E0.03437
+G1 X54.716 Y76.263 E0.03415
+G1 X53.928 Y75.819 E0.03385
+G1 X53.167 Y75.348 E0.03349
+G1 X52.429 Y74.858 E0.03312
+G1 X51.710 Y74.359 E0.03277
+G1 X51.002 Y73.855 E0.03250
+G1 X50.302 Y73.349 E0.03235
+G1 X49.603 Y72.839 E0.03235
+G1 X48.906 Y72.322 E0.03250
+G1 X48.208 Y71.792 E0.03277
+G1 X47.515 Y71.241 E0.03312
+G1 X46.831 Y70.664 E0.03349
+G1 X46.166 Y70.051 E0.03385
+G1 X45.528 Y69.398 E0.03415
+G1 X44.931 Y68.700 E0.03437
+G1 X44.386 Y67.956 E0.03452
+G1 X43.904 Y67.167 E0.03461
+G1 X43.495 Y66.336 E0.03465
+G1 X43.166 Y65.470 E0.03466
+G1 X42.923 Y64.576 E0.03466
+G1 X42.765 Y63.663 E0.03465
+G1 X42.691 Y62.741 E0.03461
+G1 X42.695 Y61.819 E0.03452
+G1 X42.768 Y60.903 E0.03437
+G1 X42.900 Y60.000 E0.03415
+G1 X43.079 Y59.113 E0.03385
+G1 X43.292 Y58.244 E0.03349
+G1 X43.530 Y57.391 E0.03312
+G1 X43.782 Y56.553 E0.03277
+G1 X44.042 Y55.724 E0.03250
+G1 X44.308 Y54.901 E0.03235
+G1 X44.577 Y54.080 E0.03235
+G1 X44.853 Y53.256 E0.03250
+G1 X45.142 Y52.429 E0.03277
+G1 X45.451 Y51.600 E0.03312
+G1 X45.789 Y50.771 E0.03349
+G1 X46.166 Y49.949 E0.03385
+G1 X46.590 Y49.141 E0.03415
+G1 X47.069 Y48.357 E0.03437
+G1 X47.608 Y47.608 E0.03452
+G1 X48.210 Y46.906 E0.03461
+G1 X48.874 Y46.260 E0.03465
+G1 X49.596 Y45.680 E0.03466
+G1 X50.371 Y45.173 E0.03466
+G1 X51.190 Y44.741 E0.03465
+G1 X52.044 Y44.386 E0.03461
+G1 X52.923 Y44.104 E0.03452
+G1 X53.816 Y43.891 E0.03437
+G1 X54.716 Y43.737 E0.03415
+G1 X55.614 Y43.633 E0.03385
+G1 X56.507 Y43.567 E0.03349
+G1 X57.391 Y43.530 E0.03312
+G1 X58.267 Y43.510 E0.03277
+G1 X59.135 Y43.502 E0.03250
+G1 X60.000 Y43.500 E0.03235
+G1 X60.865 Y43.502 E0.03235
+G1 X61.733 Y43.510 E0.03250
+G1 X62.609 Y43.530 E0.03277
+G1 X63.493 Y43.567 E0.03312
+G1 X64.386 Y43.633 E0.03349
+G1 X65.284 Y43.737 E0.03385
+G1 X66.184 Y43.891 E0.03415
+G1 X67.077 Y44.104 E0.03437
+G1 X67.956 Y44.386 E0.03452
+G1 X68.810 Y44.741 E0.03461
+G1 X69.629 Y45.173 E0.03465
+G1 X70.404 Y45.680 E0.03466
+G1 X71.126 Y46.260 E0.03466
+G1 X71.790 Y46.906 E0.03465
+G1 X72.392 Y47.608 E0.03461
+G1 X72.931 Y48.357 E0.03452
+G1 X73.410 Y49.141 E0.03437
+G1 X73.834 Y49.949 E0.03415
+G1 X74.211 Y50.771 E0.03385
+G1 X74.549 Y51.600 E0.03349
+G1 X74.858 Y52.429 E0.03312
+G1 X75.147 Y53.256 E0.03277
+G1 X75.423 Y54.080 E0.03250
+G1 X75.692 Y54.901 E0.03235
+G1 X75.958 Y55.724 E0.03235
+G1 X76.218 Y56.553 E0.03250
+G1 X76.470 Y57.391 E0.03277
+G1 X76.708 Y58.244 E0.03312
+G1 X76.921 Y59.113 E0.03349
+G1 X77.100 Y60.000 E0.03385
+G1 E-0.80000 F2100.00000
+;TYPE:Solid infill
+;WIDTH:0.5
+G1 X55.969 Y44.000 F7800.000
+G1 E0.80000 F2100.00000
+G1 F2400
+G1 X57.984 Y44.000 E0.07542
+G1 X60.000 Y44.000 E0.07542
+G1 X62.016 Y44.000 E0.07542
+G1 X64.031 Y44.000 E0.07542
+G1 X65.657 Y44.500 E0.01871
+G1 X62.828 Y44.500 E0.10583
+G1 X60.000 Y44.500 E0.10583
+G1 X57.172 Y44.500 E0.10583
+G1 X54.343 Y44.500 E0.10583
+G1 X53.126 Y45.000 E0.01871
+G1 X56.563 Y45.000 E0.12860
+G1 X60.000 Y45.000 E0.12860
+G1 X63.437 Y45.000 E0.12860
+G1 X66.874 Y45.000 E0.12860
+G1 X67.874 Y45.500 E0.01871
+G1 X63.937 Y45.500 E0.14731
+G1 X60.000 Y45.500 E0.14731
+G1 X56.063 Y45.500 E0.14731
+G1 X52.126 Y45.500 E0.14731
+G1 X51.268 Y46.000 E0.01871
+G1 X55.634 Y46.000 E0.16337
+G1 X60.000 Y46.000 E0.16337
+G1 X64.366 Y46.000 E0.16337
+G1 X68.732 Y46.000 E0.16337
+G1 X69.487 Y46.500 E0.01871
+G1 X64.743 Y46.500 E0.17749
+G1 X60.000 Y46.500 E0.17749
+G1 X55.257 Y46.500 E0.17749
+G1 X50.513 Y46.500 E0.17749
+G1 X49.839 Y47.000 E0.01871
+G1 X54.919 Y47.000 E0.19010
+G1 X60.000 Y47.000 E0.19010
+G1 X65.081 Y47.000 E0.19010
+G1 X70.161 Y47.000 E0.19010
+G1 X70.770 Y47.500 E0.01871
+G1 X65.385 Y47.500 E0.20150
+G1 X60.000 Y47.500 E0.20150
+G1 X54.615 Y47.500 E0.20150
+G1 X49.230 Y47.500 E0.20150
+G1 X48.675 Y48.000 E0.01871
+G1 X54.338 Y48.000 E0.21187
+G1 X60.000 Y48.000 E0.21187
+G1 X65.662 Y48.000 E0.21187
+G1 X71.325 Y48.000 E0.21187
+G1 X71.832 Y48.500 E0.01871
+G1 X65.916 Y48.500 E0.22137
+G1 X60.000 Y48.500 E0.22137
+G1 X54.084 Y48.500 E0.22137
+G1 X48.168 Y48.500 E0.22137
+G1 X47.702 Y49.000 E0.01871
+G1 X53.851 Y49.000 E0.23009
+G1 X60.000 Y49.000 E0.23009
+G1 X66.149 Y49.000 E0.23009
+G1 X72.298 Y49.000 E0.23009
+G1 X72.728 Y49.500 E0.01871
+G1 X66.364 Y49.500 E0.23812
+G1 X60.000 Y49.500 E0.23812
+G1 X53.636 Y49.500 E0.23812
+G1 X47.272 Y49.500 E0.23812
+G1 X46.876 Y50.000 E0.01871
+G1 X53.438 Y50.000 E0.24554
+G1 X60.000 Y50.000 E0.24554
+G1 X66.562 Y50.000 E0.24554
+G1 X73.124 Y50.000 E0.24554
+G1 X73.491 Y50.500 E0.01871
+G1 X66.745 Y50.500 E0.25240
+G1 X60.000 Y50.500 E0.25240
+G1 X53.255 Y50.500 E0.25240
+G1 X46.509 Y50.500 E0.25240
+G1 X46.171 Y51.000 E0.01871
+G1 X53.085 Y51.000 E0.25873
+G1 X60.000 Y51.000 E0.25873
+G1 X66.915 Y51.000 E0.25873
+G1 X73.829 Y51.000 E0.25873
+G1 X74.142 Y51.500 E0.01871
+G1 X67.071 Y51.500 E0.26458
+G1 X60.000 Y51.500 E0.26458
+G1 X52.929 Y51.500 E0.26458
+G1 X45.858 Y51.500 E0.26458
+G1 X45.569 Y52.000 E0.01871
+G1 X52.785 Y52.000 E0.26998
+G1 X60.000 Y52.000 E0.26998
+G1 X67.215 Y52.000 E0.26998
+G1 X74.431 Y52.000 E0.26998
+G1 X74.697 Y52.500 E0.01871
+G1 X67.348 Y52.500 E0.27496
+G1 X60.000 Y52.500 E0.27496
+G1 X52.652 Y52.500 E0.27496
+G1 X45.303 Y52.500 E0.27496
+G1 X45.058 Y53.000 E0.01871
+G1 X52.529 Y53.000 E0.27954
+G1 X60.000 Y53.000 E0.27954
+G1 X67.471 Y53.000 E0.27954
+G1 X74.942 Y53.000 E0.27954
+G1 X75.166 Y53.500 E0.01871
+G1 X67.583 Y53.500 E0.28373
+G1 X60.000 Y53.500 E0.28373
+G1 X52.417 Y53.500 E0.28373
+G1 X44.834 Y53.500 E0.28373
+G1 X44.630 Y54.000 E0.01871
+G1 X52.315 Y54.000 E0.28756
+G1 X60.000 Y54.000 E0.28756
+G1 X67.685 Y54.000 E0.28756
+G1 X75.370 Y54.000 E0.28756
+G1 X75.556 Y54.500 E0.01871
+G1 X67.778 Y54.500 E0.29104
+G1 X60.000 Y54.500 E0.29104
+G1 X52.222 Y54.500 E0.29104
+G1 X44.444 Y54.500 E0.29104
+G1 X44.276 Y55.000 E0.01871
+G1 X52.138 Y55.000 E0.29418
+G1 X60.000 Y55.000 E0.29418
+G1 X67.862 Y55.000 E0.29418
+G1 X75.724 Y55.000 E0.29418
+G1 X75.875 Y55.500 E0.01871
+G1 X67.937 Y55.500 E0.29699
+G1 X60.000 Y55.500 E0.29699
+G1 X52.063 Y55.500 E0.29699
+G1 X44.125 Y55.500 E0.29699
+G1 X43.992 Y56.000 E0.01871
+G1 X51.996 Y56.000 E0.29949
+G1 X60.000 Y56.000 E0.29949
+G1 X68.004 Y56.000 E0.29949
+G1 X76.008 Y56.000 E0.29949
+G1 X76.125 Y56.500 E0.01871
+G1 X68.062 Y56.500 E0.30167
+G1 X60.000 Y56.500 E0.30167
+G1 X51.938 Y56.500 E0.30167
+G1 X43.875 Y56.500 E0.30167
+G1 X43.775 Y57.000 E0.01871
+G1 X51.888 Y57.000 E0.30355
+G1 X60.000 Y57.000 E0.30355
+G1 X68.112 Y57.000 E0.30355
+G1 X76.225 Y57.000 E0.30355
+G1 X76.310 Y57.500 E0.01871
+G1 X68.155 Y57.500 E0.30513
+G1 X60.000 Y57.500 E0.30513
+G1 X51.845 Y57.500 E0.30513
+G1 X43.690 Y57.500 E0.30513
+G1 X43.622 Y58.000 E0.01871
+G1 X51.811 Y58.000 E0.30642
+G1 X60.000 Y58.000 E0.30642
+G1 X68.189 Y58.000 E0.30642
+G1 X76.378 Y58.000 E0.30642
+G1 X76.432 Y58.500 E0.01871
+G1 X68.216 Y58.500 E0.30742
+G1 X60.000 Y58.500 E0.30742
+G1 X51.784 Y58.500 E0.30742
+G1 X43.568 Y58.500 E0.30742
+G1 X43.530 Y59.000 E0.01871
+G1 X51.765 Y59.000 E0.30813
+G1 X60.000 Y59.000 E0.30813
+G1 X68.235 Y59.000 E0.30813
+G1 X76.470 Y59.000 E0.30813
+G1 X76.492 Y59.500 E0.01871
+G1 X68.246 Y59.500 E0.30855
+G1 X60.000 Y59.500 E0.30855
+G1 X51.754 Y59.500 E0.30855
+G1 X43.508 Y59.500 E0.30855
+G1 X43.500 Y60.000 E0.01871
+G1 X51.750 Y60.000 E0.30870
+G1 X60.000 Y60.000 E0.30870
+G1 X68.250 Y60.000 E0.30870
+G1 X76.500 Y60.000 E0.30870
+G1 X76.492 Y60.500 E0.01871
+G1 X68.246 Y60.500 E0.30855
+G1 X60.000 Y60.500 E0.30855
+G1 X51.754 Y60.500 E0.30855
+G1 X43.508 Y60.500 E0.30855
+G1 X43.530 Y61.000 E0.01871
+G1 X51.765 Y61.000 E0.30813
+G1 X60.000 Y61.000 E0.30813
+G1 X68.235 Y61.000 E0.30813
+G1 X76.470 Y61.000 E0.30813
+G1 X76.432 Y61.500 E0.01871
+G1 X68.216 Y61.500 E0.30742
+G1 X60.000 Y61.500 E0.30742
+G1 X51.784 Y61.500 E0.30742
+G1 X43.568 Y61.500 E0.30742
+G1 X43.622 Y62.000 E0.01871
+G1 X51.811 Y62.000 E0.30642
+G1 X60.000 Y62.000 E0.30642
+G1 X68.189 Y62.000 E0.30642
+G1 X76.378 Y62.000 E0.30642
+G1 X76.310 Y62.500 E0.01871
+G1 X68.155 Y62.500 E0.30513
+G1 X60.000 Y62.500 E0.30513
+G1 X51.845 Y62.500 E0.30513
+G1 X43.690 Y62.500 E0.30513
+G1 X43.775 Y63.000 E0.01871
+G1 X51.888 Y63.000 E0.30355
+G1 X60.000 Y63.000 E0.30355
+G1 X68.112 Y63.000 E0.30355
+G1 X76.225 Y63.000 E0.30355
+G1 X76.125 Y63.500 E0.01871
+G1 X68.062 Y63.500 E0.30167
+G1 X60.000 Y63.500 E0.30167
+G1 X51.938 Y63.500 E0.30167
+G1 X43.875 Y63.500 E0.30167
+G1 X43.992 Y64.000 E0.01871
+G1 X51.996 Y64.000 E0.29949
+G1 X60.000 Y64.000 E0.29949
+G1 X68.004 Y64.000 E0.29949
+G1 X76.008 Y64.000 E0.29949
+G1 X75.875 Y64.500 E0.01871
+G1 X67.937 Y64.500 E0.29699
+G1 X60.000 Y64.500 E0.29699
+G1 X52.063 Y64.500 E0.29699
+G1 X44.125 Y64.500 E0.29699
+G1 X44.276 Y65.000 E0.01871
+G1 X52.138 Y65.000 E0.29418
+G1 X60.000 Y65.000 E0.29418
+G1 X67.862 Y65.000 E0.29418
+G1 X75.724 Y65.000 E0.29418
+G1 X75.556 Y65.500 E0.01871
+G1 X67.778 Y65.500 E0.29104
+G1 X60.000 Y65.500 E0.29104
+G1 X52.222 Y65.500 E0.29104
+G1 X44.444 Y65.500 E0.29104
+G1 X44.630 Y66.000 E0.01871
+G1 X52.315 Y66.000 E0.28756
+G1 X60.000 Y66.000 E0.28756
+G1 X67.685 Y66.000 E0.28756
+G1 X75.370 Y66.000 E0.28756
+G1 X75.166 Y66.500 E0.01871
+G1 X67.583 Y66.500 E0.28373
+G1 X60.000 Y66.500 E0.28373
+G1 X52.417 Y66.500 E0.28373
+G1 X44.834 Y66.500 E0.28373
+G1 X45.058 Y67.000 E0.01871
+G1 X52.529 Y67.000 E0.27954
+G1 X60.000 Y67.000 E0.27954
+G1 X67.471 Y67.000 E0.27954
+G1 X74.942 Y67.000 E0.27954
+G1 X74.697 Y67.500 E0.01871
+G1 X67.348 Y67.500 E0.27496
+G1 X60.000 Y67.500 E0.27496
+G1 X52.652 Y67.500 E0.27496
+G1 X45.303 Y67.500 E0.27496
+G1 X45.569 Y68.000 E0.01871
+G1 X52.785 Y68.000 E0.26998
+G1 X60.000 Y68.000 E0.26998
+G1 X67.215 Y68.000 E0.26998
+G1 X74.431 Y68.000 E0.26998
+G1 X74.142 Y68.500 E0.01871
+G1 X67.071 Y68.500 E0.26458
+G1 X60.000 Y68.500 E0.26458
+G1 X52.929 Y68.500 E0.26458
+G1 X45.858 Y68.500 E0.26458
+G1 X46.171 Y69.000 E0.01871
+G1 X53.085 Y69.000 E0.25873
+G1 X60.000 Y69.000 E0.25873
+G1 X66.915 Y69.000 E0.25873
+G1 X73.829 Y69.000 E0.25873
+G1 X73.491 Y69.500 E0.01871
+G1 X66.745 Y69.500 E0.25240
+G1 X60.000 Y69.500 E0.25240
+G1 X53.255 Y69.500 E0.25240
+G1 X46.509 Y69.500 E0.25240
+G1 X46.876 Y70.000 E0.01871
+G1 X53.438 Y70.000 E0.24554
+G1 X60.000 Y70.000 E0.24554
+G1 X66.562 Y70.000 E0.24554
+G1 X73.124 Y70.000 E0.24554
+G1 X72.728 Y70.500 E0.01871
+G1 X66.364 Y70.500 E0.23812
+G1 X60.000 Y70.500 E0.23812
+G1 X53.636 Y70.500 E0.23812
+G1 X47.272 Y70.500 E0.23812
+G1 X47.702 Y71.000 E0.01871
+G1 X53.851 Y71.000 E0.23009
+G1 X60.000 Y71.000 E0.23009
+G1 X66.149 Y71.000 E0.23009
+G1 X72.298 Y71.000 E0.23009
+G1 X71.832 Y71.500 E0.01871
+G1 X65.916 Y71.500 E0.22137
+G1 X60.000 Y71.500 E0.22137
+G1 X54.084 Y71.500 E0.22137
+G1 X48.168 Y71.500 E0.22137
+G1 X48.675 Y72.000 E0.01871
+G1 X54.338 Y72.000 E0.21187
+G1 X60.000 Y72.000 E0.21187
+G1 X65.662 Y72.000 E0.21187
+G1 X71.325 Y72.000 E0.21187
+G1 X70.770 Y72.500 E0.01871
+G1 X65.385 Y72.500 E0.20150
+G1 X60.000 Y72.500 E0.20150
+G1 X54.615 Y72.500 E0.20150
+G1 X49.230 Y72.500 E0.20150
+G1 X49.839 Y73.000 E0.01871
+G1 X54.919 Y73.000 E0.19010
+G1 X60.000 Y73.000 E0.19010
+G1 X65.081 Y73.000 E0.19010
+G1 X70.161 Y73.000 E0.19010
+G1 X69.487 Y73.500 E0.01871
+G1 X64.743 Y73.500 E0.17749
+G1 X60.000 Y73.500 E0.17749
+G1 X55.257 Y73.500 E0.17749
+G1 X50.513 Y73.500 E0.17749
+G1 X51.268 Y74.000 E0.01871
+G1 X55.634 Y74.000 E0.16337
+G1 X60.000 Y74.000 E0.16337
+G1 X64.366 Y74.000 E0.16337
+G1 X68.732 Y74.000 E0.16337
+G1 X67.874 Y74.500 E0.01871
+G1 X63.937 Y74.500 E0.14731
+G1 X60.000 Y74.500 E0.14731
+G1 X56.063 Y74.500 E0.14731
+G1 X52.126 Y74.500 E0.14731
+G1 X53.126 Y75.000 E0.01871
+G1 X56.563 Y75.000 E0.12860
+G1 X60.000 Y75.000 E0.12860
+G1 X63.437 Y75.000 E0.12860
+G1 X66.874 Y75.000 E0.12860
+G1 X65.657 Y75.500 E0.01871
+G1 X62.828 Y75.500 E0.10583
+G1 X60.000 Y75.500 E0.10583
+G1 X57.172 Y75.500 E0.10583
+G1 X54.343 Y75.500 E0.10583
+G1 X55.969 Y76.000 E0.01871
+G1 X57.984 Y76.000 E0.07542
+G1 X60.000 Y76.000 E0.07542
+G1 X62.016 Y76.000 E0.07542
+G1 X64.031 Y76.000 E0.07542
+;WIPE_START
+G1 F8640;_WIPE
+G1 X60.000 Y60.000 E-0.40000
+;WIPE_END
+M117 Layer 8 of 8
+M107
+M104 S0 ; turn off temperature
+M140 S0 ; turn off heatbed
+G1 Z10 F600
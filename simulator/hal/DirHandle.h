@@ -0,0 +1,2 @@
+// Host simulator: shadows the mbed DirHandle.h, nothing in the simulated modules lists directories
+#pragma once
@@ -0,0 +1,26 @@
+// Host simulator: shadows the mbed InterruptIn class, the simulator fires the edges by calling rise_fnc/fall_fnc of the
+// one on a pin, every InterruptIn made is in sim_interrupt_ins()
+#pragma once
+#include "PinNames.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace mbed {
+class InterruptIn;
+inline std::vector<InterruptIn *>& sim_interrupt_ins() { static std::vector<InterruptIn *> v; return v; }
+
+class InterruptIn {
+public:
+    InterruptIn(PinName p) : pin(p) { sim_interrupt_ins().push_back(this); }
+    ~InterruptIn() { auto& v = sim_interrupt_ins(); v.erase(std::remove(v.begin(), v.end(), this), v.end()); }
+    template<typename T> void rise(T *tptr, void (T::*mptr)(void)) { rise_fnc = [tptr, mptr]() { (tptr->*mptr)(); }; }
+    template<typename T> void fall(T *tptr, void (T::*mptr)(void)) { fall_fnc = [tptr, mptr]() { (tptr->*mptr)(); }; }
+    void enable_irq() {}
+    void disable_irq() {}
+
+    PinName pin;
+    std::function<void()> rise_fnc;
+    std::function<void()> fall_fnc;
+};
+}
@@ -0,0 +1,195 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Host simulator replacement for the CMSIS LPC17xx device header.
+    Only the peripherals used by the motion pipeline are modelled, they are plain structs in host memory
+    so firmware code can read and write them as if they were the real registers.
+    GPIO set/clear writes are routed through sim_gpio_write() so the simulator can watch pin edges.
+*/
+
+#ifndef __LPC17xx_H__
+#define __LPC17xx_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// read only registers are writable here so the simulator can set them
+#define __I  volatile
+#define __O  volatile
+#define __IO volatile
+
+typedef enum IRQn {
+    NonMaskableInt_IRQn   = -14,
+    MemoryManagement_IRQn = -12,
+    BusFault_IRQn         = -11,
+    UsageFault_IRQn       = -10,
+    SVCall_IRQn           = -5,
+    DebugMonitor_IRQn     = -4,
+    PendSV_IRQn           = -2,
+    SysTick_IRQn          = -1,
+    WDT_IRQn              = 0,
+    TIMER0_IRQn           = 1,
+    TIMER1_IRQn           = 2,
+    TIMER2_IRQn           = 3,
+    TIMER3_IRQn           = 4,
+    UART0_IRQn            = 5,
+    UART1_IRQn            = 6,
+    UART2_IRQn            = 7,
+    UART3_IRQn            = 8,
+    PWM1_IRQn             = 9,
+    EINT3_IRQn            = 21,
+    ADC_IRQn              = 22,
+    USB_IRQn              = 24,
+} IRQn_Type;
+
+struct LPC_GPIO_TypeDef;
+// called by the simulated GPIO block whenever a pin is set or cleared
+void sim_gpio_write(LPC_GPIO_TypeDef *port, uint32_t mask, bool set);
+
+// write only register that sets or clears bits in FIOPIN of the owning port
+template<bool SET>
+struct SimGpioWriteReg {
+    inline SimGpioWriteReg& operator=(uint32_t v);
+};
+
+typedef struct LPC_GPIO_TypeDef {
+    __IO uint32_t FIODIR;
+    uint32_t RESERVED0[3];
+    __IO uint32_t FIOMASK;
+    __IO uint32_t FIOPIN;
+    SimGpioWriteReg<true>  FIOSET;
+    SimGpioWriteReg<false> FIOCLR;
+} LPC_GPIO_TypeDef;
+
+template<bool SET>
+inline SimGpioWriteReg<SET>& SimGpioWriteReg<SET>::operator=(uint32_t v)
+{
+    LPC_GPIO_TypeDef *port = reinterpret_cast<LPC_GPIO_TypeDef *>(reinterpret_cast<char *>(this) - (SET ? offsetof(LPC_GPIO_TypeDef, FIOSET) : offsetof(LPC_GPIO_TypeDef, FIOCLR)));
+    if(SET) port->FIOPIN |= v;
+    else    port->FIOPIN &= ~v;
+    sim_gpio_write(port, v, SET);
+    return *this;
+}
+
+typedef struct {
+    __IO uint32_t IR;
+    __IO uint32_t TCR;
+    __IO uint32_t TC;
+    __IO uint32_t PR;
+    __IO uint32_t PC;
+    __IO uint32_t MCR;
+    __IO uint32_t MR0;
+    __IO uint32_t MR1;
+    __IO uint32_t MR2;
+    __IO uint32_t MR3;
+    __IO uint32_t CCR;
+    __I  uint32_t CR0;
+    __I  uint32_t CR1;
+    uint32_t RESERVED0[2];
+    __IO uint32_t EMR;
+    uint32_t RESERVED1[12];
+    __IO uint32_t CTCR;
+} LPC_TIM_TypeDef;
+
+typedef struct {
+    __IO uint32_t IR;
+    __IO uint32_t TCR;
+    __IO uint32_t TC;
+    __IO uint32_t PR;
+    __IO uint32_t PC;
+    __IO uint32_t MCR;
+    __IO uint32_t MR0;
+    __IO uint32_t MR1;
+    __IO uint32_t MR2;
+    __IO uint32_t MR3;
+    __IO uint32_t CCR;
+    __I  uint32_t CR0;
+    __I  uint32_t CR1;
+    __I  uint32_t CR2;
+    __I  uint32_t CR3;
+    uint32_t RESERVED0;
+    __IO uint32_t MR4;
+    __IO uint32_t MR5;
+    __IO uint32_t MR6;
+    __IO uint32_t PCR;
+    __IO uint32_t LER;
+    uint32_t RESERVED1[7];
+    __IO uint32_t CTCR;
+} LPC_PWM_TypeDef;
+
+typedef struct {
+    __IO uint32_t PCONP;
+    __IO uint32_t PCLKSEL0;
+    __IO uint32_t PCLKSEL1;
+} LPC_SC_TypeDef;
+
+typedef struct {
+    __IO uint32_t PINSEL[11];
+    __IO uint32_t PINMODE0;
+    __IO uint32_t PINMODE1;
+    __IO uint32_t PINMODE2;
+    __IO uint32_t PINMODE3;
+    __IO uint32_t PINMODE4;
+    __IO uint32_t PINMODE5;
+    __IO uint32_t PINMODE6;
+    __IO uint32_t PINMODE7;
+    __IO uint32_t PINMODE8;
+    __IO uint32_t PINMODE9;
+    __IO uint32_t PINMODE_OD0;
+    __IO uint32_t PINMODE_OD1;
+    __IO uint32_t PINMODE_OD2;
+    __IO uint32_t PINMODE_OD3;
+    __IO uint32_t PINMODE_OD4;
+} LPC_PINCON_TypeDef;
+
+typedef struct {
+    __IO uint8_t  WDMOD;
+    __IO uint32_t WDTC;
+    __O  uint8_t  WDFEED;
+    __I  uint32_t WDTV;
+    __IO uint32_t WDCLKSEL;
+} LPC_WDT_TypeDef;
+
+extern LPC_GPIO_TypeDef   sim_gpio[5];
+extern LPC_TIM_TypeDef    sim_tim[4];
+extern LPC_PWM_TypeDef    sim_pwm1;
+extern LPC_SC_TypeDef     sim_sc;
+extern LPC_PINCON_TypeDef sim_pincon;
+extern LPC_WDT_TypeDef    sim_wdt;
+
+#define LPC_GPIO0  (&sim_gpio[0])
+#define LPC_GPIO1  (&sim_gpio[1])
+#define LPC_GPIO2  (&sim_gpio[2])
+#define LPC_GPIO3  (&sim_gpio[3])
+#define LPC_GPIO4  (&sim_gpio[4])
+#define LPC_TIM0   (&sim_tim[0])
+#define LPC_TIM1   (&sim_tim[1])
+#define LPC_TIM2   (&sim_tim[2])
+#define LPC_TIM3   (&sim_tim[3])
+#define LPC_PWM1   (&sim_pwm1)
+#define LPC_SC     (&sim_sc)
+#define LPC_PINCON (&sim_pincon)
+#define LPC_WDT    (&sim_wdt)
+
+// there are no interrupts on the host, the simulator calls the handlers directly
+static inline void __enable_irq() {}
+static inline void __disable_irq() {}
+static inline void __NOP() {}
+static inline void __WFI() {}
+static inline void NVIC_EnableIRQ(IRQn_Type) {}
+static inline void NVIC_DisableIRQ(IRQn_Type) {}
+static inline void NVIC_SetPendingIRQ(IRQn_Type) {}
+static inline void NVIC_ClearPendingIRQ(IRQn_Type) {}
+static inline void NVIC_SetPriority(IRQn_Type, uint32_t) {}
+static inline uint32_t NVIC_GetPriority(IRQn_Type) { return 0; }
+static inline void NVIC_SetPriorityGrouping(uint32_t) {}
+void NVIC_SystemReset(void);
+
+extern uint32_t SystemCoreClock;
+
+#endif
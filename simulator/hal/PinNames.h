@@ -0,0 +1,19 @@
+// Host simulator: shadows the mbed PinNames header
+#pragma once
+
+typedef enum {
+    Port0 = 0, Port1 = 1, Port2 = 2, Port3 = 3, Port4 = 4
+} PortName;
+
+#define LPC_PIN(port, pin) ((PinName)(((port) << 5) | (pin)))
+
+typedef enum {
+    P1_18 = (1 << 5) | 18, P1_19 = (1 << 5) | 19, P1_20 = (1 << 5) | 20, P1_21 = (1 << 5) | 21,
+    P1_23 = (1 << 5) | 23, P1_24 = (1 << 5) | 24, P1_26 = (1 << 5) | 26,
+    P2_0 = (2 << 5) | 0, P2_1 = (2 << 5) | 1, P2_2 = (2 << 5) | 2, P2_3 = (2 << 5) | 3,
+    P2_4 = (2 << 5) | 4, P2_5 = (2 << 5) | 5,
+    P3_25 = (3 << 5) | 25, P3_26 = (3 << 5) | 26,
+    P4_28 = (4 << 5) | 28,
+    USBTX = 0x1000, USBRX,
+    NC = -1
+} PinName;
@@ -0,0 +1,50 @@
+// Host simulator: shadows the mbed PwmOut class, works the PWM1 match registers as the LPC1768 mbed library does so
+// code that writes a match register itself reads back the same duty cycle
+#pragma once
+#include "PinNames.h"
+#include "LPC17xx.h"
+
+namespace mbed {
+class PwmOut {
+public:
+    PwmOut(PinName p) : pin(p) {
+        static const struct { PinName pin; uint8_t channel; } map[] = {
+            {P1_18, 1}, {P1_20, 2}, {P1_21, 3}, {P1_23, 4}, {P1_24, 5}, {P1_26, 6},
+            {P2_0, 1}, {P2_1, 2}, {P2_2, 3}, {P2_3, 4}, {P2_4, 5}, {P2_5, 6},
+            {P3_25, 2}, {P3_26, 3},
+        };
+        uint8_t channel = 1;
+        for(auto& m : map) {
+            if(m.pin == p) channel = m.channel;
+        }
+        MR = channel <= 3 ? &LPC_PWM1->MR0 + channel : &LPC_PWM1->MR4 + channel - 4;
+        LPC_PWM1->MCR = 1 << 1; // reset TC on match 0
+        period_us(20000);
+        write(0);
+    }
+    void write(float value) {
+        if(value < 0) value = 0;
+        if(value > 1) value = 1;
+        uint32_t v = LPC_PWM1->MR0 * value;
+        if(v == LPC_PWM1->MR0) v++; // as mbed, so a channel never drops out for a cycle
+        *MR = v;
+        LPC_PWM1->LER |= 1 << (MR <= &LPC_PWM1->MR3 ? MR - &LPC_PWM1->MR0 : MR - &LPC_PWM1->MR4 + 4);
+    }
+    float read() {
+        if(LPC_PWM1->MR0 == 0) return 0;
+        float v = (float)*MR / LPC_PWM1->MR0;
+        return v > 1 ? 1 : v;
+    }
+    void period(float seconds) { period_us(seconds * 1000000); }
+    void period_us(int us) {
+        float v = read();
+        LPC_PWM1->MR0 = us * (SystemCoreClock / 4000000);
+        write(v);
+    }
+    PwmOut& operator= (float value) { write(value); return *this; }
+    operator float() { return read(); }
+
+    PinName pin;
+    __IO uint32_t *MR;
+};
+}
@@ -0,0 +1,13 @@
+// Host simulator: shadows src/libs/SDFAT.h, the simulated card is the host file system (see SimHal.h)
+#pragma once
+
+#include <stdint.h>
+
+class SDFAT {
+    public:
+        int remount() { return 0; }
+        // the size and modified time of a file in the sd_root directory, the time in host seconds
+        int stat(const char *name, uint32_t *size, uint32_t *date_time);
+};
+
+extern SDFAT mounter;
@@ -0,0 +1,17 @@
+// Host simulator: shadows the mbed SPI class, every byte is exchanged with the device sim_spi_write() models
+#pragma once
+#include "PinNames.h"
+
+// the simulated device on the bus, defined by the program that uses SPI
+int sim_spi_write(int value);
+
+namespace mbed {
+class SPI {
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk) : hz(1000000) {}
+    void frequency(int f) { hz = f; }
+    int write(int value) { return sim_spi_write(value); }
+
+    int hz;
+};
+}
@@ -0,0 +1,3 @@
+// Host simulator: shadows the mbed Timer header
+#pragma once
+#include "us_ticker_api.h"
@@ -0,0 +1,3 @@
+// Host simulator: shadows the mbed cmsis header
+#pragma once
+#include "LPC17xx.h"
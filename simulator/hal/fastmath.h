@@ -0,0 +1,3 @@
+// Host simulator: newlib fastmath.h is just math.h on the host
+#pragma once
+#include <math.h>
@@ -0,0 +1,2 @@
+// Host simulator: shadows src/libs/LPC17xx/sLPC17xx.h
+#include "LPC17xx.h"
@@ -0,0 +1,19 @@
+// Host simulator: shadows the mbed library header with the small subset used by the motion code
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cmsis.h"
+#include "PinNames.h"
+#include "us_ticker_api.h"
+#include "wait_api.h"
+#include "PwmOut.h"
+#include "SPI.h"
+#include "InterruptIn.h"
+#include "Timer.h"
+
+using namespace mbed;
+using namespace std;
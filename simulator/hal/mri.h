@@ -0,0 +1,10 @@
+// Host simulator: shadows the MRI debug monitor header
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void __debugbreak(void);
+#ifdef __cplusplus
+}
+#endif
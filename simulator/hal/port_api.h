@@ -0,0 +1,5 @@
+// Host simulator: shadows the mbed port api header
+#pragma once
+#include "PinNames.h"
+
+static inline PinName port_pin(PortName port, int pin_n) { return (PinName)((port << 5) | pin_n); }
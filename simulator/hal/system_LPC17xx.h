@@ -0,0 +1,3 @@
+// Host simulator: shadows the mbed system header
+#pragma once
+#include "LPC17xx.h"
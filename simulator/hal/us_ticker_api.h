@@ -0,0 +1,5 @@
+// Host simulator: shadows the mbed us ticker api, time is simulated time derived from the step ticker
+#pragma once
+#include <stdint.h>
+
+uint32_t us_ticker_read(void);
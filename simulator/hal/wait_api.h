@@ -0,0 +1,6 @@
+// Host simulator: shadows the mbed wait api
+#pragma once
+
+void wait(float s);
+void wait_ms(int ms);
+void wait_us(int us);
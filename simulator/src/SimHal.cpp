@@ -0,0 +1,217 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Host implementation of the small part of the LPC17xx/mbed HAL that the motion pipeline touches.
+    Time is simulated: it only advances when the simulated step ticker runs, see SimHal.h
+*/
+
+#include "SimHal.h"
+#include "LPC17xx.h"
+#include "mri.h"
+#include "SDFAT.h"
+#include "gpio.h"
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <string>
+
+LPC_GPIO_TypeDef   sim_gpio[5];
+LPC_TIM_TypeDef    sim_tim[4];
+LPC_PWM_TypeDef    sim_pwm1;
+LPC_SC_TypeDef     sim_sc;
+LPC_PINCON_TypeDef sim_pincon;
+LPC_WDT_TypeDef    sim_wdt;
+
+uint32_t SystemCoreClock = 120000000; // LPC1769
+
+// the firmware links src/config.default in as a binary blob, the simulator runs without a default config
+char _binary_config_default_start;
+char _binary_config_default_end;
+
+SimHal sim_hal;
+
+// the leds SlowTicker flashes, only written when the kernel uses them which it does not here
+GPIO::GPIO(PinName pin) : port(0), pin(0) {}
+int GPIO::operator=(int value) { return value; }
+GPIO leds[5] = { GPIO(P1_18), GPIO(P1_19), GPIO(P1_20), GPIO(P1_21), GPIO(P4_28) };
+
+SimHal::SimHal()
+{
+    // the ISP button SlowTicker checks is pulled up
+    sim_gpio[2].FIOPIN |= 1 << 10;
+
+    ticks = 0;
+    tick_frequency = 100000;
+    gpio_watcher = nullptr;
+    sd_us_per_sector = 0;
+    run_us = nullptr;
+    sd_root = nullptr;
+}
+
+uint32_t SimHal::get_time_us() const
+{
+    return (uint32_t)((ticks * 1000000ULL) / tick_frequency);
+}
+
+void SimHal::advance_us(uint32_t us)
+{
+    ticks += ((uint64_t)us * tick_frequency) / 1000000ULL;
+}
+
+void sim_gpio_write(LPC_GPIO_TypeDef *port, uint32_t mask, bool set)
+{
+    if(sim_hal.gpio_watcher) sim_hal.gpio_watcher(port - sim_gpio, mask, set);
+}
+
+// the SD card is the host file system, files are read through a cookie that adds the time the card would take,
+// fopen is wrapped at link time (-Wl,--wrap=fopen) so Player gets one, and remove so an upload can be removed
+SDFAT mounter;
+
+extern "C" FILE *__real_fopen(const char *path, const char *mode);
+extern "C" int __real_remove(const char *path);
+
+// a /sd/ path in the host directory that is the card, other paths as they are
+static std::string sd_path(const char *path)
+{
+    if(sim_hal.sd_root != nullptr && strncmp(path, "/sd/", 4) == 0) return std::string(sim_hal.sd_root) + (path + 3);
+    return path;
+}
+
+// the card reads whole sectors, the time for one is taken when the first byte of it is read
+struct SimSdFile {
+    FILE *fp;
+    uint64_t pos;
+};
+
+static ssize_t sd_read(void *cookie, char *buf, size_t size)
+{
+    SimSdFile *f = (SimSdFile *)cookie;
+    size_t n = fread(buf, 1, size, f->fp);
+    uint32_t sectors = (f->pos + n + 511) / 512 - (f->pos + 511) / 512;
+    f->pos += n;
+    if(sectors > 0 && sim_hal.run_us) sim_hal.run_us(sectors * sim_hal.sd_us_per_sector);
+    return n;
+}
+
+static int sd_seek(void *cookie, off64_t *offset, int whence)
+{
+    SimSdFile *f = (SimSdFile *)cookie;
+    if(fseeko(f->fp, *offset, whence) != 0) return -1;
+    *offset = f->pos = ftello(f->fp);
+    return 0;
+}
+
+static int sd_close(void *cookie)
+{
+    SimSdFile *f = (SimSdFile *)cookie;
+    int r = fclose(f->fp);
+    delete f;
+    return r;
+}
+
+extern "C" FILE *__wrap_fopen(const char *path, const char *mode)
+{
+    FILE *fp = __real_fopen(sd_path(path).c_str(), mode);
+    if(fp == nullptr || sim_hal.sd_us_per_sector == 0 || strcmp(mode, "r") != 0) return fp;
+
+    cookie_io_functions_t io = { sd_read, nullptr, sd_seek, sd_close };
+    return fopencookie(new SimSdFile{fp, 0}, mode, io);
+}
+
+extern "C" int __wrap_remove(const char *path)
+{
+    return __real_remove(sd_path(path).c_str());
+}
+
+int SDFAT::stat(const char *name, uint32_t *size, uint32_t *date_time)
+{
+    if(sim_hal.sd_root == nullptr) return -1;
+    std::string host_path = std::string(sim_hal.sd_root) + "/" + name;
+    struct ::stat st;
+    if(::stat(host_path.c_str(), &st) != 0) return -1;
+    *size = st.st_size;
+    *date_time = st.st_mtime;
+    return 0;
+}
+
+uint32_t us_ticker_read()
+{
+    return sim_hal.get_time_us();
+}
+
+void wait(float s)   { sim_hal.advance_us(s * 1000000.0F); }
+void wait_ms(int ms) { sim_hal.advance_us(ms * 1000); }
+void wait_us(int us) { sim_hal.advance_us(us); }
+
+void NVIC_SystemReset(void)
+{
+    fprintf(stderr, "system reset requested\n");
+    exit(1);
+}
+
+extern "C" void __debugbreak(void)
+{
+    fprintf(stderr, "__debugbreak() hit\n");
+    abort();
+}
+
+// there is no debugger to protect the machine from in the simulator
+extern "C" void set_high_on_debug(int port, int pin) {}
+extern "C" void set_low_on_debug(int port, int pin) {}
+
+// the firmware counts heap allocations in its malloc wrappers (see build/mbed_custom.cpp), here malloc itself is
+// replaced, glibc lets a program do that and its own strdup etc and operator new then come through here too. The bytes
+// are what malloc_usable_size says a block has, which like the firmware's heap includes the rounding up
+volatile unsigned int g_heapAllocations;
+long sim_heap_in_use;
+long sim_heap_peak;
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void *__libc_calloc(size_t n, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+static void *heap_count(void *ptr)
+{
+    if(ptr != nullptr) {
+        sim_heap_in_use += malloc_usable_size(ptr);
+        if(sim_heap_in_use > sim_heap_peak) sim_heap_peak = sim_heap_in_use;
+    }
+    return ptr;
+}
+
+extern "C" void *malloc(size_t size)
+{
+    g_heapAllocations++;
+    return heap_count(__libc_malloc(size));
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    g_heapAllocations++;
+    size_t old = ptr != nullptr ? malloc_usable_size(ptr) : 0;
+    void *moved = __libc_realloc(ptr, size);
+    // a failed realloc keeps the old block
+    if(moved != nullptr || size == 0) sim_heap_in_use -= old;
+    return heap_count(moved);
+}
+
+extern "C" void *calloc(size_t n, size_t size)
+{
+    g_heapAllocations++;
+    return heap_count(__libc_calloc(n, size));
+}
+
+extern "C" void free(void *ptr)
+{
+    if(ptr != nullptr) sim_heap_in_use -= malloc_usable_size(ptr);
+    __libc_free(ptr);
+}
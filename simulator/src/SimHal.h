@@ -0,0 +1,41 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <functional>
+
+// Simulated hardware state shared by the host HAL
+// ticks is the number of step ticker interrupts that have been simulated so far, it is the simulator's clock
+class SimHal {
+    public:
+        SimHal();
+        uint32_t get_time_us() const;
+        void advance_us(uint32_t us);
+
+        uint64_t ticks;
+        uint32_t tick_frequency;
+
+        // called with port number, bit mask and true for set/false for clear on every GPIO write
+        std::function<void(int, uint32_t, bool)> gpio_watcher;
+
+        // the SD card, files opened once sd_us_per_sector is set take that long for every 512 bytes read from them.
+        // the main loop is blocked while it reads so run_us runs the step ticker "interrupt" for the time it takes
+        uint32_t sd_us_per_sector;
+        std::function<void(uint32_t)> run_us;
+
+        // the host directory mounted as /sd, files like /sd/cartesian.grid are opened and removed in it. nullptr for none
+        const char *sd_root;
+};
+
+extern SimHal sim_hal;
+
+// the bytes of host heap handed out and not freed, and the most there have been since sim_heap_peak was last set,
+// counted by the malloc and free of SimHal.cpp
+extern long sim_heap_in_use;
+extern long sim_heap_peak;
@@ -0,0 +1,165 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+This is part of the Smoothie host simulator, it replaces src/libs/Kernel.cpp and only creates the core motion modules and the slow ticker
+*/
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/Config.h"
+#include "libs/StreamOutputPool.h"
+#include "libs/StepTicker.h"
+#include "libs/SlowTicker.h"
+#include "libs/ConfigSources/FileConfigSource.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/robot/Planner.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+#include "SimpleShell.h"
+#include "StepperMotor.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "SimHal.h"
+
+#include <stdio.h>
+#include <string>
+
+#define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
+#define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define grbl_mode_checksum                          CHECKSUM("grbl_mode")
+#define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+
+Kernel* Kernel::instance;
+
+// set by the simulator before the Kernel is created
+std::string sim_config_filename;
+
+// console output of the simulated machine goes to stdout
+class SimConsoleStream : public StreamOutput {
+    public:
+        int puts(const char *s) { return fputs(s, stdout); }
+};
+static SimConsoleStream sim_console;
+
+Kernel::Kernel()
+{
+    halted = false;
+    feed_hold = false;
+    enable_feed_hold = false;
+    bad_mcu = false;
+    stop_request = false;
+    use_leds = false;
+
+    instance = this; // setup the Singleton instance of the kernel
+
+    this->serial = nullptr;
+    this->adc = nullptr;
+    this->simpleshell = nullptr;
+    this->configurator = nullptr;
+
+    this->config = new Config(new FileConfigSource(sim_config_filename, "sim"));
+    this->config->config_cache_load();
+
+    this->streams = new StreamOutputPool();
+    this->streams->append_stream(&sim_console);
+
+    this->current_path = "/";
+
+    this->grbl_mode = this->config->value( grbl_mode_checksum )->by_default(false)->as_bool();
+    this->ok_per_line = this->config->value( ok_per_line_checksum )->by_default(true)->as_bool();
+
+    this->step_ticker = new StepTicker();
+
+    // Configure the step ticker
+    this->base_stepping_frequency = this->config->value(base_stepping_frequency_checksum)->by_default(100000)->as_number();
+    float microseconds_per_step_pulse = this->config->value(microseconds_per_step_pulse_checksum)->by_default(1)->as_number();
+
+    this->step_ticker->set_frequency( this->base_stepping_frequency );
+    this->step_ticker->set_unstep_time( microseconds_per_step_pulse );
+    sim_hal.tick_frequency = this->base_stepping_frequency;
+
+    // TIMER2 counts simulated time, see MotionSim
+    this->add_module( this->slow_ticker = new SlowTicker());
+
+    // Core modules
+    this->add_module( this->conveyor       = new Conveyor()      );
+    this->add_module( this->gcode_dispatch = new GcodeDispatch() );
+    this->add_module( this->robot          = new Robot()         );
+
+    this->planner = new Planner();
+}
+
+std::string Kernel::get_query_string()
+{
+    return "<Sim>\n";
+}
+
+// Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
+void Kernel::add_module(Module* module)
+{
+    module->on_module_loaded();
+}
+
+// Adds a hook for a given module and event
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    this->hooks[id_event].push_back(mod);
+}
+
+void Kernel::immediate_halt()
+{
+    this->halted = true;
+    conveyor->flush_queue();
+    for(auto &a : robot->actuators) a->stop_moving();
+}
+
+// Call a specific event with an argument
+void Kernel::call_event(_EVENT_ENUM id_event, void * argument)
+{
+    bool was_idle = true;
+    if(id_event == ON_HALT) {
+        this->halted = (argument == nullptr);
+        if(!this->halted && this->feed_hold) this->feed_hold= false; // also clear feed hold
+        was_idle = conveyor->is_idle(); // see if we were doing anything like printing
+    }
+
+    // send to all registered modules
+    for (auto m : hooks[id_event]) {
+        (m->*kernel_callback_functions[id_event])(argument);
+    }
+
+    if(id_event == ON_HALT) {
+        if(!this->halted || !was_idle) {
+            this->robot->reset_position_from_current_actuator_position();
+        }
+    }
+}
+
+bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto m : hooks[id_event]) {
+        if(m == mod) return true;
+    }
+    return false;
+}
+
+void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
+        if(*i == mod) {
+            hooks[id_event].erase(i);
+            return;
+        }
+    }
+}
+
+// SimpleShell is not part of the simulator, console commands are simply not found
+bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+{
+    return false;
+}
@@ -0,0 +1,1055 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Host simulator for the motion pipeline.
+    Replays a gcode file through GcodeDispatch -> Robot -> Planner -> Conveyor -> StepTicker exactly as the firmware does,
+    the step ticker interrupt is simulated from the idle loop, and every step/dir edge can be written to a binary trace.
+*/
+
+// must come before LPC17xx.h which defines __I and __O
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/StepTicker.h"
+#include "libs/SlowTicker.h"
+#include "libs/StepperMotor.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "libs/Pin.h"
+#include "libs/Config.h"
+#include "libs/ConfigSources/FileConfigSource.h"
+#include "modules/communication/utils/Gcode.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/communication/utils/MoveFrame.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+#include "modules/robot/Block.h"
+#include "modules/robot/arm_solutions/BaseSolution.h"
+#include "modules/utils/player/Player.h"
+#include "modules/tools/laser/Laser.h"
+#include "modules/tools/extruder/ExtruderMaker.h"
+#include "modules/tools/zprobe/ZProbe.h"
+#include "PlayerPublicAccess.h"
+#include "PublicData.h"
+#include "MemoryPool.h"
+#include "platform_memory.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "utils.h"
+#include "SimHal.h"
+#include "SimNetwork.h"
+#include "StepTrace.h"
+#include "InterruptIn.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+
+extern std::string sim_config_filename;
+extern volatile unsigned int g_heapAllocations;
+
+// same sizes as the LPC1769 AHB banks
+static uint8_t ahb0_buffer[16384] __attribute__ ((aligned (8)));
+static uint8_t ahb1_buffer[16384] __attribute__ ((aligned (8)));
+
+using sim_clock = std::chrono::steady_clock;
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HAVE_CYCLE_COUNTER 1
+static inline uint64_t read_cycles() { return __rdtsc(); }
+#else
+#define HAVE_CYCLE_COUNTER 0
+static inline uint64_t read_cycles() { return std::chrono::duration_cast<std::chrono::nanoseconds>(sim_clock::now().time_since_epoch()).count(); }
+#endif
+
+static double seconds_since(sim_clock::time_point t)
+{
+    return std::chrono::duration<double>(sim_clock::now() - t).count();
+}
+
+// counts the replies to the host, we do not want to print all the oks
+class SimHostStream : public StreamOutput {
+    public:
+        int puts(const char *s) { if(verbose) fputs(s, stdout); return strlen(s); }
+        bool verbose{false};
+};
+
+extern "C" void TIMER2_IRQHandler (void);
+
+#define probe_pin_checksum                      CHECKSUM("probe_pin")
+
+#define laser_checksum                          CHECKSUM("laser")
+#define extruder_checksum                       CHECKSUM("extruder")
+#define laser_module_maximum_power_checksum     CHECKSUM("laser_module_maximum_power")
+#define laser_module_minimum_power_checksum     CHECKSUM("laser_module_minimum_power")
+#define laser_module_maximum_s_value_checksum   CHECKSUM("laser_module_maximum_s_value")
+
+// compares the power the laser is set to on every tick with the power for the speed the primary axis is at right then,
+// scaled by the pixel it is in for a raster, and writes a sample every sample_ticks to a csv file for tools/laserplot.py
+class LaserWatch {
+    public:
+        LaserWatch(Laser *laser) : laser(laser)
+        {
+            minimum_power = THEKERNEL->config->value(laser_module_minimum_power_checksum)->by_default(0)->as_number();
+            maximum_power = THEKERNEL->config->value(laser_module_maximum_power_checksum)->by_default(1.0F)->as_number();
+            maximum_s_value = THEKERNEL->config->value(laser_module_maximum_s_value_checksum)->by_default(1.0F)->as_number();
+        }
+
+        bool open(const char *filename, uint32_t ticks)
+        {
+            csv = fopen(filename, "w");
+            if(csv == nullptr) return false;
+            sample_ticks = ticks;
+            fprintf(csv, "time,block,speed,nominal_speed,power,speed_power\n");
+            return true;
+        }
+
+        void close() { if(csv != nullptr) fclose(csv); csv = nullptr; }
+
+        void tick(const StepTicker *st)
+        {
+            const Block *b = st->get_current_block();
+            if(b != last_block) {
+                last_block = b;
+                if(b != nullptr) ++block_count;
+            }
+            if(b == nullptr || !b->is_g123 || b->steps_event_count == 0) return;
+
+            // the power for this speed is what the 1kHz update computed for the moment it ran
+            float ratio = st->get_current_rate() * st->get_frequency() / b->nominal_rate;
+            float requested = ((float)b->s_value / (1 << 11)) / maximum_s_value * laser->get_scale() / 100;
+            if(b->raster_pixels > 0) {
+                // the pixel the primary axis is in, pixel n starts at step ceil(n * steps / pixels)
+                uint32_t i = (uint64_t)st->get_primary_steps() * b->raster_pixels / b->steps_event_count;
+                if(i >= b->raster_pixels) i = b->raster_pixels - 1;
+                requested *= laser->get_raster_pixel(b->raster_start + i) / 255.0F;
+                ++raster_ticks;
+            }
+            float speed_power = minimum_power + (maximum_power - minimum_power) * std::min(1.0F, requested * ratio);
+            float power = laser->get_current_power() / 100;
+            float error = fabsf(power - speed_power);
+            error_sum += error;
+            if(error > error_max) error_max = error;
+            ++ticks;
+
+            if(csv != nullptr && ticks % sample_ticks == 0) {
+                float mm_per_step = b->millimeters / b->steps_event_count;
+                fprintf(csv, "%1.6f,%lu,%1.3f,%1.3f,%1.4f,%1.4f\n", (double)sim_hal.ticks / st->get_frequency(), (unsigned long)block_count,
+                        ratio * b->nominal_rate * mm_per_step, b->nominal_speed, power * 100, speed_power * 100);
+            }
+        }
+
+        Laser *laser;
+        float minimum_power, maximum_power, maximum_s_value;
+        FILE *csv{nullptr};
+        uint32_t sample_ticks{10};
+        const Block *last_block{nullptr};
+        uint32_t block_count{0};
+        uint64_t ticks{0};
+        uint64_t raster_ticks{0};
+        double error_sum{0};
+        float error_max{0};
+};
+
+// A bed the Z probe touches at bed_z mm, the probe pin is active while the Z actuator is at or below it. The pin changes
+// on the tick the step that touches is made, and its edge interrupt is taken before the next tick as it would be on the
+// board, the slow ticker polls it every 1ms. Each touch measures how many steps Z went on past the one that touched
+class ProbeWatch {
+    public:
+        ProbeWatch(float bed_z)
+        {
+            pin.from_string(THEKERNEL->config->value(zprobe_checksum, probe_pin_checksum)->by_default("nc")->as_string());
+            bed_steps = floorf(bed_z * THEROBOT->actuators[Z_AXIS]->get_steps_per_mm());
+            // it may start on the bed, that is not a touch
+            touching = THEROBOT->actuators[Z_AXIS]->get_current_step() <= bed_steps;
+            if(pin.connected()) set_level();
+        }
+
+        bool is_connected() { return pin.connected(); }
+
+        void tick()
+        {
+            int32_t z = THEROBOT->actuators[Z_AXIS]->get_current_step();
+            bool t = z <= bed_steps;
+            if(t != touching) {
+                touching = t;
+                if(touching) {
+                    touch_step = z;
+                    overshoot = 0;
+                    ++touches;
+                } else {
+                    done();
+                }
+
+                bool level = set_level();
+                for(auto i : mbed::sim_interrupt_ins()) {
+                    if(i->pin != LPC_PIN(pin.port_number, pin.pin)) continue;
+                    auto& f = level ? i->rise_fnc : i->fall_fnc;
+                    if(f) f();
+                }
+            }
+            if(touching && touch_step - z > overshoot) overshoot = touch_step - z;
+        }
+
+        void done()
+        {
+            overshoot_sum += overshoot;
+            if(overshoot > overshoot_max) overshoot_max = overshoot;
+            overshoot = 0;
+        }
+
+        // the level on the pin, an inverted probe is pulled low when it touches
+        bool set_level()
+        {
+            bool level = touching != pin.is_inverting();
+            LPC_GPIO_TypeDef *port = &sim_gpio[(uint8_t)pin.port_number];
+            if(level) port->FIOPIN |= 1 << pin.pin;
+            else port->FIOPIN &= ~(1 << pin.pin);
+            return level;
+        }
+
+        Pin pin;
+        int32_t bed_steps;
+        bool touching;
+        int32_t touch_step{0};
+        int32_t overshoot{0};
+        uint32_t touches{0};
+        int64_t overshoot_sum{0};
+        int32_t overshoot_max{0};
+};
+
+// Runs the step ticker "interrupt" whenever the firmware idles, this is where simulated time passes. TIMER2 counts at
+// SystemCoreClock/4 and the slow ticker interrupt is taken at the first step tick it matches on
+class MotionSim : public Module {
+    public:
+        MotionSim(uint32_t ticks_per_idle) : ticks_per_idle(ticks_per_idle) {}
+
+        void on_module_loaded() { register_for_event(ON_IDLE); }
+
+        void on_idle(void *) { run_ticks(ticks_per_idle); }
+
+        void run_ticks(uint32_t n)
+        {
+            StepTicker *st = THEKERNEL->step_ticker;
+            const uint32_t timer2_per_tick = (SystemCoreClock / 4) / sim_hal.tick_frequency;
+            sim_clock::time_point start = sim_clock::now();
+            for (uint32_t i = 0; i < n; ++i) {
+                bool active = st->get_current_block() != nullptr;
+                uint64_t c0 = read_cycles();
+                st->step_tick();
+                uint64_t c = read_cycles() - c0;
+                st->unstep_tick();
+                ++sim_hal.ticks;
+                if(probe_watch != nullptr) probe_watch->tick();
+
+                if(LPC_TIM2->TCR & 1) {
+                    uint32_t to_match = LPC_TIM2->MR0 - LPC_TIM2->TC;
+                    LPC_TIM2->TC += timer2_per_tick;
+                    if(to_match <= timer2_per_tick) {
+                        LPC_TIM2->IR |= 1;
+                        TIMER2_IRQHandler();
+                    }
+                }
+                if(laser_watch != nullptr) laser_watch->tick(st);
+                if(sim_hal.ticks % (sim_hal.tick_frequency / 100) == 0) watch_acceleration();
+
+                if(active) {
+                    ++active_ticks;
+                    active_cycles += c;
+                    if(c > max_cycles) max_cycles = c;
+                    // how far ahead the planner sees, every 10ms at 100kHz
+                    if(active_ticks % 1000 == 0) {
+                        queued_mm += THECONVEYOR->get_queued_millimeters();
+                        ++queue_samples;
+                    }
+                }
+
+                const Block *b = st->get_current_block();
+                if(b != last_block) {
+                    if(b != nullptr) ++blocks;
+                    watch_speed_change(b, st);
+                    watch_planned_speed_change(b);
+                    last_block = b;
+                } else if(b != nullptr) {
+                    actuator_speeds(b, st, speed);
+                    planned_exit = b->exit_speed;
+                }
+            }
+            tick_seconds += seconds_since(start);
+        }
+
+        // each actuators speed in mm/s from the primary axis rate, NAN round an arc where they are not in proportion
+        static void actuator_speeds(const Block *b, const StepTicker *st, float *v)
+        {
+            float steps_per_s = st->get_current_rate() * st->get_frequency() / b->steps_event_count;
+            for (uint8_t m = 0; m < THEROBOT->get_number_registered_motors(); ++m) {
+                v[m] = b->is_arc ? NAN : (b->direction_bits[m] ? -1.0F : 1.0F) * b->steps[m] * steps_per_s / THEROBOT->actuators[m]->get_steps_per_mm();
+            }
+        }
+
+        // how much each actuator jumped in speed going from the last tick of a block into the first of the next, or
+        // to and from standing still when the queue starts or runs out
+        void watch_speed_change(const Block *b, const StepTicker *st)
+        {
+            float v[k_max_actuators];
+            if(b != nullptr) actuator_speeds(b, st, v);
+            for (uint8_t m = 0; m < THEROBOT->get_number_registered_motors(); ++m) {
+                if(b == nullptr) v[m] = 0;
+                float change = fabsf(v[m] - speed[m]);
+                if(change > max_speed_change[m]) max_speed_change[m] = change; // false for NAN
+                speed[m] = v[m];
+            }
+        }
+
+        // the same from the speeds the planner gave the junction, the previous block's exit and this one's entry. Those
+        // are what the junction limits hold to, the step generation can end a decelerating block a few ticks early
+        // and a little faster, and the first tick of the next is already accelerating. The planner limits the
+        // actuators as they move before they are rounded to whole steps, each block can be a step off that
+        void watch_planned_speed_change(const Block *b)
+        {
+            float u[k_max_actuators], step[k_max_actuators];
+            float entry = 0;
+            if(b != nullptr) {
+                // a block in the deceleration tail runs on from where the one before it ended
+                entry = b->decel_tail ? planned_exit : b->entry_speed;
+                for (uint8_t m = 0; m < THEROBOT->get_number_registered_motors(); ++m) {
+                    float steps_per_mm = THEROBOT->actuators[m]->get_steps_per_mm() * b->millimeters;
+                    u[m] = b->is_arc ? NAN : (b->direction_bits[m] ? -1.0F : 1.0F) * b->steps[m] / steps_per_mm;
+                    step[m] = 1.0F / steps_per_mm;
+                }
+            }
+            for (uint8_t m = 0; m < THEROBOT->get_number_registered_motors(); ++m) {
+                if(b == nullptr) u[m] = step[m] = 0;
+                float change = fabsf(entry * u[m] - planned_exit * planned_unit[m]) - entry * step[m] - planned_exit * planned_step[m];
+                if(change > max_planned_speed_change[m]) max_planned_speed_change[m] = change; // false for NAN
+                planned_unit[m] = u[m];
+                planned_step[m] = step[m];
+            }
+            planned_exit = b != nullptr ? b->exit_speed : 0;
+        }
+
+        // the acceleration of the first three actuators together, from where their steps have got them to every 10ms.
+        // On a cartesian that is the acceleration along the path, round an arc as well as along it. A step either
+        // way is 2 steps/mm/s² at 80 steps/mm
+        void watch_acceleration()
+        {
+            float v[3];
+            float a2 = 0;
+            for (uint8_t m = 0; m < 3 && m < THEROBOT->get_number_registered_motors(); ++m) {
+                int32_t pos = THEROBOT->actuators[m]->get_current_step();
+                v[m] = (pos - window_pos[m]) / THEROBOT->actuators[m]->get_steps_per_mm() * 100;
+                a2 += (v[m] - window_speed[m]) * (v[m] - window_speed[m]);
+                window_pos[m] = pos;
+                window_speed[m] = v[m];
+            }
+            float a = sqrtf(a2) * 100;
+            if(a > max_acceleration) max_acceleration = a;
+        }
+
+        uint32_t ticks_per_idle;
+        LaserWatch *laser_watch{nullptr};
+        ProbeWatch *probe_watch{nullptr};
+        uint64_t active_ticks{0};
+        uint64_t active_cycles{0};
+        uint64_t max_cycles{0};
+        uint64_t blocks{0};
+        double queued_mm{0};
+        uint64_t queue_samples{0};
+        double tick_seconds{0};
+        const Block *last_block{nullptr};
+        float speed[k_max_actuators]{};             // mm/s each actuator went on the last tick
+        float max_speed_change[k_max_actuators]{};
+        float planned_exit{0};                      // the exit speed of the block running
+        float planned_unit[k_max_actuators]{};      // and its mm of each actuator per mm of the path
+        float planned_step[k_max_actuators]{};      // what a step is of that
+        float max_planned_speed_change[k_max_actuators]{};
+        int32_t window_pos[3]{};                    // the step each actuator was at 10ms ago
+        float window_speed[3]{};                    // and its mm/s over the 10ms before that
+        float max_acceleration{0};
+};
+
+struct PinWatch {
+    int8_t motor;
+    bool is_dir;
+};
+
+static PinWatch pin_watch[5 * 32];
+static bool dir_state[k_max_actuators];
+static uint64_t steps_issued[k_max_actuators];
+static StepTrace trace;
+
+// find the step and dir pins of each motor so we can tell which GPIO writes are step or dir edges
+static void watch_motor_pins(uint8_t n_motors)
+{
+    static const char *names[] = {"alpha", "beta", "gamma", "delta", "epsilon", "zeta"};
+    static bool inverting[5 * 32];
+
+    for (auto &w : pin_watch) w.motor = -1;
+
+    // the extruders are registered after the actuators in the order the enabled ones are in the config
+    std::vector<uint16_t> extruders;
+    THEKERNEL->config->get_module_list(&extruders, extruder_checksum);
+    extruders.erase(std::remove_if(extruders.begin(), extruders.end(), [](uint16_t cs) {
+        return !THEKERNEL->config->value(extruder_checksum, cs, CHECKSUM("enable"))->as_bool();
+    }), extruders.end());
+    size_t extruder = 0;
+
+    for (uint8_t m = 0; m < n_motors; ++m) {
+        uint16_t cs = 0;
+        if(THEROBOT->actuators[m]->is_extruder()) {
+            if(extruder >= extruders.size()) continue;
+            cs = extruders[extruder++];
+        }
+        for (int d = 0; d < 2; ++d) {
+            Pin pin;
+            if(cs != 0) {
+                pin.from_string(THEKERNEL->config->value(extruder_checksum, cs, d == 0 ? CHECKSUM("step_pin") : CHECKSUM("dir_pin"))->by_default("nc")->as_string());
+            } else {
+                std::string key = std::string(names[m]) + (d == 0 ? "_step_pin" : "_dir_pin");
+                pin.from_string(THEKERNEL->config->value(get_checksum(key))->by_default("nc")->as_string());
+            }
+            if(!pin.connected()) continue;
+            int i = pin.port_number * 32 + pin.pin;
+            pin_watch[i].motor = m;
+            pin_watch[i].is_dir = (d == 1);
+            inverting[i] = pin.is_inverting();
+        }
+    }
+
+    sim_hal.gpio_watcher = [](int port, uint32_t mask, bool set) {
+        while(mask != 0) {
+            int bit = __builtin_ctz(mask);
+            mask &= mask - 1;
+            int i = port * 32 + bit;
+            const PinWatch &w = pin_watch[i];
+            if(w.motor < 0) continue;
+
+            bool level = set ^ inverting[i]; // logical level
+            if(w.is_dir) {
+                if(level != dir_state[w.motor]) {
+                    dir_state[w.motor] = level;
+                    trace.record(sim_hal.ticks, w.motor, true, level);
+                }
+            } else if(level) {
+                ++steps_issued[w.motor];
+                trace.record(sim_hal.ticks, w.motor, false, true);
+            }
+        }
+    };
+}
+
+// the config overrides are appended to a copy of the config, later lines replace earlier ones like config-override
+static std::string merged_config_filename;
+static bool apply_overrides(const std::vector<std::string>& overrides)
+{
+    char tmpl[] = "/tmp/smoothiesim-config-XXXXXX";
+    int fd = mkstemp(tmpl);
+    if(fd < 0) return false;
+    FILE *out = fdopen(fd, "w");
+    FILE *in = fopen(sim_config_filename.c_str(), "r");
+    if(out == nullptr || in == nullptr) return false;
+
+    char buf[256];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), in)) > 0) fwrite(buf, 1, n, out);
+    fputs("\n", out);
+    for(auto& o : overrides) fprintf(out, "%s\n", o.c_str());
+    fclose(in);
+    fclose(out);
+
+    merged_config_filename = tmpl;
+    sim_config_filename = merged_config_filename;
+    atexit([]() { unlink(merged_config_filename.c_str()); });
+    return true;
+}
+
+// the receive side of USBSerial for -s, the file is the bytes a host sends (see fast-stream.py -o), they arrive in 64 byte
+// packets whenever the 256 byte receive buffer has room, the move frames are found with the same MoveFrameTracker and
+// each line or frame is dispatched like USBSerial::on_main_loop does.
+// With a link rate the bytes arrive no faster than that in simulated time, which models how many bytes per second the
+// firmware can take in, and the planner starves if it is too slow for the moves
+class SimUsbLink {
+    public:
+        SimUsbLink(FILE *fp, uint32_t rate) : fp(fp), rate(rate) {}
+
+        enum { MESSAGE, WAIT, END };
+
+        // receives what fits and has arrived then returns the next line or frame in message
+        int receive(std::string &message)
+        {
+            uint64_t arrived = rate == 0 ? UINT64_MAX : sim_hal.ticks * rate / sim_hal.tick_frequency;
+            while(rx.size() <= 256 - 64 && !feof(fp) && bytes < arrived) {
+                uint8_t packet[64];
+                size_t n = fread(packet, 1, std::min<uint64_t>(sizeof(packet), arrived - bytes), fp);
+                bytes += n;
+                for (size_t i = 0; i < n; ++i) {
+                    uint8_t f = tracker.feed(packet[i]);
+                    rx.push_back(packet[i]);
+                    if(f == MoveFrameTracker::FRAME_END || (f == MoveFrameTracker::TEXT && (packet[i] == '\n' || packet[i] == '\r'))) ++complete;
+                }
+            }
+            if(complete == 0) return feof(fp) ? END : WAIT;
+
+            message.clear();
+            if(rx.front() == MOVE_FRAME_SYNC) {
+                size_t size = rx[1] + 4;
+                message.assign(rx.begin(), rx.begin() + size);
+                rx.erase(rx.begin(), rx.begin() + size);
+                ++frames;
+            } else {
+                while(rx.front() != '\n' && rx.front() != '\r') {
+                    message += rx.front();
+                    rx.pop_front();
+                }
+                rx.pop_front();
+                ++lines;
+            }
+            --complete;
+            return MESSAGE;
+        }
+
+        uint64_t bytes{0};
+        uint32_t lines{0};
+        uint32_t frames{0};
+
+    private:
+        FILE *fp;
+        uint32_t rate;
+        std::deque<uint8_t> rx;
+        MoveFrameTracker tracker;
+        uint32_t complete{0};
+};
+
+// the gcode parse benchmark, each line becomes a Gcode like GcodeDispatch makes them and its arguments are looked up
+// the way Robot::process_move and the M code handlers do, nothing is executed
+static int parse_benchmark(FILE *fp, uint32_t repeat)
+{
+    std::vector<std::string> lines;
+    char buf[256];
+    while(fgets(buf, sizeof(buf), fp) != NULL) {
+        std::string l(buf);
+        size_t comment = l.find_first_of(";(\r\n");
+        if(comment != std::string::npos) l.resize(comment);
+        if(!l.empty()) lines.push_back(l);
+    }
+    fclose(fp);
+
+    float sum = 0;
+    uint64_t lookups = 0;
+    sim_clock::time_point start = sim_clock::now();
+    for(uint32_t r = 0; r < repeat; ++r) {
+        for(auto& l : lines) {
+            Gcode *gcode = new Gcode(l, &StreamOutput::NullStream);
+            if(gcode->has_g) {
+                for(char c : {'X', 'Y', 'Z', 'I', 'J', 'K', 'E', 'A', 'B', 'C', 'F'}) {
+                    if(gcode->has_letter(c)) sum += gcode->get_value(c);
+                    ++lookups;
+                }
+            } else if(gcode->has_m) {
+                for(char c : {'S', 'P', 'T'}) {
+                    if(gcode->has_letter(c)) sum += gcode->get_value(c);
+                    ++lookups;
+                }
+                sum += gcode->get_num_args();
+            }
+            delete gcode;
+        }
+    }
+    double seconds = seconds_since(start);
+
+    uint64_t n = (uint64_t)lines.size() * repeat;
+    printf("parse: %llu lines, %llu lookups, %1.0f lines/s (%1.0f ns/line), checksum %g\n",
+           (unsigned long long)n, (unsigned long long)lookups, n / seconds, seconds * 1e9 / n, sum);
+    return 0;
+}
+
+// the arm solution converts random lines split into segment ends the way Robot::append_line does
+static int kinematics_benchmark(uint32_t repeat)
+{
+    const uint16_t run = 16;
+    const uint32_t nlines = 1000;
+    BaseSolution *solution = THEROBOT->arm_solution;
+
+    // lines of 16 segments of 0.2 to 2mm within 60mm of the middle of the bed, Z 10 to 60mm, the solutions that can not
+    // reach both ends are not given the line
+    std::vector<float> lines;
+    uint32_t seed = 12345;
+    auto rnd = [&seed]() { seed = seed * 1103515245 + 12345; return ((seed >> 8) & 0xFFFF) / 65536.0F; };
+    for(uint32_t tries = 0; lines.size() < nlines * 6 && tries < nlines * 100; ++tries) {
+        float a = rnd() * 2 * (float)M_PI, r = 60 * sqrtf(rnd()), d = rnd() * 2 * (float)M_PI, len = 0.2F + rnd() * 1.8F;
+        float l[6] = { r * cosf(a), r * sinf(a), 10 + rnd() * 50, len * cosf(d), len * sinf(d), (rnd() - 0.5F) * 0.1F };
+        float end[3] = { l[0] + l[3] * (run - 1), l[1] + l[4] * (run - 1), l[2] + l[5] * (run - 1) };
+        ActuatorCoordinates a0, a1;
+        solution->cartesian_to_actuator(l, a0);
+        solution->cartesian_to_actuator(end, a1);
+        bool ok = true;
+        for(int i = X_AXIS; i <= Z_AXIS; ++i) ok = ok && !isnan(a0[i]) && !isnan(a1[i]);
+        if(ok) lines.insert(lines.end(), l, l + 6);
+    }
+    const uint32_t n = lines.size() / 6;
+    if(n == 0) {
+        printf("kinematics: no lines the arm solution can reach\n");
+        return 1;
+    }
+
+    std::vector<ActuatorCoordinates> solved(n * run);
+    uint64_t cycles = 0;
+    double seconds = 0;
+    for(uint32_t r = 0; r < repeat; ++r) {
+        sim_clock::time_point t = sim_clock::now();
+        uint64_t c0 = read_cycles();
+        for(uint32_t k = 0; k < n; ++k) {
+            const float *l = &lines[k * 6];
+            for(uint16_t i = 0; i < run; ++i) {
+                float p[3] = { l[0] + l[3] * i, l[1] + l[4] * i, l[2] + l[5] * i };
+                solution->cartesian_to_actuator(p, solved[k * run + i]);
+            }
+        }
+        cycles += read_cycles() - c0;
+        seconds += seconds_since(t);
+    }
+
+    double sum = 0;
+    for(uint32_t i = 0; i < n * run; ++i) {
+        for(int j = X_AXIS; j <= Z_AXIS; ++j) sum += solved[i][j];
+    }
+
+    uint64_t points = (uint64_t)n * run * repeat;
+    printf("kinematics: %u lines, %llu segment ends, checksum %g\n", n, (unsigned long long)points, sum);
+    printf("%1.0f segments/s (%1.1f %s each)\n", points / seconds, (double)cycles / points, HAVE_CYCLE_COUNTER ? "cycles" : "ns");
+    return 0;
+}
+
+// the config is loaded into the cache like at boot then every setting in the file is looked up the way the modules do
+// in on_module_loaded, numbers with as_number and the rest with as_string, the commented out ones are looked up too and
+// get their default like the settings a config leaves out, and each module family is listed like the module pools do
+static int config_benchmark(uint32_t repeat)
+{
+    FILE *fp = fopen(sim_config_filename.c_str(), "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "Unable to open config file: %s\n", sim_config_filename.c_str());
+        return 2;
+    }
+    struct setting { uint16_t check_sums[3]; bool number; };
+    std::vector<setting> settings, missing;
+    std::vector<uint16_t> families;
+    char buf[256];
+    while(fgets(buf, sizeof(buf), fp) != NULL) {
+        char key[128], value[128];
+        bool commented = buf[0] == '#';
+        if(sscanf(buf + (commented ? 1 : 0), "%127s %127s", key, value) != 2 || key[0] == '#') continue;
+        if(commented && strchr(key, '.') == nullptr) continue;
+        setting s;
+        get_checksums(s.check_sums, key);
+        char *end;
+        strtof(value, &end);
+        s.number = end != value && *end == '\0';
+        (commented ? missing : settings).push_back(s);
+        if(!commented && s.check_sums[2] == CHECKSUM("enable") && std::find(families.begin(), families.end(), s.check_sums[0]) == families.end()) {
+            families.push_back(s.check_sums[0]);
+        }
+    }
+    fclose(fp);
+
+    // with -d the time the card takes to read the files is added up
+    uint64_t sd_us = 0;
+    sim_hal.run_us = [&sd_us](uint32_t us) { sd_us += us; };
+
+    Config *config = new Config(new FileConfigSource(sim_config_filename, "sim"));
+    double first_load_seconds = 0, load_seconds = 0, lookup_seconds = 0;
+    uint64_t first_sd_us = 0;
+    long peak = 0, held = 0;
+    unsigned int allocations = 0;
+    size_t modules = 0;
+    double sum = 0;
+    for(uint32_t r = 0; r < repeat; ++r) {
+        long heap = sim_heap_in_use;
+        sim_heap_peak = heap;
+        unsigned int a = g_heapAllocations;
+        uint64_t us = sd_us;
+        sim_clock::time_point t = sim_clock::now();
+        config->config_cache_load();
+        // the first load is the one at boot, the file config source writes its image then
+        if(r == 0) {
+            first_load_seconds = seconds_since(t);
+            first_sd_us = sd_us - us;
+            sd_us = us;
+        } else {
+            load_seconds += seconds_since(t);
+        }
+        allocations = g_heapAllocations - a;
+        peak = std::max(peak, sim_heap_peak - heap);
+        held = sim_heap_in_use - heap;
+
+        t = sim_clock::now();
+        for(auto& s : settings) {
+            ConfigValue *cv = config->value(s.check_sums);
+            sum += s.number ? cv->as_number() : cv->as_string().size();
+        }
+        for(auto& s : missing) sum += config->value(s.check_sums)->by_default(1.0F)->as_number();
+        modules = 0;
+        for(uint16_t f : families) {
+            std::vector<uint16_t> list;
+            config->get_module_list(&list, f);
+            modules += list.size();
+            for(uint16_t m : list) sum += m;
+        }
+        lookup_seconds += seconds_since(t);
+        config->config_cache_clear();
+    }
+    delete config;
+
+    uint64_t lookups = (uint64_t)(settings.size() + missing.size()) * repeat;
+    printf("config: %u settings, %u missing, %u modules in %u families, checksum %g\n", (unsigned)settings.size(), (unsigned)missing.size(),
+           (unsigned)modules, (unsigned)families.size(), sum / repeat);
+    printf("first load: %1.3f ms", first_load_seconds * 1000);
+    if(sim_hal.sd_us_per_sector > 0) printf(" and %1.1f ms reading the card", first_sd_us / 1000.0);
+    if(repeat > 1) {
+        printf(", after: %1.3f ms", load_seconds * 1000 / (repeat - 1));
+        if(sim_hal.sd_us_per_sector > 0) printf(" and %1.1f ms reading the card", sd_us / 1000.0 / (repeat - 1));
+    }
+    printf("\nload: %u heap allocations, %ld bytes held, %ld bytes at the peak\n", allocations, held, peak);
+    printf("lookups: %1.3f ms for all of them, %1.0f ns each with the module lists\n", lookup_seconds * 1000 / repeat, lookup_seconds * 1e9 / lookups);
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s -c config [-o \"key value\"]... [-g gcode]... [-t trace.bin] [-i ticks_per_idle] [-r repeat] [-s | -n] [-l bytes/s] [-f] [-d us] [-m dir] [-w laser.csv] [-b mm] [-v] file.gcode\n", prog);
+    fprintf(stderr, "       %s -c config [-o \"key value\"]... -k [-r repeat]\n", prog);
+    fprintf(stderr, "       %s -c config [-o \"key value\"]... -e [-r repeat] [-d us] [-m dir]\n", prog);
+    fprintf(stderr, "       %s -p [-r repeat] file.gcode\n", prog);
+    fprintf(stderr, "  -c config        Smoothie config file for the simulated machine\n");
+    fprintf(stderr, "  -o \"key value\"  override a config setting, eg -o \"planner_queue_size 256\", can be repeated\n");
+    fprintf(stderr, "  -g gcode         a line to send before the file, eg -g \"M204 J5000\", can be repeated\n");
+    fprintf(stderr, "  -t trace.bin     write every step/dir edge to a binary trace (see StepTrace.h)\n");
+    fprintf(stderr, "  -i ticks         step ticks simulated per idle loop, models how fast lines arrive (default 10)\n");
+    fprintf(stderr, "  -r repeat        replay the file this many times, for benchmarks (default 1)\n");
+    fprintf(stderr, "  -s               the file is a host stream with binary move frames (fast-stream.py -b -o), received like USBSerial\n");
+    fprintf(stderr, "  -n               the file is sent to the gcode stream port over TCP, received by uIP like Network does (see SimNetwork.h)\n");
+    fprintf(stderr, "  -l bytes/s       with -s or -n, the rate the bytes arrive at in simulated time (default unlimited)\n");
+    fprintf(stderr, "  -f               play the file from the simulated SD card with the Player module, like the play command\n");
+    fprintf(stderr, "  -d us            with -f or -e, the time the SD card takes to read each 512 byte sector (default 0)\n");
+    fprintf(stderr, "  -m dir           the host directory that is the SD card, files in /sd/ like /sd/cartesian.grid are opened in it\n");
+    fprintf(stderr, "  -w laser.csv     with the laser module enabled, write its power and the speed every 10 ticks (see tools/laserplot.py)\n");
+    fprintf(stderr, "  -b mm            with the zprobe module enabled, a bed at this Z the probe touches (see ProbeWatch)\n");
+    fprintf(stderr, "  -v               echo the replies that would be sent to the host\n");
+    fprintf(stderr, "  -k               convert random lines with the arm solution, benchmarks the kinematics\n");
+    fprintf(stderr, "  -e               load the config into the cache and look up every setting in it, benchmarks the config cache\n");
+    fprintf(stderr, "  -p               only parse each line and look up its arguments, benchmarks the gcode parser\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *trace_filename = nullptr;
+    uint32_t ticks_per_idle = 10;
+    uint32_t repeat = 1;
+    SimHostStream host;
+    std::vector<std::string> prelude;
+    std::vector<std::string> overrides;
+    bool parse_only = false;
+    bool kinematics_only = false;
+    bool config_only = false;
+    bool host_stream = false;
+    bool net_stream = false;
+    uint32_t link_rate = 0;
+    bool play_file = false;
+    uint32_t sd_us_per_sector = 0;
+    const char *laser_filename = nullptr;
+    float bed_z = NAN;
+
+    int c;
+    while((c = getopt(argc, argv, "c:o:g:t:i:r:pkesnl:fd:m:w:b:vh")) != -1) {
+        switch(c) {
+            case 'c': sim_config_filename = optarg; break;
+            case 'o': overrides.push_back(optarg); break;
+            case 'g': prelude.push_back(optarg); break;
+            case 't': trace_filename = optarg; break;
+            case 'i': ticks_per_idle = strtoul(optarg, nullptr, 10); break;
+            case 'r': repeat = strtoul(optarg, nullptr, 10); break;
+            case 'v': host.verbose = true; break;
+            case 'p': parse_only = true; break;
+            case 'k': kinematics_only = true; break;
+            case 'e': config_only = true; break;
+            case 's': host_stream = true; break;
+            case 'n': net_stream = true; break;
+            case 'l': link_rate = strtoul(optarg, nullptr, 10); break;
+            case 'f': play_file = true; break;
+            case 'd': sd_us_per_sector = strtoul(optarg, nullptr, 10); break;
+            case 'm': sim_hal.sd_root = optarg; break;
+            case 'w': laser_filename = optarg; break;
+            case 'b': bed_z = strtof(optarg, nullptr); break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+
+    if((optind >= argc && !kinematics_only && !config_only) || (sim_config_filename.empty() && !parse_only) || ticks_per_idle == 0 || repeat == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if(config_only) {
+        if(!overrides.empty() && !apply_overrides(overrides)) {
+            fprintf(stderr, "Unable to apply the config overrides\n");
+            return 2;
+        }
+        sim_hal.sd_us_per_sector = sd_us_per_sector;
+        return config_benchmark(repeat);
+    }
+
+    if(kinematics_only) {
+        if(!overrides.empty() && !apply_overrides(overrides)) {
+            fprintf(stderr, "Unable to apply the config overrides\n");
+            return 2;
+        }
+        _AHB0 = new MemoryPool(ahb0_buffer, sizeof(ahb0_buffer));
+        _AHB1 = new MemoryPool(ahb1_buffer, sizeof(ahb1_buffer));
+        new Kernel();
+        return kinematics_benchmark(repeat);
+    }
+
+    FILE *fp = fopen(argv[optind], "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "Unable to open gcode file: %s\n", argv[optind]);
+        return 2;
+    }
+
+    if(parse_only) return parse_benchmark(fp, repeat);
+
+    // there is no on_boot.gcode to play
+    if(play_file) overrides.push_back("on_boot_gcode_enable false");
+
+    if(!overrides.empty() && !apply_overrides(overrides)) {
+        fprintf(stderr, "Unable to apply the config overrides\n");
+        return 2;
+    }
+
+    _AHB0 = new MemoryPool(ahb0_buffer, sizeof(ahb0_buffer));
+    _AHB1 = new MemoryPool(ahb1_buffer, sizeof(ahb1_buffer));
+
+    Kernel *kernel = new Kernel();
+    MotionSim *sim = new MotionSim(ticks_per_idle);
+    kernel->add_module(sim);
+    if(play_file) kernel->add_module(new Player());
+    kernel->add_module(new ZProbe());
+    kernel->add_module(new Laser());
+
+    // extruders only if the config has any, they are the motors after the actuators
+    std::vector<uint16_t> extruders;
+    kernel->config->get_module_list(&extruders, extruder_checksum);
+    if(!extruders.empty()) {
+        ExtruderMaker *em = new ExtruderMaker();
+        em->load_tools();
+        delete em;
+    }
+
+    // the laser module deletes itself unless it is enabled
+    Laser *laser = nullptr;
+    LaserWatch *laser_watch = nullptr;
+    if(PublicData::get_value(laser_checksum, &laser)) {
+        sim->laser_watch = laser_watch = new LaserWatch(laser);
+        if(laser_filename != nullptr && !laser_watch->open(laser_filename, 10)) {
+            fprintf(stderr, "Unable to open laser file: %s\n", laser_filename);
+            return 2;
+        }
+    }
+
+    ProbeWatch *probe_watch = nullptr;
+    if(!isnan(bed_z)) {
+        sim->probe_watch = probe_watch = new ProbeWatch(bed_z);
+        if(!probe_watch->is_connected()) {
+            fprintf(stderr, "A bed needs the zprobe module enabled with a probe_pin\n");
+            return 2;
+        }
+    }
+
+    uint8_t n_motors = THEROBOT->get_number_registered_motors();
+    watch_motor_pins(n_motors);
+    if(trace_filename != nullptr && !trace.open(trace_filename, n_motors, kernel->base_stepping_frequency)) {
+        fprintf(stderr, "Unable to open trace file: %s\n", trace_filename);
+        return 2;
+    }
+
+    // start the timers and interrupts
+    THECONVEYOR->start(n_motors);
+    THEKERNEL->step_ticker->start();
+    THEKERNEL->slow_ticker->start();
+    THEROBOT->after_config();
+
+    // replay the file like the main loop does for lines arriving on a serial port, the message is reused like
+    // SerialConsole and USBSerial do
+    struct SerialMessage message;
+    message.stream = &host;
+    message.message.reserve(128);
+    auto send_line = [&](const char *line) {
+        message.message.assign(line);
+        kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+        kernel->call_event(ON_MAIN_LOOP);
+        kernel->call_event(ON_IDLE);
+    };
+
+    for(auto& l : prelude) send_line(l.c_str());
+
+    sim_clock::time_point start = sim_clock::now();
+    char buf[256];
+    uint32_t lines = 0;
+    SimUsbLink link(fp, link_rate);
+    SimNetwork *net = nullptr;
+    if(net_stream) {
+        // sent again on the same connection for each repeat, the last line has to end for it to be queued
+        std::string file, data;
+        size_t n;
+        while((n = fread(buf, 1, sizeof(buf), fp)) > 0) file.append(buf, n);
+        if(!file.empty() && file.back() != '\n') file += '\n';
+        for(uint32_t r = 0; r < repeat; ++r) data += file;
+        lines = std::count(data.begin(), data.end(), '\n');
+        kernel->add_module(net = new SimNetwork(data, link_rate));
+    }
+    SimHostStream console;
+    console.verbose = true;
+    for(uint32_t r = 0; r < repeat && !kernel->is_halted(); ++r) {
+        rewind(fp);
+        if(play_file) {
+            // Player reads the file itself, the main loop runs until it is done
+            sim_hal.sd_us_per_sector = sd_us_per_sector;
+            sim_hal.run_us = [sim](uint32_t us) { sim->run_ticks((uint64_t)us * sim_hal.tick_frequency / 1000000); };
+            char *path = realpath(argv[optind], nullptr);
+            send_line((std::string("play ") + path).c_str());
+            free(path);
+
+            bool *playing;
+            while(!kernel->is_halted() && PublicData::get_value(player_checksum, is_playing_checksum, &playing) && *playing) {
+                kernel->call_event(ON_MAIN_LOOP);
+                kernel->call_event(ON_IDLE);
+            }
+            lines = kernel->gcode_dispatch->get_line_allocations().lines;
+            continue;
+        }
+
+        if(net != nullptr) {
+            while(!net->is_done() && !kernel->is_halted()) {
+                kernel->call_event(ON_MAIN_LOOP);
+                kernel->call_event(ON_IDLE);
+            }
+            break;
+        }
+
+        if(host_stream) {
+            int got;
+            while((got = link.receive(message.message)) != SimUsbLink::END) {
+                if(got == SimUsbLink::MESSAGE) {
+                    kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+                    kernel->call_event(ON_MAIN_LOOP);
+                    ++lines;
+                }
+                kernel->call_event(ON_IDLE);
+                if(kernel->is_halted()) break;
+            }
+            continue;
+        }
+
+        while(fgets(buf, sizeof(buf), fp) != NULL) {
+            size_t n = strlen(buf);
+            while(n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == '\r')) buf[--n] = '\0';
+
+            send_line(buf);
+            ++lines;
+            if(kernel->is_halted()) break;
+        }
+    }
+    fclose(fp);
+
+    THECONVEYOR->wait_for_idle();
+    double total_seconds = seconds_since(start);
+    trace.close();
+
+    // report
+    double plan_seconds = total_seconds - sim->tick_seconds;
+    printf("lines: %u, blocks: %llu, simulated time: %1.4f s (%llu ticks at %lu Hz)\n",
+           lines, (unsigned long long)sim->blocks, (double)sim_hal.ticks / kernel->base_stepping_frequency,
+           (unsigned long long)sim_hal.ticks, (unsigned long)kernel->base_stepping_frequency);
+    printf("queue: ran empty %lu times, %1.1f mm queued on average while moving\n", (unsigned long)THECONVEYOR->get_queue_empty_count(),
+           sim->queue_samples > 0 ? sim->queued_mm / sim->queue_samples : 0);
+    printf("junctions: speed change at most");
+    for (uint8_t m = 0; m < n_motors; ++m) printf(" %c %1.2f", THEROBOT->actuators[m]->is_extruder() ? 'E' : "XYZABC"[m], sim->max_speed_change[m]);
+    printf(" mm/s as issued,");
+    for (uint8_t m = 0; m < n_motors; ++m) printf(" %c %1.2f", THEROBOT->actuators[m]->is_extruder() ? 'E' : "XYZABC"[m], sim->max_planned_speed_change[m]);
+    printf(" mm/s planned, to a step\n");
+    printf("acceleration: at most %1.0f mm/s² of the first three actuators together, from their steps every 10ms\n", sim->max_acceleration);
+    printf("planning: %1.0f blocks/s (%1.3f s host time excluding step ticks)\n", plan_seconds > 0 ? sim->blocks / plan_seconds : 0, plan_seconds);
+#ifdef STEPTICKER_FIXED32
+    unsigned block_bytes = sizeof(Block);
+#else
+    unsigned block_bytes = sizeof(Block) + n_motors * sizeof(Block::tickinfo_t); // plus its separately allocated tick_info
+#endif
+    printf("memory: %u bytes per block, AHB0 free %lu, AHB1 free %lu\n", block_bytes, (unsigned long)AHB0.free(), (unsigned long)AHB1.free());
+    printf("step ticker: %llu active ticks, %1.1f %s/tick average, %llu max\n",
+           (unsigned long long)sim->active_ticks,
+           sim->active_ticks > 0 ? (double)sim->active_cycles / sim->active_ticks : 0,
+           HAVE_CYCLE_COUNTER ? "cycles" : "ns",
+           (unsigned long long)sim->max_cycles);
+    const GcodeDispatch::line_allocations_t& la = kernel->gcode_dispatch->get_line_allocations();
+    printf("heap allocations: %lu in %lu gcode lines, max %lu per line\n", (unsigned long)la.total, (unsigned long)la.lines, (unsigned long)la.max);
+    if(host_stream) {
+        double seconds = (double)sim_hal.ticks / kernel->base_stepping_frequency;
+        printf("stream: %llu bytes, %u lines and %u frames with %lu moves, %1.1f bytes per block, %1.0f blocks/s\n",
+               (unsigned long long)link.bytes, link.lines, link.frames, (unsigned long)kernel->gcode_dispatch->get_frame_moves(),
+               sim->blocks > 0 ? (double)link.bytes / sim->blocks : 0, seconds > 0 ? sim->blocks / seconds : 0);
+    }
+    if(net != nullptr) {
+        double seconds = (double)sim_hal.ticks / kernel->base_stepping_frequency;
+        printf("network: %llu bytes in %lu segments, stopped %lu times, %1.0f blocks/s\n", (unsigned long long)net->bytes,
+               (unsigned long)net->segments, (unsigned long)net->stops, seconds > 0 ? sim->blocks / seconds : 0);
+        if(host.verbose) fputs(net->replies.c_str(), stdout);
+    }
+    if(play_file) {
+        message.stream = &console;
+        message.message.assign("progress");
+        kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    }
+    if(trace_filename != nullptr) printf("trace: %llu edges written to %s\n", (unsigned long long)trace.get_count(), trace_filename);
+    if(laser_watch != nullptr) {
+        laser_watch->close();
+        printf("laser: %lu blocks, power off from the power for the speed by %1.3f%% on average, %1.2f%% at most\n",
+               (unsigned long)laser_watch->block_count, laser_watch->ticks > 0 ? laser_watch->error_sum * 100 / laser_watch->ticks : 0,
+               laser_watch->error_max * 100);
+        if(laser_watch->raster_ticks > 0) printf("raster: %llu ticks in pixels\n", (unsigned long long)laser_watch->raster_ticks);
+    }
+
+    if(probe_watch != nullptr) {
+        if(probe_watch->touching && probe_watch->touches > 0) probe_watch->done();
+        printf("probe: %lu touches of the bed at %ld steps, Z stopped at most %ld steps past the touch, %1.1f on average\n",
+               (unsigned long)probe_watch->touches, (long)probe_watch->bed_steps, (long)probe_watch->overshoot_max,
+               probe_watch->touches > 0 ? (double)probe_watch->overshoot_sum / probe_watch->touches : 0);
+    }
+
+    // the steps issued must have brought each actuator to where the planner thinks it is
+    int ret = kernel->is_halted() ? 1 : 0;
+    for (uint8_t m = 0; m < n_motors; ++m) {
+        StepperMotor *a = THEROBOT->actuators[m];
+        char name = a->is_extruder() ? 'E' : "XYZABC"[m];
+        printf("motor %c: %llu steps, position %ld steps\n", name, (unsigned long long)steps_issued[m], (long)a->get_current_step());
+        if(a->get_current_step() != a->get_last_milestone_steps()) {
+            printf("ERROR: motor %c ended at %ld steps, planned %ld steps\n", name, (long)a->get_current_step(), (long)a->get_last_milestone_steps());
+            ret = 1;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,184 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SimNetwork.h"
+#include "SimHal.h"
+#include "libs/Kernel.h"
+#include "libs/Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "CommandQueue.h"
+#include "gcodestream.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+extern "C" {
+#include "uip.h"
+}
+
+#define network_checksum                  CHECKSUM("network")
+#define network_command_batch_us_checksum CHECKSUM("command_batch_us")
+
+// uip.c keeps these to itself
+#define TCP_FIN 0x01
+#define TCP_SYN 0x02
+#define TCP_RST 0x04
+#define TCP_PSH 0x08
+#define TCP_ACK 0x10
+
+#define BUF ((struct uip_tcpip_hdr *)&uip_buf[UIP_LLH_LEN])
+
+// what Network.cpp and the ethernet driver give uIP on the board
+static u8_t sim_uip_buf[UIP_BUFSIZE + 2] __attribute__ ((aligned (4)));
+u8_t *uip_buf = sim_uip_buf;
+
+extern "C" void uip_log(char *m)
+{
+    fprintf(stderr, "uip: %s\n", m);
+}
+
+extern "C" void app_select_appcall(void)
+{
+    if(uip_conn->lport == HTONS(GcodeStream::PORT)) GcodeStream::appcall();
+}
+
+extern "C" void dhcpc_appcall(void) {}
+
+static void put32(u8_t *p, uint32_t v)
+{
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static uint32_t get32(const u8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+void SimNetwork::on_module_loaded()
+{
+    register_for_event(ON_MAIN_LOOP);
+    register_for_event(ON_IDLE);
+    command_batch_us = THEKERNEL->config->value(network_checksum, network_command_batch_us_checksum)->by_default(2000)->as_int();
+    command_q = CommandQueue::getInstance();
+
+    uip_init();
+    uip_ipaddr_t addr;
+    uip_ipaddr(addr, 192, 168, 3, 222);
+    uip_sethostaddr(addr);
+    uip_ipaddr(addr, 255, 255, 255, 0);
+    uip_setnetmask(addr);
+    GcodeStream::init();
+
+    // the host connects, the SYN then the ack of uIP's SYN
+    input(TCP_SYN, iss, 0);
+    if(connected) input(TCP_ACK, iss + 1, 0);
+}
+
+// issues the commands and polls a stopped connection like Network::on_main_loop
+void SimNetwork::on_main_loop(void *)
+{
+    command_q->pop_batch(command_batch_us);
+
+    if(!GcodeStream::has_room()) return;
+    for (struct uip_conn *connr = &uip_conns[0]; connr <= &uip_conns[UIP_CONNS - 1]; ++connr) {
+        if(connr->lport == HTONS(GcodeStream::PORT) && uip_stopped(connr)) {
+            uip_poll_conn(connr);
+            if(uip_len > 0) output();
+        }
+    }
+}
+
+void SimNetwork::on_idle(void *)
+{
+    if(!connected) return;
+
+    // the host puts the next segment on the wire when the window has room for it
+    if(pending_len == 0) {
+        pending_len = std::min<uint32_t>(std::min<uint32_t>(UIP_TCP_MSS, window), data.size() - acked);
+        if(pending_len > 0) pending_at = sim_hal.ticks + (rate == 0 ? 0 : (uint64_t)pending_len * sim_hal.tick_frequency / rate);
+    }
+
+    // one frame is received per main loop
+    if(pending_len > 0) {
+        if(sim_hal.ticks < pending_at) return;
+        uint16_t n = pending_len;
+        pending_len = 0;
+        ++segments;
+        input(TCP_ACK | TCP_PSH, iss + 1 + acked, n);
+    } else if(ack_due) {
+        input(TCP_ACK, iss + 1 + acked, 0);
+    }
+}
+
+bool SimNetwork::is_done() const
+{
+    return connected && acked == data.size() && command_q->size() == 0;
+}
+
+// a segment from the host to the board, the data is len bytes of the file from seq
+void SimNetwork::input(uint8_t flags, uint32_t seq, uint16_t len)
+{
+    memset(uip_buf, 0, UIP_LLH_LEN + UIP_TCPIP_HLEN);
+    struct uip_tcpip_hdr *h = BUF;
+    uint16_t ip_len = UIP_TCPIP_HLEN + len;
+    h->vhl = 0x45;
+    h->len[0] = ip_len >> 8;
+    h->len[1] = ip_len & 0xff;
+    h->ttl = 64;
+    h->proto = UIP_PROTO_TCP;
+    uip_ipaddr(h->srcipaddr, 192, 168, 3, 10);
+    uip_ipaddr_copy(h->destipaddr, uip_hostaddr);
+    h->srcport = HTONS(40000);
+    h->destport = HTONS(GcodeStream::PORT);
+    put32(h->seqno, seq);
+    put32(h->ackno, rcv_nxt);
+    h->tcpoffset = 5 << 4;
+    h->flags = (flags & TCP_SYN) ? flags : flags | TCP_ACK;
+    h->wnd[0] = 0xff;
+    h->wnd[1] = 0xff;
+    if(len > 0) memcpy(&uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN], data.data() + (seq - iss - 1), len);
+    h->ipchksum = ~(uip_ipchksum());
+    h->tcpchksum = ~(uip_tcpchksum());
+    uip_len = UIP_LLH_LEN + ip_len;
+    ack_due = false;
+
+    uip_input();
+    if(uip_len > 0) output();
+}
+
+// what uIP sends back, the window and how much of the file it has taken are in its ack
+void SimNetwork::output()
+{
+    struct uip_tcpip_hdr *h = BUF;
+    uip_len = 0;
+    if(h->proto != UIP_PROTO_TCP) return;
+    if(h->flags & TCP_RST) {
+        fprintf(stderr, "gcode stream: connection reset\n");
+        connected = false;
+        return;
+    }
+
+    uint16_t ip_len = (h->len[0] << 8) | h->len[1];
+    uint16_t offset = UIP_IPH_LEN + (h->tcpoffset >> 4) * 4;
+    uint16_t len = ip_len - offset;
+    if(len > 0) {
+        replies.append((const char *)&uip_buf[UIP_LLH_LEN + offset], len);
+        ack_due = true;
+    }
+    rcv_nxt = get32(h->seqno) + len + ((h->flags & (TCP_SYN | TCP_FIN)) ? 1 : 0);
+
+    if(h->flags & TCP_ACK) {
+        if(h->flags & TCP_SYN) connected = true;
+        else acked = get32(h->ackno) - iss - 1;
+        bytes = acked;
+        uint16_t w = (h->wnd[0] << 8) | h->wnd[1];
+        if(w == 0 && window > 0) ++stops;
+        window = w;
+    }
+}
@@ -0,0 +1,62 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "libs/Module.h"
+
+#include <stdint.h>
+#include <string>
+
+class CommandQueue;
+
+/*
+    The network side of the firmware for -n, the real uIP stack, CommandQueue and GcodeStream with the ethernet driver
+    replaced by a host that sends a file to the gcode stream port.
+
+    The host sends segments of the MSS as long as the window uIP advertised has room, a segment takes its bytes at the
+    link rate to arrive in simulated time and one is received per main loop like Network::on_idle does. Every segment is
+    taken in by uip_input() and the ack uIP answers with is what the host learns the window from, a stopped connection
+    advertises none until Network would poll it again.
+*/
+class SimNetwork : public Module {
+    public:
+        SimNetwork(const std::string& data, uint32_t rate) : data(data), rate(rate) {}
+
+        void on_module_loaded();
+        void on_main_loop(void *);
+        void on_idle(void *);
+
+        // all of the file has been taken in and issued
+        bool is_done() const;
+
+        uint64_t bytes{0};
+        uint32_t segments{0};
+        uint32_t stops{0};
+        std::string replies;
+
+    private:
+        void input(uint8_t flags, uint32_t seq, uint16_t len);
+        void output();
+
+        std::string data;
+        uint32_t rate;
+        CommandQueue *command_q;
+        uint32_t command_batch_us;
+
+        // the host side of the connection, offsets into data count from the first byte after the SYN
+        uint32_t iss{1000};
+        uint32_t acked{0};
+        uint32_t rcv_nxt{0};
+        uint16_t window{0};
+        bool connected{false};
+        bool ack_due{false};
+
+        // the segment on the wire and the tick its last byte arrives at, the link is busy until then
+        uint32_t pending_len{0};
+        uint64_t pending_at{0};
+};
@@ -0,0 +1,55 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StepTrace.h"
+
+StepTrace::StepTrace()
+{
+    fp = nullptr;
+    count = 0;
+}
+
+StepTrace::~StepTrace()
+{
+    close();
+}
+
+bool StepTrace::open(const char *filename, uint16_t n_motors, uint32_t tick_frequency)
+{
+    fp = fopen(filename, "wb");
+    if(fp == nullptr) return false;
+
+    uint16_t version = 1;
+    fwrite("SMST", 1, 4, fp);
+    fwrite(&version, sizeof(version), 1, fp);
+    fwrite(&n_motors, sizeof(n_motors), 1, fp);
+    fwrite(&tick_frequency, sizeof(tick_frequency), 1, fp);
+    return true;
+}
+
+void StepTrace::close()
+{
+    if(fp != nullptr) {
+        fclose(fp);
+        fp = nullptr;
+    }
+}
+
+void StepTrace::record(uint32_t tick, uint8_t motor, bool is_dir, bool level)
+{
+    ++count;
+    if(fp == nullptr) return;
+
+    uint8_t rec[6];
+    rec[0] = tick & 0xFF;
+    rec[1] = (tick >> 8) & 0xFF;
+    rec[2] = (tick >> 16) & 0xFF;
+    rec[3] = (tick >> 24) & 0xFF;
+    rec[4] = (motor << 1) | (is_dir ? 1 : 0);
+    rec[5] = level ? 1 : 0;
+    fwrite(rec, 1, sizeof(rec), fp);
+}
@@ -0,0 +1,38 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+    Writes a compact binary trace of every step and direction edge the simulated step ticker produces
+
+    File layout (little endian):
+        header: char magic[4] = "SMST", uint16_t version, uint16_t n_motors, uint32_t tick_frequency
+        records: uint32_t tick, uint8_t channel, uint8_t level   (6 bytes, packed)
+
+    channel is (motor << 1) | 0 for a step pulse and (motor << 1) | 1 for a direction change.
+    Only the leading edge of each step pulse is recorded (level 1), direction records carry the new
+    logical direction (1 is negative, as in Block::direction_bits).
+*/
+class StepTrace {
+    public:
+        StepTrace();
+        ~StepTrace();
+
+        bool open(const char *filename, uint16_t n_motors, uint32_t tick_frequency);
+        void close();
+        void record(uint32_t tick, uint8_t motor, bool is_dir, bool level);
+        bool is_open() const { return fp != nullptr; }
+        uint64_t get_count() const { return count; }
+
+    private:
+        FILE *fp;
+        uint64_t count;
+};
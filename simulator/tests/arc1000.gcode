@@ -0,0 +1,1006 @@
+; 1000 segment arc, a quarter circle of radius 10mm as 0.016mm G1 segments like a CAM post processor can produce
+G21
+G90
+G92 X0 Y0 Z0
+G1 X10 Y0 F6000
+G1 X10.0000 Y0.0157
+G1 X10.0000 Y0.0314
+G1 X9.9999 Y0.0471
+G1 X9.9998 Y0.0628
+G1 X9.9997 Y0.0785
+G1 X9.9996 Y0.0942
+G1 X9.9994 Y0.1100
+G1 X9.9992 Y0.1257
+G1 X9.9990 Y0.1414
+G1 X9.9988 Y0.1571
+G1 X9.9985 Y0.1728
+G1 X9.9982 Y0.1885
+G1 X9.9979 Y0.2042
+G1 X9.9976 Y0.2199
+G1 X9.9972 Y0.2356
+G1 X9.9968 Y0.2513
+G1 X9.9964 Y0.2670
+G1 X9.9960 Y0.2827
+G1 X9.9955 Y0.2984
+G1 X9.9951 Y0.3141
+G1 X9.9946 Y0.3298
+G1 X9.9940 Y0.3455
+G1 X9.9935 Y0.3612
+G1 X9.9929 Y0.3769
+G1 X9.9923 Y0.3926
+G1 X9.9917 Y0.4083
+G1 X9.9910 Y0.4240
+G1 X9.9903 Y0.4397
+G1 X9.9896 Y0.4554
+G1 X9.9889 Y0.4711
+G1 X9.9881 Y0.4868
+G1 X9.9874 Y0.5024
+G1 X9.9866 Y0.5181
+G1 X9.9857 Y0.5338
+G1 X9.9849 Y0.5495
+G1 X9.9840 Y0.5652
+G1 X9.9831 Y0.5809
+G1 X9.9822 Y0.5965
+G1 X9.9812 Y0.6122
+G1 X9.9803 Y0.6279
+G1 X9.9793 Y0.6436
+G1 X9.9782 Y0.6593
+G1 X9.9772 Y0.6749
+G1 X9.9761 Y0.6906
+G1 X9.9750 Y0.7063
+G1 X9.9739 Y0.7219
+G1 X9.9728 Y0.7376
+G1 X9.9716 Y0.7533
+G1 X9.9704 Y0.7689
+G1 X9.9692 Y0.7846
+G1 X9.9679 Y0.8002
+G1 X9.9667 Y0.8159
+G1 X9.9654 Y0.8316
+G1 X9.9640 Y0.8472
+G1 X9.9627 Y0.8629
+G1 X9.9613 Y0.8785
+G1 X9.9599 Y0.8942
+G1 X9.9585 Y0.9098
+G1 X9.9571 Y0.9254
+G1 X9.9556 Y0.9411
+G1 X9.9541 Y0.9567
+G1 X9.9526 Y0.9724
+G1 X9.9511 Y0.9880
+G1 X9.9495 Y1.0036
+G1 X9.9479 Y1.0192
+G1 X9.9463 Y1.0349
+G1 X9.9447 Y1.0505
+G1 X9.9430 Y1.0661
+G1 X9.9413 Y1.0817
+G1 X9.9396 Y1.0973
+G1 X9.9379 Y1.1130
+G1 X9.9361 Y1.1286
+G1 X9.9343 Y1.1442
+G1 X9.9325 Y1.1598
+G1 X9.9307 Y1.1754
+G1 X9.9288 Y1.1910
+G1 X9.9269 Y1.2066
+G1 X9.9250 Y1.2222
+G1 X9.9231 Y1.2377
+G1 X9.9211 Y1.2533
+G1 X9.9192 Y1.2689
+G1 X9.9172 Y1.2845
+G1 X9.9151 Y1.3001
+G1 X9.9131 Y1.3156
+G1 X9.9110 Y1.3312
+G1 X9.9089 Y1.3468
+G1 X9.9068 Y1.3623
+G1 X9.9046 Y1.3779
+G1 X9.9024 Y1.3935
+G1 X9.9002 Y1.4090
+G1 X9.8980 Y1.4246
+G1 X9.8958 Y1.4401
+G1 X9.8935 Y1.4557
+G1 X9.8912 Y1.4712
+G1 X9.8889 Y1.4867
+G1 X9.8865 Y1.5023
+G1 X9.8841 Y1.5178
+G1 X9.8817 Y1.5333
+G1 X9.8793 Y1.5488
+G1 X9.8769 Y1.5643
+G1 X9.8744 Y1.5799
+G1 X9.8719 Y1.5954
+G1 X9.8694 Y1.6109
+G1 X9.8669 Y1.6264
+G1 X9.8643 Y1.6419
+G1 X9.8617 Y1.6574
+G1 X9.8591 Y1.6728
+G1 X9.8564 Y1.6883
+G1 X9.8538 Y1.7038
+G1 X9.8511 Y1.7193
+G1 X9.8484 Y1.7348
+G1 X9.8456 Y1.7502
+G1 X9.8429 Y1.7657
+G1 X9.8401 Y1.7812
+G1 X9.8373 Y1.7966
+G1 X9.8345 Y1.8121
+G1 X9.8316 Y1.8275
+G1 X9.8287 Y1.8429
+G1 X9.8258 Y1.8584
+G1 X9.8229 Y1.8738
+G1 X9.8199 Y1.8892
+G1 X9.8169 Y1.9047
+G1 X9.8139 Y1.9201
+G1 X9.8109 Y1.9355
+G1 X9.8079 Y1.9509
+G1 X9.8048 Y1.9663
+G1 X9.8017 Y1.9817
+G1 X9.7986 Y1.9971
+G1 X9.7954 Y2.0125
+G1 X9.7922 Y2.0279
+G1 X9.7890 Y2.0433
+G1 X9.7858 Y2.0586
+G1 X9.7826 Y2.0740
+G1 X9.7793 Y2.0894
+G1 X9.7760 Y2.1047
+G1 X9.7727 Y2.1201
+G1 X9.7693 Y2.1354
+G1 X9.7660 Y2.1508
+G1 X9.7626 Y2.1661
+G1 X9.7592 Y2.1814
+G1 X9.7557 Y2.1968
+G1 X9.7523 Y2.2121
+G1 X9.7488 Y2.2274
+G1 X9.7453 Y2.2427
+G1 X9.7417 Y2.2580
+G1 X9.7382 Y2.2733
+G1 X9.7346 Y2.2886
+G1 X9.7310 Y2.3039
+G1 X9.7274 Y2.3192
+G1 X9.7237 Y2.3345
+G1 X9.7200 Y2.3497
+G1 X9.7163 Y2.3650
+G1 X9.7126 Y2.3802
+G1 X9.7088 Y2.3955
+G1 X9.7051 Y2.4108
+G1 X9.7013 Y2.4260
+G1 X9.6974 Y2.4412
+G1 X9.6936 Y2.4565
+G1 X9.6897 Y2.4717
+G1 X9.6858 Y2.4869
+G1 X9.6819 Y2.5021
+G1 X9.6780 Y2.5173
+G1 X9.6740 Y2.5325
+G1 X9.6700 Y2.5477
+G1 X9.6660 Y2.5629
+G1 X9.6620 Y2.5781
+G1 X9.6579 Y2.5932
+G1 X9.6538 Y2.6084
+G1 X9.6497 Y2.6236
+G1 X9.6456 Y2.6387
+G1 X9.6414 Y2.6539
+G1 X9.6372 Y2.6690
+G1 X9.6330 Y2.6842
+G1 X9.6288 Y2.6993
+G1 X9.6246 Y2.7144
+G1 X9.6203 Y2.7295
+G1 X9.6160 Y2.7446
+G1 X9.6117 Y2.7597
+G1 X9.6073 Y2.7748
+G1 X9.6029 Y2.7899
+G1 X9.5985 Y2.8050
+G1 X9.5941 Y2.8201
+G1 X9.5897 Y2.8351
+G1 X9.5852 Y2.8502
+G1 X9.5807 Y2.8652
+G1 X9.5762 Y2.8803
+G1 X9.5717 Y2.8953
+G1 X9.5671 Y2.9104
+G1 X9.5625 Y2.9254
+G1 X9.5579 Y2.9404
+G1 X9.5533 Y2.9554
+G1 X9.5486 Y2.9704
+G1 X9.5440 Y2.9854
+G1 X9.5393 Y3.0004
+G1 X9.5345 Y3.0154
+G1 X9.5298 Y3.0304
+G1 X9.5250 Y3.0453
+G1 X9.5202 Y3.0603
+G1 X9.5154 Y3.0752
+G1 X9.5106 Y3.0902
+G1 X9.5057 Y3.1051
+G1 X9.5008 Y3.1200
+G1 X9.4959 Y3.1350
+G1 X9.4910 Y3.1499
+G1 X9.4860 Y3.1648
+G1 X9.4810 Y3.1797
+G1 X9.4760 Y3.1946
+G1 X9.4710 Y3.2094
+G1 X9.4659 Y3.2243
+G1 X9.4609 Y3.2392
+G1 X9.4558 Y3.2540
+G1 X9.4506 Y3.2689
+G1 X9.4455 Y3.2837
+G1 X9.4403 Y3.2986
+G1 X9.4351 Y3.3134
+G1 X9.4299 Y3.3282
+G1 X9.4247 Y3.3430
+G1 X9.4194 Y3.3578
+G1 X9.4141 Y3.3726
+G1 X9.4088 Y3.3874
+G1 X9.4035 Y3.4022
+G1 X9.3981 Y3.4169
+G1 X9.3927 Y3.4317
+G1 X9.3873 Y3.4464
+G1 X9.3819 Y3.4612
+G1 X9.3765 Y3.4759
+G1 X9.3710 Y3.4906
+G1 X9.3655 Y3.5053
+G1 X9.3600 Y3.5201
+G1 X9.3544 Y3.5347
+G1 X9.3489 Y3.5494
+G1 X9.3433 Y3.5641
+G1 X9.3377 Y3.5788
+G1 X9.3320 Y3.5935
+G1 X9.3264 Y3.6081
+G1 X9.3207 Y3.6228
+G1 X9.3150 Y3.6374
+G1 X9.3093 Y3.6520
+G1 X9.3035 Y3.6666
+G1 X9.2978 Y3.6812
+G1 X9.2920 Y3.6958
+G1 X9.2862 Y3.7104
+G1 X9.2803 Y3.7250
+G1 X9.2745 Y3.7396
+G1 X9.2686 Y3.7542
+G1 X9.2627 Y3.7687
+G1 X9.2567 Y3.7833
+G1 X9.2508 Y3.7978
+G1 X9.2448 Y3.8123
+G1 X9.2388 Y3.8268
+G1 X9.2328 Y3.8413
+G1 X9.2267 Y3.8558
+G1 X9.2207 Y3.8703
+G1 X9.2146 Y3.8848
+G1 X9.2085 Y3.8993
+G1 X9.2023 Y3.9137
+G1 X9.1962 Y3.9282
+G1 X9.1900 Y3.9426
+G1 X9.1838 Y3.9571
+G1 X9.1775 Y3.9715
+G1 X9.1713 Y3.9859
+G1 X9.1650 Y4.0003
+G1 X9.1587 Y4.0147
+G1 X9.1524 Y4.0291
+G1 X9.1461 Y4.0434
+G1 X9.1397 Y4.0578
+G1 X9.1333 Y4.0721
+G1 X9.1269 Y4.0865
+G1 X9.1205 Y4.1008
+G1 X9.1140 Y4.1151
+G1 X9.1076 Y4.1295
+G1 X9.1011 Y4.1438
+G1 X9.0945 Y4.1580
+G1 X9.0880 Y4.1723
+G1 X9.0814 Y4.1866
+G1 X9.0748 Y4.2009
+G1 X9.0682 Y4.2151
+G1 X9.0616 Y4.2293
+G1 X9.0549 Y4.2436
+G1 X9.0483 Y4.2578
+G1 X9.0416 Y4.2720
+G1 X9.0348 Y4.2862
+G1 X9.0281 Y4.3004
+G1 X9.0213 Y4.3146
+G1 X9.0146 Y4.3287
+G1 X9.0077 Y4.3429
+G1 X9.0009 Y4.3570
+G1 X8.9941 Y4.3712
+G1 X8.9872 Y4.3853
+G1 X8.9803 Y4.3994
+G1 X8.9734 Y4.4135
+G1 X8.9664 Y4.4276
+G1 X8.9594 Y4.4417
+G1 X8.9525 Y4.4557
+G1 X8.9454 Y4.4698
+G1 X8.9384 Y4.4838
+G1 X8.9314 Y4.4979
+G1 X8.9243 Y4.5119
+G1 X8.9172 Y4.5259
+G1 X8.9101 Y4.5399
+G1 X8.9029 Y4.5539
+G1 X8.8958 Y4.5679
+G1 X8.8886 Y4.5818
+G1 X8.8814 Y4.5958
+G1 X8.8741 Y4.6097
+G1 X8.8669 Y4.6237
+G1 X8.8596 Y4.6376
+G1 X8.8523 Y4.6515
+G1 X8.8450 Y4.6654
+G1 X8.8377 Y4.6793
+G1 X8.8303 Y4.6932
+G1 X8.8229 Y4.7070
+G1 X8.8155 Y4.7209
+G1 X8.8081 Y4.7347
+G1 X8.8006 Y4.7486
+G1 X8.7932 Y4.7624
+G1 X8.7857 Y4.7762
+G1 X8.7782 Y4.7900
+G1 X8.7706 Y4.8038
+G1 X8.7631 Y4.8175
+G1 X8.7555 Y4.8313
+G1 X8.7479 Y4.8450
+G1 X8.7403 Y4.8588
+G1 X8.7326 Y4.8725
+G1 X8.7250 Y4.8862
+G1 X8.7173 Y4.8999
+G1 X8.7096 Y4.9136
+G1 X8.7018 Y4.9273
+G1 X8.6941 Y4.9409
+G1 X8.6863 Y4.9546
+G1 X8.6785 Y4.9682
+G1 X8.6707 Y4.9819
+G1 X8.6629 Y4.9955
+G1 X8.6550 Y5.0091
+G1 X8.6471 Y5.0227
+G1 X8.6392 Y5.0362
+G1 X8.6313 Y5.0498
+G1 X8.6234 Y5.0633
+G1 X8.6154 Y5.0769
+G1 X8.6074 Y5.0904
+G1 X8.5994 Y5.1039
+G1 X8.5914 Y5.1174
+G1 X8.5833 Y5.1309
+G1 X8.5753 Y5.1444
+G1 X8.5672 Y5.1579
+G1 X8.5591 Y5.1713
+G1 X8.5509 Y5.1847
+G1 X8.5428 Y5.1982
+G1 X8.5346 Y5.2116
+G1 X8.5264 Y5.2250
+G1 X8.5182 Y5.2384
+G1 X8.5099 Y5.2517
+G1 X8.5017 Y5.2651
+G1 X8.4934 Y5.2785
+G1 X8.4851 Y5.2918
+G1 X8.4768 Y5.3051
+G1 X8.4684 Y5.3184
+G1 X8.4601 Y5.3317
+G1 X8.4517 Y5.3450
+G1 X8.4433 Y5.3583
+G1 X8.4349 Y5.3715
+G1 X8.4264 Y5.3848
+G1 X8.4179 Y5.3980
+G1 X8.4094 Y5.4112
+G1 X8.4009 Y5.4244
+G1 X8.3924 Y5.4376
+G1 X8.3839 Y5.4508
+G1 X8.3753 Y5.4639
+G1 X8.3667 Y5.4771
+G1 X8.3581 Y5.4902
+G1 X8.3494 Y5.5034
+G1 X8.3408 Y5.5165
+G1 X8.3321 Y5.5296
+G1 X8.3234 Y5.5426
+G1 X8.3147 Y5.5557
+G1 X8.3060 Y5.5688
+G1 X8.2972 Y5.5818
+G1 X8.2884 Y5.5948
+G1 X8.2796 Y5.6078
+G1 X8.2708 Y5.6208
+G1 X8.2620 Y5.6338
+G1 X8.2531 Y5.6468
+G1 X8.2442 Y5.6597
+G1 X8.2353 Y5.6727
+G1 X8.2264 Y5.6856
+G1 X8.2175 Y5.6985
+G1 X8.2085 Y5.7114
+G1 X8.1995 Y5.7243
+G1 X8.1905 Y5.7372
+G1 X8.1815 Y5.7501
+G1 X8.1725 Y5.7629
+G1 X8.1634 Y5.7757
+G1 X8.1543 Y5.7885
+G1 X8.1452 Y5.8013
+G1 X8.1361 Y5.8141
+G1 X8.1269 Y5.8269
+G1 X8.1178 Y5.8397
+G1 X8.1086 Y5.8524
+G1 X8.0994 Y5.8651
+G1 X8.0902 Y5.8779
+G1 X8.0809 Y5.8906
+G1 X8.0717 Y5.9032
+G1 X8.0624 Y5.9159
+G1 X8.0531 Y5.9286
+G1 X8.0438 Y5.9412
+G1 X8.0344 Y5.9538
+G1 X8.0251 Y5.9665
+G1 X8.0157 Y5.9790
+G1 X8.0063 Y5.9916
+G1 X7.9968 Y6.0042
+G1 X7.9874 Y6.0168
+G1 X7.9779 Y6.0293
+G1 X7.9685 Y6.0418
+G1 X7.9590 Y6.0543
+G1 X7.9494 Y6.0668
+G1 X7.9399 Y6.0793
+G1 X7.9303 Y6.0918
+G1 X7.9208 Y6.1042
+G1 X7.9112 Y6.1167
+G1 X7.9016 Y6.1291
+G1 X7.8919 Y6.1415
+G1 X7.8823 Y6.1539
+G1 X7.8726 Y6.1662
+G1 X7.8629 Y6.1786
+G1 X7.8532 Y6.1909
+G1 X7.8434 Y6.2033
+G1 X7.8337 Y6.2156
+G1 X7.8239 Y6.2279
+G1 X7.8141 Y6.2402
+G1 X7.8043 Y6.2524
+G1 X7.7945 Y6.2647
+G1 X7.7846 Y6.2769
+G1 X7.7748 Y6.2891
+G1 X7.7649 Y6.3013
+G1 X7.7550 Y6.3135
+G1 X7.7450 Y6.3257
+G1 X7.7351 Y6.3379
+G1 X7.7251 Y6.3500
+G1 X7.7151 Y6.3621
+G1 X7.7051 Y6.3742
+G1 X7.6951 Y6.3863
+G1 X7.6851 Y6.3984
+G1 X7.6750 Y6.4105
+G1 X7.6649 Y6.4225
+G1 X7.6548 Y6.4346
+G1 X7.6447 Y6.4466
+G1 X7.6346 Y6.4586
+G1 X7.6244 Y6.4706
+G1 X7.6143 Y6.4825
+G1 X7.6041 Y6.4945
+G1 X7.5938 Y6.5064
+G1 X7.5836 Y6.5183
+G1 X7.5734 Y6.5302
+G1 X7.5631 Y6.5421
+G1 X7.5528 Y6.5540
+G1 X7.5425 Y6.5659
+G1 X7.5322 Y6.5777
+G1 X7.5218 Y6.5895
+G1 X7.5115 Y6.6013
+G1 X7.5011 Y6.6131
+G1 X7.4907 Y6.6249
+G1 X7.4803 Y6.6367
+G1 X7.4699 Y6.6484
+G1 X7.4594 Y6.6601
+G1 X7.4489 Y6.6718
+G1 X7.4385 Y6.6835
+G1 X7.4279 Y6.6952
+G1 X7.4174 Y6.7069
+G1 X7.4069 Y6.7185
+G1 X7.3963 Y6.7301
+G1 X7.3857 Y6.7417
+G1 X7.3751 Y6.7533
+G1 X7.3645 Y6.7649
+G1 X7.3539 Y6.7765
+G1 X7.3432 Y6.7880
+G1 X7.3326 Y6.7995
+G1 X7.3219 Y6.8110
+G1 X7.3112 Y6.8225
+G1 X7.3004 Y6.8340
+G1 X7.2897 Y6.8455
+G1 X7.2789 Y6.8569
+G1 X7.2681 Y6.8683
+G1 X7.2573 Y6.8797
+G1 X7.2465 Y6.8911
+G1 X7.2357 Y6.9025
+G1 X7.2248 Y6.9139
+G1 X7.2140 Y6.9252
+G1 X7.2031 Y6.9365
+G1 X7.1922 Y6.9478
+G1 X7.1813 Y6.9591
+G1 X7.1703 Y6.9704
+G1 X7.1594 Y6.9817
+G1 X7.1484 Y6.9929
+G1 X7.1374 Y7.0041
+G1 X7.1264 Y7.0153
+G1 X7.1154 Y7.0265
+G1 X7.1043 Y7.0377
+G1 X7.0932 Y7.0488
+G1 X7.0822 Y7.0600
+G1 X7.0711 Y7.0711
+G1 X7.0600 Y7.0822
+G1 X7.0488 Y7.0932
+G1 X7.0377 Y7.1043
+G1 X7.0265 Y7.1154
+G1 X7.0153 Y7.1264
+G1 X7.0041 Y7.1374
+G1 X6.9929 Y7.1484
+G1 X6.9817 Y7.1594
+G1 X6.9704 Y7.1703
+G1 X6.9591 Y7.1813
+G1 X6.9478 Y7.1922
+G1 X6.9365 Y7.2031
+G1 X6.9252 Y7.2140
+G1 X6.9139 Y7.2248
+G1 X6.9025 Y7.2357
+G1 X6.8911 Y7.2465
+G1 X6.8797 Y7.2573
+G1 X6.8683 Y7.2681
+G1 X6.8569 Y7.2789
+G1 X6.8455 Y7.2897
+G1 X6.8340 Y7.3004
+G1 X6.8225 Y7.3112
+G1 X6.8110 Y7.3219
+G1 X6.7995 Y7.3326
+G1 X6.7880 Y7.3432
+G1 X6.7765 Y7.3539
+G1 X6.7649 Y7.3645
+G1 X6.7533 Y7.3751
+G1 X6.7417 Y7.3857
+G1 X6.7301 Y7.3963
+G1 X6.7185 Y7.4069
+G1 X6.7069 Y7.4174
+G1 X6.6952 Y7.4279
+G1 X6.6835 Y7.4385
+G1 X6.6718 Y7.4489
+G1 X6.6601 Y7.4594
+G1 X6.6484 Y7.4699
+G1 X6.6367 Y7.4803
+G1 X6.6249 Y7.4907
+G1 X6.6131 Y7.5011
+G1 X6.6013 Y7.5115
+G1 X6.5895 Y7.5218
+G1 X6.5777 Y7.5322
+G1 X6.5659 Y7.5425
+G1 X6.5540 Y7.5528
+G1 X6.5421 Y7.5631
+G1 X6.5302 Y7.5734
+G1 X6.5183 Y7.5836
+G1 X6.5064 Y7.5938
+G1 X6.4945 Y7.6041
+G1 X6.4825 Y7.6143
+G1 X6.4706 Y7.6244
+G1 X6.4586 Y7.6346
+G1 X6.4466 Y7.6447
+G1 X6.4346 Y7.6548
+G1 X6.4225 Y7.6649
+G1 X6.4105 Y7.6750
+G1 X6.3984 Y7.6851
+G1 X6.3863 Y7.6951
+G1 X6.3742 Y7.7051
+G1 X6.3621 Y7.7151
+G1 X6.3500 Y7.7251
+G1 X6.3379 Y7.7351
+G1 X6.3257 Y7.7450
+G1 X6.3135 Y7.7550
+G1 X6.3013 Y7.7649
+G1 X6.2891 Y7.7748
+G1 X6.2769 Y7.7846
+G1 X6.2647 Y7.7945
+G1 X6.2524 Y7.8043
+G1 X6.2402 Y7.8141
+G1 X6.2279 Y7.8239
+G1 X6.2156 Y7.8337
+G1 X6.2033 Y7.8434
+G1 X6.1909 Y7.8532
+G1 X6.1786 Y7.8629
+G1 X6.1662 Y7.8726
+G1 X6.1539 Y7.8823
+G1 X6.1415 Y7.8919
+G1 X6.1291 Y7.9016
+G1 X6.1167 Y7.9112
+G1 X6.1042 Y7.9208
+G1 X6.0918 Y7.9303
+G1 X6.0793 Y7.9399
+G1 X6.0668 Y7.9494
+G1 X6.0543 Y7.9590
+G1 X6.0418 Y7.9685
+G1 X6.0293 Y7.9779
+G1 X6.0168 Y7.9874
+G1 X6.0042 Y7.9968
+G1 X5.9916 Y8.0063
+G1 X5.9790 Y8.0157
+G1 X5.9665 Y8.0251
+G1 X5.9538 Y8.0344
+G1 X5.9412 Y8.0438
+G1 X5.9286 Y8.0531
+G1 X5.9159 Y8.0624
+G1 X5.9032 Y8.0717
+G1 X5.8906 Y8.0809
+G1 X5.8779 Y8.0902
+G1 X5.8651 Y8.0994
+G1 X5.8524 Y8.1086
+G1 X5.8397 Y8.1178
+G1 X5.8269 Y8.1269
+G1 X5.8141 Y8.1361
+G1 X5.8013 Y8.1452
+G1 X5.7885 Y8.1543
+G1 X5.7757 Y8.1634
+G1 X5.7629 Y8.1725
+G1 X5.7501 Y8.1815
+G1 X5.7372 Y8.1905
+G1 X5.7243 Y8.1995
+G1 X5.7114 Y8.2085
+G1 X5.6985 Y8.2175
+G1 X5.6856 Y8.2264
+G1 X5.6727 Y8.2353
+G1 X5.6597 Y8.2442
+G1 X5.6468 Y8.2531
+G1 X5.6338 Y8.2620
+G1 X5.6208 Y8.2708
+G1 X5.6078 Y8.2796
+G1 X5.5948 Y8.2884
+G1 X5.5818 Y8.2972
+G1 X5.5688 Y8.3060
+G1 X5.5557 Y8.3147
+G1 X5.5426 Y8.3234
+G1 X5.5296 Y8.3321
+G1 X5.5165 Y8.3408
+G1 X5.5034 Y8.3494
+G1 X5.4902 Y8.3581
+G1 X5.4771 Y8.3667
+G1 X5.4639 Y8.3753
+G1 X5.4508 Y8.3839
+G1 X5.4376 Y8.3924
+G1 X5.4244 Y8.4009
+G1 X5.4112 Y8.4094
+G1 X5.3980 Y8.4179
+G1 X5.3848 Y8.4264
+G1 X5.3715 Y8.4349
+G1 X5.3583 Y8.4433
+G1 X5.3450 Y8.4517
+G1 X5.3317 Y8.4601
+G1 X5.3184 Y8.4684
+G1 X5.3051 Y8.4768
+G1 X5.2918 Y8.4851
+G1 X5.2785 Y8.4934
+G1 X5.2651 Y8.5017
+G1 X5.2517 Y8.5099
+G1 X5.2384 Y8.5182
+G1 X5.2250 Y8.5264
+G1 X5.2116 Y8.5346
+G1 X5.1982 Y8.5428
+G1 X5.1847 Y8.5509
+G1 X5.1713 Y8.5591
+G1 X5.1579 Y8.5672
+G1 X5.1444 Y8.5753
+G1 X5.1309 Y8.5833
+G1 X5.1174 Y8.5914
+G1 X5.1039 Y8.5994
+G1 X5.0904 Y8.6074
+G1 X5.0769 Y8.6154
+G1 X5.0633 Y8.6234
+G1 X5.0498 Y8.6313
+G1 X5.0362 Y8.6392
+G1 X5.0227 Y8.6471
+G1 X5.0091 Y8.6550
+G1 X4.9955 Y8.6629
+G1 X4.9819 Y8.6707
+G1 X4.9682 Y8.6785
+G1 X4.9546 Y8.6863
+G1 X4.9409 Y8.6941
+G1 X4.9273 Y8.7018
+G1 X4.9136 Y8.7096
+G1 X4.8999 Y8.7173
+G1 X4.8862 Y8.7250
+G1 X4.8725 Y8.7326
+G1 X4.8588 Y8.7403
+G1 X4.8450 Y8.7479
+G1 X4.8313 Y8.7555
+G1 X4.8175 Y8.7631
+G1 X4.8038 Y8.7706
+G1 X4.7900 Y8.7782
+G1 X4.7762 Y8.7857
+G1 X4.7624 Y8.7932
+G1 X4.7486 Y8.8006
+G1 X4.7347 Y8.8081
+G1 X4.7209 Y8.8155
+G1 X4.7070 Y8.8229
+G1 X4.6932 Y8.8303
+G1 X4.6793 Y8.8377
+G1 X4.6654 Y8.8450
+G1 X4.6515 Y8.8523
+G1 X4.6376 Y8.8596
+G1 X4.6237 Y8.8669
+G1 X4.6097 Y8.8741
+G1 X4.5958 Y8.8814
+G1 X4.5818 Y8.8886
+G1 X4.5679 Y8.8958
+G1 X4.5539 Y8.9029
+G1 X4.5399 Y8.9101
+G1 X4.5259 Y8.9172
+G1 X4.5119 Y8.9243
+G1 X4.4979 Y8.9314
+G1 X4.4838 Y8.9384
+G1 X4.4698 Y8.9454
+G1 X4.4557 Y8.9525
+G1 X4.4417 Y8.9594
+G1 X4.4276 Y8.9664
+G1 X4.4135 Y8.9734
+G1 X4.3994 Y8.9803
+G1 X4.3853 Y8.9872
+G1 X4.3712 Y8.9941
+G1 X4.3570 Y9.0009
+G1 X4.3429 Y9.0077
+G1 X4.3287 Y9.0146
+G1 X4.3146 Y9.0213
+G1 X4.3004 Y9.0281
+G1 X4.2862 Y9.0348
+G1 X4.2720 Y9.0416
+G1 X4.2578 Y9.0483
+G1 X4.2436 Y9.0549
+G1 X4.2293 Y9.0616
+G1 X4.2151 Y9.0682
+G1 X4.2009 Y9.0748
+G1 X4.1866 Y9.0814
+G1 X4.1723 Y9.0880
+G1 X4.1580 Y9.0945
+G1 X4.1438 Y9.1011
+G1 X4.1295 Y9.1076
+G1 X4.1151 Y9.1140
+G1 X4.1008 Y9.1205
+G1 X4.0865 Y9.1269
+G1 X4.0721 Y9.1333
+G1 X4.0578 Y9.1397
+G1 X4.0434 Y9.1461
+G1 X4.0291 Y9.1524
+G1 X4.0147 Y9.1587
+G1 X4.0003 Y9.1650
+G1 X3.9859 Y9.1713
+G1 X3.9715 Y9.1775
+G1 X3.9571 Y9.1838
+G1 X3.9426 Y9.1900
+G1 X3.9282 Y9.1962
+G1 X3.9137 Y9.2023
+G1 X3.8993 Y9.2085
+G1 X3.8848 Y9.2146
+G1 X3.8703 Y9.2207
+G1 X3.8558 Y9.2267
+G1 X3.8413 Y9.2328
+G1 X3.8268 Y9.2388
+G1 X3.8123 Y9.2448
+G1 X3.7978 Y9.2508
+G1 X3.7833 Y9.2567
+G1 X3.7687 Y9.2627
+G1 X3.7542 Y9.2686
+G1 X3.7396 Y9.2745
+G1 X3.7250 Y9.2803
+G1 X3.7104 Y9.2862
+G1 X3.6958 Y9.2920
+G1 X3.6812 Y9.2978
+G1 X3.6666 Y9.3035
+G1 X3.6520 Y9.3093
+G1 X3.6374 Y9.3150
+G1 X3.6228 Y9.3207
+G1 X3.6081 Y9.3264
+G1 X3.5935 Y9.3320
+G1 X3.5788 Y9.3377
+G1 X3.5641 Y9.3433
+G1 X3.5494 Y9.3489
+G1 X3.5347 Y9.3544
+G1 X3.5201 Y9.3600
+G1 X3.5053 Y9.3655
+G1 X3.4906 Y9.3710
+G1 X3.4759 Y9.3765
+G1 X3.4612 Y9.3819
+G1 X3.4464 Y9.3873
+G1 X3.4317 Y9.3927
+G1 X3.4169 Y9.3981
+G1 X3.4022 Y9.4035
+G1 X3.3874 Y9.4088
+G1 X3.3726 Y9.4141
+G1 X3.3578 Y9.4194
+G1 X3.3430 Y9.4247
+G1 X3.3282 Y9.4299
+G1 X3.3134 Y9.4351
+G1 X3.2986 Y9.4403
+G1 X3.2837 Y9.4455
+G1 X3.2689 Y9.4506
+G1 X3.2540 Y9.4558
+G1 X3.2392 Y9.4609
+G1 X3.2243 Y9.4659
+G1 X3.2094 Y9.4710
+G1 X3.1946 Y9.4760
+G1 X3.1797 Y9.4810
+G1 X3.1648 Y9.4860
+G1 X3.1499 Y9.4910
+G1 X3.1350 Y9.4959
+G1 X3.1200 Y9.5008
+G1 X3.1051 Y9.5057
+G1 X3.0902 Y9.5106
+G1 X3.0752 Y9.5154
+G1 X3.0603 Y9.5202
+G1 X3.0453 Y9.5250
+G1 X3.0304 Y9.5298
+G1 X3.0154 Y9.5345
+G1 X3.0004 Y9.5393
+G1 X2.9854 Y9.5440
+G1 X2.9704 Y9.5486
+G1 X2.9554 Y9.5533
+G1 X2.9404 Y9.5579
+G1 X2.9254 Y9.5625
+G1 X2.9104 Y9.5671
+G1 X2.8953 Y9.5717
+G1 X2.8803 Y9.5762
+G1 X2.8652 Y9.5807
+G1 X2.8502 Y9.5852
+G1 X2.8351 Y9.5897
+G1 X2.8201 Y9.5941
+G1 X2.8050 Y9.5985
+G1 X2.7899 Y9.6029
+G1 X2.7748 Y9.6073
+G1 X2.7597 Y9.6117
+G1 X2.7446 Y9.6160
+G1 X2.7295 Y9.6203
+G1 X2.7144 Y9.6246
+G1 X2.6993 Y9.6288
+G1 X2.6842 Y9.6330
+G1 X2.6690 Y9.6372
+G1 X2.6539 Y9.6414
+G1 X2.6387 Y9.6456
+G1 X2.6236 Y9.6497
+G1 X2.6084 Y9.6538
+G1 X2.5932 Y9.6579
+G1 X2.5781 Y9.6620
+G1 X2.5629 Y9.6660
+G1 X2.5477 Y9.6700
+G1 X2.5325 Y9.6740
+G1 X2.5173 Y9.6780
+G1 X2.5021 Y9.6819
+G1 X2.4869 Y9.6858
+G1 X2.4717 Y9.6897
+G1 X2.4565 Y9.6936
+G1 X2.4412 Y9.6974
+G1 X2.4260 Y9.7013
+G1 X2.4108 Y9.7051
+G1 X2.3955 Y9.7088
+G1 X2.3802 Y9.7126
+G1 X2.3650 Y9.7163
+G1 X2.3497 Y9.7200
+G1 X2.3345 Y9.7237
+G1 X2.3192 Y9.7274
+G1 X2.3039 Y9.7310
+G1 X2.2886 Y9.7346
+G1 X2.2733 Y9.7382
+G1 X2.2580 Y9.7417
+G1 X2.2427 Y9.7453
+G1 X2.2274 Y9.7488
+G1 X2.2121 Y9.7523
+G1 X2.1968 Y9.7557
+G1 X2.1814 Y9.7592
+G1 X2.1661 Y9.7626
+G1 X2.1508 Y9.7660
+G1 X2.1354 Y9.7693
+G1 X2.1201 Y9.7727
+G1 X2.1047 Y9.7760
+G1 X2.0894 Y9.7793
+G1 X2.0740 Y9.7826
+G1 X2.0586 Y9.7858
+G1 X2.0433 Y9.7890
+G1 X2.0279 Y9.7922
+G1 X2.0125 Y9.7954
+G1 X1.9971 Y9.7986
+G1 X1.9817 Y9.8017
+G1 X1.9663 Y9.8048
+G1 X1.9509 Y9.8079
+G1 X1.9355 Y9.8109
+G1 X1.9201 Y9.8139
+G1 X1.9047 Y9.8169
+G1 X1.8892 Y9.8199
+G1 X1.8738 Y9.8229
+G1 X1.8584 Y9.8258
+G1 X1.8429 Y9.8287
+G1 X1.8275 Y9.8316
+G1 X1.8121 Y9.8345
+G1 X1.7966 Y9.8373
+G1 X1.7812 Y9.8401
+G1 X1.7657 Y9.8429
+G1 X1.7502 Y9.8456
+G1 X1.7348 Y9.8484
+G1 X1.7193 Y9.8511
+G1 X1.7038 Y9.8538
+G1 X1.6883 Y9.8564
+G1 X1.6728 Y9.8591
+G1 X1.6574 Y9.8617
+G1 X1.6419 Y9.8643
+G1 X1.6264 Y9.8669
+G1 X1.6109 Y9.8694
+G1 X1.5954 Y9.8719
+G1 X1.5799 Y9.8744
+G1 X1.5643 Y9.8769
+G1 X1.5488 Y9.8793
+G1 X1.5333 Y9.8817
+G1 X1.5178 Y9.8841
+G1 X1.5023 Y9.8865
+G1 X1.4867 Y9.8889
+G1 X1.4712 Y9.8912
+G1 X1.4557 Y9.8935
+G1 X1.4401 Y9.8958
+G1 X1.4246 Y9.8980
+G1 X1.4090 Y9.9002
+G1 X1.3935 Y9.9024
+G1 X1.3779 Y9.9046
+G1 X1.3623 Y9.9068
+G1 X1.3468 Y9.9089
+G1 X1.3312 Y9.9110
+G1 X1.3156 Y9.9131
+G1 X1.3001 Y9.9151
+G1 X1.2845 Y9.9172
+G1 X1.2689 Y9.9192
+G1 X1.2533 Y9.9211
+G1 X1.2377 Y9.9231
+G1 X1.2222 Y9.9250
+G1 X1.2066 Y9.9269
+G1 X1.1910 Y9.9288
+G1 X1.1754 Y9.9307
+G1 X1.1598 Y9.9325
+G1 X1.1442 Y9.9343
+G1 X1.1286 Y9.9361
+G1 X1.1130 Y9.9379
+G1 X1.0973 Y9.9396
+G1 X1.0817 Y9.9413
+G1 X1.0661 Y9.9430
+G1 X1.0505 Y9.9447
+G1 X1.0349 Y9.9463
+G1 X1.0192 Y9.9479
+G1 X1.0036 Y9.9495
+G1 X0.9880 Y9.9511
+G1 X0.9724 Y9.9526
+G1 X0.9567 Y9.9541
+G1 X0.9411 Y9.9556
+G1 X0.9254 Y9.9571
+G1 X0.9098 Y9.9585
+G1 X0.8942 Y9.9599
+G1 X0.8785 Y9.9613
+G1 X0.8629 Y9.9627
+G1 X0.8472 Y9.9640
+G1 X0.8316 Y9.9654
+G1 X0.8159 Y9.9667
+G1 X0.8002 Y9.9679
+G1 X0.7846 Y9.9692
+G1 X0.7689 Y9.9704
+G1 X0.7533 Y9.9716
+G1 X0.7376 Y9.9728
+G1 X0.7219 Y9.9739
+G1 X0.7063 Y9.9750
+G1 X0.6906 Y9.9761
+G1 X0.6749 Y9.9772
+G1 X0.6593 Y9.9782
+G1 X0.6436 Y9.9793
+G1 X0.6279 Y9.9803
+G1 X0.6122 Y9.9812
+G1 X0.5965 Y9.9822
+G1 X0.5809 Y9.9831
+G1 X0.5652 Y9.9840
+G1 X0.5495 Y9.9849
+G1 X0.5338 Y9.9857
+G1 X0.5181 Y9.9866
+G1 X0.5024 Y9.9874
+G1 X0.4868 Y9.9881
+G1 X0.4711 Y9.9889
+G1 X0.4554 Y9.9896
+G1 X0.4397 Y9.9903
+G1 X0.4240 Y9.9910
+G1 X0.4083 Y9.9917
+G1 X0.3926 Y9.9923
+G1 X0.3769 Y9.9929
+G1 X0.3612 Y9.9935
+G1 X0.3455 Y9.9940
+G1 X0.3298 Y9.9946
+G1 X0.3141 Y9.9951
+G1 X0.2984 Y9.9955
+G1 X0.2827 Y9.9960
+G1 X0.2670 Y9.9964
+G1 X0.2513 Y9.9968
+G1 X0.2356 Y9.9972
+G1 X0.2199 Y9.9976
+G1 X0.2042 Y9.9979
+G1 X0.1885 Y9.9982
+G1 X0.1728 Y9.9985
+G1 X0.1571 Y9.9988
+G1 X0.1414 Y9.9990
+G1 X0.1257 Y9.9992
+G1 X0.1100 Y9.9994
+G1 X0.0942 Y9.9996
+G1 X0.0785 Y9.9997
+G1 X0.0628 Y9.9998
+G1 X0.0471 Y9.9999
+G1 X0.0314 Y10.0000
+G1 X0.0157 Y10.0000
+G1 X0.0000 Y10.0000
+G0 X0 Y0
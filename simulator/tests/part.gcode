@@ -0,0 +1,415 @@
+G21
+G90
+G0 Z1 F300
+G0 X10 Y10 F6000
+G1 Z0 F300
+G1 X60 Y10 F3000
+G1 X60 Y60
+G1 X10 Y60
+G1 X10 Y10
+G2 X10 Y10 I25 J0 F2400
+G0 Z2 F300
+G0 X35 Y35 F6000
+G1 Z0 F300
+G1 F2400
+G1 X35.059 Y35.012
+G1 X35.111 Y35.047
+G1 X35.149 Y35.102
+G1 X35.167 Y35.172
+G1 X35.162 Y35.252
+G1 X35.130 Y35.336
+G1 X35.071 Y35.414
+G1 X34.986 Y35.480
+G1 X34.877 Y35.526
+G1 X34.750 Y35.546
+G1 X34.612 Y35.534
+G1 X34.469 Y35.486
+G1 X34.332 Y35.402
+G1 X34.209 Y35.281
+G1 X34.109 Y35.127
+G1 X34.042 Y34.944
+G1 X34.014 Y34.739
+G1 X34.032 Y34.522
+G1 X34.098 Y34.302
+G1 X34.216 Y34.092
+G1 X34.382 Y33.902
+G1 X34.594 Y33.744
+G1 X34.845 Y33.629
+G1 X35.126 Y33.566
+G1 X35.425 Y33.562
+G1 X35.731 Y33.622
+G1 X36.028 Y33.748
+G1 X36.303 Y33.939
+G1 X36.541 Y34.192
+G1 X36.728 Y34.497
+G1 X36.854 Y34.845
+G1 X36.907 Y35.224
+G1 X36.881 Y35.617
+G1 X36.774 Y36.008
+G1 X36.583 Y36.380
+G1 X36.314 Y36.714
+G1 X35.974 Y36.995
+G1 X35.573 Y37.207
+G1 X35.126 Y37.337
+G1 X34.651 Y37.374
+G1 X34.166 Y37.314
+G1 X33.691 Y37.154
+G1 X33.249 Y36.895
+G1 X32.859 Y36.544
+G1 X32.540 Y36.113
+G1 X32.309 Y35.615
+G1 X32.181 Y35.070
+G1 X32.164 Y34.498
+G1 X32.265 Y33.923
+G1 X32.483 Y33.368
+G1 X32.814 Y32.858
+G1 X33.250 Y32.417
+G1 X33.775 Y32.066
+G1 X34.370 Y31.822
+G1 X35.015 Y31.700
+G1 X35.682 Y31.710
+G1 X36.346 Y31.856
+G1 X36.978 Y32.137
+G1 X37.550 Y32.545
+G1 X38.038 Y33.068
+G1 X38.417 Y33.689
+G1 X38.669 Y34.384
+G1 X38.778 Y35.127
+G1 X38.736 Y35.889
+G1 X38.539 Y36.639
+G1 X38.191 Y37.345
+G1 X37.702 Y37.976
+G1 X37.088 Y38.505
+G1 X36.370 Y38.907
+G1 X35.574 Y39.161
+G1 X34.733 Y39.252
+G1 X33.878 Y39.172
+G1 X33.044 Y38.919
+G1 X32.268 Y38.500
+G1 X31.581 Y37.926
+G1 X31.016 Y37.218
+G1 X30.597 Y36.400
+G1 X30.347 Y35.504
+G1 X30.280 Y34.564
+G1 X30.403 Y33.618
+G1 X30.717 Y32.704
+G1 X31.212 Y31.861
+G1 X31.873 Y31.124
+G1 X32.678 Y30.527
+G1 X33.597 Y30.097
+G1 X34.594 Y29.856
+G1 X35.631 Y29.818
+G1 X36.667 Y29.990
+G1 X37.659 Y30.369
+G1 X38.566 Y30.945
+G1 X39.348 Y31.698
+G1 X39.972 Y32.601
+G1 X40.407 Y33.622
+G1 X40.633 Y34.721
+G1 X40.636 Y35.854
+G1 X40.410 Y36.977
+G1 X39.960 Y38.044
+G1 X39.301 Y39.010
+G1 X38.453 Y39.833
+G1 X37.448 Y40.478
+G1 X36.325 Y40.913
+G1 X35.125 Y41.119
+G1 X33.896 Y41.081
+G1 X32.687 Y40.796
+G1 X31.549 Y40.271
+G1 X30.529 Y39.523
+G1 X29.669 Y38.578
+G1 X29.009 Y37.471
+G1 X28.579 Y36.243
+G1 X28.400 Y34.942
+G1 X28.485 Y33.619
+G1 X28.834 Y32.328
+G1 X29.438 Y31.122
+G1 X30.278 Y30.051
+G1 X31.323 Y29.161
+G1 X32.536 Y28.491
+G1 X33.868 Y28.072
+G1 X35.269 Y27.925
+G1 X36.684 Y28.061
+G1 X38.054 Y28.480
+G1 X39.324 Y29.168
+G1 X40.441 Y30.104
+G1 X41.357 Y31.252
+G1 X42.032 Y32.570
+G1 X42.434 Y34.007
+G1 X42.543 Y35.508
+G1 X42.349 Y37.012
+G1 X41.857 Y38.459
+G1 X41.080 Y39.790
+G1 X40.046 Y40.948
+G1 X38.793 Y41.884
+G1 X37.367 Y42.558
+G1 X35.825 Y42.937
+G1 X34.226 Y43.003
+G1 X32.634 Y42.747
+G1 X31.113 Y42.175
+G1 X29.727 Y41.306
+G1 X28.532 Y40.170
+G1 X27.581 Y38.809
+G1 X26.914 Y37.276
+G1 X26.563 Y35.628
+G1 X26.547 Y33.932
+G1 X26.871 Y32.255
+G1 X27.526 Y30.665
+G1 X28.492 Y29.226
+G1 X29.733 Y28.001
+G1 X31.202 Y27.039
+G1 X32.845 Y26.385
+G1 X34.597 Y26.069
+G1 X36.388 Y26.108
+G1 X38.148 Y26.505
+G1 X39.805 Y27.248
+G1 X41.290 Y28.314
+G1 X42.542 Y29.662
+G1 X43.507 Y31.242
+G1 X44.143 Y32.995
+G1 X44.419 Y34.850
+G1 X44.320 Y36.735
+G1 X43.845 Y38.575
+G1 X43.009 Y40.294
+G1 X41.840 Y41.822
+G1 X40.381 Y43.094
+G1 X38.689 Y44.058
+G1 X36.827 Y44.669
+G1 X34.869 Y44.899
+G1 X32.892 Y44.734
+G1 X30.976 Y44.176
+G1 X29.198 Y43.243
+G1 X27.633 Y41.967
+G1 X26.345 Y40.397
+G1 X25.389 Y38.591
+G1 X24.808 Y36.619
+G1 X24.629 Y34.559
+G1 X24.865 Y32.493
+G1 X25.511 Y30.504
+G1 X26.546 Y28.673
+G1 X27.931 Y27.074
+G1 X29.616 Y25.776
+G1 X31.537 Y24.834
+G1 X33.618 Y24.289
+G1 X35.778 Y24.168
+G1 X37.930 Y24.481
+G1 X39.989 Y25.219
+G1 X41.870 Y26.358
+G1 X43.496 Y27.857
+G1 X44.799 Y29.658
+G1 X45.722 Y31.694
+G1 X46.225 Y33.884
+G1 X46.282 Y36.142
+G1 X45.888 Y38.379
+G1 X45.052 Y40.503
+G1 X43.804 Y42.429
+G1 X42.190 Y44.077
+G1 X40.271 Y45.378
+G1 X38.120 Y46.276
+G1 X35.821 Y46.731
+G1 X33.467 Y46.720
+G1 X31.149 Y46.239
+G1 X28.963 Y45.301
+G1 X26.997 Y43.941
+G1 X25.332 Y42.209
+G1 X24.038 Y40.170
+G1 X23.171 Y37.904
+G1 X22.770 Y35.498
+G1 X22.856 Y33.049
+G1 X23.429 Y30.654
+G1 X24.472 Y28.410
+G1 X25.948 Y26.409
+G1 X27.801 Y24.732
+G1 X29.960 Y23.452
+G1 X32.342 Y22.622
+G1 X34.854 Y22.281
+G1 X37.395 Y22.446
+G1 X39.864 Y23.117
+G1 X42.161 Y24.270
+G1 X44.192 Y25.864
+G1 X45.874 Y27.840
+G1 X47.136 Y30.120
+G1 X47.922 Y32.618
+G1 X48.198 Y35.234
+G1 X47.947 Y37.864
+G1 X47.175 Y40.403
+G1 X45.908 Y42.749
+G1 X44.192 Y44.806
+G1 X42.092 Y46.487
+G1 X39.689 Y47.723
+G1 X37.077 Y48.461
+G1 X34.359 Y48.665
+G1 X31.642 Y48.323
+G1 X29.036 Y47.445
+G1 X26.646 Y46.060
+G1 X24.571 Y44.219
+G1 X22.895 Y41.994
+G1 X21.690 Y39.468
+G1 X21.008 Y36.742
+G1 X20.881 Y33.923
+G1 X21.319 Y31.123
+G1 X22.308 Y28.455
+G1 X23.815 Y26.027
+G1 X25.782 Y23.937
+G1 X28.135 Y22.273
+G1 X30.783 Y21.106
+G1 X33.622 Y20.485
+G1 X36.539 Y20.441
+G1 X39.419 Y20.980
+G1 X42.145 Y22.085
+G1 X44.607 Y23.716
+G1 X46.705 Y25.813
+G1 X48.350 Y28.294
+G1 X49.474 Y31.064
+G1 X50.028 Y34.015
+G1 X49.983 Y37.028
+G1 X49.339 Y39.984
+G1 X48.114 Y42.764
+G1 X46.355 Y45.255
+G1 X44.127 Y47.354
+G1 X41.516 Y48.976
+G1 X38.624 Y50.050
+G1 X35.564 Y50.530
+G1 X32.457 Y50.391
+G1 X29.429 Y49.636
+G1 X26.600 Y48.288
+G1 X24.086 Y46.397
+G1 X21.990 Y44.036
+G1 X20.399 Y41.295
+G1 X19.381 Y38.281
+G1 X18.980 Y35.113
+G1 X19.218 Y31.917
+G1 X20.090 Y28.820
+G1 X21.565 Y25.948
+G1 X23.589 Y23.416
+G1 X26.085 Y21.330
+G1 X28.957 Y19.776
+G1 X32.091 Y18.819
+G1 X35.365 Y18.504
+G1 X38.648 Y18.847
+G1 X41.809 Y19.839
+G1 X44.721 Y21.445
+G1 X47.264 Y23.606
+G1 X49.334 Y26.238
+G1 X50.846 Y29.240
+G1 X51.733 Y32.494
+G1 X51.958 Y35.871
+G1 X51.505 Y39.238
+G1 X50.388 Y42.458
+G1 X48.647 Y45.403
+G1 X46.348 Y47.952
+G1 X43.578 Y50.001
+G1 X40.446 Y51.463
+G1 X37.074 Y52.276
+G1 X33.595 Y52.403
+G1 X30.149 Y51.835
+G1 X26.874 Y50.589
+G1 X23.901 Y48.710
+G1 X21.352 Y46.270
+G1 X19.332 Y43.362
+G1 X17.925 Y40.100
+G1 X17.193 Y36.612
+G1 X17.168 Y33.035
+G1 X17.857 Y29.513
+G1 X19.236 Y26.188
+G1 X21.255 Y23.192
+G1 X23.838 Y20.650
+G1 X26.885 Y18.665
+G1 X30.277 Y17.320
+G1 X33.880 Y16.674
+G1 X37.551 Y16.758
+G1 X41.144 Y17.571
+G1 X44.515 Y19.088
+G1 X47.527 Y21.251
+G1 X50.057 Y23.979
+G1 X52.001 Y27.165
+G1 X53.277 Y30.685
+G1 X53.830 Y34.400
+G1 X53.633 Y38.163
+G1 X52.690 Y41.823
+G1 X51.032 Y45.234
+G1 X48.722 Y48.257
+G1 X45.849 Y50.768
+G1 X42.524 Y52.664
+G1 X38.876 Y53.866
+G1 X35.051 Y54.320
+G1 X31.200 Y54.004
+G1 X27.477 Y52.925
+G1 X24.032 Y51.123
+G1 X21.005 Y48.665
+G1 X18.518 Y45.644
+G1 X16.676 Y42.180
+G1 X15.556 Y38.407
+G1 X15.207 Y34.474
+G1 X15.647 Y30.539
+G1 X16.865 Y26.758
+G1 X18.815 Y23.285
+G1 X21.425 Y20.259
+G1 X24.593 Y17.804
+G1 X28.196 Y16.023
+G1 X32.094 Y14.990
+G1 X36.130 Y14.752
+G1 X40.146 Y15.322
+G1 X43.979 Y16.682
+G1 X47.476 Y18.784
+G1 X50.494 Y21.546
+G1 X52.910 Y24.863
+G1 X54.624 Y28.605
+G1 X55.563 Y32.624
+G1 X55.685 Y36.762
+G1 X54.980 Y40.853
+G1 X53.472 Y44.734
+G1 X51.217 Y48.248
+G1 X48.300 Y51.252
+G1 X44.834 Y53.623
+G1 X40.955 Y55.263
+G1 X36.816 Y56.102
+G1 X32.580 Y56.102
+G1 X28.418 Y55.257
+G1 X24.495 Y53.598
+G1 X20.970 Y51.186
+G1 X17.987 Y48.113
+G1 X15.667 Y44.498
+G1 X14.107 Y40.483
+G1 X13.375 Y36.226
+G1 X13.503 Y31.897
+G1 X14.491 Y27.668
+G1 X16.306 Y23.708
+G1 X18.877 Y20.179
+G1 X22.108 Y17.222
+G1 X25.872 Y14.961
+G1 X30.022 Y13.489
+G1 X34.393 Y12.868
+G1 X38.812 Y13.130
+G1 X43.103 Y14.267
+G1 X47.093 Y16.240
+G1 X50.621 Y18.973
+G1 X53.543 Y22.362
+G1 X55.739 Y26.275
+G1 X57.118 Y30.557
+G1 X57.620 Y35.040
+G1 X57.220 Y39.545
+G1 X55.929 Y43.893
+G1 X53.795 Y47.907
+G1 X50.898 Y51.427
+G1 X47.349 Y54.308
+G1 X43.289 Y56.433
+G1 X38.876 Y57.712
+G1 X34.284 Y58.089
+G1 X29.698 Y57.545
+G1 X25.300 Y56.097
+G1 X21.266 Y53.797
+G1 X17.761 Y50.735
+G1 X14.927 Y47.027
+G1 X12.882 Y42.820
+G1 X11.710 Y38.278
+G1 X11.463 Y33.582
+G1 X12.156 Y28.918
+G1 X13.765 Y24.475
+G1 X16.232 Y20.429
+G1 X19.462 Y16.945
+G1 X23.330 Y14.166
+G1 X27.683 Y12.206
+G0 Z5 F300
+G0 X0 Y0 F6000
@@ -0,0 +1,620 @@
+; print like moves, perimeters and zig-zag infill over a few layers, lots of short segments
+G21
+G90
+G92 X0 Y0 Z0
+G1 F6000
+G1 Z0.20 F600
+G1 F3000
+G0 X45.000 Y10.000
+G1 X45.975 Y10.096
+G1 X46.913 Y10.381
+G1 X47.778 Y10.843
+G1 X48.536 Y11.464
+G1 X49.157 Y12.222
+G1 X49.619 Y13.087
+G1 X49.904 Y14.025
+G1 X50.000 Y15.000
+G1 X50.000 Y35.000
+G1 X49.904 Y35.975
+G1 X49.619 Y36.913
+G1 X49.157 Y37.778
+G1 X48.536 Y38.536
+G1 X47.778 Y39.157
+G1 X46.913 Y39.619
+G1 X45.975 Y39.904
+G1 X45.000 Y40.000
+G1 X15.000 Y40.000
+G1 X14.025 Y39.904
+G1 X13.087 Y39.619
+G1 X12.222 Y39.157
+G1 X11.464 Y38.536
+G1 X10.843 Y37.778
+G1 X10.381 Y36.913
+G1 X10.096 Y35.975
+G1 X10.000 Y35.000
+G1 X10.000 Y15.000
+G1 X10.096 Y14.025
+G1 X10.381 Y13.087
+G1 X10.843 Y12.222
+G1 X11.464 Y11.464
+G1 X12.222 Y10.843
+G1 X13.087 Y10.381
+G1 X14.025 Y10.096
+G1 X15.000 Y10.000
+G1 X45.000 Y10.000
+G0 X45.000 Y10.450
+G1 X45.888 Y10.537
+G1 X46.741 Y10.796
+G1 X47.528 Y11.217
+G1 X48.217 Y11.783
+G1 X48.783 Y12.472
+G1 X49.204 Y13.259
+G1 X49.463 Y14.112
+G1 X49.550 Y15.000
+G1 X49.550 Y35.000
+G1 X49.463 Y35.888
+G1 X49.204 Y36.741
+G1 X48.783 Y37.528
+G1 X48.217 Y38.217
+G1 X47.528 Y38.783
+G1 X46.741 Y39.204
+G1 X45.888 Y39.463
+G1 X45.000 Y39.550
+G1 X15.000 Y39.550
+G1 X14.112 Y39.463
+G1 X13.259 Y39.204
+G1 X12.472 Y38.783
+G1 X11.783 Y38.217
+G1 X11.217 Y37.528
+G1 X10.796 Y36.741
+G1 X10.537 Y35.888
+G1 X10.450 Y35.000
+G1 X10.450 Y15.000
+G1 X10.537 Y14.112
+G1 X10.796 Y13.259
+G1 X11.217 Y12.472
+G1 X11.783 Y11.783
+G1 X12.472 Y11.217
+G1 X13.259 Y10.796
+G1 X14.112 Y10.537
+G1 X15.000 Y10.450
+G1 X45.000 Y10.450
+G1 F4800
+G0 X11 Y11
+G1 X49.000 Y11.000
+G1 X49.000 Y11.450
+G1 X11.000 Y11.450
+G1 X11.000 Y11.900
+G1 X49.000 Y11.900
+G1 X49.000 Y12.350
+G1 X11.000 Y12.350
+G1 X11.000 Y12.800
+G1 X49.000 Y12.800
+G1 X49.000 Y13.250
+G1 X11.000 Y13.250
+G1 X11.000 Y13.700
+G1 X49.000 Y13.700
+G1 X49.000 Y14.150
+G1 X11.000 Y14.150
+G1 X11.000 Y14.600
+G1 X49.000 Y14.600
+G1 X49.000 Y15.050
+G1 X11.000 Y15.050
+G1 X11.000 Y15.500
+G1 X49.000 Y15.500
+G1 X49.000 Y15.950
+G1 X11.000 Y15.950
+G1 X11.000 Y16.400
+G1 X49.000 Y16.400
+G1 X49.000 Y16.850
+G1 X11.000 Y16.850
+G1 X11.000 Y17.300
+G1 X49.000 Y17.300
+G1 X49.000 Y17.750
+G1 X11.000 Y17.750
+G1 X11.000 Y18.200
+G1 X49.000 Y18.200
+G1 X49.000 Y18.650
+G1 X11.000 Y18.650
+G1 X11.000 Y19.100
+G1 X49.000 Y19.100
+G1 X49.000 Y19.550
+G1 X11.000 Y19.550
+G1 X11.000 Y20.000
+G1 X49.000 Y20.000
+G1 X49.000 Y20.450
+G1 X11.000 Y20.450
+G1 X11.000 Y20.900
+G1 X49.000 Y20.900
+G1 X49.000 Y21.350
+G1 X11.000 Y21.350
+G1 X11.000 Y21.800
+G1 X49.000 Y21.800
+G1 X49.000 Y22.250
+G1 X11.000 Y22.250
+G1 X11.000 Y22.700
+G1 X49.000 Y22.700
+G1 X49.000 Y23.150
+G1 X11.000 Y23.150
+G1 X11.000 Y23.600
+G1 X49.000 Y23.600
+G1 X49.000 Y24.050
+G1 X11.000 Y24.050
+G1 X11.000 Y24.500
+G1 X49.000 Y24.500
+G1 X49.000 Y24.950
+G1 X11.000 Y24.950
+G1 X11.000 Y25.400
+G1 X49.000 Y25.400
+G1 X49.000 Y25.850
+G1 X11.000 Y25.850
+G1 X11.000 Y26.300
+G1 X49.000 Y26.300
+G1 X49.000 Y26.750
+G1 X11.000 Y26.750
+G1 X11.000 Y27.200
+G1 X49.000 Y27.200
+G1 X49.000 Y27.650
+G1 X11.000 Y27.650
+G1 X11.000 Y28.100
+G1 X49.000 Y28.100
+G1 X49.000 Y28.550
+G1 X11.000 Y28.550
+G1 X11.000 Y29.000
+G1 X49.000 Y29.000
+G1 X49.000 Y29.450
+G1 X11.000 Y29.450
+G1 X11.000 Y29.900
+G1 X49.000 Y29.900
+G1 X49.000 Y30.350
+G1 X11.000 Y30.350
+G1 X11.000 Y30.800
+G1 X49.000 Y30.800
+G1 X49.000 Y31.250
+G1 X11.000 Y31.250
+G1 X11.000 Y31.700
+G1 X49.000 Y31.700
+G1 X49.000 Y32.150
+G1 X11.000 Y32.150
+G1 X11.000 Y32.600
+G1 X49.000 Y32.600
+G1 X49.000 Y33.050
+G1 X11.000 Y33.050
+G1 X11.000 Y33.500
+G1 X49.000 Y33.500
+G1 X49.000 Y33.950
+G1 X11.000 Y33.950
+G1 X11.000 Y34.400
+G1 X49.000 Y34.400
+G1 X49.000 Y34.850
+G1 X11.000 Y34.850
+G1 X11.000 Y35.300
+G1 X49.000 Y35.300
+G1 X49.000 Y35.750
+G1 X11.000 Y35.750
+G1 X11.000 Y36.200
+G1 X49.000 Y36.200
+G1 X49.000 Y36.650
+G1 X11.000 Y36.650
+G1 X11.000 Y37.100
+G1 X49.000 Y37.100
+G1 X49.000 Y37.550
+G1 X11.000 Y37.550
+G1 X11.000 Y38.000
+G1 X49.000 Y38.000
+G1 X49.000 Y38.450
+G1 X11.000 Y38.450
+G1 X11.000 Y38.900
+G1 X49.000 Y38.900
+G1 X49.000 Y39.350
+G1 Z0.40 F600
+G1 F3000
+G0 X45.000 Y10.000
+G1 X45.975 Y10.096
+G1 X46.913 Y10.381
+G1 X47.778 Y10.843
+G1 X48.536 Y11.464
+G1 X49.157 Y12.222
+G1 X49.619 Y13.087
+G1 X49.904 Y14.025
+G1 X50.000 Y15.000
+G1 X50.000 Y35.000
+G1 X49.904 Y35.975
+G1 X49.619 Y36.913
+G1 X49.157 Y37.778
+G1 X48.536 Y38.536
+G1 X47.778 Y39.157
+G1 X46.913 Y39.619
+G1 X45.975 Y39.904
+G1 X45.000 Y40.000
+G1 X15.000 Y40.000
+G1 X14.025 Y39.904
+G1 X13.087 Y39.619
+G1 X12.222 Y39.157
+G1 X11.464 Y38.536
+G1 X10.843 Y37.778
+G1 X10.381 Y36.913
+G1 X10.096 Y35.975
+G1 X10.000 Y35.000
+G1 X10.000 Y15.000
+G1 X10.096 Y14.025
+G1 X10.381 Y13.087
+G1 X10.843 Y12.222
+G1 X11.464 Y11.464
+G1 X12.222 Y10.843
+G1 X13.087 Y10.381
+G1 X14.025 Y10.096
+G1 X15.000 Y10.000
+G1 X45.000 Y10.000
+G0 X45.000 Y10.450
+G1 X45.888 Y10.537
+G1 X46.741 Y10.796
+G1 X47.528 Y11.217
+G1 X48.217 Y11.783
+G1 X48.783 Y12.472
+G1 X49.204 Y13.259
+G1 X49.463 Y14.112
+G1 X49.550 Y15.000
+G1 X49.550 Y35.000
+G1 X49.463 Y35.888
+G1 X49.204 Y36.741
+G1 X48.783 Y37.528
+G1 X48.217 Y38.217
+G1 X47.528 Y38.783
+G1 X46.741 Y39.204
+G1 X45.888 Y39.463
+G1 X45.000 Y39.550
+G1 X15.000 Y39.550
+G1 X14.112 Y39.463
+G1 X13.259 Y39.204
+G1 X12.472 Y38.783
+G1 X11.783 Y38.217
+G1 X11.217 Y37.528
+G1 X10.796 Y36.741
+G1 X10.537 Y35.888
+G1 X10.450 Y35.000
+G1 X10.450 Y15.000
+G1 X10.537 Y14.112
+G1 X10.796 Y13.259
+G1 X11.217 Y12.472
+G1 X11.783 Y11.783
+G1 X12.472 Y11.217
+G1 X13.259 Y10.796
+G1 X14.112 Y10.537
+G1 X15.000 Y10.450
+G1 X45.000 Y10.450
+G1 F4800
+G0 X11 Y11
+G1 X49.000 Y11.000
+G1 X49.000 Y11.450
+G1 X11.000 Y11.450
+G1 X11.000 Y11.900
+G1 X49.000 Y11.900
+G1 X49.000 Y12.350
+G1 X11.000 Y12.350
+G1 X11.000 Y12.800
+G1 X49.000 Y12.800
+G1 X49.000 Y13.250
+G1 X11.000 Y13.250
+G1 X11.000 Y13.700
+G1 X49.000 Y13.700
+G1 X49.000 Y14.150
+G1 X11.000 Y14.150
+G1 X11.000 Y14.600
+G1 X49.000 Y14.600
+G1 X49.000 Y15.050
+G1 X11.000 Y15.050
+G1 X11.000 Y15.500
+G1 X49.000 Y15.500
+G1 X49.000 Y15.950
+G1 X11.000 Y15.950
+G1 X11.000 Y16.400
+G1 X49.000 Y16.400
+G1 X49.000 Y16.850
+G1 X11.000 Y16.850
+G1 X11.000 Y17.300
+G1 X49.000 Y17.300
+G1 X49.000 Y17.750
+G1 X11.000 Y17.750
+G1 X11.000 Y18.200
+G1 X49.000 Y18.200
+G1 X49.000 Y18.650
+G1 X11.000 Y18.650
+G1 X11.000 Y19.100
+G1 X49.000 Y19.100
+G1 X49.000 Y19.550
+G1 X11.000 Y19.550
+G1 X11.000 Y20.000
+G1 X49.000 Y20.000
+G1 X49.000 Y20.450
+G1 X11.000 Y20.450
+G1 X11.000 Y20.900
+G1 X49.000 Y20.900
+G1 X49.000 Y21.350
+G1 X11.000 Y21.350
+G1 X11.000 Y21.800
+G1 X49.000 Y21.800
+G1 X49.000 Y22.250
+G1 X11.000 Y22.250
+G1 X11.000 Y22.700
+G1 X49.000 Y22.700
+G1 X49.000 Y23.150
+G1 X11.000 Y23.150
+G1 X11.000 Y23.600
+G1 X49.000 Y23.600
+G1 X49.000 Y24.050
+G1 X11.000 Y24.050
+G1 X11.000 Y24.500
+G1 X49.000 Y24.500
+G1 X49.000 Y24.950
+G1 X11.000 Y24.950
+G1 X11.000 Y25.400
+G1 X49.000 Y25.400
+G1 X49.000 Y25.850
+G1 X11.000 Y25.850
+G1 X11.000 Y26.300
+G1 X49.000 Y26.300
+G1 X49.000 Y26.750
+G1 X11.000 Y26.750
+G1 X11.000 Y27.200
+G1 X49.000 Y27.200
+G1 X49.000 Y27.650
+G1 X11.000 Y27.650
+G1 X11.000 Y28.100
+G1 X49.000 Y28.100
+G1 X49.000 Y28.550
+G1 X11.000 Y28.550
+G1 X11.000 Y29.000
+G1 X49.000 Y29.000
+G1 X49.000 Y29.450
+G1 X11.000 Y29.450
+G1 X11.000 Y29.900
+G1 X49.000 Y29.900
+G1 X49.000 Y30.350
+G1 X11.000 Y30.350
+G1 X11.000 Y30.800
+G1 X49.000 Y30.800
+G1 X49.000 Y31.250
+G1 X11.000 Y31.250
+G1 X11.000 Y31.700
+G1 X49.000 Y31.700
+G1 X49.000 Y32.150
+G1 X11.000 Y32.150
+G1 X11.000 Y32.600
+G1 X49.000 Y32.600
+G1 X49.000 Y33.050
+G1 X11.000 Y33.050
+G1 X11.000 Y33.500
+G1 X49.000 Y33.500
+G1 X49.000 Y33.950
+G1 X11.000 Y33.950
+G1 X11.000 Y34.400
+G1 X49.000 Y34.400
+G1 X49.000 Y34.850
+G1 X11.000 Y34.850
+G1 X11.000 Y35.300
+G1 X49.000 Y35.300
+G1 X49.000 Y35.750
+G1 X11.000 Y35.750
+G1 X11.000 Y36.200
+G1 X49.000 Y36.200
+G1 X49.000 Y36.650
+G1 X11.000 Y36.650
+G1 X11.000 Y37.100
+G1 X49.000 Y37.100
+G1 X49.000 Y37.550
+G1 X11.000 Y37.550
+G1 X11.000 Y38.000
+G1 X49.000 Y38.000
+G1 X49.000 Y38.450
+G1 X11.000 Y38.450
+G1 X11.000 Y38.900
+G1 X49.000 Y38.900
+G1 X49.000 Y39.350
+G1 Z0.60 F600
+G1 F3000
+G0 X45.000 Y10.000
+G1 X45.975 Y10.096
+G1 X46.913 Y10.381
+G1 X47.778 Y10.843
+G1 X48.536 Y11.464
+G1 X49.157 Y12.222
+G1 X49.619 Y13.087
+G1 X49.904 Y14.025
+G1 X50.000 Y15.000
+G1 X50.000 Y35.000
+G1 X49.904 Y35.975
+G1 X49.619 Y36.913
+G1 X49.157 Y37.778
+G1 X48.536 Y38.536
+G1 X47.778 Y39.157
+G1 X46.913 Y39.619
+G1 X45.975 Y39.904
+G1 X45.000 Y40.000
+G1 X15.000 Y40.000
+G1 X14.025 Y39.904
+G1 X13.087 Y39.619
+G1 X12.222 Y39.157
+G1 X11.464 Y38.536
+G1 X10.843 Y37.778
+G1 X10.381 Y36.913
+G1 X10.096 Y35.975
+G1 X10.000 Y35.000
+G1 X10.000 Y15.000
+G1 X10.096 Y14.025
+G1 X10.381 Y13.087
+G1 X10.843 Y12.222
+G1 X11.464 Y11.464
+G1 X12.222 Y10.843
+G1 X13.087 Y10.381
+G1 X14.025 Y10.096
+G1 X15.000 Y10.000
+G1 X45.000 Y10.000
+G0 X45.000 Y10.450
+G1 X45.888 Y10.537
+G1 X46.741 Y10.796
+G1 X47.528 Y11.217
+G1 X48.217 Y11.783
+G1 X48.783 Y12.472
+G1 X49.204 Y13.259
+G1 X49.463 Y14.112
+G1 X49.550 Y15.000
+G1 X49.550 Y35.000
+G1 X49.463 Y35.888
+G1 X49.204 Y36.741
+G1 X48.783 Y37.528
+G1 X48.217 Y38.217
+G1 X47.528 Y38.783
+G1 X46.741 Y39.204
+G1 X45.888 Y39.463
+G1 X45.000 Y39.550
+G1 X15.000 Y39.550
+G1 X14.112 Y39.463
+G1 X13.259 Y39.204
+G1 X12.472 Y38.783
+G1 X11.783 Y38.217
+G1 X11.217 Y37.528
+G1 X10.796 Y36.741
+G1 X10.537 Y35.888
+G1 X10.450 Y35.000
+G1 X10.450 Y15.000
+G1 X10.537 Y14.112
+G1 X10.796 Y13.259
+G1 X11.217 Y12.472
+G1 X11.783 Y11.783
+G1 X12.472 Y11.217
+G1 X13.259 Y10.796
+G1 X14.112 Y10.537
+G1 X15.000 Y10.450
+G1 X45.000 Y10.450
+G1 F4800
+G0 X11 Y11
+G1 X49.000 Y11.000
+G1 X49.000 Y11.450
+G1 X11.000 Y11.450
+G1 X11.000 Y11.900
+G1 X49.000 Y11.900
+G1 X49.000 Y12.350
+G1 X11.000 Y12.350
+G1 X11.000 Y12.800
+G1 X49.000 Y12.800
+G1 X49.000 Y13.250
+G1 X11.000 Y13.250
+G1 X11.000 Y13.700
+G1 X49.000 Y13.700
+G1 X49.000 Y14.150
+G1 X11.000 Y14.150
+G1 X11.000 Y14.600
+G1 X49.000 Y14.600
+G1 X49.000 Y15.050
+G1 X11.000 Y15.050
+G1 X11.000 Y15.500
+G1 X49.000 Y15.500
+G1 X49.000 Y15.950
+G1 X11.000 Y15.950
+G1 X11.000 Y16.400
+G1 X49.000 Y16.400
+G1 X49.000 Y16.850
+G1 X11.000 Y16.850
+G1 X11.000 Y17.300
+G1 X49.000 Y17.300
+G1 X49.000 Y17.750
+G1 X11.000 Y17.750
+G1 X11.000 Y18.200
+G1 X49.000 Y18.200
+G1 X49.000 Y18.650
+G1 X11.000 Y18.650
+G1 X11.000 Y19.100
+G1 X49.000 Y19.100
+G1 X49.000 Y19.550
+G1 X11.000 Y19.550
+G1 X11.000 Y20.000
+G1 X49.000 Y20.000
+G1 X49.000 Y20.450
+G1 X11.000 Y20.450
+G1 X11.000 Y20.900
+G1 X49.000 Y20.900
+G1 X49.000 Y21.350
+G1 X11.000 Y21.350
+G1 X11.000 Y21.800
+G1 X49.000 Y21.800
+G1 X49.000 Y22.250
+G1 X11.000 Y22.250
+G1 X11.000 Y22.700
+G1 X49.000 Y22.700
+G1 X49.000 Y23.150
+G1 X11.000 Y23.150
+G1 X11.000 Y23.600
+G1 X49.000 Y23.600
+G1 X49.000 Y24.050
+G1 X11.000 Y24.050
+G1 X11.000 Y24.500
+G1 X49.000 Y24.500
+G1 X49.000 Y24.950
+G1 X11.000 Y24.950
+G1 X11.000 Y25.400
+G1 X49.000 Y25.400
+G1 X49.000 Y25.850
+G1 X11.000 Y25.850
+G1 X11.000 Y26.300
+G1 X49.000 Y26.300
+G1 X49.000 Y26.750
+G1 X11.000 Y26.750
+G1 X11.000 Y27.200
+G1 X49.000 Y27.200
+G1 X49.000 Y27.650
+G1 X11.000 Y27.650
+G1 X11.000 Y28.100
+G1 X49.000 Y28.100
+G1 X49.000 Y28.550
+G1 X11.000 Y28.550
+G1 X11.000 Y29.000
+G1 X49.000 Y29.000
+G1 X49.000 Y29.450
+G1 X11.000 Y29.450
+G1 X11.000 Y29.900
+G1 X49.000 Y29.900
+G1 X49.000 Y30.350
+G1 X11.000 Y30.350
+G1 X11.000 Y30.800
+G1 X49.000 Y30.800
+G1 X49.000 Y31.250
+G1 X11.000 Y31.250
+G1 X11.000 Y31.700
+G1 X49.000 Y31.700
+G1 X49.000 Y32.150
+G1 X11.000 Y32.150
+G1 X11.000 Y32.600
+G1 X49.000 Y32.600
+G1 X49.000 Y33.050
+G1 X11.000 Y33.050
+G1 X11.000 Y33.500
+G1 X49.000 Y33.500
+G1 X49.000 Y33.950
+G1 X11.000 Y33.950
+G1 X11.000 Y34.400
+G1 X49.000 Y34.400
+G1 X49.000 Y34.850
+G1 X11.000 Y34.850
+G1 X11.000 Y35.300
+G1 X49.000 Y35.300
+G1 X49.000 Y35.750
+G1 X11.000 Y35.750
+G1 X11.000 Y36.200
+G1 X49.000 Y36.200
+G1 X49.000 Y36.650
+G1 X11.000 Y36.650
+G1 X11.000 Y37.100
+G1 X49.000 Y37.100
+G1 X49.000 Y37.550
+G1 X11.000 Y37.550
+G1 X11.000 Y38.000
+G1 X49.000 Y38.000
+G1 X49.000 Y38.450
+G1 X11.000 Y38.450
+G1 X11.000 Y38.900
+G1 X49.000 Y38.900
+G1 X49.000 Y39.350
+G0 Z5 F600
+G0 X0 Y0 F6000
+G0 Z0 F600
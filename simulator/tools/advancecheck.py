@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""\
+Checks the pressure advance of an extruder from two smoothiesim -t traces of the same gcode file
+
+    advancecheck.py [-m motor] base.bin advance.bin advance_secs smooth_secs
+
+base.bin is without pressure advance and advance.bin with it, motor is the extruder (default the last one). The other
+motors must have stepped on exactly the same ticks. The extruder must lead where it is in base.bin by its speed there
+times the advance, smoothed with the time constant as the step ticker does, to within the steps the speed measured from
+whole steps can be out by. The final positions must be the same. Prints how far it led at most and how far from the
+lead it should have had it was, exits with 1 if any of that fails.
+"""
+
+import getopt
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from shapetimeline import read_trace  # noqa: E402
+
+
+# the position of a motor on every tick up to end
+def per_tick(ticks, positions, end):
+    out = [0] * (end + 1)
+    p = 0
+    i = 0
+    for t in range(end + 1):
+        while i < len(ticks) and ticks[i] <= t:
+            p = positions[i]
+            i += 1
+        out[t] = p
+    return out
+
+
+def main():
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], 'm:')
+    except getopt.GetoptError:
+        args = []
+        opts = []
+    motor = None
+    for o, a in opts:
+        if o == '-m':
+            motor = int(a)
+    if len(args) != 4:
+        print(__doc__)
+        sys.exit(1)
+
+    frequency, base = read_trace(args[0])
+    _, advanced = read_trace(args[1])
+    advance = float(args[2])
+    smooth_time = float(args[3])
+    if motor is None:
+        motor = len(base) - 1
+
+    ok = True
+    for m in range(len(base)):
+        if m != motor and base[m][0] != advanced[m][0]:
+            print('FAIL: motor {} stepped differently with pressure advance'.format(m))
+            ok = False
+
+    base_ticks, base_positions = base[motor]
+    ticks, positions = advanced[motor]
+    if not base_ticks or not ticks:
+        print('FAIL: the extruder did not move')
+        sys.exit(1)
+    if base_positions[-1] != positions[-1]:
+        print('FAIL: the extruder ended at {} steps, {} without pressure advance'.format(positions[-1], base_positions[-1]))
+        ok = False
+
+    # the lead it should have, worked out per tick like the step ticker but from the speed of whole steps
+    end = max(base_ticks[-1], ticks[-1])
+    e0 = per_tick(base_ticks, base_positions, end)
+    e1 = per_tick(ticks, positions, end)
+    factor = advance * frequency
+    smoothing = 1.0 / (smooth_time * frequency) if smooth_time * frequency > 1 else 1.0
+    expected = 0.0
+    lead_max = 0
+    error_max = 0.0
+    error_sum = 0.0
+    for t in range(1, end + 1):
+        expected += (factor * (e0[t] - e0[t - 1]) - expected) * smoothing
+        lead = e1[t] - e0[t]
+        lead_max = max(lead_max, lead)
+        error = abs(lead - expected)
+        error_max = max(error_max, error)
+        error_sum += error
+
+    # a step more or less in the speed moves the expected lead by factor * smoothing, and the extruder rounds to a step
+    tolerance = factor * smoothing + 1
+    print('extruder led by at most {} steps, off the lead for its speed by {:.2f} steps on average, {:.2f} at most (allowed {:.2f})'.format(
+        lead_max, error_sum / end, error_max, tolerance))
+    if lead_max <= 0:
+        print('FAIL: the extruder never led')
+        ok = False
+    if error_max > tolerance:
+        print('FAIL: the extruder was further off the lead than allowed')
+        ok = False
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
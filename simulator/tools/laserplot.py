@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""\
+Plots the laser power against the speed from a smoothiesim -w file as an SVG
+
+    laserplot.py laser.csv laser.svg [start_s end_s]
+
+The top plot is the speed of the primary axis and the nominal speed of each block, the bottom one the power the laser
+was set to and the power for the speed at that moment. Block boundaries are the vertical lines.
+"""
+
+import csv
+import sys
+
+WIDTH = 1200
+HEIGHT = 300
+MARGIN = 50
+
+
+def polyline(points, colour):
+    return '<polyline fill="none" stroke="{}" stroke-width="1" points="{}"/>\n'.format(
+        colour, ' '.join('{:.1f},{:.1f}'.format(x, y) for x, y in points))
+
+
+def plot(rows, columns, colours, label, top, t0, t1, boundaries):
+    vmax = max(max(r[c] for r in rows) for c in columns) or 1.0
+
+    def x(t):
+        return MARGIN + (t - t0) * (WIDTH - 2 * MARGIN) / (t1 - t0)
+
+    def y(v):
+        return top + HEIGHT - v * HEIGHT / vmax
+
+    out = '<rect x="{}" y="{}" width="{}" height="{}" fill="none" stroke="black"/>\n'.format(
+        MARGIN, top, WIDTH - 2 * MARGIN, HEIGHT)
+    for t in boundaries:
+        out += '<line x1="{0:.1f}" y1="{1}" x2="{0:.1f}" y2="{2}" stroke="#ddd"/>\n'.format(x(t), top, top + HEIGHT)
+    for c, colour in zip(columns, colours):
+        out += polyline([(x(r['time']), y(r[c])) for r in rows], colour)
+    out += '<text x="{}" y="{}" font-size="12">{} (0 to {:.3g}): {}</text>\n'.format(
+        MARGIN, top - 8, label, vmax, ', '.join('{} {}'.format(c, colour) for c, colour in zip(columns, colours)))
+    return out
+
+
+def main():
+    if len(sys.argv) not in (3, 5):
+        print(__doc__)
+        sys.exit(1)
+
+    with open(sys.argv[1]) as f:
+        rows = [{k: float(v) for k, v in r.items()} for r in csv.DictReader(f)]
+    if len(sys.argv) == 5:
+        start, end = float(sys.argv[3]), float(sys.argv[4])
+        rows = [r for r in rows if start <= r['time'] <= end]
+    if len(rows) < 2:
+        print('nothing to plot')
+        sys.exit(1)
+
+    t0, t1 = rows[0]['time'], rows[-1]['time']
+    boundaries = [b['time'] for a, b in zip(rows, rows[1:]) if a['block'] != b['block']]
+
+    svg = '<svg xmlns="http://www.w3.org/2000/svg" width="{}" height="{}" font-family="sans-serif">\n'.format(
+        WIDTH, 2 * HEIGHT + 3 * MARGIN)
+    svg += '<rect width="100%" height="100%" fill="white"/>\n'
+    svg += plot(rows, ['speed', 'nominal_speed'], ['blue', 'gray'], 'mm/s', MARGIN, t0, t1, boundaries)
+    svg += plot(rows, ['power', 'speed_power'], ['red', 'green'], '%', 2 * MARGIN + HEIGHT, t0, t1, boundaries)
+    svg += '<text x="{}" y="{}" font-size="12">{:.4f} s to {:.4f} s, {} blocks</text>\n'.format(
+        MARGIN, 2 * HEIGHT + 2 * MARGIN + 20, t0, t1, len(boundaries) + 1)
+    svg += '</svg>\n'
+
+    with open(sys.argv[2], 'w') as f:
+        f.write(svg)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""\
+Writes a large config for smoothiesim -e, the settings of a big machine: the motion settings of
+configs/cartesian.config then extruders, temperature controls, switches, motor drivers and endstops, with a comment
+above each module and some of its lines commented out like the sample configs. About 600 settings with the defaults.
+
+    mkconfig.py [-e extruders] [-t temperature_controls] [-s switches] [-d drivers] base.config > large.config
+"""
+
+import argparse
+
+parser = argparse.ArgumentParser(description='Make a large config for smoothiesim -e')
+parser.add_argument('base', help='the config the motion settings are taken from')
+parser.add_argument('-e', '--extruders', type=int, default=4)
+parser.add_argument('-t', '--temperature-controls', type=int, default=8)
+parser.add_argument('-s', '--switches', type=int, default=24)
+parser.add_argument('-d', '--drivers', type=int, default=8)
+args = parser.parse_args()
+
+with open(args.base) as f:
+    print(f.read().rstrip())
+
+
+def module(comment, prefix, settings):
+    print()
+    print('# ' + comment)
+    for i, (key, value) in enumerate(settings):
+        # every fifth one is left commented out, those are looked up and not found like in a real config
+        hash = '#' if i % 5 == 4 else ''
+        print('{}{}.{:<32} {:<16} # {}'.format(hash, prefix, key, value, key.replace('_', ' ')))
+
+
+for e in range(args.extruders):
+    module('Extruder module configuration', 'extruder.hotend{}'.format(e), [
+        ('enable', 'true'), ('steps_per_mm', '{:.1f}'.format(140 + e * 2.5)), ('default_feed_rate', '600'),
+        ('acceleration', '500'), ('max_speed', '50'), ('step_pin', '2.{}'.format(3 + e)),
+        ('dir_pin', '0.{}!'.format(22 + e)), ('en_pin', '0.{}'.format(21 - e)), ('x_offset', '{}'.format(e * 25)),
+        ('y_offset', '0'), ('z_offset', '0'), ('retract_length', '3'), ('retract_feedrate', '45'),
+        ('retract_recover_length', '0'), ('retract_recover_feedrate', '8'), ('retract_zlift_length', '0'),
+        ('retract_zlift_feedrate', '6000'), ('filament_diameter', '1.75'), ('pressure_advance', '0.045'),
+        ('pressure_advance_smooth_time', '0.04')])
+
+for t in range(args.temperature_controls):
+    name = 'hotend{}'.format(t) if t < args.extruders else 'chamber{}'.format(t)
+    module('Hotend temperature control configuration', 'temperature_control.' + name, [
+        ('enable', 'true'), ('thermistor_pin', '0.{}'.format(23 + t % 4)), ('heater_pin', '2.{}'.format(7 - t % 3)),
+        ('thermistor', 'EPCOS100K'), ('beta', '4066'), ('set_m_code', '104'), ('set_and_wait_m_code', '109'),
+        ('designator', 'T' if t < args.extruders else 'C'), ('p_factor', '13.7'), ('i_factor', '0.097'),
+        ('d_factor', '24'), ('max_pwm', '255'), ('pwm_frequency', '2000'), ('bang_bang', 'false'),
+        ('hysteresis', '2.0'), ('max_temp', '300'), ('min_temp', '0'), ('runaway_heating_timeout', '900'),
+        ('runaway_range', '20'), ('readings_per_second', '20')])
+
+for s in range(args.switches):
+    module('Switch module for fan control', 'switch.fan{}'.format(s), [
+        ('enable', 'true'), ('input_on_command', 'M106'), ('input_off_command', 'M107'),
+        ('output_pin', '2.{}'.format(s % 8)), ('output_type', 'pwm' if s % 2 else 'digital'), ('max_pwm', '255'),
+        ('startup_state', 'false'), ('startup_value', '{}'.format(s * 10)), ('default_on_value', '255'),
+        ('ignore_on_halt', 'false'), ('failsafe_set_to', '0')])
+
+for d in range(args.drivers):
+    module('Motor driver configuration', 'motor_driver_control.m{}'.format(d), [
+        ('enable', 'true'), ('designator', 'ABCDEFGH'[d]), ('chip', 'TMC2660'), ('current', '{:.2f}'.format(1.2 + d * 0.1)),
+        ('max_current', '2.8'), ('sense_resistor', '50'), ('microsteps', '32'), ('decay_mode', '1'),
+        ('alarm', 'true'), ('halt_on_alarm', 'false'), ('spi_channel', '{}'.format(d % 2)),
+        ('spi_cs_pin', '0.{}'.format(10 + d)), ('spi_frequency', '100000'), ('reg', '00204,981C0,A0000,C000E,E0070')])
+
+for axis in 'xyz':
+    for end in ('min', 'max'):
+        module('Endstops', 'endstop.{}{}'.format(end, axis), [
+            ('enable', 'true'), ('pin', '1.{}!^'.format(24 + 'xyz'.index(axis) * 2 + (end == 'max'))),
+            ('homing_direction', 'home_to_' + end), ('homing_position', '0' if end == 'min' else '200'),
+            ('axis', axis.upper()), ('max_travel', '500'), ('fast_rate', '50'), ('slow_rate', '25'),
+            ('retract', '5'), ('limit_enable', 'false')])
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+"""\
+Writes a square rectangular-grid file like M374 saves to /sd/cartesian.grid, sampled from a made up bed that sags
+in the middle and has a ripple along X. With -a X,Y it prints the height of that bed at the point instead.
+
+    mkgrid.py size x_size y_size > cartesian.grid
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+
+def bed(x, y, x_size, y_size):
+    cx, cy = x_size / 2, y_size / 2
+    return 0.2 * ((x - cx) ** 2 + (y - cy) ** 2) / (cx * cx) + 0.05 * math.sin(x / 15.0)
+
+
+parser = argparse.ArgumentParser(description='Make a rectangular-grid file for smoothiesim -m')
+parser.add_argument('size', type=int, help='grid points along X and Y')
+parser.add_argument('x_size', type=float)
+parser.add_argument('y_size', type=float)
+parser.add_argument('-a', '--at', help='print the bed height at X,Y')
+args = parser.parse_args()
+
+if args.at:
+    x, y = (float(v) for v in args.at.split(','))
+    print('{:.4f}'.format(bed(x, y, args.x_size, args.y_size)))
+    sys.exit(0)
+
+out = sys.stdout.buffer
+out.write(struct.pack('<Bff', args.size, args.x_size, args.y_size))
+for j in range(args.size):
+    for i in range(args.size):
+        x = args.x_size * i / (args.size - 1)
+        y = args.y_size * j / (args.size - 1)
+        out.write(struct.pack('<f', bed(x, y, args.x_size, args.y_size)))
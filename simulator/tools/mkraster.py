@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""\
+Writes the gcode to engrave a grayscale test image, one row per line scanned back and forth
+
+    mkraster.py [-m line|inline|file] [-r raw] [-w width] [-n rows] [-p pitch] [-f feedrate] > raster.gcode
+
+line    one G1 per pixel with its S value, how rasters are sent without raster support
+inline  the pixels of each row are queued with M650 as hex, then one G1 scans the row
+file    the pixels are written to the raw file given with -r, one byte each in the order they are scanned, each row is
+        queued with M650 P from it (M651 opens it, the name is relative to the SD card)
+"""
+
+import argparse
+import math
+import os
+
+parser = argparse.ArgumentParser(description='grayscale raster test gcode')
+parser.add_argument('-m', '--mode', choices=['line', 'inline', 'file'], default='inline')
+parser.add_argument('-r', '--raw', help='raw pixel file for -m file')
+parser.add_argument('-w', '--width', type=int, default=400, help='pixels per row')
+parser.add_argument('-n', '--rows', type=int, default=40)
+parser.add_argument('-p', '--pitch', type=float, default=0.1, help='pixel size in mm')
+parser.add_argument('-f', '--feedrate', type=float, default=6000, help='mm/min')
+parser.add_argument('-o', '--overscan', type=float, default=5, help='mm run up on each side of a row')
+args = parser.parse_args()
+
+if args.mode == 'file' and not args.raw:
+    parser.error('-m file needs -r')
+
+PIXELS_PER_LINE = 60  # two hex digits each, keeps M650 lines under the 128 characters the player reads
+
+
+def pixel(x, y):
+    """rings with a gradient, every value from 0 to 255"""
+    r = math.hypot(x - args.width / 2, (y - args.rows / 2) * 4)
+    return int(round(255 * (0.5 + 0.5 * math.cos(r * 0.15)) * x / (args.width - 1)))
+
+
+raw = bytearray()
+out = ['G21', 'G90', 'G0 X0 Y0 F{:g}'.format(args.feedrate), 'G1 F{:g}'.format(args.feedrate)]
+if args.mode == 'file':
+    out.append('M651 {}'.format(os.path.basename(args.raw)))
+
+for row in range(args.rows):
+    y = row * args.pitch
+    forward = row % 2 == 0
+    pixels = [pixel(i, row) for i in range(args.width)]
+    if not forward:
+        pixels.reverse()
+    start, end = (0.0, args.width * args.pitch) if forward else (args.width * args.pitch, 0.0)
+    run = args.overscan if forward else -args.overscan
+
+    out.append('G0 X{:.3f} Y{:.3f}'.format(start - run, y))
+    out.append('G1 X{:.3f} S0'.format(start))
+    if args.mode == 'line':
+        for i, v in enumerate(pixels):
+            x = start + (i + 1) * args.pitch * (1 if forward else -1)
+            out.append('G1 X{:.3f} S{:.4f}'.format(x, v / 255.0))
+    else:
+        if args.mode == 'inline':
+            for i in range(0, len(pixels), PIXELS_PER_LINE):
+                out.append('M650 ' + ''.join('{:02x}'.format(v) for v in pixels[i:i + PIXELS_PER_LINE]))
+        else:
+            raw += bytearray(pixels)
+            out.append('M650 P{}'.format(len(pixels)))
+        out.append('G1 X{:.3f} S1'.format(end))
+    out.append('G1 X{:.3f} S0'.format(end + run))
+
+if args.mode == 'file':
+    out.append('M651')
+    with open(args.raw, 'wb') as f:
+        f.write(raw)
+print('\n'.join(out))
@@ -0,0 +1,39 @@
+// Host SD card test: shadows the ChaNFS FATFileSystem without the mbed FileSystemLike layer, FatFs is used directly
+#pragma once
+
+#include "ff.h"
+#include "diskio.h"
+
+#define FFSDEBUG(FMT, ...)
+
+namespace mbed {
+class FATFileSystem {
+public:
+    FATFileSystem(const char* n);
+    virtual ~FATFileSystem();
+
+    FATFS _fs;
+    static FATFileSystem *_ffs[_DRIVES];
+    int _fsid;
+
+    virtual int disk_initialize() { return 0; }
+    virtual int disk_status() { return 0; }
+    virtual int disk_read(char *buffer, int sector) = 0;
+    virtual int disk_write(const char *buffer, int sector) = 0;
+    // the same defaults as the firmware's FATFileSystem.h
+    virtual int disk_read_sectors(char *buffer, int sector, int count) {
+        for(int i=0; i<count; i++) {
+            if(disk_read(buffer + i * 512, sector + i)) return 1;
+        }
+        return 0;
+    }
+    virtual int disk_write_sectors(const char *buffer, int sector, int count) {
+        for(int i=0; i<count; i++) {
+            if(disk_write(buffer + i * 512, sector + i)) return 1;
+        }
+        return 0;
+    }
+    virtual int disk_sync() { return 0; }
+    virtual int disk_sectors() = 0;
+};
+}
@@ -0,0 +1,441 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Runs the firmware's SDCard driver, SDFAT and FatFs against an SD card emulated at the SPI byte level.
+    The card answers the SPI mode commands the driver uses, counts them and the bytes clocked, and takes the time a card
+    would as bytes it holds the bus with: the wait for a block to be read and the busy time while it programs one.
+
+    Each test is run with the driver as it is and with one that makes a command for every block and caches nothing,
+    the way it was before multi block transfers. The files written are read back through a new driver to check the
+    cached sectors made it to the card.
+*/
+
+#include "SDCard.h"
+#include "libs/SDFAT.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <deque>
+#include <vector>
+
+// data transfer clock the driver sets
+#define SPI_HZ 2500000
+
+// bytes the card keeps the bus idle or busy for, at 2.5MHz a byte is 3.2us. Around what a cheap card takes
+#define READ_LATENCY    300     // to the first block of a read command
+#define STREAM_LATENCY  4       // between the blocks of CMD18, the card reads ahead
+#define PROGRAM_BUSY    1000    // programming a CMD24 block, or the last blocks of a CMD25 after the stop token
+#define BUFFERED_BUSY   8       // taking each block of a CMD25 into its buffer
+
+class EmulatedCard {
+    public:
+        EmulatedCard(uint32_t blocks) : blocks(blocks) { reset_counts(); }
+
+        void select(bool s) { selected= s; if(!s) cmd_len= 0; }
+        int exchange(int mosi);
+        void reset_counts() { memset(commands, 0, sizeof(commands)); bytes= 0; }
+
+        uint32_t blocks;
+        uint32_t commands[64];
+        uint64_t bytes;
+
+    private:
+        enum { COMMAND, WRITE_TOKEN, WRITE_DATA };
+
+        void execute(int cmd, uint32_t arg);
+        void queue_block(uint32_t block, int latency);
+        void busy(int n) { out.insert(out.end(), n, 0x00); }
+
+        std::map<uint32_t, std::vector<uint8_t>> data; // blocks written, the others read as zeros
+        std::deque<uint8_t> out;                       // what the card sends on the next bytes
+        std::vector<uint8_t> block_in;
+        uint8_t cmd[6];
+        int cmd_len{0};
+        int state{COMMAND};
+        uint32_t address{0};
+        uint32_t acmd41{0};
+        bool selected{false};
+        bool idle{true};
+        bool app{false};
+        bool multi{false};
+        bool streaming{false};
+};
+
+int EmulatedCard::exchange(int mosi)
+{
+    ++bytes;
+    if(!selected) return 0xFF;
+
+    // CMD18 sends blocks until it is stopped
+    if(streaming && out.empty() && address < blocks) queue_block(address++, STREAM_LATENCY);
+
+    int miso= 0xFF;
+    if(!out.empty()) {
+        miso= out.front();
+        out.pop_front();
+    }
+
+    switch(state) {
+        case COMMAND:
+            if(cmd_len == 0 && (mosi & 0xC0) != 0x40) break;
+            cmd[cmd_len++]= mosi;
+            if(cmd_len == 6) {
+                cmd_len= 0;
+                execute(cmd[0] & 0x3F, (cmd[1] << 24) | (cmd[2] << 16) | (cmd[3] << 8) | cmd[4]);
+            }
+            break;
+
+        case WRITE_TOKEN:
+            if(mosi == (multi ? 0xFC : 0xFE)) {
+                block_in.clear();
+                state= WRITE_DATA;
+            } else if(multi && mosi == 0xFD) {
+                out.push_back(0xFF);
+                busy(PROGRAM_BUSY);
+                state= COMMAND;
+            }
+            break;
+
+        case WRITE_DATA:
+            block_in.push_back(mosi);
+            if(block_in.size() == 514) { // and the crc
+                block_in.resize(512);
+                data[address++]= block_in;
+                out.push_back(0xE5); // data accepted
+                busy(multi ? BUFFERED_BUSY : PROGRAM_BUSY);
+                state= multi ? WRITE_TOKEN : COMMAND;
+            }
+            break;
+    }
+
+    return miso;
+}
+
+void EmulatedCard::queue_block(uint32_t block, int latency)
+{
+    out.insert(out.end(), latency, 0xFF);
+    out.push_back(0xFE);
+    auto i= data.find(block);
+    if(i != data.end()) out.insert(out.end(), i->second.begin(), i->second.end());
+    else out.insert(out.end(), 512, 0x00);
+    out.push_back(0xFF); // crc
+    out.push_back(0xFF);
+}
+
+void EmulatedCard::execute(int c, uint32_t arg)
+{
+    bool was_app= app;
+    app= false;
+    ++commands[c];
+
+    if(c == 12) {
+        // the byte after CMD12 is a stuff byte, whatever the card was sending is dropped
+        streaming= false;
+        out.clear();
+        out.push_back(0xFF);
+        out.push_back(0x00);
+        busy(2);
+        return;
+    }
+
+    out.clear();
+    out.push_back(0xFF); // the response comes a byte after the command
+    uint8_t r1= idle ? 0x01 : 0x00;
+
+    if(c == 0) {
+        idle= true;
+        acmd41= 0;
+        out.push_back(0x01);
+
+    } else if(c == 8) {
+        out.push_back(r1);
+        out.push_back(0x00); out.push_back(0x00); out.push_back(0x01); out.push_back(arg & 0xFF);
+
+    } else if(c == 55) {
+        app= true;
+        out.push_back(r1);
+
+    } else if(c == 41 && was_app) {
+        // a few tries before it is ready
+        if(++acmd41 >= 3) idle= false;
+        out.push_back(idle ? 0x01 : 0x00);
+
+    } else if(c == 58) {
+        // powered up and high capacity, block addressed
+        out.push_back(r1);
+        out.push_back(0xC0); out.push_back(0xFF); out.push_back(0x80); out.push_back(0x00);
+
+    } else if(c == 9) {
+        // a version 2 CSD, c_size in bits 69:48 is the size in 512KB units less one
+        uint8_t csd[16] {};
+        uint32_t c_size= blocks / 1024 - 1;
+        csd[0]= 0x40;
+        csd[7]= (c_size >> 16) & 0x3F;
+        csd[8]= c_size >> 8;
+        csd[9]= c_size;
+        out.push_back(0x00);
+        out.insert(out.end(), 2, 0xFF);
+        out.push_back(0xFE);
+        out.insert(out.end(), csd, csd + 16);
+        out.push_back(0xFF);
+        out.push_back(0xFF);
+
+    } else if(c == 16) {
+        out.push_back(r1);
+
+    } else if(c == 17 || c == 18 || c == 24 || c == 25) {
+        if(idle || arg >= blocks) {
+            out.push_back(r1 | 0x20); // address error
+            return;
+        }
+        out.push_back(0x00);
+        address= arg;
+        if(c == 17) {
+            queue_block(address, READ_LATENCY);
+        } else if(c == 18) {
+            queue_block(address++, READ_LATENCY);
+            streaming= true;
+        } else {
+            multi= (c == 25);
+            state= WRITE_TOKEN;
+        }
+
+    } else {
+        out.push_back(r1 | 0x04); // illegal command
+    }
+}
+
+static EmulatedCard *card;
+
+int sim_spi_write(int value)
+{
+    return card->exchange(value);
+}
+
+// the chip select of the card, the only pin the driver uses
+GPIO::GPIO(PinName p) : port((p >> 5) & 7), pin(p & 0x1F) {}
+void GPIO::output() {}
+int GPIO::operator=(int value) { card->select(value == 0); return value; }
+
+namespace mbed {
+FATFileSystem *FATFileSystem::_ffs[_DRIVES] = {0};
+
+FATFileSystem::FATFileSystem(const char* n)
+{
+    for(int i=0; i<_DRIVES; i++) {
+        if(_ffs[i] == 0) {
+            _ffs[i] = this;
+            _fsid = i;
+            f_mount(i, &_fs);
+            return;
+        }
+    }
+}
+
+FATFileSystem::~FATFileSystem()
+{
+    _ffs[_fsid]= 0;
+    f_mount(_fsid, NULL);
+}
+}
+
+DWORD get_fattime(void)
+{
+    return 999;
+}
+
+// the driver before multi block transfers, a command for each block and nothing cached
+class SingleBlockSDCard : public SDCard {
+    public:
+        SingleBlockSDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) : SDCard(mosi, miso, sclk, cs) {}
+
+        int disk_read(char *buffer, uint32_t block_number) { return _read_blocks(buffer, block_number, 1); }
+        int disk_write(const char *buffer, uint32_t block_number) { return _write_blocks(buffer, block_number, 1); }
+        int disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count) { return MSD_Disk::disk_read_blocks(buffer, block_number, count); }
+        int disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count) { return MSD_Disk::disk_write_blocks(buffer, block_number, count); }
+        int disk_sync() { return 0; }
+};
+
+struct Counts {
+    uint32_t single, multi, stop; // read or write commands
+    uint64_t bytes;
+};
+
+static Counts take_counts(bool write)
+{
+    Counts c;
+    c.single= card->commands[write ? 24 : 17];
+    c.multi= card->commands[write ? 25 : 18];
+    c.stop= card->commands[12];
+    c.bytes= card->bytes;
+    card->reset_counts();
+    return c;
+}
+
+static void print_counts(const char *what, bool write, uint32_t size, const Counts& c)
+{
+    double t= c.bytes * 8.0 / SPI_HZ;
+    printf("  %-22s CMD%d %5u  CMD%d %4u  CMD12 %4u  %8llu bytes  %6.3f s  %6.1f KB/s\n", what,
+           write ? 24 : 17, c.single, write ? 25 : 18, c.multi, c.stop, (unsigned long long)c.bytes, t, size / 1024.0 / t);
+}
+
+static uint8_t pattern(uint32_t i, uint32_t seed)
+{
+    return (i * 131 + seed * 7 + (i >> 9)) & 0xFF;
+}
+
+#define FILE_SIZE   (256 * 1024)
+#define WRITE_CHUNK 4096        // an upload buffer
+#define READ_CHUNK  1024        // Player reads ahead this much
+#define SMALL_FILES 32
+
+// the file tests on a freshly formatted card, returns false if a file does not read back as written
+template<class Driver> static bool run_files(const char *name, Counts *counts)
+{
+    EmulatedCard emulated(128 * 1024 * 2); // 128MB
+    card= &emulated;
+    bool ok= true;
+    static uint8_t buf[WRITE_CHUNK];
+    FIL_t f;
+    UINT n;
+
+    {
+        Driver sd(LPC_PIN(0, 9), LPC_PIN(0, 8), LPC_PIN(0, 7), LPC_PIN(0, 6));
+        SDFAT fs("sd", &sd);
+        if(f_mkfs(fs._fsid, 0, 16384) != FR_OK) {
+            printf("%s: f_mkfs failed\n", name);
+            return false;
+        }
+        card->reset_counts();
+
+        // a large file written like an upload
+        f_open(&f, "/upload.g", FA_WRITE | FA_CREATE_ALWAYS);
+        for(uint32_t pos= 0; pos < FILE_SIZE; pos += WRITE_CHUNK) {
+            for(int i= 0; i < WRITE_CHUNK; i++) buf[i]= pattern(pos + i, 1);
+            f_write(&f, buf, WRITE_CHUNK, &n);
+        }
+        f_close(&f);
+        counts[0]= take_counts(true);
+
+        // and many small ones, the directory and the FAT are where they go
+        f_mkdir("/small");
+        for(int k= 0; k < SMALL_FILES; k++) {
+            char fn[32];
+            snprintf(fn, sizeof(fn), "/small/file%d.g", k);
+            for(int i= 0; i < 700; i++) buf[i]= pattern(i, k);
+            f_open(&f, fn, FA_WRITE | FA_CREATE_ALWAYS);
+            f_write(&f, buf, 700, &n);
+            f_close(&f);
+        }
+        counts[1]= take_counts(true);
+    }
+
+    // read back through a new driver, nothing can come from the cache of the one that wrote them
+    Driver sd(LPC_PIN(0, 9), LPC_PIN(0, 8), LPC_PIN(0, 7), LPC_PIN(0, 6));
+    SDFAT fs("sd", &sd);
+    f_open(&f, "/upload.g", FA_READ);
+    card->reset_counts();
+    uint32_t total= 0;
+    while(f_read(&f, buf, READ_CHUNK, &n) == FR_OK && n > 0) {
+        for(UINT i= 0; i < n; i++) {
+            if(buf[i] != pattern(total + i, 1)) ok= false;
+        }
+        total += n;
+    }
+    f_close(&f);
+    counts[2]= take_counts(false);
+    if(total != FILE_SIZE) ok= false;
+
+    for(int k= 0; k < SMALL_FILES; k++) {
+        char fn[32];
+        snprintf(fn, sizeof(fn), "/small/file%d.g", k);
+        if(f_open(&f, fn, FA_READ) != FR_OK || f_read(&f, buf, sizeof(buf), &n) != FR_OK || n != 700) {
+            ok= false;
+            continue;
+        }
+        for(int i= 0; i < 700; i++) {
+            if(buf[i] != pattern(i, k)) ok= false;
+        }
+        f_close(&f);
+    }
+    counts[3]= take_counts(false);
+
+    if(!ok) printf("%s: the files did not read back as written\n", name);
+    return ok;
+}
+
+// the cached sectors and the multi block transfers over them must agree
+static bool run_coherence()
+{
+    EmulatedCard emulated(128 * 1024 * 2);
+    card= &emulated;
+    SDCard sd(LPC_PIN(0, 9), LPC_PIN(0, 8), LPC_PIN(0, 7), LPC_PIN(0, 6));
+    if(sd.disk_initialize() != 0) {
+        printf("coherence: the card did not initialise\n");
+        return false;
+    }
+
+    static char a[8 * 512], b[8 * 512];
+    bool ok= true;
+
+    // 100..107 on the card, then 102 changed in the cache only
+    for(int i= 0; i < 8 * 512; i++) a[i]= pattern(i, 2);
+    sd.disk_write_blocks(a, 100, 8);
+    for(int i= 0; i < 512; i++) a[2 * 512 + i]= pattern(i, 3);
+    sd.disk_write(a + 2 * 512, 102);
+    sd.disk_read_blocks(b, 100, 8);
+    if(memcmp(a, b, sizeof(a)) != 0) { printf("coherence: a multi block read missed a cached write\n"); ok= false; }
+
+    // a multi block write over a cached sector replaces it
+    for(int i= 0; i < 8 * 512; i++) a[i]= pattern(i, 4);
+    sd.disk_write_blocks(a, 100, 8);
+    sd.disk_read(b, 102);
+    if(memcmp(a + 2 * 512, b, 512) != 0) { printf("coherence: a cached sector was not updated by a multi block write\n"); ok= false; }
+
+    // a dirty sector is evicted to the card when the cache is full, and the rest when synced
+    for(int k= 0; k < 2 * SD_CACHE_SECTORS + 2; k++) {
+        for(int i= 0; i < 512; i++) a[i]= pattern(i, 10 + k);
+        sd.disk_write(a, 200 + k);
+    }
+    sd.disk_sync();
+    SDCard other(LPC_PIN(0, 9), LPC_PIN(0, 8), LPC_PIN(0, 7), LPC_PIN(0, 6));
+    other.disk_initialize();
+    for(int k= 0; k < 2 * SD_CACHE_SECTORS + 2; k++) {
+        for(int i= 0; i < 512; i++) a[i]= pattern(i, 10 + k);
+        other.disk_read(b, 200 + k);
+        if(memcmp(a, b, 512) != 0) { printf("coherence: sector %d did not reach the card\n", 200 + k); ok= false; }
+    }
+
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    static const char *tests[] = { "upload 256KB", "32 small files", "play 256KB", "read 32 small files" };
+    static const bool writes[] = { true, true, false, false };
+    Counts before[4], after[4];
+
+    bool ok= run_coherence();
+    ok= run_files<SingleBlockSDCard>("single block", before) && ok;
+    ok= run_files<SDCard>("multi block", after) && ok;
+
+    printf("SD card emulated at %d Hz SPI, %d sectors cached\n", SPI_HZ, SD_CACHE_SECTORS);
+    for(int i= 0; i < 4; i++) {
+        printf("%s\n", tests[i]);
+        print_counts("single block, no cache", writes[i], i == 0 || i == 2 ? FILE_SIZE : SMALL_FILES * 700, before[i]);
+        print_counts("multi block, cached", writes[i], i == 0 || i == 2 ? FILE_SIZE : SMALL_FILES * 700, after[i]);
+    }
+
+    if(!ok) {
+        printf("FAILED\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""\
+Runs a gcode file through smoothiesim without and with input shaping and writes the step timeline of both as CSV
+
+    shapetimeline.py [-e smoothiesim] -c config [-o "key value"]... [-f Hz] [-z damping] [-p ms] [-m motors]
+                     [-s timeline.svg] file.gcode timeline.csv
+
+The unshaped run has the input shaper of every motor set to none, the shaped one is the config with the -o options.
+The CSV has the time and the position of each motor in mm, unshaped then shaped, every -p ms (default 1).
+
+The head of each motor is modelled as a mass on a spring, ringing at -f Hz (default 40) with a damping ratio of -z
+(default 0.1), carried by the motor. The ringing is how far the head is from the motor once the steady lag of the
+spring is taken out, the peak and RMS of it are printed for both runs.
+"""
+
+import csv
+import getopt
+import math
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+NAMES = ['alpha', 'beta', 'gamma', 'delta', 'epsilon', 'zeta']
+AXES = 'XYZABC'
+DEFAULT_STEPS_PER_MM = [80.0, 80.0, 2560.0, 80.0, 80.0, 80.0]
+MODEL_RATE = 10000  # Hz the spring is worked out at
+
+WIDTH = 1200
+HEIGHT = 300
+MARGIN = 50
+
+
+def read_config(filename, options):
+    config = {}
+    with open(filename) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    for o in options:
+        words = o.split()
+        if len(words) >= 2:
+            config[words[0]] = words[1]
+    return config
+
+
+def run(sim, config, options, gcode, trace):
+    args = [sim, '-c', config]
+    for o in options:
+        args += ['-o', o]
+    args += ['-t', trace, gcode]
+    out = subprocess.run(args, stdout=subprocess.PIPE, universal_newlines=True)
+    if out.returncode != 0 or 'ERROR' in out.stdout:
+        print(out.stdout)
+        sys.exit(1)
+    return [l for l in out.stdout.splitlines() if l.startswith('lines:')]
+
+
+# returns the tick frequency and for each motor the ticks it stepped on and the position after each step
+def read_trace(filename):
+    with open(filename, 'rb') as f:
+        data = f.read()
+    magic, version, n_motors, frequency = struct.unpack_from('<4sHHI', data, 0)
+    if magic != b'SMST':
+        print('{} is not a step trace'.format(filename))
+        sys.exit(1)
+    steps = [([], []) for _ in range(n_motors)]
+    direction = [False] * n_motors
+    position = [0] * n_motors
+    for tick, channel, level in struct.iter_unpack('<IBB', data[12:]):
+        m = channel >> 1
+        if channel & 1:
+            direction[m] = level != 0
+        elif level:
+            position[m] += -1 if direction[m] else 1
+            steps[m][0].append(tick)
+            steps[m][1].append(position[m])
+    return frequency, steps
+
+
+# the position of a motor every period ticks up to end
+def sample(ticks, positions, period, end):
+    out = []
+    i = 0
+    p = 0
+    for t in range(0, end + 1, period):
+        while i < len(ticks) and ticks[i] <= t:
+            p = positions[i]
+            i += 1
+        out.append(p)
+    return out
+
+
+# the head follows the motor through a spring and damper, the ringing is how far it is from the motor less the mean of
+# that over one ringing period, which is the lag of the spring
+def ringing(u, frequency, damping):
+    dt = 1.0 / MODEL_RATE
+    w = 2 * math.pi * frequency
+    x = u[0]
+    v = 0.0
+    z = []
+    for i in range(len(u)):
+        du = (u[i] - u[i - 1]) / dt if i > 0 else 0.0
+        v += (w * w * (u[i] - x) + 2 * damping * w * (du - v)) * dt
+        x += v * dt
+        z.append(x - u[i])
+
+    n = max(1, int(MODEL_RATE / frequency))
+    total = 0.0
+    peak = 0.0
+    square = 0.0
+    window = 0.0
+    for i in range(len(z)):
+        window += z[i]
+        if i >= n:
+            window -= z[i - n]
+        if i >= n - 1:
+            r = z[i - n // 2] - window / n
+            peak = max(peak, abs(r))
+            square += r * r
+            total += 1
+    return peak, math.sqrt(square / total) if total else 0.0
+
+
+def polyline(points, colour):
+    return '<polyline fill="none" stroke="{}" stroke-width="1" points="{}"/>\n'.format(
+        colour, ' '.join('{:.1f},{:.1f}'.format(x, y) for x, y in points))
+
+
+def svg(filename, times, columns):
+    out = '<svg xmlns="http://www.w3.org/2000/svg" width="{}" height="{}" font-family="sans-serif">\n'.format(
+        WIDTH, len(columns) * (HEIGHT + MARGIN) + MARGIN)
+    out += '<rect width="100%" height="100%" fill="white"/>\n'
+    t0, t1 = times[0], times[-1] if times[-1] > times[0] else times[0] + 1
+    for k, (name, unshaped, shaped) in enumerate(columns):
+        top = MARGIN + k * (HEIGHT + MARGIN)
+        vmin, vmax = min(unshaped + shaped), max(unshaped + shaped)
+        if vmax == vmin:
+            vmax = vmin + 1
+
+        def x(t):
+            return MARGIN + (t - t0) * (WIDTH - 2 * MARGIN) / (t1 - t0)
+
+        def y(v):
+            return top + HEIGHT - (v - vmin) * HEIGHT / (vmax - vmin)
+
+        out += '<rect x="{}" y="{}" width="{}" height="{}" fill="none" stroke="black"/>\n'.format(
+            MARGIN, top, WIDTH - 2 * MARGIN, HEIGHT)
+        out += polyline([(x(t), y(v)) for t, v in zip(times, unshaped)], 'gray')
+        out += polyline([(x(t), y(v)) for t, v in zip(times, shaped)], 'blue')
+        out += '<text x="{}" y="{}" font-size="12">{} mm ({:.3f} to {:.3f}): unshaped gray, shaped blue</text>\n'.format(
+            MARGIN, top - 8, name, vmin, vmax)
+    out += '</svg>\n'
+    with open(filename, 'w') as f:
+        f.write(out)
+
+
+def main():
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], 'e:c:o:f:z:p:m:s:')
+    except getopt.GetoptError:
+        args = []
+        opts = []
+    sim = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'smoothiesim')
+    config = None
+    options = []
+    frequency = 40.0
+    damping = 0.1
+    period_ms = 1.0
+    motors = None
+    svg_filename = None
+    for o, a in opts:
+        if o == '-e':
+            sim = a
+        elif o == '-c':
+            config = a
+        elif o == '-o':
+            options.append(a)
+        elif o == '-f':
+            frequency = float(a)
+        elif o == '-z':
+            damping = float(a)
+        elif o == '-p':
+            period_ms = float(a)
+        elif o == '-m':
+            motors = a.upper()
+        elif o == '-s':
+            svg_filename = a
+    if config is None or len(args) != 2:
+        print(__doc__)
+        sys.exit(1)
+
+    settings = read_config(config, options)
+    with tempfile.TemporaryDirectory() as tmp:
+        unshaped_trace = os.path.join(tmp, 'unshaped.bin')
+        shaped_trace = os.path.join(tmp, 'shaped.bin')
+        print('unshaped', *run(sim, config, options + ['{}_input_shaper none'.format(n) for n in NAMES], args[0], unshaped_trace))
+        print('shaped  ', *run(sim, config, options, args[0], shaped_trace))
+        _, unshaped = read_trace(unshaped_trace)
+        tick_frequency, shaped = read_trace(shaped_trace)
+
+    end = max([t[-1] for t, _ in unshaped + shaped if t] + [0])
+    period = max(1, int(tick_frequency * period_ms / 1000))
+    model_period = max(1, tick_frequency // MODEL_RATE)
+
+    columns = []
+    for m in range(len(shaped)):
+        if motors is not None and AXES[m] not in motors:
+            continue
+        if not unshaped[m][0] and not shaped[m][0]:
+            continue
+        spm = float(settings.get(NAMES[m] + '_steps_per_mm', DEFAULT_STEPS_PER_MM[m]))
+        results = []
+        for steps in (unshaped[m], shaped[m]):
+            u = [p / spm for p in sample(steps[0], steps[1], model_period, end)]
+            results.append(ringing(u, frequency, damping))
+        print('motor {}: ringing at {:g} Hz, unshaped peak {:.4f} mm rms {:.4f} mm, shaped peak {:.4f} mm rms {:.4f} mm'.format(
+            AXES[m], frequency, results[0][0], results[0][1], results[1][0], results[1][1]))
+        columns.append((AXES[m],
+                        [p / spm for p in sample(unshaped[m][0], unshaped[m][1], period, end)],
+                        [p / spm for p in sample(shaped[m][0], shaped[m][1], period, end)]))
+
+    times = [t / tick_frequency for t in range(0, end + 1, period)]
+    with open(args[1], 'w') as f:
+        w = csv.writer(f)
+        w.writerow(['time'] + [c for name, _, _ in columns for c in (name + '_unshaped', name + '_shaped')])
+        for i, t in enumerate(times):
+            w.writerow(['{:.4f}'.format(t)] + ['{:.5f}'.format(v) for _, a, b in columns for v in (a[i], b[i])])
+
+    if svg_filename is not None:
+        svg(svg_filename, times, columns)
+
+
+if __name__ == '__main__':
+    main()
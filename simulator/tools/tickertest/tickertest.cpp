@@ -0,0 +1,240 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Runs the firmware's SlowTicker against an emulated TIMER2 with the hooks a printer with a laser attaches.
+    The timer counts at SystemCoreClock/4, each match is taken as an interrupt and a hook advances the counter by the
+    cycles it is given, so the ISR time the ticker measures is the time the hooks were given.
+
+    Every hook must be called at its frequency and on time, over long enough for the counter to wrap, including a hook
+    attached while the ticker runs. The interrupts and the cycles spent are compared with the ticker it replaced, which
+    interrupted at the fastest frequency and walked every hook each time. Then a hook takes much longer than its period
+    once, the others must be called once for the time they missed and go on at their frequency.
+*/
+
+#include "SlowTicker.h"
+#include "libs/Kernel.h"
+#include "libs/StreamOutput.h"
+#include "gpio.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// cycles of an interrupt entry and exit, of the old ticker visiting a hook, and of the new one reordering a group it
+// called. Estimates for a Cortex-M3 running from flash, only used to compare the two
+#define IRQ_CYCLES          40
+#define POLL_HOOK_CYCLES    12
+#define GROUP_CYCLES        80
+
+// the emulated hardware, the ticker only uses the timer and the ISP button pin
+LPC_GPIO_TypeDef   sim_gpio[5];
+LPC_TIM_TypeDef    sim_tim[4];
+LPC_SC_TypeDef     sim_sc;
+LPC_PINCON_TypeDef sim_pincon;
+LPC_WDT_TypeDef    sim_wdt;
+uint32_t SystemCoreClock = 120000000; // LPC1769
+
+void sim_gpio_write(LPC_GPIO_TypeDef *port, uint32_t mask, bool set) {}
+
+static int debugbreaks;
+extern "C" void __debugbreak(void) { ++debugbreaks; }
+
+// the ticker is loaded like any module, there is no kernel to route its events
+Kernel* Kernel::instance;
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod) {}
+void Kernel::call_event(_EVENT_ENUM id_event, void * argument) {}
+bool is_whitespace(int c) { return c == ' ' || c == '\t'; }
+GPIO::GPIO(PinName pin) : port(0), pin(0) {}
+int GPIO::operator=(int value) { return value; }
+GPIO leds[5] = { GPIO(P1_18), GPIO(P1_19), GPIO(P1_20), GPIO(P1_21), GPIO(P4_28) };
+
+extern "C" void TIMER2_IRQHandler (void);
+
+class StdoutStream : public StreamOutput {
+    public:
+        int puts(const char *s) { return fputs(s, stdout); }
+};
+
+static uint64_t now;            // timer ticks since the ticker started, the counter is its low 32 bits
+static uint32_t interrupts;
+
+// the time in the interrupt being taken, the hooks advance the counter
+static uint64_t time_now()
+{
+    return now + (uint32_t)(LPC_TIM2->TC - (uint32_t)now);
+}
+
+class TestHook {
+    public:
+        TestHook(const char *name, uint32_t frequency, uint32_t cycles) : name(name), frequency(frequency), cycles(cycles) {}
+
+        uint32_t run(uint32_t)
+        {
+            // how far from its deadline the hook is called, the hooks before it in the interrupt make it late and it
+            // can be called early with another group
+            uint64_t at = time_now();
+            uint64_t due = attached + (uint64_t)(calls + 1) * interval;
+            uint64_t off = at > due ? at - due : due - at;
+            if(off > jitter) jitter = off;
+            ++calls;
+
+            uint32_t c = cycles;
+            if(overrun_cycles > 0) {
+                c = overrun_cycles;
+                overrun_cycles = 0;
+            }
+            LPC_TIM2->TC += c / 4;
+            return 0;
+        }
+
+        const char *name;
+        uint32_t frequency;
+        uint32_t cycles;
+        uint32_t interval{0};
+        uint32_t calls{0};
+        uint64_t attached{0};
+        uint64_t jitter{0};
+        uint32_t overrun_cycles{0}; // taken by the next call instead of cycles
+};
+
+// runs the timer to the match, takes the interrupt and lets the hooks advance the counter, until the time is up
+static void run_until(uint64_t end)
+{
+    while(now < end) {
+        uint32_t to_match = LPC_TIM2->MR0 - LPC_TIM2->TC;
+        now += to_match;
+        LPC_TIM2->TC = LPC_TIM2->MR0;
+        LPC_TIM2->IR |= 1;
+
+        LPC_TIM2->TC += IRQ_CYCLES / 4;
+        TIMER2_IRQHandler();
+        now = time_now();
+        ++interrupts;
+    }
+}
+
+// a hook was called as often as it should have been in the time since it was attached or last checked
+static bool check_calls(TestHook *h, uint64_t elapsed, uint32_t calls, uint32_t missed)
+{
+    uint32_t expected = elapsed / h->interval;
+    return calls + missed + 1 >= expected && calls <= expected + 1;
+}
+
+int main(int argc, char *argv[])
+{
+    const uint32_t tick_hz = SystemCoreClock / 4;
+    const uint32_t seconds = 200;   // the counter wraps after 143 seconds
+    const uint32_t late_us = 100;   // the most a hook can be called after it was due, the hooks before it take some of it
+    const uint32_t early = 64;      // and a group can be called 1/64 of its period early
+    int failures = 0;
+
+    // the ISP button is pulled up
+    sim_gpio[2].FIOPIN |= 1 << 10;
+
+    SlowTicker *ticker = new SlowTicker();
+
+    std::vector<TestHook*> hooks = {
+        new TestHook("hotend pwm", 2000, 150),
+        new TestHook("bed pwm", 2000, 150),
+        new TestHook("hotend thermistor", 20, 400),
+        new TestHook("bed thermistor", 20, 400),
+        new TestHook("endstops", 1000, 120),
+        new TestHook("zprobe", 1000, 60),
+        new TestHook("laser", 1000, 100),
+        new TestHook("fan sigma delta", 1000, 60),
+        new TestHook("filament detector", 100, 80),
+        new TestHook("switch pin poll", 100, 60),
+        new TestHook("network", 100, 200),
+        new TestHook("kill button", 5, 60),
+        new TestHook("play led", 12, 40),
+    };
+    for(TestHook *h : hooks) h->interval = ticker->attach(h->frequency, h, &TestHook::run)->interval;
+    ticker->start();
+
+    // a hook attached while it runs, the stats are counted from then
+    run_until((uint64_t)tick_hz * 3 / 2);
+    TestHook *late_hook = new TestHook("attached later", 2000, 100);
+    late_hook->interval = ticker->attach(late_hook->frequency, late_hook, &TestHook::run)->interval;
+    late_hook->attached = now;
+    hooks.push_back(late_hook);
+    uint64_t late_start = now;
+    ticker->reset_stats();
+
+    run_until((uint64_t)tick_hz * seconds);
+
+    printf("%lu s:\n", (unsigned long)seconds);
+    uint64_t hook_cycles = 0;
+    uint32_t fastest = 0;
+    std::vector<uint32_t> frequencies = { 1, 5 }; // the ticker's own hooks
+    for(TestHook *h : hooks) {
+        uint64_t elapsed = (h == late_hook) ? now - late_start : now;
+        uint32_t jitter = h->jitter * 1000000ULL / tick_hz;
+        bool ok = check_calls(h, elapsed, h->calls, 0) && jitter < late_us + 1000000 / h->frequency / early;
+        printf("%-18s %4lu Hz: %7lu calls, at most %4lu us off %s\n", h->name, (unsigned long)h->frequency,
+               (unsigned long)h->calls, (unsigned long)jitter, ok ? "" : "FAIL");
+        if(!ok) ++failures;
+
+        hook_cycles += (uint64_t)h->calls * h->cycles;
+        if(h->frequency > fastest) fastest = h->frequency;
+        bool seen = false;
+        for(uint32_t f : frequencies) seen = seen || f == h->frequency;
+        if(!seen) frequencies.push_back(h->frequency);
+    }
+    if(debugbreaks > 0) {
+        printf("the ISP button was seen pressed %d times FAIL\n", debugbreaks);
+        ++failures;
+    }
+
+    // the ticker's own stats
+    printf("\n");
+    StdoutStream out;
+    ticker->print_stats(&out);
+
+    // the old ticker visited every hook on each interrupt, the groups are reordered once per period
+    uint32_t nhooks = hooks.size() + 2;
+    uint64_t group_calls = 0;
+    for(uint32_t f : frequencies) group_calls += (uint64_t)f * seconds;
+    uint64_t polled = (uint64_t)fastest * seconds;
+    uint64_t cycles_old = polled * (IRQ_CYCLES + nhooks * POLL_HOOK_CYCLES) + hook_cycles;
+    uint64_t cycles_new = (uint64_t)interrupts * IRQ_CYCLES + group_calls * GROUP_CYCLES + hook_cycles;
+    printf("\n%lu hooks at %lu frequencies, %1.3f%% cpu in the hooks\n", (unsigned long)nhooks, (unsigned long)frequencies.size(),
+           hook_cycles * 100.0 / ((double)SystemCoreClock * seconds));
+    printf("tick at %lu Hz, walk every hook: %8llu interrupts, %1.3f%% cpu\n", (unsigned long)fastest, (unsigned long long)polled,
+           cycles_old * 100.0 / ((double)SystemCoreClock * seconds));
+    printf("deadline ordered groups:        %8lu interrupts, %1.3f%% cpu\n", (unsigned long)interrupts,
+           cycles_new * 100.0 / ((double)SystemCoreClock * seconds));
+
+    // a thermistor read that takes 100ms once, then a second more
+    TestHook *overrun_hook = hooks[2];
+    overrun_hook->overrun_cycles = SystemCoreClock / 10;
+    std::vector<uint32_t> calls;
+    for(TestHook *h : hooks) calls.push_back(h->calls);
+    uint64_t overrun_start = now;
+    run_until(now + tick_hz);
+
+    bool ok = true;
+    for(size_t i = 0; i < hooks.size(); ++i) {
+        TestHook *h = hooks[i];
+        // the periods in the 100ms are missed, less the one that was called late
+        uint32_t missed = tick_hz / 10 / h->interval;
+        if(!check_calls(h, now - overrun_start, h->calls - calls[i], missed)) {
+            printf("%s: %lu calls after a hook took 100ms FAIL\n", h->name, (unsigned long)(h->calls - calls[i]));
+            ok = false;
+        }
+    }
+    printf("\nafter a hook took 100ms the others went on at their frequency %s\n", ok ? "" : "FAIL");
+    if(!ok) ++failures;
+
+    if(failures > 0) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
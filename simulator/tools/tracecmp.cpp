@@ -0,0 +1,123 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Compares two step traces written by smoothiesim -t (see StepTrace.h)
+    The n'th step of each motor in the second trace is compared to the n'th step in the first one,
+    the steps must go in the same direction and the difference in ticks is the step timing error.
+    As a late block end delays everything after it the difference between step intervals is also shown,
+    that is the jitter the motor actually sees.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+struct Steps {
+    std::vector<uint32_t> ticks;
+    std::vector<bool> dirs;
+};
+
+static bool load(const char *fn, std::vector<Steps>& motors, uint32_t& frequency)
+{
+    FILE *fp= fopen(fn, "rb");
+    if(fp == nullptr) {
+        fprintf(stderr, "Unable to open %s\n", fn);
+        return false;
+    }
+
+    uint8_t hdr[12];
+    if(fread(hdr, 1, sizeof(hdr), fp) != sizeof(hdr) || memcmp(hdr, "SMST", 4) != 0) {
+        fprintf(stderr, "%s is not a step trace\n", fn);
+        fclose(fp);
+        return false;
+    }
+
+    uint16_t n_motors= hdr[6] | (hdr[7] << 8);
+    frequency= hdr[8] | (hdr[9] << 8) | (hdr[10] << 16) | ((uint32_t)hdr[11] << 24);
+    motors.assign(n_motors, Steps());
+    std::vector<bool> dir(n_motors, false);
+
+    uint8_t r[6];
+    while(fread(r, 1, sizeof(r), fp) == sizeof(r)) {
+        uint32_t tick= r[0] | (r[1] << 8) | (r[2] << 16) | ((uint32_t)r[3] << 24);
+        uint8_t m= r[4] >> 1;
+        if(m >= n_motors) continue;
+        if(r[4] & 1) {
+            dir[m]= r[5] != 0;
+        } else {
+            motors[m].ticks.push_back(tick);
+            motors[m].dirs.push_back(dir[m]);
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc != 3) {
+        fprintf(stderr, "Usage: %s reference.bin test.bin\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<Steps> ref, test;
+    uint32_t ref_freq, test_freq;
+    if(!load(argv[1], ref, ref_freq) || !load(argv[2], test, test_freq)) return 2;
+
+    if(ref.size() != test.size() || ref_freq != test_freq) {
+        fprintf(stderr, "traces are for different machines\n");
+        return 1;
+    }
+
+    int ret= 0;
+    for (size_t m = 0; m < ref.size(); ++m) {
+        const Steps& a= ref[m];
+        const Steps& b= test[m];
+        if(a.ticks.size() != b.ticks.size()) {
+            printf("motor %c: step count differs %zu vs %zu\n", "XYZABC"[m], a.ticks.size(), b.ticks.size());
+            ret= 1;
+            continue;
+        }
+        if(a.ticks.empty()) continue;
+
+        uint64_t max_err= 0, max_ierr= 0;
+        double sum= 0, sum2= 0, isum2= 0;
+        for (size_t i = 0; i < a.ticks.size(); ++i) {
+            if(a.dirs[i] != b.dirs[i]) {
+                printf("motor %c: step %zu goes the other way\n", "XYZABC"[m], i);
+                ret= 1;
+                break;
+            }
+            int64_t e= (int64_t)b.ticks[i] - (int64_t)a.ticks[i];
+            uint64_t ae= e < 0 ? -e : e;
+            if(ae > max_err) max_err= ae;
+            sum += ae;
+            sum2 += (double)e * e;
+
+            if(i > 0) {
+                int64_t ie= ((int64_t)b.ticks[i] - b.ticks[i - 1]) - ((int64_t)a.ticks[i] - a.ticks[i - 1]);
+                uint64_t aie= ie < 0 ? -ie : ie;
+                if(aie > max_ierr) max_ierr= aie;
+                isum2 += (double)ie * ie;
+            }
+        }
+
+        double us_per_tick= 1e6 / ref_freq;
+        size_t n= a.ticks.size();
+        printf("motor %c: %zu steps, timing error max %llu ticks (%1.1f us), mean %1.3f ticks, rms %1.3f ticks, last step %+lld ticks\n",
+               "XYZABC"[m], n, (unsigned long long)max_err, max_err * us_per_tick, sum / n, sqrt(sum2 / n),
+               (long long)b.ticks[n - 1] - (long long)a.ticks[n - 1]);
+        printf("         step interval error max %llu ticks (%1.1f us), rms %1.3f ticks\n",
+               (unsigned long long)max_ierr, max_ierr * us_per_tick, sqrt(isum2 / n));
+    }
+
+    return ret;
+}
@@ -0,0 +1,57 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Runs the easyunit tests of src/testframework/unittests on the host, in place of Test_main.cpp and Test_kernel.cpp.
+    The kernel is the simulator's, created once from the config given on the command line with the queue started and
+    nothing stepping, so a test can append moves and look at how they were planned. The sd card is the directory
+    given with -m, the tests that read and write /sd files need it.
+*/
+
+#include "libs/Kernel.h"
+#include "MemoryPool.h"
+#include "platform_memory.h"
+#include "modules/robot/Conveyor.h"
+#include "modules/robot/Robot.h"
+#include "SimHal.h"
+
+#include "easyunit/testharness.h"
+
+#include <stdio.h>
+#include <string>
+#include <unistd.h>
+
+extern std::string sim_config_filename;
+
+static uint8_t ahb0_buffer[16384] __attribute__ ((aligned (8)));
+static uint8_t ahb1_buffer[16384] __attribute__ ((aligned (8)));
+
+int main(int argc, char *argv[])
+{
+    int opt;
+    while((opt = getopt(argc, argv, "c:m:")) != -1) {
+        switch(opt) {
+            case 'c': sim_config_filename = optarg; break;
+            case 'm': sim_hal.sd_root = optarg; break;
+            default:
+                fprintf(stderr, "Usage: %s -c config [-m dir]\n", argv[0]);
+                return 2;
+        }
+    }
+    if(sim_config_filename.empty()) {
+        fprintf(stderr, "Usage: %s -c config [-m dir]\n", argv[0]);
+        return 2;
+    }
+
+    _AHB0 = new MemoryPool(ahb0_buffer, sizeof(ahb0_buffer));
+    _AHB1 = new MemoryPool(ahb1_buffer, sizeof(ahb1_buffer));
+    new Kernel();
+    THECONVEYOR->start(THEROBOT->get_number_registered_motors());
+
+    const TestResult *result = TestRegistry::runAndPrint();
+    return result->getFailures() > 0 || result->getErrors() > 0 ? 1 : 0;
+}
@@ -137,6 +137,24 @@ DirHandle *FATFileSystem::opendir(const char *name) {
     return new FATDirHandle(dir);
 }
 
+int FATFileSystem::stat(const char *name, uint32_t *size, uint32_t *date_time) {
+    char n[64];
+    sprintf(n, "%d:/%s", _fsid, name);
+    FILINFO finfo;
+#if _USE_LFN
+    finfo.lfname = NULL;
+    finfo.lfsize = 0;
+#endif
+    FRESULT res = f_stat(n, &finfo);
+    if(res) {
+        FFSDEBUG("f_stat() failed (%d, %s)\n", res, FR_ERRORS[res]);
+        return -1;
+    }
+    *size = finfo.fsize;
+    *date_time = ((uint32_t)finfo.fdate << 16) | finfo.ftime;
+    return 0;
+}
+
 int FATFileSystem::mkdir(const char *name, mode_t mode) {
     FRESULT res = f_mkdir(name);
     return res == 0 ? 0 : -1;
@@ -24,6 +24,8 @@
 #include "ff.h"
 #include "diskio.h"
 
+#include <stdint.h>
+
 namespace mbed {
 /* Class: FATFileSystem
  * The class itself
@@ -43,6 +45,8 @@ public:
     virtual int format();
     virtual DirHandle *opendir(const char *name);
     virtual int mkdir(const char *name, mode_t mode);
+    // size and last modified date and time of a file, the date in the top 16 bits like FatFs has them
+    int stat(const char *name, uint32_t *size, uint32_t *date_time);
 
     FATFS _fs;                                // Work area (file system object) for logical drive
     static FATFileSystem *_ffs[_DRIVES];    // FATFileSystem objects, as parallel to FatFs drives array
@@ -52,6 +56,19 @@ public:
     virtual int disk_status() { return 0; }
     virtual int disk_read(char *buffer, int sector) = 0;
     virtual int disk_write(const char *buffer, int sector) = 0;
+    // consecutive sectors, override these if the disk can transfer several in one go
+    virtual int disk_read_sectors(char *buffer, int sector, int count) {
+        for(int i=0; i<count; i++) {
+            if(disk_read(buffer + i * 512, sector + i)) return 1;
+        }
+        return 0;
+    }
+    virtual int disk_write_sectors(const char *buffer, int sector, int count) {
+        for(int i=0; i<count; i++) {
+            if(disk_write(buffer + i * 512, sector + i)) return 1;
+        }
+        return 0;
+    }
     virtual int disk_sync() { return 0; }
     virtual int disk_sectors() = 0;
 
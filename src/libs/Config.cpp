@@ -80,6 +80,7 @@ void Config::config_cache_load(bool parse)
         for( ConfigSource *source : this->config_sources ) {
             source->transfer_values_to_cache(this->config_cache);
         }
+        this->config_cache->build_index();
     }
 }
 
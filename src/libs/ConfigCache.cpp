@@ -3,8 +3,13 @@
 
 #include "libs/StreamOutput.h"
 
+#include <algorithm>
+#include <string.h>
+#include <stdio.h>
+
 ConfigCache::ConfigCache()
 {
+    indexed= true;
 }
 
 ConfigCache::~ConfigCache()
@@ -19,11 +24,14 @@ void ConfigCache::clear()
     }
     store.clear();
     storage_t().swap(store);   //  makes sure the vector releases its memory
+    vector<uint16_t>().swap(index);
+    indexed= true;
 }
 
 void ConfigCache::add(ConfigValue *v)
 {
     store.push_back(v);
+    indexed= false;
 }
 
 void ConfigCache::pop()
@@ -31,45 +39,94 @@ void ConfigCache::pop()
     auto cv= store.back();
     store.pop_back();
     delete cv;
+    indexed= false;
 }
 
-// If we find an existing value, replace it, otherwise, push it at the back of the list
+// the duplicates are found when the index is built, going through the whole list for each line made loading a big
+// config take the square of its lines
 void ConfigCache::replace_or_push_back(ConfigValue *new_value)
 {
-    // For each already existing element
-    for(auto &cv : store) {
-        // If this configvalue matches the checksum
-        if(memcmp(new_value->check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0) {
-            // Replace with the provided value
-            delete cv; // free up old one
-            cv =  new_value;
+    add(new_value);
+}
+
+// by check sums then by position, so the first of several values with the same check sums comes first
+bool ConfigCache::key_less(uint16_t a, uint16_t b) const
+{
+    const uint16_t *ca= store[a]->check_sums, *cb= store[b]->check_sums;
+    if(ca[0] != cb[0]) return ca[0] < cb[0];
+    if(ca[1] != cb[1]) return ca[1] < cb[1];
+    if(ca[2] != cb[2]) return ca[2] < cb[2];
+    return a < b;
+}
+
+void ConfigCache::build_index()
+{
+    if(indexed) return;
+
+    index.resize(store.size());
+    for (size_t i = 0; i < store.size(); ++i) index[i]= i;
+    std::sort(index.begin(), index.end(), [this](uint16_t a, uint16_t b) { return key_less(a, b); });
+
+    // a key read again replaces the value where it was first read, like a config-override line replaces the config's
+    bool duplicates= false;
+    for (size_t i = 1; i < index.size(); ++i) {
+        ConfigValue *&first= store[index[i - 1]];
+        ConfigValue *&again= store[index[i]];
+        if(memcmp(first->check_sums, again->check_sums, sizeof(first->check_sums)) == 0) {
+            delete first;
+            first= again;
+            again= nullptr;
+            index[i]= index[i - 1];
+            duplicates= true;
             printf("WARNING: duplicate config line replaced\n");
-            return;
         }
     }
 
-    // Value does not already exists, add to the list
-    store.push_back(new_value);
+    if(duplicates) {
+        store.erase(std::remove(store.begin(), store.end(), nullptr), store.end());
+        indexed= false;
+        build_index();
+        return;
+    }
+
+    indexed= true;
 }
 
-ConfigValue *ConfigCache::lookup(const uint16_t *check_sums) const
+// the first position whose check sums are not less than these
+vector<uint16_t>::const_iterator ConfigCache::find_first(uint16_t cs0, uint16_t cs1, uint16_t cs2) const
 {
-    for( auto &cv : store) {
-        if(memcmp(check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0)
-            return cv;
-    }
+    return std::lower_bound(index.begin(), index.end(), 0, [this, cs0, cs1, cs2](uint16_t p, int) {
+        const uint16_t *c= store[p]->check_sums;
+        if(c[0] != cs0) return c[0] < cs0;
+        if(c[1] != cs1) return c[1] < cs1;
+        return c[2] < cs2;
+    });
+}
+
+ConfigValue *ConfigCache::lookup(const uint16_t *check_sums)
+{
+    build_index();
+    auto i= find_first(check_sums[0], check_sums[1], check_sums[2]);
+    if(i != index.end() && memcmp(check_sums, store[*i]->check_sums, sizeof(store[*i]->check_sums)) == 0)
+        return store[*i];
 
     return NULL;
 }
 
+// the modules of a family are next to each other in the index, they are returned in the order of the config so tools
+// and extruders are numbered the way they are written
 void ConfigCache::collect(uint16_t family, uint16_t cs, vector<uint16_t> *list)
 {
-    for( auto &kv : store ) {
-        if( kv->check_sums[2] == cs && kv->check_sums[0] == family ) {
-            // We found a module enable for this family, add it's number
-            list->push_back(kv->check_sums[1]);
+    build_index();
+    vector<uint16_t> found;
+    for (auto i= find_first(family, 0, 0); i != index.end() && store[*i]->check_sums[0] == family; ++i) {
+        if( store[*i]->check_sums[2] == cs ) {
+            // We found a module enable for this family, note where it is
+            found.push_back(*i);
         }
     }
+    std::sort(found.begin(), found.end());
+    for (uint16_t p : found) list->push_back(store[p]->check_sums[1]);
 }
 
 void ConfigCache::dump(StreamOutput *stream)
@@ -77,7 +134,7 @@ void ConfigCache::dump(StreamOutput *stream)
     int l = 1;
     for( auto &kv : store ) {
         ConfigValue *v = kv;
-        stream->printf("%3d - %04X %04X %04X : '%s' - found: %d, default: %d, default-double: %f, default-int: %d\n",
-                       l++, v->check_sums[0], v->check_sums[1], v->check_sums[2], v->value.c_str(), v->found, v->default_set, v->default_double, v->default_int );
+        stream->printf("%3d - %04X %04X %04X : '%s' - found: %d, default: %d, number: %d\n",
+                       l++, v->check_sums[0], v->check_sums[1], v->check_sums[2], v->as_string().c_str(), v->found, v->default_set, v->kind == ConfigValue::NUMBER );
     }
 }
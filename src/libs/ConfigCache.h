@@ -11,11 +11,15 @@
 using namespace std;
 #include <vector>
 #include <stdint.h>
+#include <stddef.h>
 #include <map>
 
 class ConfigValue;
 class StreamOutput;
 
+// The values are kept in the order they were read, which is the order collect returns modules in, and an index of
+// their positions sorted by the check sums is built once they are all read so lookup is a binary search. A key read
+// twice is only found to be a duplicate when the index is built, the later value replaces the earlier one
 class ConfigCache {
     public:
         ConfigCache();
@@ -24,22 +28,34 @@ class ConfigCache {
 
         void add(ConfigValue* v);
         void pop();
+        // the values in the order they were added
+        size_t size() const { return store.size(); }
+        ConfigValue *at(size_t i) const { return store[i]; }
 
         // lookup and return the entru that matches the check sums,return NULL if not found
-        ConfigValue *lookup(const uint16_t *check_sums) const;
+        ConfigValue *lookup(const uint16_t *check_sums);
 
         // collect enabled checksums of the given family
         void collect(uint16_t family, uint16_t cs, vector<uint16_t> *list);
 
-        // If we find an existing value, replace it, otherwise, push it at the back of the list
+        // push it at the back of the list, it replaces an existing value with the same check sums when the index is built
         void replace_or_push_back(ConfigValue* new_value);
 
+        // sorts the index and drops duplicates, lookup and collect do it if a value was added since
+        void build_index();
+
         // used for debugging, dumps the cache to a stream
         void dump(StreamOutput *stream);
 
     private:
+        bool key_less(uint16_t a, uint16_t b) const;
+        vector<uint16_t>::const_iterator find_first(uint16_t cs0, uint16_t cs1, uint16_t cs2) const;
+
         typedef vector<ConfigValue*> storage_t;
         storage_t store;
+        // positions in store sorted by check sums then position
+        vector<uint16_t> index;
+        bool indexed;
 };
 
 
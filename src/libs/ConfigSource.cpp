@@ -41,10 +41,10 @@ ConfigValue* ConfigSource::process_line(const string &buffer)
     result->check_sums[2] = check_sums[2];
 
     size_t end_value = buffer.find_first_of("\r\n# \t", begin_value + 1);
-    size_t vsize = end_value == string::npos ? end_value : end_value - begin_value;
-    result->value = buffer.substr(begin_value, vsize);
+    size_t vsize = end_value == string::npos ? buffer.size() - begin_value : end_value - begin_value;
+    result->set_value(buffer.c_str() + begin_value, vsize);
 
-    //printf("key: %s, value: %s\n\n", key.c_str(), result->value.c_str());
+    //printf("key: %s, value: %s\n\n", key.c_str(), result->as_string().c_str());
     return result;
 }
 
@@ -65,7 +65,7 @@ string ConfigSource::process_line_from_ascii_config(const string &buffer, uint16
     ConfigValue *result = process_line(buffer);
     if(result != NULL) {
         if(result->check_sums[0] == line_checksums[0] && result->check_sums[1] == line_checksums[1] && result->check_sums[2] == line_checksums[2]) {
-            value= result->value;
+            value= result->as_string();
         }
         delete result;
     }
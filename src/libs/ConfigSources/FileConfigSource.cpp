@@ -11,6 +11,7 @@
 #include "ConfigCache.h"
 #include "checksumm.h"
 #include "utils.h"
+#include "SDFAT.h"
 #include <malloc.h>
 
 using namespace std;
@@ -19,11 +20,17 @@ using namespace std;
 
 #define include_checksum     CHECKSUM("include")
 
+// "SCI1", the first word of a config image
+#define IMAGE_MAGIC 0x31494353
+
+extern SDFAT mounter;
+
 FileConfigSource::FileConfigSource(string config_file, const char *name)
 {
     this->name_checksum = get_checksum(name);
     this->config_file = config_file;
     this->config_file_found = false;
+    this->image_writable = true;
 }
 
 bool FileConfigSource::readLine(string& line, int lineno, FILE *fp)
@@ -55,7 +62,18 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache )
     if( !this->has_config_file() ) {
         return;
     }
+
+    // the values are read back from the image if the config and its includes have not changed since it was written
+    if(load_image(cache)) {
+        this->image_writable = false;
+        return;
+    }
+
+    size_t first = cache->size();
     transfer_values_to_cache( cache, this->get_config_file().c_str());
+    if(this->image_writable) save_image(cache, first);
+    this->image_writable = false;
+    vector<string>().swap(this->image_sources);
 }
 
 void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char * file_name )
@@ -63,6 +81,7 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
     if( !file_exists(file_name) ) {
         return;
     }
+    this->image_sources.push_back(file_name);
 
     // Open the config file ( find it if we haven't already found it )
     FILE *lp = fopen(file_name, "r");
@@ -79,7 +98,7 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
 
             // if this line is an include directive then attempt to read the included file
             if(cv->check_sums[0] == include_checksum) {
-                string inc_file_name = cv->value.c_str();
+                string inc_file_name = cv->as_string();
                 cache->pop(); // we do not need to keep this around or leave it on the list
 
                 if(!file_exists(inc_file_name)) {
@@ -120,6 +139,144 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
     fclose(lp);
 }
 
+// A config on the sd card is written as an image next to it once it has been read. The image has the size and modified
+// time of each file that was read, then the values as they were added to the cache, numbers as floats so nothing has
+// to be parsed, and a CRC-32 of all that at the end
+string FileConfigSource::image_file() const
+{
+    return this->config_file + ".img";
+}
+
+static uint32_t crc32_update(uint32_t crc, const void *data, size_t size)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while(size-- > 0) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; ++i) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+// only files on the sd card have a size and a time to check
+static bool sd_stat(const string &file_name, uint32_t &size, uint32_t &date_time)
+{
+    if(file_name.compare(0, 4, "/sd/") != 0) return false;
+    return mounter.stat(file_name.c_str() + 4, &size, &date_time) == 0;
+}
+
+// reads and writes the image keeping the CRC of what went through
+struct ImageFile {
+    FILE *fp;
+    uint32_t crc;
+    bool read(void *p, size_t n) { if(fread(p, 1, n, fp) != n) return false; crc = crc32_update(crc, p, n); return true; }
+    bool write(const void *p, size_t n) { crc = crc32_update(crc, p, n); return fwrite(p, 1, n, fp) == n; }
+};
+
+bool FileConfigSource::load_image(ConfigCache *cache)
+{
+    if(this->config_file.compare(0, 4, "/sd/") != 0) return false;
+    FILE *fp = fopen(image_file().c_str(), "r");
+    if(fp == NULL) return false;
+
+    size_t first = cache->size();
+    bool ok = read_image(fp, cache);
+    fclose(fp);
+    if(!ok) {
+        // a changed config, or an image that was not written to the end
+        while(cache->size() > first) cache->pop();
+    }
+    return ok;
+}
+
+bool FileConfigSource::read_image(FILE *fp, ConfigCache *cache)
+{
+    ImageFile in{fp, 0};
+    uint32_t magic;
+    uint8_t nsources;
+    uint16_t nvalues;
+    if(!in.read(&magic, 4) || magic != IMAGE_MAGIC || !in.read(&nsources, 1) || !in.read(&nvalues, 2)) return false;
+
+    for (int i = 0; i < nsources; ++i) {
+        uint32_t size, date_time, now_size, now_date_time;
+        uint8_t len;
+        char name[256];
+        if(!in.read(&size, 4) || !in.read(&date_time, 4) || !in.read(&len, 1) || !in.read(name, len)) return false;
+        name[len] = '\0';
+        if(!sd_stat(name, now_size, now_date_time) || now_size != size || now_date_time != date_time) return false;
+    }
+
+    for (int i = 0; i < nvalues; ++i) {
+        uint16_t check_sums[3];
+        uint8_t kind, n;
+        if(!in.read(check_sums, sizeof(check_sums)) || !in.read(&kind, 1) || !in.read(&n, 1)) return false;
+        ConfigValue *cv = new ConfigValue(check_sums);
+        cv->found = true;
+        cache->add(cv);
+        if(kind == ConfigValue::NUMBER) {
+            float number;
+            if(!in.read(&number, 4)) return false;
+            cv->kind = ConfigValue::NUMBER;
+            cv->number = number;
+            cv->precision = n;
+        } else if(kind == ConfigValue::TEXT) {
+            char text[256];
+            if(!in.read(text, n)) return false;
+            cv->set_value(text, n);
+        } else {
+            return false;
+        }
+    }
+
+    uint32_t crc = in.crc, image_crc;
+    return fread(&image_crc, 1, 4, fp) == 4 && image_crc == crc;
+}
+
+// the values from first on are the ones read from the config
+void FileConfigSource::save_image(ConfigCache *cache, size_t first)
+{
+    if(this->image_sources.size() > 255 || cache->size() - first > 65535) return;
+    uint8_t nsources = this->image_sources.size();
+    uint16_t nvalues = cache->size() - first;
+    vector<uint32_t> stats(nsources * 2);
+    for (int i = 0; i < nsources; ++i) {
+        if(this->image_sources[i].size() > 255 || !sd_stat(this->image_sources[i], stats[i * 2], stats[i * 2 + 1])) return;
+    }
+    // the lengths are a byte, a config with a longer text value is read from the file every time
+    for (size_t i = first; i < cache->size(); ++i) {
+        ConfigValue *cv = cache->at(i);
+        if(cv->kind != ConfigValue::NUMBER && strlen(cv->str) > 255) return;
+    }
+
+    FILE *fp = fopen(image_file().c_str(), "w");
+    if(fp == NULL) return;
+
+    ImageFile out{fp, 0};
+    uint32_t magic = IMAGE_MAGIC;
+    bool ok = out.write(&magic, 4) && out.write(&nsources, 1) && out.write(&nvalues, 2);
+    for (int i = 0; ok && i < nsources; ++i) {
+        const string &name = this->image_sources[i];
+        uint8_t len = name.size();
+        ok = out.write(&stats[i * 2], 4) && out.write(&stats[i * 2 + 1], 4) && out.write(&len, 1) && out.write(name.data(), len);
+    }
+    for (size_t i = first; ok && i < cache->size(); ++i) {
+        ConfigValue *cv = cache->at(i);
+        uint8_t kind = cv->kind;
+        if(kind == ConfigValue::NUMBER) {
+            uint8_t precision = cv->precision;
+            ok = out.write(cv->check_sums, sizeof(cv->check_sums)) && out.write(&kind, 1) && out.write(&precision, 1) && out.write(&cv->number, 4);
+        } else {
+            // a found value is a number or text
+            uint8_t len = strlen(cv->str);
+            ok = out.write(cv->check_sums, sizeof(cv->check_sums)) && out.write(&kind, 1) && out.write(&len, 1) && out.write(cv->str, len);
+        }
+    }
+    uint32_t crc = out.crc;
+    ok = ok && fwrite(&crc, 1, 4, fp) == 4;
+    fclose(fp);
+    if(!ok) remove(image_file().c_str());
+}
+
 // Return true if the check_sums match
 bool FileConfigSource::is_named( uint16_t check_sum )
 {
@@ -133,6 +290,10 @@ bool FileConfigSource::write( string setting, string value )
         return false;
     }
 
+    // the line may be changed in place, which does not change the size of the file and the firmware has no clock to
+    // date it, so the image has to go
+    remove(image_file().c_str());
+
     uint16_t setting_checksums[3];
     get_checksums(setting_checksums, setting );
 
@@ -142,10 +303,9 @@ bool FileConfigSource::write( string setting, string value )
     // search each line for a match
     while(!feof(lp)) {
         string line;
-        fpos_t bol, eol;
-        fgetpos( lp, &bol ); // get start of line
+        long bol = ftell(lp); // get start of line
         if(readLine(line, 0, lp)) {
-            fgetpos( lp, &eol ); // get end of line
+            long eol = ftell(lp); // get end of line
             if(!process_line_from_ascii_config(line, setting_checksums).empty()) {
                 // found it
                 unsigned int free_space = eol - bol - 4; // length of line
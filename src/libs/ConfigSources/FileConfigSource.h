@@ -14,6 +14,7 @@ class ConfigCache;
 
 using namespace std;
 #include <string>
+#include <vector>
 #include <stdio.h>
 
 class FileConfigSource : public ConfigSource
@@ -31,8 +32,15 @@ public:
 
 private:
     bool readLine(string& line, int lineno, FILE *fp);
+    string image_file() const;
+    bool load_image(ConfigCache *cache);
+    bool read_image(FILE *fp, ConfigCache *cache);
+    void save_image(ConfigCache *cache, size_t first);
+
     string config_file;         // Path to the config file
+    vector<string> image_sources; // the config file and the files it includes, in the order they were read
     bool   config_file_found;   // Wether or not the config file's location is known
+    bool   image_writable;      // only the load at boot writes the image, the host may have the card mounted after
 };
 
 
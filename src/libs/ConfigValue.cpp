@@ -14,47 +14,133 @@
 
 ConfigValue::ConfigValue()
 {
+    this->kind = EMPTY;
     clear();
 }
 
+ConfigValue::~ConfigValue()
+{
+    release();
+}
+
 void ConfigValue:: clear()
 {
+    release();
     this->found = false;
     this->default_set = false;
     this->check_sums[0] = 0x0000;
     this->check_sums[1] = 0x0000;
     this->check_sums[2] = 0x0000;
-    this->default_double= 0.0F;
-    this->default_int= 0;
-    this->value= "";
 }
 
 ConfigValue::ConfigValue(uint16_t *cs) {
     memcpy(this->check_sums, cs, sizeof(this->check_sums));
     this->found = false;
     this->default_set = false;
-    this->value= "";
+    this->kind = EMPTY;
+    this->numeric_default = false;
 }
 
 ConfigValue::ConfigValue(const ConfigValue& to_copy)
 {
-    this->found = to_copy.found;
-    this->default_set = to_copy.default_set;
-    memcpy(this->check_sums, to_copy.check_sums, sizeof(this->check_sums));
-    this->value.assign(to_copy.value);
+    this->kind = EMPTY;
+    *this = to_copy;
 }
 
 ConfigValue& ConfigValue::operator= (const ConfigValue& to_copy)
 {
     if( this != &to_copy ){
+        release();
         this->found = to_copy.found;
         this->default_set = to_copy.default_set;
         memcpy(this->check_sums, to_copy.check_sums, sizeof(this->check_sums));
-        this->value.assign(to_copy.value);
+        this->kind = to_copy.kind;
+        this->precision = to_copy.precision;
+        this->numeric_default = to_copy.numeric_default;
+        if(to_copy.kind == TEXT) {
+            this->kind = EMPTY;
+            set_value(to_copy.str, strlen(to_copy.str));
+        } else {
+            this->integer = to_copy.integer; // copies the float too
+        }
     }
     return *this;
 }
 
+void ConfigValue::release()
+{
+    if(this->kind == TEXT) delete [] this->str;
+    this->kind = EMPTY;
+    this->numeric_default = false;
+}
+
+// the precision %.*g prints the decimal in text back with, 0 if it prints it differently: it has no leading zeros, no
+// trailing zeros after the point, and its first significant digit is at most 4 places after the point
+static int printed_precision(const char *text, size_t len)
+{
+    size_t i = text[0] == '-' ? 1 : 0;
+    size_t int_start = i;
+    while(i < len && text[i] >= '0' && text[i] <= '9') ++i;
+    size_t int_len = i - int_start;
+    if(int_len == 0 || (int_len > 1 && text[int_start] == '0')) return 0;
+
+    size_t frac_start = i, frac_len = 0;
+    if(i < len && text[i] == '.') {
+        frac_start = ++i;
+        while(i < len && text[i] >= '0' && text[i] <= '9') ++i;
+        frac_len = i - frac_start;
+        if(frac_len == 0 || text[i - 1] == '0') return 0;
+    }
+    if(i != len) return 0;
+
+    if(text[int_start] != '0') return int_len + frac_len;
+    if(frac_len == 0) return 1; // 0 or -0
+    size_t zeros = 0;
+    while(text[frac_start + zeros] == '0') ++zeros;
+    return zeros > 3 ? 0 : frac_len - zeros;
+}
+
+// most values in a config are numbers, they are kept as a float instead of a copy of their text if they print back to
+// the same text, 0.10 and 2.0 do not so pins like those stay text
+void ConfigValue::set_value(const char *text, size_t len)
+{
+    release();
+    if(len == 0) return;
+
+    int p = len < 16 ? printed_precision(text, len) : 0;
+    if(p > 0 && p <= 9) {
+        char buf[16];
+        memcpy(buf, text, len);
+        buf[len] = '\0';
+        float v = strtof(buf, NULL);
+        // a float keeps 6 significant digits of any decimal, more than that it has to be printed to know
+        char printed[24];
+        if(p <= 6 || (snprintf(printed, sizeof(printed), "%.*g", p, v), strcmp(printed, buf) == 0)) {
+            this->kind = NUMBER;
+            this->number = v;
+            this->precision = p;
+            return;
+        }
+    }
+
+    this->str = new char[len + 1];
+    memcpy(this->str, text, len);
+    this->str[len] = '\0';
+    this->kind = TEXT;
+}
+
+// the text the value was read from
+string ConfigValue::text() const
+{
+    char buf[24];
+    switch(this->kind) {
+        case TEXT: return this->str;
+        case NUMBER: snprintf(buf, sizeof(buf), "%.*g", this->precision, this->number); return buf;
+        case INTEGER: snprintf(buf, sizeof(buf), "%d", this->integer); return buf;
+        default: return "";
+    }
+}
+
 ConfigValue *ConfigValue::required()
 {
     if( !this->found ) {
@@ -65,15 +151,17 @@ ConfigValue *ConfigValue::required()
 
 float ConfigValue::as_number()
 {
-    if( this->found == false && this->default_set == true ) {
-        return this->default_double;
+    if( this->kind == NUMBER ) {
+        return this->number;
+    } else if( this->kind == INTEGER ) {
+        return this->integer;
     } else {
         char *endptr = NULL;
-        string str = remove_non_number(this->value);
+        string str = remove_non_number(text());
         const char *cp= str.c_str();
         float result = strtof(cp, &endptr);
         if( endptr <= cp ) {
-            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid number, please see http://smoothieware.org/configuring-smoothie\r\n", this->value.c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
+            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid number, please see http://smoothieware.org/configuring-smoothie\r\n", text().c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
         }
         return result;
     }
@@ -81,15 +169,18 @@ float ConfigValue::as_number()
 
 int ConfigValue::as_int()
 {
-    if( this->found == false && this->default_set == true ) {
-        return this->default_int;
+    if( this->kind == NUMBER ) {
+        // only plain decimals are kept as a number, so this is what strtol makes of the text
+        return this->number;
+    } else if( this->kind == INTEGER ) {
+        return this->integer;
     } else {
         char *endptr = NULL;
-        string str = remove_non_number(this->value);
+        string str = remove_non_number(text());
         const char *cp= str.c_str();
         int result = strtol(cp, &endptr, 10);
         if( endptr <= cp ) {
-            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid int, please see http://smoothieware.org/configuring-smoothie\r\n", this->value.c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
+            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid int, please see http://smoothieware.org/configuring-smoothie\r\n", text().c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
         }
         return result;
     }
@@ -97,30 +188,45 @@ int ConfigValue::as_int()
 
 std::string ConfigValue::as_string()
 {
-    return this->value;
+    if( this->numeric_default ) {
+        return "";
+    }
+    return text();
 }
 
 bool ConfigValue::as_bool()
 {
-    if( this->found == false && this->default_set == true ) {
-        return this->default_int;
+    if( this->numeric_default ) {
+        return as_number() != 0;
     } else {
-        return this->value.find_first_of("ty1") != string::npos;
+        return text().find_first_of("ty1") != string::npos;
     }
 }
 
 ConfigValue *ConfigValue::by_default(int val)
 {
+    if( this->found ) {
+        return this;
+    }
+    release();
     this->default_set = true;
-    this->default_int = val;
-    this->default_double = val; // we need to set both becuase sometimes an integer is passed when it should be a float
+    this->kind = INTEGER;
+    this->numeric_default = true;
+    this->integer = val; // as_number gives it as a float, sometimes an integer is passed when it should be a float
     return this;
 }
 
 ConfigValue *ConfigValue::by_default(float val)
 {
+    if( this->found ) {
+        return this;
+    }
+    release();
     this->default_set = true;
-    this->default_double = val;
+    this->kind = NUMBER;
+    this->numeric_default = true;
+    this->number = val;
+    this->precision = 9;
     return this;
 }
 
@@ -130,13 +236,13 @@ ConfigValue *ConfigValue::by_default(string val)
         return this;
     }
     this->default_set = true;
-    this->value = val;
+    set_value(val.data(), val.size());
     return this;
 }
 
 bool ConfigValue::has_characters( const char *mask )
 {
-    if( this->value.find_first_of(mask) != string::npos ) {
+    if( as_string().find_first_of(mask) != string::npos ) {
         return true;
     } else {
         return false;
@@ -147,4 +253,3 @@ bool ConfigValue::is_inverted()
 {
     return this->has_characters("!");
 }
-
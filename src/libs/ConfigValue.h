@@ -9,6 +9,8 @@
 #define CONFIGVALUE_H
 
 #include <string>
+#include <stdint.h>
+#include <stddef.h>
 using std::string;
 
 class ConfigValue{
@@ -17,6 +19,7 @@ class ConfigValue{
         ConfigValue(uint16_t *check_sums);
         ConfigValue(const ConfigValue& to_copy);
         ConfigValue& operator= (const ConfigValue& to_copy);
+        ~ConfigValue();
         void clear();
         ConfigValue* required();
         float as_number();
@@ -37,13 +40,26 @@ class ConfigValue{
         friend class FileConfigSource;
 
     private:
+        // a value that prints back to exactly the text it was read from with %.*g is kept as the number and the
+        // precision, anything else as a copy of the text. A default is kept the same way in a value that was not found,
+        // a number given as the default has no text so as_string() is empty as it was before numbers were kept
+        enum { EMPTY, TEXT, NUMBER, INTEGER };
+        void set_value(const char *text, size_t len);
+        void release();
+        string text() const;
         bool has_characters( const char* mask );
-        string value;
-        int default_int;
-        float default_double;
+
+        union {
+            char *str;
+            float number;
+            int integer;
+        };
         uint16_t check_sums[3];
-        bool found;
-        bool default_set;
+        uint8_t kind:2;
+        uint8_t precision:4;
+        bool found:1;
+        bool default_set:1;
+        bool numeric_default:1;
 };
 
 
@@ -0,0 +1,81 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EdgeTrigger.h"
+
+#include "Kernel.h"
+#include "Robot.h"
+#include "StepperMotor.h"
+#include "Pin.h"
+
+#include "InterruptIn.h" // mbed
+
+EdgeTrigger::EdgeTrigger()
+{
+    pin= nullptr;
+    irq= nullptr;
+    motors= 0;
+    armed= false;
+    triggered= false;
+    for (auto& s : steps) s= 0;
+}
+
+EdgeTrigger::~EdgeTrigger()
+{
+    delete irq;
+}
+
+bool EdgeTrigger::attach(Pin *pin)
+{
+    // interrupt_pin() marks a pin it can not do invalid, so ask a copy
+    Pin dummy_pin= *pin;
+    irq= dummy_pin.interrupt_pin();
+    if(irq == nullptr) return false;
+
+    this->pin= pin;
+    // the active level depends on the inverting which G38.4 and M670 change, so both edges are taken
+    irq->rise(this, &EdgeTrigger::on_edge);
+    irq->fall(this, &EdgeTrigger::on_edge);
+    // EINT3 has the priority of the step ticker (see Kernel), a motor stops after the tick it is in
+    return true;
+}
+
+void EdgeTrigger::arm(uint32_t motors)
+{
+    this->motors= motors;
+    triggered= false;
+    armed= true;
+}
+
+void EdgeTrigger::on_edge()
+{
+    if(armed && pin->get()) trigger();
+}
+
+// all of them are stopped before any is latched, so none steps after it is latched. If the interrupt comes in while
+// polling is in here both stop and latch the same steps
+void EdgeTrigger::trigger()
+{
+    if(!armed) return;
+
+    uint32_t bm= motors;
+    while(bm != 0) {
+        uint8_t m= __builtin_ctz(bm);
+        bm &= bm - 1;
+        THEROBOT->actuators[m]->stop_moving();
+    }
+
+    bm= motors;
+    while(bm != 0) {
+        uint8_t m= __builtin_ctz(bm);
+        bm &= bm - 1;
+        steps[m]= THEROBOT->actuators[m]->get_current_step();
+    }
+
+    triggered= true;
+    armed= false;
+}
@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ActuatorCoordinates.h"
+
+#include <stdint.h>
+
+namespace mbed {
+    class InterruptIn;
+}
+class Pin;
+
+// Stops motors the moment an endstop or probe input goes active and latches the step each one stopped on. The input
+// is watched by a GPIO edge interrupt when the pin can have one, only pins on ports 0 and 2 can, otherwise its owner
+// polls it and calls trigger() itself. The step ticker does not make the step a stopped motor was due on that tick, so
+// the latched steps are where the motors stopped
+class EdgeTrigger
+{
+    public:
+        EdgeTrigger();
+        ~EdgeTrigger();
+
+        // watch pin with an edge interrupt, false if it can not have one. The pin is read on every edge so its
+        // inverting can be changed while attached
+        bool attach(Pin *pin);
+        bool is_attached() const { return irq != nullptr; }
+
+        // stop the actuators in the bitmask as soon as the pin is active, until it triggers or is disarmed
+        void arm(uint32_t motors);
+        void disarm() { armed= false; }
+
+        // stops the armed actuators now and latches where they are, from the interrupt or from polling
+        void trigger();
+        bool is_triggered() const { return triggered; }
+        int32_t get_steps(uint8_t m) const { return steps[m]; }
+
+    private:
+        void on_edge();
+
+        Pin *pin;
+        mbed::InterruptIn *irq;
+        int32_t steps[k_max_actuators];
+        volatile uint32_t motors;
+        volatile bool armed;
+        volatile bool triggered;
+};
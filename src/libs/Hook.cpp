@@ -5,4 +5,4 @@ extern "C"{
 
 // Hook is just a glorified FPointer
 
-Hook::Hook(){}
+Hook::Hook() : interval(0), calls(0), time_total(0), time_max(0) {}
@@ -2,13 +2,21 @@
 #define HOOK_H
 #include "libs/FPointer.h"
 
+#include <stdint.h>
+
 // Hook is just a glorified FPointer
 
 class Hook : public FPointer {
     public:
         Hook();
-        int     interval;
-        int     countdown;
+        const void *get_object() const { return obj_callback; }
+
+        uint32_t interval;
+
+        // time spent in the hook, in timer ticks, kept by SlowTicker
+        uint32_t calls;
+        uint32_t time_total;
+        uint32_t time_max;
 };
 
 #endif
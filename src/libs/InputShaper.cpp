@@ -0,0 +1,168 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "InputShaper.h"
+
+#include "platform_memory.h"
+
+#include <math.h>
+
+#define PI 3.14159265358979323846F
+
+// the age of a step is worked out from the low 15 bits of the tick it was made on, every step is added in by all its
+// impulses well before that wraps
+#define MAX_DELAY_TICKS 16000
+#define TICK_MASK 0x7FFF
+#define DIR_BIT 0x8000
+
+InputShaper::InputShaper()
+{
+    ring= nullptr;
+    mask= 0;
+    head= 0;
+    reader[0]= reader[1]= reader[2]= 0;
+    delay[0]= delay[1]= delay[2]= 0;
+    amplitude[0]= 65536;
+    amplitude[1]= amplitude[2]= 0;
+    error= 0;
+    n= 1;
+    type= NONE;
+}
+
+InputShaper::~InputShaper()
+{
+    if(ring == nullptr) return;
+    if(AHB0.has(ring)) AHB0.dealloc(ring);
+    else AHB1.dealloc(ring);
+}
+
+InputShaper::TYPE InputShaper::type_from_string(const std::string& s)
+{
+    if(s == "zv") return ZV;
+    if(s == "zvd") return ZVD;
+    if(s == "mzv") return MZV;
+    return NONE;
+}
+
+const char *InputShaper::type_name(TYPE type)
+{
+    switch(type) {
+        case ZV: return "zv";
+        case ZVD: return "zvd";
+        case MZV: return "mzv";
+        default: return "none";
+    }
+}
+
+// the impulses of each shaper for a ringing frequency and damping ratio, the times are in periods of the damped ringing
+bool InputShaper::configure(TYPE type, float frequency, float damping, float tick_frequency, float max_step_rate)
+{
+    if(type == NONE || frequency <= 0.0F || damping < 0.0F || damping >= 1.0F) return false;
+
+    float wd= sqrtf(1.0F - damping * damping);
+    float period= tick_frequency / (frequency * wd); // in ticks
+    float a[3], t[3];
+    int count;
+    if(type == ZV) {
+        float k= expf(-damping * PI / wd);
+        a[0]= 1.0F; a[1]= k;
+        t[0]= 0.0F; t[1]= 0.5F;
+        count= 2;
+
+    } else if(type == ZVD) {
+        float k= expf(-damping * PI / wd);
+        a[0]= 1.0F; a[1]= 2.0F * k; a[2]= k * k;
+        t[0]= 0.0F; t[1]= 0.5F; t[2]= 1.0F;
+        count= 3;
+
+    } else {
+        float k= expf(-0.75F * damping * PI / wd);
+        float a1= 1.0F - 1.0F / sqrtf(2.0F);
+        a[0]= a1; a[1]= (sqrtf(2.0F) - 1.0F) * k; a[2]= a1 * k * k;
+        t[0]= 0.0F; t[1]= 0.375F; t[2]= 0.75F;
+        count= 3;
+    }
+
+    if(t[count - 1] * period > MAX_DELAY_TICKS) return false;
+
+    // the ring holds the steps of the longest delay, a power of two so the indexes wrap
+    uint32_t max_steps= ceilf(max_step_rate * t[count - 1] * period / tick_frequency);
+    uint32_t size= 16;
+    while(size < max_steps + 16 && size < 0x8000) size <<= 1;
+    if(ring == nullptr || size != get_size()) {
+        if(ring != nullptr) {
+            if(AHB0.has(ring)) AHB0.dealloc(ring);
+            else AHB1.dealloc(ring);
+        }
+        ring= (uint16_t *)AHB0.alloc(size * sizeof(uint16_t));
+        if(ring == nullptr) ring= (uint16_t *)AHB1.alloc(size * sizeof(uint16_t));
+        if(ring == nullptr) {
+            this->type= NONE;
+            n= 1;
+            return false;
+        }
+        mask= size - 1;
+    }
+
+    float sum= 0;
+    for (int i = 0; i < count; ++i) sum += a[i];
+    int32_t left= 65536;
+    for (int i = 0; i < count; ++i) {
+        amplitude[i]= (i == count - 1) ? left : lroundf(a[i] / sum * 65536);
+        left -= amplitude[i];
+        delay[i]= lroundf(t[i] * period);
+    }
+
+    this->type= type;
+    n= count;
+    flush();
+    return true;
+}
+
+void InputShaper::flush()
+{
+    head= 0;
+    reader[0]= reader[1]= reader[2]= 0;
+    error= 0;
+}
+
+// the first impulse is not delayed, the later ones are added in from the ring when they are due
+void InputShaper::push(bool dir, uint16_t tick)
+{
+    if((uint16_t)(head - reader[n - 1]) > mask) {
+        // full, the motor steps faster than it was sized for. The oldest step has its impulses added in early rather
+        // than lose it
+        uint16_t oldest= reader[n - 1];
+        for (int i = 1; i < n; ++i) {
+            if(reader[i] == oldest) consume(i);
+        }
+    }
+
+    ring[head & mask]= (tick & TICK_MASK) | (dir ? DIR_BIT : 0);
+    ++head;
+    error += dir ? -amplitude[0] : amplitude[0];
+}
+
+// adds in the step the reader of impulse i is at
+void InputShaper::consume(int i)
+{
+    error += (ring[reader[i] & mask] & DIR_BIT) ? -amplitude[i] : amplitude[i];
+    ++reader[i];
+}
+
+int InputShaper::follow(uint16_t tick)
+{
+    for (int i = 1; i < n; ++i) {
+        while(reader[i] != head && ((tick - ring[reader[i] & mask]) & TICK_MASK) >= delay[i]) {
+            consume(i);
+        }
+    }
+
+    if(error >= 32768) return 1;
+    if(error <= -32768) return -1;
+    return 0;
+}
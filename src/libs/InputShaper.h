@@ -0,0 +1,63 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+// Input shaping of the steps of one motor, used by the step ticker. Each step the step generation makes is split into
+// two or three impulses, fractions of a step that are each delayed by a fraction of the ringing period so the ringing
+// they excite cancels out. The motor steps wherever the sum of the impulses so far rounds to. The steps waiting for
+// their later impulses are kept in a ring of the ticks they were made on, sized for the fastest the motor can step
+class InputShaper
+{
+    public:
+        enum TYPE { NONE, ZV, ZVD, MZV };
+
+        InputShaper();
+        ~InputShaper();
+
+        static TYPE type_from_string(const std::string& s);
+        static const char *type_name(TYPE type);
+
+        // max_step_rate is the fastest the motor steps in steps/sec, returns false if the shaper is too long or there is no
+        // memory for the ring
+        bool configure(TYPE type, float frequency, float damping, float tick_frequency, float max_step_rate);
+
+        // the step generation made a step on tick, only the low 15 bits are used
+        void push(bool dir, uint16_t tick);
+
+        // adds in the impulses that are due on tick, then returns 1 if the motor needs to step positive, -1 negative
+        int follow(uint16_t tick);
+
+        // the motor made the step follow() asked for
+        void stepped(int dir) { error -= dir * 65536; }
+
+        // steps still to be made, the shaped position has not caught up with where the step generation went
+        bool is_pending() const { return error <= -32768 || error >= 32768 || reader[n - 1] != head; }
+
+        // drops the steps still to be made, the motor was stopped
+        void flush();
+
+        uint32_t get_duration() const { return delay[n - 1]; } // ticks from the first impulse of a step to the last
+        TYPE get_type() const { return type; }
+        uint32_t get_size() const { return mask + 1; }
+
+    private:
+        void consume(int i);
+
+        uint16_t *ring;
+        uint16_t mask;
+        uint16_t head;              // where the next step goes
+        uint16_t reader[3];         // the next step each impulse is still to add in, reader[0] is not used
+        uint16_t delay[3];          // ticks
+        int32_t amplitude[3];       // 16.16 fixed point fractions of a step, they add up to exactly one step
+        int32_t error;              // 16.16 fixed point steps the shaped position is from the steps the motor made
+        uint8_t n;                  // impulses
+        TYPE type;
+};
@@ -137,6 +137,9 @@ Kernel::Kernel()
     NVIC_SetPriority(TIMER2_IRQn, 4);
     NVIC_SetPriority(TIMER3_IRQn, 4);
     NVIC_SetPriority(PendSV_IRQn, 3);
+    // the GPIO edge interrupts, all pins share it. The same as the step ticker so an endstop or probe edge never cuts
+    // a step tick in half (see EdgeTrigger), the filament detector and spindle feedback pulse counts are short enough
+    NVIC_SetPriority(EINT3_IRQn, 2);
 
     // Set other priorities lower than the timers
     NVIC_SetPriority(ADC_IRQn, 5);
@@ -0,0 +1,79 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <utility>
+
+// A fixed table of values keyed by the letters A to Z, used for gcode arguments.
+// It has the parts of the std::map interface the option handlers use, but lookups are an index and it never allocates.
+// Iterating visits the letters in alphabetical order like std::map, the entries are read only when iterating.
+template<class T> class LetterTable {
+    public:
+        using value_type= std::pair<char, T>;
+
+        class iterator {
+            public:
+                iterator() : table(nullptr), index(26) {}
+                iterator(const LetterTable *t, int i) : table(t), index(i) { load(); }
+                const value_type& operator*() const { return current; }
+                const value_type* operator->() const { return &current; }
+                iterator& operator++() { ++index; load(); return *this; }
+                bool operator==(const iterator& o) const { return index == o.index; }
+                bool operator!=(const iterator& o) const { return index != o.index; }
+
+            private:
+                // skip to the next letter that is set
+                void load()
+                {
+                    while(index < 26 && !(table->mask & (1UL << index))) ++index;
+                    if(index < 26) current= value_type('A' + index, table->values[index]);
+                }
+
+                const LetterTable *table;
+                int index;
+                value_type current;
+        };
+        using const_iterator= iterator;
+
+        LetterTable() : mask(0) {}
+
+        static bool is_letter(char c) { return c >= 'A' && c <= 'Z'; }
+
+        bool has(char c) const { return is_letter(c) && (mask & (1UL << (c - 'A'))); }
+        size_t count(char c) const { return has(c) ? 1 : 0; }
+
+        // the value for a letter, the caller must check it is set
+        const T& at(char c) const { return values[c - 'A']; }
+
+        // sets the letter, zero initialised if it was not set already
+        T& operator[](char c)
+        {
+            int i= c - 'A';
+            if(!(mask & (1UL << i))) {
+                mask |= (1UL << i);
+                values[i]= T();
+            }
+            return values[i];
+        }
+
+        void set(char c, T v) { int i= c - 'A'; mask |= (1UL << i); values[i]= v; }
+        void erase(char c) { if(is_letter(c)) mask &= ~(1UL << (c - 'A')); }
+        void clear() { mask= 0; }
+        bool empty() const { return mask == 0; }
+        size_t size() const { return __builtin_popcount(mask); }
+
+        iterator begin() const { return iterator(this, 0); }
+        iterator end() const { return iterator(this, 26); }
+        iterator find(char c) const { return has(c) ? iterator(this, c - 'A') : end(); }
+
+    private:
+        T values[26];
+        uint32_t mask;  // bit n is set when 'A'+n has a value
+};
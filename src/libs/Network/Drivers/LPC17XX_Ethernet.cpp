@@ -2,6 +2,7 @@
 #include "LPC17XX_Ethernet.h"
 
 #include "Kernel.h"
+#include "platform_memory.h"
 
 #include <cstring>
 #include <cstdio>
@@ -157,8 +158,25 @@ int32_t emac_SetPHYMode(uint32_t ulPHYMode)
     return (0);
 }
 
-_rxbuf_t LPC17XX_Ethernet::rxbuf __attribute__ ((section ("AHBSRAM1"))) __attribute__((aligned(8)));
-_txbuf_t LPC17XX_Ethernet::txbuf __attribute__ ((section ("AHBSRAM1"))) __attribute__((aligned(8)));
+_rxbuf_t *LPC17XX_Ethernet::rxbuf;
+_txbuf_t *LPC17XX_Ethernet::txbuf;
+
+// the EMAC's DMA only reaches the AHB SRAM, AHB1 is used first as AHB0 has the block queue. The status arrays need 8
+// byte alignment, the pools only give 4
+static void *ahb_alloc(size_t size, void *&mem)
+{
+    mem= AHB1.alloc(size + 4);
+    if(mem == NULL) mem= AHB0.alloc(size + 4);
+    if(mem == NULL) return NULL;
+    return (void *)(((uintptr_t)mem + 7) & ~(uintptr_t)7);
+}
+
+static void ahb_dealloc(void *mem)
+{
+    if(mem == NULL) return;
+    if(AHB1.has(mem)) AHB1.dealloc(mem);
+    else AHB0.dealloc(mem);
+}
 
 LPC17XX_Ethernet* LPC17XX_Ethernet::instance;
 
@@ -175,19 +193,30 @@ LPC17XX_Ethernet::LPC17XX_Ethernet()
     // ip_address = IPA(192,168,3,222);
     // ip_mask = 0xFFFFFF00;
 
-    for (int i = 0; i < LPC17XX_RXBUFS; i++) {
-        rxbuf.rxdesc[i].packet = rxbuf.buf[i];
-        rxbuf.rxdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_RCTRL_INT;
+    // the network module only makes one when the network is enabled, so the buffers cost nothing otherwise
+    rxbuf = (_rxbuf_t *)ahb_alloc(sizeof(_rxbuf_t), rxbuf_mem);
+    txbuf = (_txbuf_t *)ahb_alloc(sizeof(_txbuf_t), txbuf_mem);
+    if(!has_buffers()) {
+        ahb_dealloc(rxbuf_mem);
+        ahb_dealloc(txbuf_mem);
+        rxbuf_mem = txbuf_mem = NULL;
+        rxbuf = NULL;
+        txbuf = NULL;
+    }
+
+    for (int i = 0; rxbuf != NULL && i < LPC17XX_RXBUFS; i++) {
+        rxbuf->rxdesc[i].packet = rxbuf->buf[i];
+        rxbuf->rxdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_RCTRL_INT;
 
-        rxbuf.rxstat[i].Info = 0;
-        rxbuf.rxstat[i].HashCRC = 0;
+        rxbuf->rxstat[i].Info = 0;
+        rxbuf->rxstat[i].HashCRC = 0;
     }
 
-    for (int i = 0; i < LPC17XX_TXBUFS; i++) {
-        txbuf.txdesc[i].packet = txbuf.buf[i];
-        txbuf.txdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_TCTRL_PAD | EMAC_TCTRL_CRC | EMAC_TCTRL_LAST | EMAC_TCTRL_INT;
+    for (int i = 0; txbuf != NULL && i < LPC17XX_TXBUFS; i++) {
+        txbuf->txdesc[i].packet = txbuf->buf[i];
+        txbuf->txdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_TCTRL_PAD | EMAC_TCTRL_CRC | EMAC_TCTRL_LAST | EMAC_TCTRL_INT;
 
-        txbuf.txstat[i].Info = 0;
+        txbuf->txstat[i].Info = 0;
     }
 
     interface_name = (uint8_t*) malloc(5);
@@ -198,6 +227,14 @@ LPC17XX_Ethernet::LPC17XX_Ethernet()
     up = false;
 }
 
+LPC17XX_Ethernet::~LPC17XX_Ethernet()
+{
+    ahb_dealloc(rxbuf_mem);
+    ahb_dealloc(txbuf_mem);
+    rxbuf = NULL;
+    txbuf = NULL;
+}
+
 void LPC17XX_Ethernet::on_module_loaded()
 {
     LPC_PINCON->PINSEL2 |=   (1 << 0) | (1 << 2) | (1 << 8) | (1 << 16) | (1 << 18) | (1 << 20) | (1 << 28) | (1 << 30);
@@ -348,12 +385,12 @@ void LPC17XX_Ethernet::emac_init()
     setEmacAddr(mac_address);
 
     /* Initialize Tx and Rx DMA Descriptors */
-    LPC_EMAC->RxDescriptor       = (uint32_t) rxbuf.rxdesc;
-    LPC_EMAC->RxStatus           = (uint32_t) rxbuf.rxstat;
+    LPC_EMAC->RxDescriptor       = (uint32_t) rxbuf->rxdesc;
+    LPC_EMAC->RxStatus           = (uint32_t) rxbuf->rxstat;
     LPC_EMAC->RxDescriptorNumber = LPC17XX_RXBUFS-1;
 
-    LPC_EMAC->TxDescriptor       = (uint32_t) txbuf.txdesc;
-    LPC_EMAC->TxStatus           = (uint32_t) txbuf.txstat;
+    LPC_EMAC->TxDescriptor       = (uint32_t) txbuf->txdesc;
+    LPC_EMAC->TxStatus           = (uint32_t) txbuf->txstat;
     LPC_EMAC->TxDescriptorNumber = LPC17XX_TXBUFS-1;
 
     // Set Receive Filter register: enable broadcast and multicast
@@ -383,10 +420,10 @@ bool LPC17XX_Ethernet::_receive_frame(void *packet, int *size)
     if (can_read_packet() && can_write_packet())
     {
         int i = LPC_EMAC->RxConsumeIndex;
-        RX_Stat* stat = &(rxbuf.rxstat[i]);
+        RX_Stat* stat = &(rxbuf->rxstat[i]);
         int len = (stat->Info & EMAC_RINFO_SIZE) + 1; //this is the index so add one to get the size
         if(len <= *size) { // check against recieving buffer length
-            memcpy(packet, rxbuf.buf[i], len);
+            memcpy(packet, rxbuf->buf[i], len);
             *size= len;
         }else{
             // discard frame that is too big for input buffer
@@ -426,8 +463,8 @@ bool LPC17XX_Ethernet::can_read_packet()
 
 int LPC17XX_Ethernet::read_packet(uint8_t** buf)
 {
-    *buf = rxbuf.buf[LPC_EMAC->RxConsumeIndex];
-    return rxbuf.rxstat[LPC_EMAC->RxConsumeIndex].Info & EMAC_RINFO_SIZE;
+    *buf = rxbuf->buf[LPC_EMAC->RxConsumeIndex];
+    return rxbuf->rxstat[LPC_EMAC->RxConsumeIndex].Info & EMAC_RINFO_SIZE;
 }
 
 void LPC17XX_Ethernet::release_read_packet(uint8_t*)
@@ -438,33 +475,84 @@ void LPC17XX_Ethernet::release_read_packet(uint8_t*)
     LPC_EMAC->RxConsumeIndex = r;
 }
 
+// a frame can be built in request_packet_buffer() and sent as it is or split in two, without waiting for the DMA
 bool LPC17XX_Ethernet::can_write_packet()
 {
-    uint32_t r = LPC_EMAC->TxProduceIndex + 1;
-    if (r > LPC_EMAC->TxDescriptorNumber)
-        r = 0;
-    return (r != LPC_EMAC->TxConsumeIndex);
+    return tx_free() >= 2 && !tx_buffer_busy(LPC_EMAC->TxProduceIndex);
 }
 
-int LPC17XX_Ethernet::write_packet(uint8_t* buf, int size)
+// descriptors that can be filled, one is always left as the EMAC takes produce == consume as an empty ring
+uint32_t LPC17XX_Ethernet::tx_free()
 {
-    txbuf.txdesc[LPC_EMAC->TxProduceIndex].control = ((size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
+    uint32_t p = LPC_EMAC->TxProduceIndex;
+    uint32_t c = LPC_EMAC->TxConsumeIndex;
+    return (c > p ? c - p : LPC17XX_TXBUFS - p + c) - 1;
+}
 
-    uint32_t r = LPC_EMAC->TxProduceIndex + 1;
-    if (r > LPC_EMAC->TxDescriptorNumber)
-        r = 0;
+// the tail fragment of a frame is sent from the buffer of an earlier one, that buffer is busy until the tail has gone
+bool LPC17XX_Ethernet::tx_buffer_busy(uint32_t i)
+{
+    uint8_t *buf = txbuf->buf[i];
+    uint32_t p = LPC_EMAC->TxProduceIndex;
+    for (uint32_t d = LPC_EMAC->TxConsumeIndex; d != p; d = (d + 1) % LPC17XX_TXBUFS) {
+        uint8_t *packet = (uint8_t *) txbuf->txdesc[d].packet;
+        if (packet >= buf && packet < buf + LPC17XX_MAX_PACKET)
+            return true;
+    }
+    return false;
+}
 
-    if (r == LPC_EMAC->TxConsumeIndex)
+// room for n descriptors and the buffer at the produce index to copy into, the caller checks can_write_packet() before
+// uIP builds a frame so this only fails if it sent more than one, the frame is dropped and TCP sends it again
+bool LPC17XX_Ethernet::tx_ready(uint32_t n)
+{
+    return tx_free() >= n && !tx_buffer_busy(LPC_EMAC->TxProduceIndex);
+}
+
+// hands n descriptors to the DMA, the buffer of the next one may still be busy until a tail fragment has gone
+void LPC17XX_Ethernet::advance_tx(uint32_t n)
+{
+    LPC_EMAC->TxProduceIndex = (LPC_EMAC->TxProduceIndex + n) % LPC17XX_TXBUFS;
+}
+
+int LPC17XX_Ethernet::write_packet(uint8_t* buf, int size)
+{
+    if (!tx_ready(1))
         return 0;
 
-    LPC_EMAC->TxProduceIndex = r;
+    uint32_t i = LPC_EMAC->TxProduceIndex;
+    if (buf != txbuf->buf[i])
+        memcpy(txbuf->buf[i], buf, size);
+
+    txbuf->txdesc[i].packet = txbuf->buf[i];
+    txbuf->txdesc[i].control = ((size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
+    advance_tx(1);
 
     return size;
 }
 
+int LPC17XX_Ethernet::write_packet(uint8_t *head, int head_size, uint8_t *tail, int tail_size)
+{
+    if (!tx_ready(2))
+        return 0;
+
+    uint32_t i = LPC_EMAC->TxProduceIndex;
+    uint32_t j = (i + 1) % LPC17XX_TXBUFS;
+    if (head != txbuf->buf[i])
+        memcpy(txbuf->buf[i], head, head_size);
+
+    txbuf->txdesc[i].packet = txbuf->buf[i];
+    txbuf->txdesc[i].control = ((head_size - 1) & 0x7ff) | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD;
+    txbuf->txdesc[j].packet = tail;
+    txbuf->txdesc[j].control = ((tail_size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
+    advance_tx(2);
+
+    return head_size + tail_size;
+}
+
 void* LPC17XX_Ethernet::request_packet_buffer()
 {
-    return txbuf.txdesc[LPC_EMAC->TxProduceIndex].packet;
+    return txbuf->buf[LPC_EMAC->TxProduceIndex];
 }
 
 NET_PACKET  LPC17XX_Ethernet::get_new_packet_buffer(NetworkInterface* ni)
@@ -482,11 +570,11 @@ NET_PAYLOAD LPC17XX_Ethernet::get_payload_buffer(NET_PACKET packet)
 
 void LPC17XX_Ethernet::set_payload_length(NET_PACKET packet, int length)
 {
-    uint32_t offset = ((uint8_t*) packet) - txbuf.buf[0];
+    uint32_t offset = ((uint8_t*) packet) - txbuf->buf[0];
     int i = (offset / LPC17XX_MAX_PACKET);
     if ((i < LPC17XX_TXBUFS) && ((offset % LPC17XX_MAX_PACKET) == 0))
     {
-        txbuf.txdesc[i].control = (txbuf.txdesc[i].control & ~EMAC_TCTRL_SIZE) | (length & EMAC_TCTRL_SIZE);
+        txbuf->txdesc[i].control = (txbuf->txdesc[i].control & ~EMAC_TCTRL_SIZE) | (length & EMAC_TCTRL_SIZE);
     }
 }
 
@@ -11,9 +11,7 @@
 // SMSC 8720A special control/status register
 #define EMAC_PHY_REG_SCSR 0x1F
 
-#define LPC17XX_MAX_PACKET 600
-#define LPC17XX_TXBUFS     4
-#define LPC17XX_RXBUFS     4
+#include "lpc17xx_ethernet_conf.h"
 
 typedef struct {
     void* packet;
@@ -38,6 +36,7 @@ class LPC17XX_Ethernet : public Module, public NetworkInterface
 {
 public:
     LPC17XX_Ethernet();
+    ~LPC17XX_Ethernet();
 
     void on_module_loaded();
     void on_idle(void*);
@@ -58,8 +57,12 @@ public:
     void release_read_packet(uint8_t*);
     void periodical(int);
 
+    // false while the DMA has not freed what the next frame needs, it is not waited for so call uIP again later
     bool can_write_packet(void);
+    // a frame built in the buffer request_packet_buffer() gave is sent from there, anything else is copied into it
     int write_packet(uint8_t *, int);
+    // a frame in two fragments, head is copied and tail is sent from where it is, it must stay unchanged until sent
+    int write_packet(uint8_t *head, int head_size, uint8_t *tail, int tail_size);
 
     void* request_packet_buffer(void);
 
@@ -72,11 +75,20 @@ public:
 
     static LPC17XX_Ethernet* instance;
 
+    // false if there was no room for the frame buffers, then it can not be used
+    bool has_buffers() const { return rxbuf != nullptr && txbuf != nullptr; }
+
 private:
-    static _rxbuf_t rxbuf;
-    static _txbuf_t txbuf;
+    // about 12KB of AHB SRAM, only allocated when the network is enabled (see LPC17XX_Ethernet())
+    static _rxbuf_t *rxbuf;
+    static _txbuf_t *txbuf;
+    void *rxbuf_mem, *txbuf_mem;
 
     void check_interface();
+    uint32_t tx_free();
+    bool tx_buffer_busy(uint32_t i);
+    bool tx_ready(uint32_t n);
+    void advance_tx(uint32_t n);
 };
 
 #endif /* _LPC17XX_ETHERNET_H */
@@ -0,0 +1,14 @@
+#ifndef _LPC17XX_ETHERNET_CONF_H
+#define _LPC17XX_ETHERNET_CONF_H
+
+// The EMAC descriptor pool, shared with uip-conf.h which sizes the uIP buffer, the MSS and the receive window from it
+
+// a whole ethernet frame with its CRC, rounded up
+#define LPC17XX_MAX_PACKET 1536
+#define LPC17XX_TXBUFS     4
+#define LPC17XX_RXBUFS     4
+
+// the largest frame without the CRC, 1500 bytes of MTU and the ethernet header
+#define LPC17XX_MAX_FRAME  1514
+
+#endif /* _LPC17XX_ETHERNET_CONF_H */
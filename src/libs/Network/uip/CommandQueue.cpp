@@ -7,6 +7,8 @@
 #include "Kernel.h"
 #include "libs/SerialMessage.h"
 #include "CallbackStream.h"
+#include "Conveyor.h"
+#include "us_ticker_api.h"
 
 static CommandQueue *command_queue_instance;
 CommandQueue *CommandQueue::instance = NULL;
@@ -66,3 +68,17 @@ bool CommandQueue::pop()
     }
     return true;
 }
+
+// pops commands until the planner is full or max_us has passed, returns how many were submitted. A segment from the
+// network holds many short lines and one per main loop iteration does not keep the planner fed. One is always submitted
+// like USB serial does, as not every command needs a block, so 0 submits one per call
+int CommandQueue::pop_batch(uint32_t max_us)
+{
+    uint32_t start= us_ticker_read();
+    int n= 0;
+    while(pop()) {
+        ++n;
+        if(THECONVEYOR->is_queue_full() || us_ticker_read() - start >= max_us) break;
+    }
+    return n;
+}
@@ -5,6 +5,7 @@
 
 #include "fifo.h"
 #include <string>
+#include <stdint.h>
 
 class StreamOutput;
 
@@ -14,6 +15,7 @@ public:
     CommandQueue();
     ~CommandQueue();
     bool pop();
+    int pop_batch(uint32_t max_us);
     int add(const char* cmd, StreamOutput *pstream);
     int size() {return q.size();}
     static CommandQueue* getInstance();
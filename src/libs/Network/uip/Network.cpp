@@ -23,6 +23,7 @@
 #include "webserver.h"
 #include "dhcpc.h"
 #include "sftpd.h"
+#include "gcodestream.h"
 
 #ifndef NOPLAN9
 #include "plan9.h"
@@ -32,10 +33,15 @@
 
 #define BUF ((struct uip_eth_hdr *)&uip_buf[0])
 
+// uIP builds every frame in the ethernet transmit buffer it is sent from, see tapdev_send()
+u8_t *uip_buf;
+
 #define network_enable_checksum CHECKSUM("enable")
 #define network_webserver_checksum CHECKSUM("webserver")
 #define network_telnet_checksum CHECKSUM("telnet")
 #define network_plan9_checksum CHECKSUM("plan9")
+#define network_gcode_stream_checksum CHECKSUM("gcode_stream")
+#define network_command_batch_us_checksum CHECKSUM("command_batch_us")
 #define network_mac_override_checksum CHECKSUM("mac_override")
 #define network_ip_address_checksum CHECKSUM("ip_address")
 #define network_hostname_checksum CHECKSUM("hostname")
@@ -52,11 +58,14 @@ static Network* theNetwork;
 Network::Network()
 {
     theNetwork= this;
-    ethernet = new LPC17XX_Ethernet();
+    ethernet = NULL; // made when the network is enabled, its frame buffers take about 12KB of AHB SRAM
     tickcnt= 0;
+    periodic_conn= UIP_CONNS;
+    periodic_udp_conn= UIP_UDP_CONNS;
     sftpd= NULL;
     hostname = NULL;
     plan9_enabled= false;
+    gcode_stream_enabled= false;
     command_q= CommandQueue::getInstance();
 }
 
@@ -129,9 +138,19 @@ void Network::on_module_loaded()
         return;
     }
 
+    ethernet = new LPC17XX_Ethernet();
+    if (!ethernet->has_buffers()) {
+        printf("Network not started, no room for the ethernet buffers in AHB0 or AHB1\n");
+        delete this;
+        return;
+    }
+
     webserver_enabled = THEKERNEL->config->value( network_checksum, network_webserver_checksum, network_enable_checksum )->by_default(false)->as_bool();
     telnet_enabled = THEKERNEL->config->value( network_checksum, network_telnet_checksum, network_enable_checksum )->by_default(false)->as_bool();
     plan9_enabled = THEKERNEL->config->value( network_checksum, network_plan9_checksum, network_enable_checksum )->by_default(false)->as_bool();
+    gcode_stream_enabled = THEKERNEL->config->value( network_checksum, network_gcode_stream_checksum, network_enable_checksum )->by_default(false)->as_bool();
+    // how long one main loop iteration may spend issuing queued network commands, 0 issues one per iteration
+    command_batch_us = THEKERNEL->config->value( network_checksum, network_command_batch_us_checksum )->by_default(2000)->as_int();
     string mac = THEKERNEL->config->value( network_checksum, network_mac_override_checksum )->by_default("")->as_string();
     if (mac.size() == 17 ) { // parse mac address
         if (!parse_ip_str(mac, mac_address, 6, 16, ':')) {
@@ -235,7 +254,11 @@ void Network::on_idle(void *argument)
 {
     if (!ethernet->isUp()) return;
 
-    int len= sizeof(uip_buf); // set maximum size
+    // uIP builds each frame in the transmit buffer it is sent from, while the DMA has not freed it uIP is not called. A
+    // received frame waits in the receive ring and the periodic connections carry on from where they were next time
+    if (!ethernet->can_write_packet()) return;
+
+    int len= LPC17XX_MAX_PACKET; // set maximum size
     if (ethernet->_receive_frame(uip_buf, &len)) {
         uip_len = len;
         this->handlePacket();
@@ -244,31 +267,36 @@ void Network::on_idle(void *argument)
 
         if (timer_expired(&periodic_timer)) { /* no packet but periodic_timer time out (0.1s)*/
             timer_reset(&periodic_timer);
+            periodic_conn= 0;
+            periodic_udp_conn= 0;
+        }
 
-            for (int i = 0; i < UIP_CONNS; i++) {
-                uip_periodic(i);
-                /* If the above function invocation resulted in data that
-                   should be sent out on the network, the global variable
-                   uip_len is set to a value > 0. */
-                if (uip_len > 0) {
-                    uip_arp_out();
-                    tapdev_send(uip_buf, uip_len);
-                }
+        // each one may send a frame
+        while (periodic_conn < UIP_CONNS && ethernet->can_write_packet()) {
+            uip_periodic(periodic_conn);
+            periodic_conn++;
+            /* If the above function invocation resulted in data that
+               should be sent out on the network, the global variable
+               uip_len is set to a value > 0. */
+            if (uip_len > 0) {
+                uip_arp_out();
+                tapdev_send(uip_buf, uip_len);
             }
+        }
 
 #if UIP_CONF_UDP
-            for (int i = 0; i < UIP_UDP_CONNS; i++) {
-                uip_udp_periodic(i);
-                /* If the above function invocation resulted in data that
-                   should be sent out on the network, the global variable
-                   uip_len is set to a value > 0. */
-                if (uip_len > 0) {
-                    uip_arp_out();
-                    tapdev_send(uip_buf, uip_len);
-                }
+        while (periodic_udp_conn < UIP_UDP_CONNS && ethernet->can_write_packet()) {
+            uip_udp_periodic(periodic_udp_conn);
+            periodic_udp_conn++;
+            /* If the above function invocation resulted in data that
+               should be sent out on the network, the global variable
+               uip_len is set to a value > 0. */
+            if (uip_len > 0) {
+                uip_arp_out();
+                tapdev_send(uip_buf, uip_len);
             }
-#endif
         }
+#endif
 /*
         This didn't work actually made it worse,it should have worked though
         else{
@@ -314,6 +342,12 @@ void Network::setup_servers()
     }
 #endif
 
+    if (gcode_stream_enabled) {
+        // Initialize the raw gcode streaming server
+        GcodeStream::init();
+        printf("Gcode stream initialized\n");
+    }
+
     // sftpd service, which is lazily created on reciept of first packet
     uip_listen(HTONS(115));
 }
@@ -357,6 +391,7 @@ void Network::init(void)
     timer_set(&arp_timer, CLOCK_SECOND * 10);   /* 10s */
 
     // Initialize the uIP TCP/IP stack.
+    uip_buf= (u8_t *)ethernet->request_packet_buffer();
     uip_init();
 
     uip_setethaddr(mac_address);
@@ -387,14 +422,29 @@ void Network::init(void)
 
 void Network::on_main_loop(void *argument)
 {
-    // issue commands here if any available
-    // while(command_q->pop()) {
-    //     // keep feeding them until empty
-    // }
+    // issue queued commands until the planner is full or the time is up
+    command_q->pop_batch(command_batch_us);
 
-    // issue one comamnd per iteration of main loop like USB serial does
-    command_q->pop();
+    if(gcode_stream_enabled) restart_gcode_streams();
+}
 
+// a stopped gcode stream would otherwise wait for the periodic timer to be polled and restarted, the planner can run dry
+// in that time
+void Network::restart_gcode_streams()
+{
+    if (!ethernet->isUp() || !GcodeStream::has_room()) return;
+
+    for (struct uip_conn *connr = &uip_conns[0]; connr <= &uip_conns[UIP_CONNS - 1]; ++connr) {
+        // the rest are polled on the next main loop
+        if (!ethernet->can_write_packet()) break;
+        if(connr->lport == HTONS(GcodeStream::PORT) && uip_stopped(connr)) {
+            uip_poll_conn(connr);
+            if (uip_len > 0) {
+                uip_arp_out();
+                tapdev_send(uip_buf, uip_len);
+            }
+        }
+    }
 }
 
 extern "C" const char *get_query_string()
@@ -414,6 +464,10 @@ extern "C" void app_select_appcall(void)
             if (theNetwork->telnet_enabled) Telnetd::appcall();
             break;
 
+        case HTONS(GcodeStream::PORT):
+            if (theNetwork->gcode_stream_enabled) GcodeStream::appcall();
+            break;
+
 #ifndef NOPLAN9
         case HTONS(564):
             if (theNetwork->plan9_enabled) Plan9::appcall();
@@ -435,13 +489,21 @@ extern "C" void app_select_appcall(void)
     }
 }
 
+// the frame is in the transmit buffer already so it is not copied, uIP builds the next one in the buffer after it
 void Network::tapdev_send(void *pPacket, unsigned int size)
 {
-    memcpy(ethernet->request_packet_buffer(), pPacket, size);
     ethernet->write_packet((uint8_t *) pPacket, size);
+    uip_buf= (u8_t *)ethernet->request_packet_buffer();
 }
 
-// define this to split full frames into two to illicit an ack from the endpoint
+void Network::tapdev_send(void *pHeader, unsigned int header_size, void *pData, unsigned int data_size)
+{
+    ethernet->write_packet((uint8_t *) pHeader, header_size, (uint8_t *) pData, data_size);
+    uip_buf= (u8_t *)ethernet->request_packet_buffer();
+}
+
+// define this to split full frames into two to illicit an ack from the endpoint, uIP has one segment in flight per
+// connection and the delayed ack of the other end would hold each one up
 #define SPLIT_OUTPUT
 
 #ifdef SPLIT_OUTPUT
@@ -450,6 +512,11 @@ extern "C" void tcpip_output()
 {
     theNetwork->tapdev_send(uip_buf, uip_len);
 }
+// the second half of a split frame, its headers then its data which is still in the buffer of the first half
+extern "C" void tcpip_output_tail(u8_t *hdr, u16_t hdrlen, u8_t *data, u16_t datalen)
+{
+    theNetwork->tapdev_send(hdr, hdrlen, data, datalen);
+}
 void network_device_send()
 {
     uip_split_output();
@@ -20,6 +20,7 @@ public:
     void on_get_public_data(void* argument);
     void dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw);
     void tapdev_send(void *pPacket, unsigned int size);
+    void tapdev_send(void *pHeader, unsigned int header_size, void *pData, unsigned int data_size);
 
     // accessed from C
     Sftpd *sftpd;
@@ -27,6 +28,7 @@ public:
         bool webserver_enabled:1;
         bool telnet_enabled:1;
         bool plan9_enabled:1;
+        bool gcode_stream_enabled:1;
         bool use_dhcp:1;
     };
 
@@ -35,13 +37,18 @@ private:
     void setup_servers();
     uint32_t tick(uint32_t dummy);
     void handlePacket();
+    void restart_gcode_streams();
 
     CommandQueue *command_q;
     LPC17XX_Ethernet *ethernet;
 
     struct timer periodic_timer, arp_timer;
+    // the next connections uip_periodic() is called for since the periodic timer expired
+    uint8_t periodic_conn;
+    uint8_t periodic_udp_conn;
     char *hostname;
     volatile uint32_t tickcnt;
+    uint32_t command_batch_us;
     uint8_t mac_address[6];
     uint8_t ipaddr[4];
     uint8_t ipmask[4];
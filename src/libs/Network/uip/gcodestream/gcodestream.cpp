@@ -0,0 +1,179 @@
+#include "gcodestream.h"
+
+#include "Kernel.h"
+#include "Conveyor.h"
+#include "StreamOutputPool.h"
+#include "CallbackStream.h"
+#include "CommandQueue.h"
+
+#include <string.h>
+#include <stdio.h>
+
+extern "C" {
+#include "uip.h"
+}
+
+#define ISO_nl 0x0a
+#define ISO_cr 0x0d
+
+#define DEBUG_PRINTF(...)
+//#define DEBUG_PRINTF printf
+
+GcodeStream::GcodeStream()
+{
+    DEBUG_PRINTF("GcodeStream: ctor %p\n", this);
+    linelen= 0;
+    outlen= 0;
+    sent= 0;
+    rport= 0;
+    pstream= new CallbackStream(output_callback, this);
+    // so halts and other broadcasts reach the host too
+    THEKERNEL->streams->append_stream(pstream);
+}
+
+GcodeStream::~GcodeStream()
+{
+    DEBUG_PRINTF("GcodeStream: dtor %p\n", this);
+    THEKERNEL->streams->remove_stream(pstream);
+    // the stream may still be on the command queue, it deletes itself when it no longer is
+    static_cast<CallbackStream*>(pstream)->mark_closed();
+}
+
+// how many blocks a line makes is only known once it is issued, an arc or a delta move makes many and an M code none,
+// so what was received has to be issued into the planner first. A few lines may be left waiting, they fit in the blocks
+// that free up while the next segment arrives
+bool GcodeStream::has_room(void)
+{
+    return CommandQueue::getInstance()->size() < MAX_WAITING_LINES && !THECONVEYOR->is_queue_full();
+}
+
+// the oks are what the host would wait on with a serial port, here the TCP window does that so they are not sent
+int GcodeStream::output_callback(const char *str, void *p)
+{
+    GcodeStream *gs= static_cast<GcodeStream*>(p);
+    if(str == NULL) return 0; // command is done
+    if(strcmp(str, "ok\n") == 0 || strcmp(str, "ok\r\n") == 0) return 1;
+    return gs->output(str);
+}
+
+// 1 if it was buffered, 0 if the buffer is full and it has to wait for the host to ack what was sent
+int GcodeStream::output(const char *str)
+{
+    size_t len= strlen(str);
+    if(len > OUTBUFSIZE) {
+        // would never fit so cut it
+        len= OUTBUFSIZE;
+    }
+    if(outlen + len > OUTBUFSIZE) return 0;
+    memcpy(&outbuf[outlen], str, len);
+    outlen += len;
+    return 1;
+}
+
+void GcodeStream::acked(void)
+{
+    outlen -= sent;
+    memmove(outbuf, &outbuf[sent], outlen);
+    sent= 0;
+}
+
+// uIP only has one segment in flight per connection, it is resent as is until it is acked
+void GcodeStream::senddata(void)
+{
+    if(!uip_rexmit()) {
+        if(sent > 0 || outlen == 0) return;
+        sent= outlen < uip_mss() ? outlen : uip_mss();
+    }
+    memcpy(uip_appdata, outbuf, sent);
+    uip_send(uip_appdata, sent);
+}
+
+void GcodeStream::get_char(char c)
+{
+    if(c == ISO_cr) return;
+
+    if(c == '?') {
+        output(THEKERNEL->get_query_string().c_str());
+        return;
+    }
+
+    if(c == 'X'-'A'+1) { // CTRL-X
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        output(THEKERNEL->is_grbl_mode() ? "ALARM: Abort during cycle\r\n" : "HALTED, M999 or $X to exit HALT state\r\n");
+        return;
+    }
+
+    if(c == ISO_nl || linelen == sizeof(line) - 1) {
+        line[linelen]= 0;
+        if(linelen > 0) CommandQueue::getInstance()->add(line, pstream);
+        linelen= 0;
+        if(c == ISO_nl) return;
+    }
+
+    line[linelen++]= c;
+}
+
+void GcodeStream::newdata(void)
+{
+    const char *dataptr= (const char *)uip_appdata;
+    for (u16_t len= uip_datalen(); len > 0; --len) {
+        get_char(*dataptr++);
+    }
+
+    // a whole segment is taken at once so this can go over, it is stopped until the planner has caught up
+    if(!has_room()) {
+        DEBUG_PRINTF("GcodeStream: stopped: %d\n", CommandQueue::getInstance()->size());
+        uip_stop();
+    }
+}
+
+// static
+void GcodeStream::appcall(void)
+{
+    GcodeStream *instance= reinterpret_cast<GcodeStream *>(uip_conn->appstate);
+
+    if (uip_connected()) {
+        instance= new GcodeStream;
+        uip_conn->appstate= instance;
+        instance->rport= uip_conn->rport;
+    }
+
+    if (uip_closed() || uip_aborted() || uip_timedout()) {
+        DEBUG_PRINTF("GcodeStream: closed: %p\n", instance);
+        if(instance != NULL) {
+            delete instance;
+            uip_conn->appstate= NULL;
+        }
+        return;
+    }
+
+    // sanity check
+    if(instance == NULL || instance->rport != uip_conn->rport) {
+        uip_abort();
+        return;
+    }
+
+    if (uip_acked()) {
+        instance->acked();
+    }
+
+    if (uip_newdata()) {
+        instance->newdata();
+    }
+
+    // Network polls a stopped connection as soon as there is room again, not only on the periodic timer
+    if(uip_stopped(uip_conn) && has_room()) {
+        DEBUG_PRINTF("GcodeStream: restarted %d\n", CommandQueue::getInstance()->size());
+        uip_restart();
+    }
+
+    if (uip_rexmit() || uip_newdata() || uip_acked() || uip_connected() || uip_poll()) {
+        instance->senddata();
+    }
+}
+
+// static
+void GcodeStream::init(void)
+{
+    uip_listen(HTONS(PORT));
+}
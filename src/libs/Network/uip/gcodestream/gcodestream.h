@@ -0,0 +1,61 @@
+#ifndef __GCODESTREAM_H__
+#define __GCODESTREAM_H__
+
+/*
+ * Streams G-code over a raw TCP connection.
+ *
+ * Every line received is queued as a command, there is no ok to wait for, the oks are dropped and only other replies
+ * and errors are sent back. Flow control is the TCP window: the connection is stopped while the planner is full or
+ * more than a few received lines are still waiting to be issued, and restarted once they have been, so a host just
+ * writes the file to the socket.
+ *
+ * How to use it:
+ *
+ *   1. Add "network.gcode_stream.enable true" to the config
+ *   2. Send a file with e.g. "nc -q 0 $ip 2323 < file.gcode"
+ *
+ * '?' and ^X are handled as they arrive like on the telnet port.
+ */
+
+#include <stdint.h>
+
+class StreamOutput;
+
+class GcodeStream
+{
+public:
+    GcodeStream();
+    ~GcodeStream();
+
+    static void init(void);
+    static void appcall(void);
+
+    // true when the planner can take a block and the network command queue is down to a few lines
+    static bool has_room(void);
+
+    static const uint16_t PORT= 2323;
+
+private:
+    static const int MAXLINELENGTH= 132;
+    static const int OUTBUFSIZE= 512;
+    static const int MAX_WAITING_LINES= 8;
+
+    static int output_callback(const char *str, void *p);
+
+    void newdata(void);
+    void acked(void);
+    void senddata(void);
+    void get_char(char c);
+    int output(const char *str);
+
+    StreamOutput *pstream;
+
+    char line[MAXLINELENGTH];
+    char outbuf[OUTBUFSIZE];
+    uint16_t linelen;
+    uint16_t outlen;
+    uint16_t sent;
+    uint16_t rport;
+};
+
+#endif /* __GCODESTREAM_H__ */
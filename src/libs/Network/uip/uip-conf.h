@@ -56,6 +56,7 @@
 #define __UIP_CONF_H__
 
 #include <inttypes.h>
+#include "lpc17xx_ethernet_conf.h"
 
 /**
  * 8 bit datatype
@@ -102,9 +103,25 @@ typedef unsigned short uip_stats_t;
 /**
  * uIP buffer size.
  *
+ * A whole ethernet frame so the MSS is 1460. uip_buf is not an array,
+ * it points at the EMAC transmit buffer the next frame is sent from so
+ * frames are built where the DMA sends them from.
+ *
+ * \hideinitializer
+ */
+#define UIP_CONF_BUFFER_SIZE     LPC17XX_MAX_FRAME
+#define UIP_CONF_EXTERNAL_BUFFER
+
+/**
+ * TCP receive window.
+ *
+ * One segment less than the EMAC has receive buffers, a sender can
+ * have that many in flight and they wait in the receive ring until
+ * they are taken.
+ *
  * \hideinitializer
  */
-#define UIP_CONF_BUFFER_SIZE     400
+#define UIP_CONF_RECEIVE_WINDOW  ((LPC17XX_RXBUFS - 1) * UIP_TCP_MSS)
 
 #define UIP_CONF_BROADCAST 1
 
@@ -48,6 +48,7 @@
 
 void uip_add32(u8_t *op32, u16_t op16);
 void tcpip_output();
+void tcpip_output_tail(u8_t *hdr, u16_t hdrlen, u8_t *data, u16_t datalen);
 
 #define BUF ((struct uip_tcpip_hdr *)&uip_buf[UIP_LLH_LEN])
 
@@ -57,92 +58,82 @@ void tcpip_output();
 #define UIP_SPLIT_SIZE UIP_TCP_MSS
 #endif /* UIP_SPLIT_CONF_SIZE */
 
+/* One's complement addition of two checksums in host order. */
+static u16_t
+chksum_add(u16_t a, u16_t b)
+{
+    u16_t sum = a + b;
+    return sum < b ? sum + 1 : sum;
+}
+
 /*-----------------------------------------------------------------------------*/
 void uip_split_output(void)
 {
-    u16_t tcplen, len1, len2;
-
+    u16_t tcplen, len1, len2, sum;
+    u8_t hdr[UIP_LLH_LEN + UIP_TCPIP_HLEN];
+    struct uip_tcpip_hdr *hdr2 = (struct uip_tcpip_hdr *)&hdr[UIP_LLH_LEN];
+    u8_t *data2;
 
     /* We only try to split maximum sized TCP segments. */
     if (BUF->proto == UIP_PROTO_TCP &&
         uip_len >= UIP_SPLIT_SIZE + UIP_TCPIP_HLEN) {
 
         tcplen = uip_len - UIP_TCPIP_HLEN - UIP_LLH_LEN;
-        /* Split the segment in two. If the original packet length was
-           odd, we make the second packet one byte larger. */
-        len1 = len2 = tcplen / 2;
-        if (len1 + len2 < tcplen) {
-            ++len2;
-        }
+        /* Split the segment in two. The first packet gets an even
+           length so the data of the second starts on a 16 bit word of
+           the checksum. */
+        len1 = (tcplen / 2) & ~1;
+        len2 = tcplen - len1;
+
+        /* The second packet is sent from where its data is in uip_buf,
+           only its headers are made here. That is done before the first
+           packet is sent as uip_buf is the buffer the ethernet sends it
+           from, uip_buf is another one after it. */
+        data2 = &uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN + len1];
+        memcpy(hdr, uip_buf, sizeof(hdr));
+
+        hdr2->len[0] = (len2 + UIP_TCPIP_HLEN) >> 8;
+        hdr2->len[1] = (len2 + UIP_TCPIP_HLEN) & 0xff;
+
+        uip_add32(hdr2->seqno, len1);
+        hdr2->seqno[0] = uip_acc32[0];
+        hdr2->seqno[1] = uip_acc32[1];
+        hdr2->seqno[2] = uip_acc32[2];
+        hdr2->seqno[3] = uip_acc32[3];
+
+        /* The TCP checksum of the pseudo header, the TCP header and the
+           data, summed apart as they are not together. */
+        hdr2->tcpchksum = 0;
+        sum = UIP_TCPH_LEN + len2 + UIP_PROTO_TCP;
+        sum = chksum_add(sum, ntohs(uip_chksum((u16_t *)&hdr2->srcipaddr[0], 2 * sizeof(uip_ipaddr_t))));
+        sum = chksum_add(sum, ntohs(uip_chksum((u16_t *)&hdr[UIP_LLH_LEN + UIP_IPH_LEN], UIP_TCPH_LEN)));
+        sum = chksum_add(sum, ntohs(uip_chksum((u16_t *)data2, len2)));
+        hdr2->tcpchksum = ~((sum == 0) ? 0xffff : htons(sum));
+
+        hdr2->ipchksum = 0;
+        sum = ntohs(uip_chksum((u16_t *)&hdr[UIP_LLH_LEN], UIP_IPH_LEN));
+        hdr2->ipchksum = ~((sum == 0) ? 0xffff : htons(sum));
 
         /* Create the first packet. This is done by altering the length
            field of the IP header and updating the checksums. */
         uip_len = len1 + UIP_TCPIP_HLEN;
-#if UIP_CONF_IPV6
-        /* For IPv6, the IP length field does not include the IPv6 IP header
-           length. */
-        BUF->len[0] = ((uip_len - UIP_IPH_LEN) >> 8);
-        BUF->len[1] = ((uip_len - UIP_IPH_LEN) & 0xff);
-#else /* UIP_CONF_IPV6 */
         BUF->len[0] = uip_len >> 8;
         BUF->len[1] = uip_len & 0xff;
-#endif /* UIP_CONF_IPV6 */
 
         /* Recalculate the TCP checksum. */
         BUF->tcpchksum = 0;
         BUF->tcpchksum = ~(uip_tcpchksum());
 
-#if !UIP_CONF_IPV6
         /* Recalculate the IP checksum. */
         BUF->ipchksum = 0;
         BUF->ipchksum = ~(uip_ipchksum());
-#endif /* UIP_CONF_IPV6 */
 
         uip_len += UIP_LLH_LEN;
 
-        /* Transmit the first packet. */
-        /*    uip_fw_output();*/
-        tcpip_output();
-
-        /* Now, create the second packet. To do this, it is not enough to
-           just alter the length field, but we must also update the TCP
-           sequence number and point the uip_appdata to a new place in
-           memory. This place is detemined by the length of the first
-           packet (len1). */
-        uip_len = len2 + UIP_TCPIP_HLEN;
-#if UIP_CONF_IPV6
-        /* For IPv6, the IP length field does not include the IPv6 IP header
-           length. */
-        BUF->len[0] = ((uip_len - UIP_IPH_LEN) >> 8);
-        BUF->len[1] = ((uip_len - UIP_IPH_LEN) & 0xff);
-#else /* UIP_CONF_IPV6 */
-        BUF->len[0] = uip_len >> 8;
-        BUF->len[1] = uip_len & 0xff;
-#endif /* UIP_CONF_IPV6 */
-
-        /*    uip_appdata += len1;*/
-        memcpy(uip_appdata, (u8_t *)uip_appdata + len1, len2);
-
-        uip_add32(BUF->seqno, len1);
-        BUF->seqno[0] = uip_acc32[0];
-        BUF->seqno[1] = uip_acc32[1];
-        BUF->seqno[2] = uip_acc32[2];
-        BUF->seqno[3] = uip_acc32[3];
-
-        /* Recalculate the TCP checksum. */
-        BUF->tcpchksum = 0;
-        BUF->tcpchksum = ~(uip_tcpchksum());
-
-#if !UIP_CONF_IPV6
-        /* Recalculate the IP checksum. */
-        BUF->ipchksum = 0;
-        BUF->ipchksum = ~(uip_ipchksum());
-#endif /* UIP_CONF_IPV6 */
-
-        uip_len += UIP_LLH_LEN;
-        /* Transmit the second packet. */
-        /*    uip_fw_output();*/
+        /* Transmit the first packet, then the second one made of the
+           headers and the rest of the data in the first one's buffer. */
         tcpip_output();
+        tcpip_output_tail(hdr, sizeof(hdr), data2, len2);
     } else {
         /*    uip_fw_output();*/
         tcpip_output();
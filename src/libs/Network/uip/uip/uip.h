@@ -427,11 +427,21 @@ void uip_setipid(u16_t id);
  \endcode
  */
 
+#ifdef UIP_CONF_EXTERNAL_BUFFER
+/* The device driver points uip_buf at the buffer the next packet will
+   be sent from, at least UIP_BUFSIZE bytes. */
+#ifdef __cplusplus
+extern "C" u8_t *uip_buf;
+#else
+extern u8_t *uip_buf;
+#endif
+#else /* UIP_CONF_EXTERNAL_BUFFER */
 #ifdef __cplusplus
 extern "C" u8_t uip_buf[UIP_BUFSIZE+4];
 #else
 extern u8_t uip_buf[UIP_BUFSIZE+4];
 #endif
+#endif /* UIP_CONF_EXTERNAL_BUFFER */
 
 #ifdef __cplusplus
 extern "C" {
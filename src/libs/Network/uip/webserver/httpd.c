@@ -76,6 +76,7 @@
 #include "CallbackStream.h"
 
 #include "c-fifo.h"
+#include "upload.h"
 
 #define STATE_WAITING 0
 #define STATE_HEADERS 1
@@ -141,45 +142,6 @@ static void create_callback_stream(struct httpd_state *s)
     s->pstream = new_callback_stream(command_result, s);
 }
 
-// Used to save files to SDCARD during upload
-static FILE *fd;
-static char *output_filename = NULL;
-static int file_cnt = 0;
-static int open_file(const char *fn)
-{
-    if (output_filename != NULL) free(output_filename);
-    output_filename = malloc(strlen(fn) + 5);
-    strcpy(output_filename, "/sd/");
-    strcat(output_filename, fn);
-    fd = fopen(output_filename, "w");
-    if (fd == NULL) {
-        free(output_filename);
-        output_filename = NULL;
-        return 0;
-    }
-    return 1;
-}
-
-static int close_file()
-{
-    free(output_filename);
-    output_filename = NULL;
-    fclose(fd);
-    return 1;
-}
-
-static int save_file(uint8_t *buf, unsigned int len)
-{
-    if (fwrite(buf, 1, len, fd) == len) {
-        file_cnt += len;
-        return 1;
-
-    } else {
-        close_file();
-        return 0;
-    }
-}
-
 static int fs_open(struct httpd_state *s)
 {
     if (strncmp(s->filename, "/sd/", 4) == 0) {
@@ -346,6 +308,10 @@ PT_THREAD(handle_output(struct httpd_state *s))
                 PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
                 PSOCK_SEND_STR(&s->sout, "OK\r\n");
             }
+            if (s->upload != NULL) {
+                // the MD5, size and rate of the upload
+                PSOCK_SEND_STR(&s->sout, upload_result(s->upload));
+            }
 
         } else {
             DEBUG_PRINTF("Unknown POST: %s\n", s->filename);
@@ -426,7 +392,8 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
     DEBUG_PRINTF("Uploading file: %s, %d\n", s->upload_name, s->content_length);
 
     // The body is the raw data to be stored to the file
-    if (!open_file(s->upload_name)) {
+    s->upload = upload_open(s->upload_name);
+    if (s->upload == NULL) {
         DEBUG_PRINTF("failed to open file\n");
         s->uploadok = 0;
         PT_EXIT(&s->inputpt);
@@ -436,8 +403,10 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
 
     if (len > 0) {
         // write the first part of the buffer
-        if (!save_file(buf, len)) {
+        if (!upload_write(s->upload, buf, len)) {
             DEBUG_PRINTF("initial write failed\n");
+            upload_free(s->upload);
+            s->upload = NULL;
             s->uploadok = 0;
             PT_EXIT(&s->inputpt);
         }
@@ -456,8 +425,10 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
         //DEBUG_PRINTF("read %d bytes of data\n", readlen);
 
         if (readlen > 0) {
-            if (!save_file(readptr, readlen)) {
+            if (!upload_write(s->upload, readptr, readlen)) {
                 DEBUG_PRINTF("write failed\n");
+                upload_free(s->upload);
+                s->upload = NULL;
                 s->uploadok = 0;
                 PT_EXIT(&s->inputpt);
             }
@@ -465,9 +436,9 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
         }
     }
 
-    close_file();
-    s->uploadok = 1;
-    DEBUG_PRINTF("finished upload\n");
+    // kept for the response, freed when the connection closes
+    s->uploadok = upload_close(s->upload, s->upload_md5);
+    DEBUG_PRINTF("finished upload: %d\n", s->uploadok);
 
     PT_END(&s->inputpt);
 }
@@ -545,6 +516,11 @@ PT_THREAD(handle_input(struct httpd_state *s))
                     strncpy(s->upload_name, &s->inputbuf[12], sizeof(s->upload_name) - 1);
                     DEBUG_PRINTF("Upload name= %s\n", s->upload_name);
 
+                } else if (strncmp(s->inputbuf, "X-MD5: ", 7) == 0) {
+                    s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
+                    strncpy(s->upload_md5, &s->inputbuf[7], sizeof(s->upload_md5) - 1);
+                    DEBUG_PRINTF("Upload MD5= %s\n", s->upload_md5);
+
                 } else if (strncmp(s->inputbuf, http_cache_control, sizeof(http_cache_control) - 1) == 0) {
                     s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
                     s->cache_page = strncmp(http_no_cache, &s->inputbuf[sizeof(http_cache_control) - 1], sizeof(http_no_cache) - 1) != 0;
@@ -642,6 +618,9 @@ httpd_appcall(void)
         s->strbuf = NULL;
         s->fifo = NULL;
         s->pstream = NULL;
+        s->upload = NULL;
+        s->upload_md5[0] = 0;
+        s->upload_md5[sizeof(s->upload_md5) - 1] = 0;
     }
 
     if (s == NULL) {
@@ -663,7 +642,8 @@ httpd_appcall(void)
 
     if (uip_closed() || uip_aborted() || uip_timedout()) {
         DEBUG_PRINTF("Closing connection: %d\n", HTONS(uip_conn->rport));
-        if (s->fd != NULL) fclose(fd); // clean up
+        if (s->fd != NULL) fclose(s->fd); // clean up
+        if (s->upload != NULL) upload_free(s->upload); // removes the file if the upload did not finish
         if (s->strbuf != NULL) free(s->strbuf);
         if (s->pstream != NULL) {
             // free these if they were allocated
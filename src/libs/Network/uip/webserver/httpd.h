@@ -46,6 +46,7 @@ struct httpd_state {
   char inputbuf[100];
   char filename[60];
   char upload_name[60];
+  char upload_md5[33];
   char method;
   char state;
   struct httpd_fs_file file;
@@ -59,6 +60,7 @@ struct httpd_state {
   uint8_t cache_page;
   void *pstream;
   void *fifo;
+  void *upload;
   uint16_t command_count;
 };
 
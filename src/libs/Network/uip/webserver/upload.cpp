@@ -0,0 +1,146 @@
+#include "upload.h"
+
+#include "Kernel.h"
+#include "StreamOutputPool.h"
+#include "platform_memory.h"
+#include "md5.h"
+#include "mbed.h" // for us_ticker_read()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+
+// whole sectors, FatFs writes those straight to the card with one multi block write up to the end of a cluster
+#define UPLOAD_BUFFER_SIZE 4096
+
+//#define DEBUG_PRINTF printf
+#define DEBUG_PRINTF(...)
+
+namespace {
+struct Upload {
+    std::string path;
+    FILE *fd;
+    uint8_t *buffer;
+    unsigned int buffered;
+    uint32_t size;
+    uint32_t last_us;
+    uint32_t elapsed_us;
+    uint32_t write_us;
+    MD5 md5;
+    char result[140];
+
+    Upload() : fd(NULL), buffer(NULL), buffered(0), size(0), elapsed_us(0), write_us(0) { result[0] = 0; }
+    ~Upload();
+    bool flush();
+    void tick();
+};
+}
+
+Upload::~Upload()
+{
+    if(fd != NULL) {
+        // it did not finish so what there is of it is not kept
+        fclose(fd);
+        remove(path.c_str());
+    }
+    if(buffer != NULL) {
+        if(AHB0.has(buffer)) AHB0.dealloc(buffer);
+        else free(buffer);
+    }
+}
+
+bool Upload::flush()
+{
+    if(buffered == 0) return true;
+
+    uint32_t t = us_ticker_read();
+    bool ok = fwrite(buffer, 1, buffered, fd) == buffered;
+    write_us += us_ticker_read() - t;
+    buffered = 0;
+    return ok;
+}
+
+// the time is summed a step at a time so the microsecond ticker wrapping during a long upload does not matter
+void Upload::tick()
+{
+    uint32_t now = us_ticker_read();
+    elapsed_us += now - last_us;
+    last_us = now;
+}
+
+void *upload_open(const char *name)
+{
+    Upload *u = new Upload;
+    u->path = std::string("/sd/") + name;
+
+    // AHB0 is mostly free, the heap is used if it is not
+    u->buffer = (uint8_t *)AHB0.alloc(UPLOAD_BUFFER_SIZE);
+    if(u->buffer == NULL) u->buffer = (uint8_t *)malloc(UPLOAD_BUFFER_SIZE);
+
+    if(u->buffer != NULL) u->fd = fopen(u->path.c_str(), "w");
+    if(u->fd == NULL) {
+        DEBUG_PRINTF("upload: can not open %s\n", u->path.c_str());
+        delete u;
+        return NULL;
+    }
+    // the buffer is written as it is, stdio would cut it into its own smaller writes
+    setvbuf(u->fd, NULL, _IONBF, 0);
+
+    u->last_us = us_ticker_read();
+    return u;
+}
+
+int upload_write(void *upload, const uint8_t *buf, unsigned int len)
+{
+    Upload *u = static_cast<Upload *>(upload);
+    u->md5.update(buf, len);
+    u->size += len;
+
+    while(len > 0) {
+        unsigned int n = UPLOAD_BUFFER_SIZE - u->buffered;
+        if(n > len) n = len;
+        memcpy(u->buffer + u->buffered, buf, n);
+        u->buffered += n;
+        buf += n;
+        len -= n;
+        if(u->buffered == UPLOAD_BUFFER_SIZE && !u->flush()) return 0;
+    }
+
+    u->tick();
+    return 1;
+}
+
+int upload_close(void *upload, const char *md5)
+{
+    Upload *u = static_cast<Upload *>(upload);
+    bool ok = u->flush();
+    ok = fclose(u->fd) == 0 && ok;
+    u->fd = NULL;
+    u->tick();
+
+    std::string digest = u->md5.finalize().hexdigest();
+    bool match = md5 == NULL || md5[0] == 0 || strcasecmp(md5, digest.c_str()) == 0;
+    if(!ok || !match) remove(u->path.c_str());
+
+    unsigned long ms = u->elapsed_us / 1000;
+    unsigned long rate = u->elapsed_us > 0 ? (uint64_t)u->size * 1000000 / u->elapsed_us : 0;
+    unsigned long write_rate = u->write_us > 0 ? (uint64_t)u->size * 1000000 / u->write_us : 0;
+    snprintf(u->result, sizeof(u->result), "%s %lu bytes in %lu.%03lus, %lu bytes/s, SD write %lu bytes/s%s\r\n",
+             digest.c_str(), (unsigned long)u->size, ms / 1000, ms % 1000, rate, write_rate,
+             !ok ? ", write failed" : !match ? ", MD5 mismatch" : "");
+    THEKERNEL->streams->printf("upload %s: %s", u->path.c_str(), u->result);
+
+    return ok && match;
+}
+
+const char *upload_result(void *upload)
+{
+    return static_cast<Upload *>(upload)->result;
+}
+
+void upload_free(void *upload)
+{
+    delete static_cast<Upload *>(upload);
+}
@@ -0,0 +1,35 @@
+#ifndef __UPLOAD_H__
+#define __UPLOAD_H__
+
+/*
+ * Saves a file posted to /upload on the SD card.
+ *
+ * The data is gathered into a buffer of whole sectors and written a buffer at a time with the file unbuffered, so
+ * FatFs writes it to the card in multi block writes instead of a few hundred bytes at a time as the segments come in.
+ * The MD5 of the data is summed as it comes, when the request gave one in an X-MD5 header the file is only kept if
+ * they match.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* opens /sd/name for writing, NULL if it can not be */
+void *upload_open(const char *name);
+/* 0 if the card write failed */
+int upload_write(void *upload, const uint8_t *buf, unsigned int len);
+/* writes what is left and closes the file, 0 if that failed or the MD5 is not md5 (hex, empty to not check), the file
+   is removed then */
+int upload_close(void *upload, const char *md5);
+/* the MD5, size and rate of a closed upload, one line */
+const char *upload_result(void *upload);
+/* frees it, an upload that was not closed is removed */
+void upload_free(void *upload);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UPLOAD_H__ */
@@ -0,0 +1,51 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PressureAdvance.h"
+
+#include <math.h>
+
+// the most the extruder can be ahead, in 16.16 fixed point steps
+#define MAX_ADVANCE 0x40000000
+
+PressureAdvance::PressureAdvance()
+{
+    advance_time= 0;
+    smooth_time= 0;
+    factor= 0;
+    smoothing= 65536;
+    advance= 0;
+    error= 0;
+}
+
+void PressureAdvance::configure(float advance, float smooth_time, float tick_frequency)
+{
+    if(advance < 0) advance= 0;
+    if(smooth_time < 0) smooth_time= 0;
+    this->advance_time= advance;
+    this->smooth_time= smooth_time;
+
+    factor= lroundf(advance * tick_frequency * 65536.0F);
+    float ticks= smooth_time * tick_frequency;
+    smoothing= ticks > 1.0F ? lroundf(65536.0F / ticks) : 65536;
+    if(smoothing < 1) smoothing= 1;
+}
+
+// the advance is the speed in steps per tick times the ticks of advance. Smoothed it moves a fraction of the way there
+// each tick, it gets to no advance exactly as the shift rounds down
+int PressureAdvance::follow(uint32_t rate)
+{
+    uint64_t a= ((uint64_t)rate * factor) >> 32;
+    int32_t target= a > MAX_ADVANCE ? MAX_ADVANCE : a;
+    int32_t next= advance + (int32_t)(((int64_t)(target - advance) * smoothing) >> 16);
+    error += next - advance;
+    advance= next;
+
+    if(error >= 32768) return 1;
+    if(error <= -32768) return -1;
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// Linear pressure advance of an extruder, used by the step ticker. The extruder is kept ahead of the steps the step
+// generation makes for it by its speed times the advance time, so it pushes harder as the head accelerates and eases
+// off as it decelerates. The speed is the rate the step ticker steps it at, which it changes every tick by the
+// acceleration_change or deceleration_change of the block. The advance can be smoothed so it does not jump where the
+// extrusion rate does between blocks
+class PressureAdvance
+{
+    public:
+        PressureAdvance();
+
+        // advance is in seconds, smooth_time the time constant of the smoothing in seconds, 0 is none
+        void configure(float advance, float smooth_time, float tick_frequency);
+        float get_advance() const { return advance_time; }
+        float get_smooth_time() const { return smooth_time; }
+
+        // the step generation made a step
+        void push(bool dir) { error += dir ? -65536 : 65536; }
+
+        // moves the advance towards the one for rate, the steps per tick in 0.32 fixed point the step generation moves
+        // the extruder at, 0 if it is not extruding. Returns 1 if the motor needs to step positive, -1 negative
+        int follow(uint32_t rate);
+
+        // the motor made the step follow() asked for
+        void stepped(int dir) { error -= dir * 65536; }
+
+        // steps still to be made, the motor is not yet back to the steps the step generation made
+        bool is_pending() const { return error <= -32768 || error >= 32768 || advance != 0; }
+
+        // drops the steps still to be made, the motor was stopped
+        void flush() { error= 0; advance= 0; }
+
+    private:
+        float advance_time;
+        float smooth_time;
+        uint32_t factor;            // 16.16 fixed point ticks of advance
+        int32_t smoothing;          // 0.16 fixed point fraction of the way to the new advance it moves each tick
+        int32_t advance;            // 16.16 fixed point steps the extruder is ahead
+        int32_t error;              // 16.16 fixed point steps the extruder is from the step generation plus the advance
+};
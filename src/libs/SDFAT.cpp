@@ -25,6 +25,17 @@ int SDFAT::disk_write(const char *buffer, int sector)
     return d->disk_write(buffer, sector);
 }
 
+// a single sector is FatFs moving its window, those are cached by the disk, file data is read and written a cluster at a time
+int SDFAT::disk_read_sectors(char *buffer, int sector, int count)
+{
+    return count == 1 ? d->disk_read(buffer, sector) : d->disk_read_blocks(buffer, sector, count);
+}
+
+int SDFAT::disk_write_sectors(const char *buffer, int sector, int count)
+{
+    return count == 1 ? d->disk_write(buffer, sector) : d->disk_write_blocks(buffer, sector, count);
+}
+
 int SDFAT::disk_sync()
 {
     return d->disk_sync();
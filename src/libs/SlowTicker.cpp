@@ -11,16 +11,31 @@
 #include "SlowTicker.h"
 #include "StepTicker.h"
 #include "libs/Hook.h"
+#include "libs/StreamOutput.h"
 #include "modules/robot/Conveyor.h"
 #include "Gcode.h"
 
+#include <algorithm>
 #include <mri.h>
 
 // This module uses a Timer to periodically call hooks
 // Modules register with a function ( callback ) and a frequency, and we then call that function at the given frequency.
+// Hooks with the same frequency are called together, and the timer match is set to the next group that is due rather
+// than ticking at the fastest frequency, so an interrupt is only taken when there is something to call.
 
 SlowTicker* global_slow_ticker;
 
+// a group can be called up to 1/EARLY_FRACTION of its period early
+#define EARLY_FRACTION 64
+
+// the timer counts at SystemCoreClock/4 and is never reset, so deadlines are compared by their difference as it wraps
+static inline bool is_before(uint32_t a, uint32_t b) { return (int32_t)(a - b) < 0; }
+
+// heap order, the group with the earliest deadline is on top
+struct LaterDeadline {
+    template<typename G> bool operator()(const G *a, const G *b) const { return is_before(b->deadline, a->deadline); }
+};
+
 SlowTicker::SlowTicker(){
     global_slow_ticker = this;
 
@@ -28,18 +43,22 @@ SlowTicker::SlowTicker(){
     ispbtn.from_string("2.10")->as_input()->pull_up();
 
     LPC_SC->PCONP |= (1 << 22);     // Power Ticker ON
-    LPC_TIM2->MCR = 3;              // Match on MR0, reset on MR0
-    // do not enable interrupt until setup is complete
-    LPC_TIM2->TCR = 0;              // Disable interrupt
+    LPC_TIM2->MCR = 1;              // Interrupt on MR0, the counter keeps running
+    // do not start counting until setup is complete
+    LPC_TIM2->TCR = 2;              // Reset and hold the counter
 
-    max_frequency = 5;  // initial max frequency is set to 5Hz
-    set_frequency(max_frequency);
     flag_1s_flag = 0;
+    reset_stats();
+
+    // the ISP button used to be checked on every tick, and the slowest it ticked was 5Hz
+    attach(5, this, &SlowTicker::check_isp_button);
+    attach(1, this, &SlowTicker::second_tick);
 }
 
 void SlowTicker::start()
 {
-    LPC_TIM2->TCR = 1;              // Enable interrupt
+    LPC_TIM2->MR0 = groups.front()->deadline;
+    LPC_TIM2->TCR = 1;              // Start counting
     NVIC_EnableIRQ(TIMER2_IRQn);    // Enable interrupt handler
 }
 
@@ -47,44 +66,134 @@ void SlowTicker::on_module_loaded(){
     register_for_event(ON_IDLE);
 }
 
-// Set the base frequency we use for all sub-frequencies
-void SlowTicker::set_frequency( int frequency ){
-    this->interval = (SystemCoreClock >> 2) / frequency;   // SystemCoreClock/4 = Timer increments in a second
-    LPC_TIM2->MR0 = this->interval;
-    LPC_TIM2->TCR = 3;  // Reset
-    LPC_TIM2->TCR = 1;  // Reset
-    flag_1s_count= SystemCoreClock>>2;
+void SlowTicker::add_hook(Hook *hook)
+{
+    // to avoid race conditions we must stop the interupts before updating the non thread safe groups
+    __disable_irq();
+    auto g = std::find_if(groups.begin(), groups.end(), [hook](HookGroup *g) { return g->interval == hook->interval; });
+    if(g != groups.end()) {
+        // called from the next time the group is due
+        (*g)->hooks.push_back(hook);
+
+    } else {
+        HookGroup *group = new HookGroup;
+        group->interval = hook->interval;
+        group->deadline = LPC_TIM2->TC + hook->interval;
+        group->hooks.push_back(hook);
+        groups.push_back(group);
+        std::push_heap(groups.begin(), groups.end(), LaterDeadline());
+
+        // due before the match that is set
+        if(groups.front() == group) LPC_TIM2->MR0 = group->deadline;
+    }
+    __enable_irq();
 }
 
 // The actual interrupt being called by the timer, this is where work is done
 void SlowTicker::tick(){
-
-    // Call all hooks that need to be called
-    for (Hook* hook : this->hooks){
-        hook->countdown -= this->interval;
-        if (hook->countdown < 0)
-        {
-            hook->countdown += hook->interval;
-            hook->call();
+    uint32_t start = LPC_TIM2->TC;
+
+    // Call all the groups that are due, then set the match to the next one
+    for(;;) {
+        HookGroup *group = groups.front();
+        uint32_t now = LPC_TIM2->TC;
+        // a group due within a fraction of its period is called early rather than take an interrupt of its own, it
+        // stays on its deadlines so it only jitters by that much
+        if(is_before(now, group->deadline - group->interval / EARLY_FRACTION)) {
+            LPC_TIM2->MR0 = group->deadline;
+            // the match only fires when the counter gets to it, if it got there while we set it we call the group now
+            if(is_before(LPC_TIM2->TC, group->deadline)) break;
+            continue;
         }
+
+        std::pop_heap(groups.begin(), groups.end(), LaterDeadline());
+        call_group(group);
+        group->deadline += group->interval;
+        // a group that fell a whole period behind (stopped in the debugger) is not called again to catch up
+        if(!is_before(now, group->deadline)) group->deadline = now + group->interval;
+        std::push_heap(groups.begin(), groups.end(), LaterDeadline());
     }
 
-    // deduct tick time from second counter
-    flag_1s_count -= this->interval;
-    // if a whole second has elapsed,
-    if (flag_1s_count < 0)
-    {
-        // add a second to our counter
-        flag_1s_count += SystemCoreClock >> 2;
-        // and set a flag for idle event to pick up
-        flag_1s_flag++;
+    ++isr_count;
+    isr_time += LPC_TIM2->TC - start;
+}
+
+void SlowTicker::call_group(HookGroup *group)
+{
+    for (Hook* hook : group->hooks) {
+        uint32_t t = LPC_TIM2->TC;
+        hook->call();
+        t = LPC_TIM2->TC - t;
+
+        hook->calls++;
+        hook->time_total += t;
+        if(t > hook->time_max) hook->time_max = t;
     }
+}
+
+uint32_t SlowTicker::second_tick(uint32_t)
+{
+    // a whole second has elapsed, set a flag for idle event to pick up
+    flag_1s_flag++;
+    stats_seconds++;
+    return 0;
+}
 
+uint32_t SlowTicker::check_isp_button(uint32_t)
+{
     // Enter MRI mode if the ISP button is pressed
     // TODO: This should have it's own module
     if (ispbtn.get() == 0)
         __debugbreak();
+    return 0;
+}
+
+void SlowTicker::reset_stats()
+{
+    __disable_irq();
+    for (HookGroup *group : groups) {
+        for (Hook *hook : group->hooks) {
+            hook->calls = 0;
+            hook->time_total = 0;
+            hook->time_max = 0;
+        }
+    }
+    isr_count = 0;
+    isr_time = 0;
+    stats_seconds = 0;
+    __enable_irq();
+}
+
+// the time taken by each hook and by the interrupt as a whole since the stats were reset, fastest hooks first
+void SlowTicker::print_stats(StreamOutput *stream)
+{
+    uint32_t seconds = stats_seconds;
+    if(seconds == 0) {
+        stream->printf("no ticker stats yet, they are collected for a second\n");
+        return;
+    }
+
+    const float us_per_tick = 4E6F / SystemCoreClock;
+    const float us_per_percent = seconds * 1E4F;
+
+    __disable_irq();
+    std::vector<HookGroup*> sorted(groups);
+    __enable_irq();
+    std::sort(sorted.begin(), sorted.end(), [](HookGroup *a, HookGroup *b) { return a->interval < b->interval; });
+
+    for (HookGroup *group : sorted) {
+        stream->printf("%lu Hz:\n", (SystemCoreClock >> 2) / group->interval);
+        for (Hook *hook : group->hooks) {
+            float total = hook->time_total * us_per_tick;
+            stream->printf("  hook %p: %lu calls, avg %1.2f us, max %1.2f us, %1.3f%% cpu\n", hook->get_object(), hook->calls,
+                           hook->calls > 0 ? total / hook->calls : 0, hook->time_max * us_per_tick, total / us_per_percent);
+        }
+    }
 
+    // the timer used to interrupt at the fastest frequency whether a hook was due or not
+    uint32_t fixed = seconds * ((SystemCoreClock >> 2) / sorted.front()->interval);
+    stream->printf("%lu interrupts in %lu s, %1.3f%% cpu, a tick at the fastest frequency would be %lu interrupts\n",
+                   isr_count, seconds, isr_time * us_per_tick / us_per_percent, fixed);
 }
 
 bool SlowTicker::flag_1s(){
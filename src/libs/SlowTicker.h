@@ -16,6 +16,9 @@
 
 #include "system_LPC17xx.h" // for SystemCoreClock
 #include <math.h>
+#include <vector>
+
+class StreamOutput;
 
 class SlowTicker : public Module{
     public:
@@ -24,7 +27,6 @@ class SlowTicker : public Module{
         void on_module_loaded(void);
         void on_idle(void*);
         void start();
-        void set_frequency( int frequency );
         void tick();
         // For some reason this can't go in the .cpp, see :  http://mbed.org/forum/mbed/topic/2774/?page=1#comment-14221
         // TODO replace this with std::function()
@@ -32,29 +34,36 @@ class SlowTicker : public Module{
             Hook* hook = new Hook();
             hook->interval = floorf((SystemCoreClock/4)/frequency);
             hook->attach(optr, fptr);
-            hook->countdown = hook->interval;
-
-            // to avoid race conditions we must stop the interupts before updating this non thread safe vector
-            __disable_irq();
-            if( frequency > this->max_frequency ){
-                this->max_frequency = frequency;
-                this->set_frequency(frequency);
-            }
-            this->hooks.push_back(hook);
-            __enable_irq();
+            this->add_hook(hook);
             return hook;
         }
 
+        void print_stats(StreamOutput *stream);
+        void reset_stats();
+
     private:
+        // hooks with the same interval are called together, the groups are kept in a heap ordered by their next deadline
+        struct HookGroup {
+            uint32_t interval;
+            uint32_t deadline;  // timer count the group is next due at
+            std::vector<Hook*> hooks;
+        };
+
+        void add_hook(Hook *hook);
+        void call_group(HookGroup *group);
+        uint32_t second_tick(uint32_t);
+        uint32_t check_isp_button(uint32_t);
         bool flag_1s();
 
-        std::vector<Hook*> hooks;
-        uint32_t max_frequency;
-        uint32_t interval;
+        std::vector<HookGroup*> groups;
+
+        // interrupts taken and the timer ticks spent in them since the stats were reset
+        uint32_t isr_count;
+        uint64_t isr_time;
+        uint32_t stats_seconds;
 
         Pin ispbtn;
 protected:
-    int flag_1s_count;
     volatile int flag_1s_flag;
 };
 
@@ -15,6 +15,9 @@
 #include "StreamOutputPool.h"
 #include "Block.h"
 #include "Conveyor.h"
+#include "fixed_sine.h"
+#include "InputShaper.h"
+#include "PressureAdvance.h"
 
 #include "system_LPC17xx.h" // mbed.h lib
 #include <math.h>
@@ -54,6 +57,7 @@ StepTicker::StepTicker()
 
     this->running = false;
     this->current_block = nullptr;
+    this->active_motors = 0;
 
     #ifdef STEPTICKER_DEBUG_PIN
     // setup debug pin if defined
@@ -130,7 +134,12 @@ void StepTicker::handle_finish (void)
     if(finished_fnc) finished_fnc();
 }
 
+#ifdef STEPTICKER_FIXED32
+
 // step clock
+// Only the primary axis (the one with the most steps) has a rate, it is updated once per tick from the acceleration
+// schedule precomputed in Block::prepare(). Each active motor steps at its fixed share of that rate, so the per motor
+// work is a multiply and a 32 bit add, and motors that are not moving in this block are not looked at.
 void StepTicker::step_tick (void)
 {
     //SET_STEPTICKER_DEBUG_PIN(running ? 1 : 0);
@@ -140,8 +149,313 @@ void StepTicker::step_tick (void)
         // check if anything new available
         if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
             running= start_next_block(); // returns true if there is at least one motor with steps to issue
-            if(!running) return;
+        }
+        if(!running) {
+            // the followed motors carry on to where the steps they were given put them
+            if(follow_motors != 0) {
+                follow_steps();
+                if(unstep.any()) {
+                    LPC_TIM1->TCR = 3;
+                    LPC_TIM1->TCR = 1;
+                }
+            }
+            return;
+        }
+    }
+
+    if(THEKERNEL->is_halted()) {
+        running= false;
+        current_tick = 0;
+        current_block= nullptr;
+        return;
+    }
+
+    // 0.32 + 0.32 fixed point add or subtract, done as two 32 bit operations
+    if(phase == ACCELERATE) {
+        uint32_t f= rate_frac + accel_frac;
+        uint32_t r= rate + accel + (f < rate_frac ? 1 : 0);
+        if(r < rate) r= 0xFFFFFFFF; // saturate at one step per tick
+        rate= r; rate_frac= f;
+
+    } else if(phase == DECELERATE) {
+        uint32_t f= rate_frac - accel_frac;
+        uint32_t r= rate - accel - (f > rate_frac ? 1 : 0);
+        if(r > rate) r= 0; // underflow
+        rate= r; rate_frac= f;
+
+    } else if(phase == SCURVE) {
+        // the jerk changes the acceleration, which is signed, and the acceleration the rate
+        const auto& ri = current_block->rate_info;
+        if(jerk_dir > 0) {
+            uint32_t f= accel_frac + ri.acceleration_frac;
+            accel= accel + ri.acceleration + (f < accel_frac ? 1 : 0);
+            accel_frac= f;
+        } else if(jerk_dir < 0) {
+            uint32_t f= accel_frac - ri.acceleration_frac;
+            accel= accel - ri.acceleration - (f > accel_frac ? 1 : 0);
+            accel_frac= f;
+        }
+        uint32_t f= rate_frac + accel_frac;
+        uint32_t r= rate + accel + (f < rate_frac ? 1 : 0);
+        if((int32_t)accel < 0) {
+            if(r > rate) { r= 0; f= 0; } // underflow
+        } else if(r < rate) {
+            r= 0xFFFFFFFF; // saturate at one step per tick
+        }
+        rate= r; rate_frac= f;
+    }
+
+    if(current_tick == next_accel_event) {
+        accel_event();
+    }
+
+    // protect against rounding errors and such, we force completion of the steps when the rate drops to zero
+    bool force= (rate == 0);
+
+    // foreach active motor see if time to issue a step to that motor
+    uint32_t bm= active_motors;
+    while(bm != 0) {
+        uint8_t m= __builtin_ctz(bm);
+        bm &= bm - 1;
+
+        auto& mt = motor_tick[m];
+        bool step;
+        if(force) {
+            step= true;
+            mt.counter= 0;
+        } else {
+            uint32_t r= ((uint64_t)rate * current_block->tick_info[m].rate_scale) >> 32; // this motors share of the primary axis rate
+            uint32_t c= mt.counter + r;
+            step= c < mt.counter; // carry means >= 1.0 step time
+            mt.counter= c;
+        }
+
+        if(step) {
+            ++mt.step_count;
+            if(m == primary_motor && mt.step_count == speed_step) speed_countdown= 1; // tell the laser on this tick
+
+            // step the motor, or the path of an arc
+            bool ismoving;
+            if(m == arc_path) {
+                ismoving= arc_step();
+            } else {
+                ismoving= step_motor(m); // returns false if the moving flag was set to false externally (probes, endstops etc)
+            }
+
+            if(!ismoving || mt.step_count == current_block->steps[m]) {
+                // done, an arc motor stops when it has followed the path to the end
+                if(m != arc_path) motor_done(m); // let motor know it is no longer moving
+                active_motors &= ~(1 << m);
+            }
+
+        } else if(!motor[m]->is_moving()) {
+            // the moving flag was set to false externally (probes, endstops etc)
+            active_motors &= ~(1 << m);
+        }
+    }
+
+    if(arc_motors != 0) arc_follow();
+    if(follow_motors != 0) follow_steps();
+
+    // the laser follows the speed, the changes between accelerating, cruising and decelerating are caught as they happen
+    if(speed_fnc && (--speed_countdown == 0 || current_tick == current_block->accelerate_until || current_tick == current_block->decelerate_after)) {
+        speed_changed();
+    }
+
+    // do this after so we start at tick 0
+    current_tick++; // count number of ticks
+
+    // We may have set a pin on in this tick, now we reset the timer to set it off
+    if( unstep.any()) {
+        LPC_TIM1->TCR = 3;
+        LPC_TIM1->TCR = 1;
+    }
+
+    // see if any motors are still moving
+    if(active_motors == 0 && arc_motors == 0) {
+        // all moves finished
+        current_tick = 0;
+
+        // get next block
+        // do it here so there is no delay in ticks
+        THECONVEYOR->block_finished();
+
+        if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
+            running= start_next_block(); // returns true if there is at least one motor with steps to issue
+
         }else{
+            current_block= nullptr;
+            running= false;
+            if(block_start_fnc) block_start_fnc(nullptr);
+        }
+    }
+}
+
+// handle the acceleration schedule events, kept out of step_tick() as they only happen a few times per block
+void StepTicker::accel_event()
+{
+    if(phase == SCURVE) {
+        if(++jerk_segment < current_block->jerk_segments) {
+            start_jerk_segment();
+        } else {
+            // the end of the s-curve. It adds up to the steps of the block so all that is left is the last step that
+            // the rounding put just past the end, it is forced out now rather than waiting for it at a low exit rate.
+            // If there is more left it carries on at the exit rate until the steps are done
+            phase= CRUISE;
+            jerk_dir= 0;
+            accel= 0;
+            accel_frac= 0;
+            bool last= current_block->steps_event_count - motor_tick[primary_motor].step_count <= 1;
+            rate= last ? 0 : current_block->rate_info.plateau_rate;
+            rate_frac= 0;
+            next_accel_event= 0xFFFFFFFF;
+        }
+        return;
+    }
+
+    if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
+        phase= CRUISE;
+        if(current_block->decelerate_after < current_block->total_move_ticks) {
+            next_accel_event = current_block->decelerate_after;
+            if(current_tick != current_block->decelerate_after) { // We are plateauing
+                rate= current_block->rate_info.plateau_rate;
+                rate_frac= 0;
+            }
+        }
+    }
+
+    if(current_tick == current_block->decelerate_after) { // We start decelerating
+        phase= DECELERATE;
+        accel= current_block->rate_info.deceleration;
+        accel_frac= current_block->rate_info.deceleration_frac;
+    }
+}
+
+// s-curve, apply the jerk of segment jerk_segment of the block until the tick it ends at
+void StepTicker::start_jerk_segment()
+{
+    uint8_t sign= (current_block->jerk_signs >> (2 * jerk_segment)) & 3;
+    jerk_dir= sign == 1 ? 1 : sign == 2 ? -1 : 0;
+    if(sign == 3) {
+        accel= 0;
+        accel_frac= 0;
+    }
+    next_accel_event= current_block->jerk_until[jerk_segment] - 1;
+}
+
+// only called from the step ticker ISR (single consumer)
+bool StepTicker::start_next_block()
+{
+    if(current_block == nullptr) return false;
+
+    uint32_t last_rate= running ? rate : 0; // the rate the previous block ended at, if it ran right up to this one
+    active_motors= 0;
+    primary_motor= 0;
+    // need to prepare each active motor
+    for (uint8_t m = 0; m < num_motors; m++) {
+        if(current_block->steps[m] == 0) continue;
+
+        if(current_block->steps[m] > current_block->steps[primary_motor]) primary_motor= m;
+        motor_tick[m].counter= 0;
+        motor_tick[m].step_count= 0;
+        active_motors |= (1 << m); // mark motor as moving
+        // set direction bit here and let motor know it is moving now
+        // NOTE this would be at least 10us before first step pulse.
+        start_motor(m, current_block->direction_bits[m]);
+    }
+    start_arc();
+    start_advance();
+
+    current_tick= 0;
+
+    if(active_motors != 0) {
+        // setup the primary axis rate from the blocks schedule, same order of events as Block::prepare() for the 64 bit version
+        rate= current_block->rate_info.initial_rate;
+        rate_frac= current_block->rate_info.initial_rate_frac;
+        accel= 0;
+        accel_frac= 0;
+        jerk_dir= 0;
+        next_accel_event= current_block->total_move_ticks + 1;
+        phase= CRUISE;
+        if(current_block->jerk_segments != 0) {
+            // s-curve, the acceleration carries on from where the previous block left it
+            phase= SCURVE;
+            accel= current_block->rate_info.initial_accel;
+            accel_frac= current_block->rate_info.initial_accel_frac;
+            jerk_segment= 0;
+            start_jerk_segment();
+
+        } else if(current_block->accelerate_until != 0) { // If the next accel event is the end of accel
+            next_accel_event= current_block->accelerate_until;
+            phase= ACCELERATE;
+            accel= current_block->rate_info.acceleration;
+            accel_frac= current_block->rate_info.acceleration_frac;
+
+        } else if(current_block->decelerate_after == 0) {
+            // we start off decelerating
+            phase= DECELERATE;
+            accel= current_block->rate_info.deceleration;
+            accel_frac= current_block->rate_info.deceleration_frac;
+
+        } else if(current_block->decelerate_after != current_block->total_move_ticks) {
+            // If the next event is the start of decel ( don't set this if the next accel event is accel end )
+            next_accel_event= current_block->decelerate_after;
+        }
+
+        if(current_block->decel_tail) {
+            // the planner has not planned the entry of this block yet (see Planner::recalculate_decel_tail()), carry on
+            // from the rate the previous block ended at converted to this blocks primary axis and decelerate until the
+            // steps are done, the planner plans the blocks after this one from where it started
+            if(last_rate != 0) {
+                uint64_t r= ((uint64_t)last_rate * current_block->carry_scale) >> 16;
+                rate= r > 0xFFFFFFFF ? 0xFFFFFFFF : r;
+                rate_frac= 0;
+            }
+            phase= DECELERATE;
+            accel= current_block->rate_info.deceleration;
+            accel_frac= current_block->rate_info.deceleration_frac;
+            next_accel_event= 0xFFFFFFFF;
+            current_block->rate_info.initial_rate= rate; // so the planner knows the speed it started at
+        }
+
+        speed_step= 0;
+        if(block_start_fnc) block_start_fnc(current_block);
+        if(speed_fnc) speed_changed();
+
+        //SET_STEPTICKER_DEBUG_PIN(1);
+        return true;
+
+    }else{
+        // this is an edge condition that should never happen, but we need to discard this block if it ever does
+        // basically it is a block that has zero steps for all motors
+        THECONVEYOR->block_finished();
+    }
+
+    return false;
+}
+
+#else
+
+// step clock
+void StepTicker::step_tick (void)
+{
+    //SET_STEPTICKER_DEBUG_PIN(running ? 1 : 0);
+
+    // if nothing has been setup we ignore the ticks
+    if(!running){
+        // check if anything new available
+        if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
+            running= start_next_block(); // returns true if there is at least one motor with steps to issue
+        }
+        if(!running) {
+            // the followed motors carry on to where the steps they were given put them
+            if(follow_motors != 0) {
+                follow_steps();
+                if(unstep.any()) {
+                    LPC_TIM1->TCR = 3;
+                    LPC_TIM1->TCR = 1;
+                }
+            }
             return;
         }
     }
@@ -156,55 +470,69 @@ void StepTicker::step_tick (void)
     bool still_moving= false;
     // foreach motor, if it is active see if time to issue a step to that motor
     for (uint8_t m = 0; m < num_motors; m++) {
-        auto& tickinfo = current_block->tick_info[m];
+        if((active_motors & (1 << m)) == 0) continue; // not active
 
-        if(tickinfo.steps_to_move == 0) continue; // not active
+        auto& mt = motor_tick[m];
+        mt.steps_per_tick += mt.acceleration_change;
 
-        tickinfo.steps_per_tick += tickinfo.acceleration_change;
-
-        if(current_tick == tickinfo.next_accel_event) {
+        if(current_tick == mt.next_accel_event) {
             if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
-                tickinfo.acceleration_change = 0;
+                mt.acceleration_change = 0;
                 if(current_block->decelerate_after < current_block->total_move_ticks) {
-                    tickinfo.next_accel_event = current_block->decelerate_after;
+                    mt.next_accel_event = current_block->decelerate_after;
                     if(current_tick != current_block->decelerate_after) { // We are plateauing
                         // steps/sec / tick frequency to get steps per tick
-                        tickinfo.steps_per_tick = tickinfo.plateau_rate;
+                        mt.steps_per_tick = current_block->tick_info[m].plateau_rate;
                     }
                 }
             }
 
             if(current_tick == current_block->decelerate_after) { // We start decelerating
-                tickinfo.acceleration_change = tickinfo.deceleration_change;
+                mt.acceleration_change = current_block->tick_info[m].deceleration_change;
             }
         }
 
         // protect against rounding errors and such
-        if(tickinfo.steps_per_tick <= 0) {
-            tickinfo.counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
-            tickinfo.steps_per_tick = 0;
+        if(mt.steps_per_tick <= 0) {
+            mt.counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
+            mt.steps_per_tick = 0;
         }
 
-        tickinfo.counter += tickinfo.steps_per_tick;
+        mt.counter += mt.steps_per_tick;
 
-        if(tickinfo.counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
-            tickinfo.counter -= STEPTICKER_FPSCALE; // -= 1.0F;
-            ++tickinfo.step_count;
+        if(mt.counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
+            mt.counter -= STEPTICKER_FPSCALE; // -= 1.0F;
+            ++mt.step_count;
+            if(m == primary_motor && mt.step_count == speed_step) speed_countdown= 1; // tell the laser on this tick
 
-            // step the motor
-            bool ismoving= motor[m]->step(); // returns false if the moving flag was set to false externally (probes, endstops etc)
-            // we stepped so schedule an unstep
-            unstep.set(m);
+            // step the motor, or the path of an arc
+            bool ismoving;
+            if(m == arc_path) {
+                ismoving= arc_step();
+            } else {
+                ismoving= step_motor(m); // returns false if the moving flag was set to false externally (probes, endstops etc)
+            }
 
-            if(!ismoving || tickinfo.step_count == tickinfo.steps_to_move) {
-                // done
-                tickinfo.steps_to_move = 0;
-                motor[m]->stop_moving(); // let motor know it is no longer moving
+            if(!ismoving || mt.step_count == current_block->steps[m]) {
+                // done, an arc motor stops when it has followed the path to the end
+                active_motors &= ~(1 << m);
+                if(m != arc_path) motor_done(m); // let motor know it is no longer moving
             }
         }
 
-        // see if any motors are still moving after this tick
-        if(motor[m]->is_moving()) still_moving= true;
+        // see if any motors are still moving after this tick, a shaped one still moves after its last step
+        if((active_motors & (1 << m)) != 0 && motor[m]->is_moving()) still_moving= true;
+    }
+
+    if(arc_motors != 0) {
+        arc_follow();
+        if(arc_motors != 0) still_moving= true;
+    }
+    if(follow_motors != 0) follow_steps();
+
+    // the laser follows the speed, the changes between accelerating, cruising and decelerating are caught as they happen
+    if(speed_fnc && (--speed_countdown == 0 || current_tick == current_block->accelerate_until || current_tick == current_block->decelerate_after)) {
+        speed_changed();
     }
 
     // do this after so we start at tick 0
@@ -237,6 +565,7 @@ void StepTicker::step_tick (void)
         }else{
             current_block= nullptr;
             running= false;
+            if(block_start_fnc) block_start_fnc(nullptr);
         }
 
         // all moves finished
@@ -251,22 +580,73 @@ bool StepTicker::start_next_block()
 {
     if(current_block == nullptr) return false;
 
-    bool ok= false;
-    // need to prepare each active motor
+    int64_t last_rate= running ? motor_tick[primary_motor].steps_per_tick : 0; // the rate the previous block ended at, if it ran right up to this one
+    active_motors= 0;
+    primary_motor= 0;
+    // need to prepare each active motor, from the same order of events as the acceleration schedule of the block
     for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue;
+        if(current_block->steps[m] == 0) continue;
+
+        if(current_block->steps[m] > current_block->steps[primary_motor]) primary_motor= m;
+        const auto& tickinfo = current_block->tick_info[m];
+        auto& mt = motor_tick[m];
+        mt.steps_per_tick= tickinfo.steps_per_tick;
+        mt.counter= 0;
+        mt.step_count= 0;
+        mt.acceleration_change= 0;
+        mt.next_accel_event= current_block->total_move_ticks + 1;
+        if(current_block->accelerate_until != 0) { // If the next accel event is the end of accel
+            mt.next_accel_event= current_block->accelerate_until;
+            mt.acceleration_change= tickinfo.acceleration_change;
+
+        } else if(current_block->decelerate_after == 0) {
+            // we start off decelerating
+            mt.acceleration_change= tickinfo.deceleration_change;
+
+        } else if(current_block->decelerate_after != current_block->total_move_ticks) {
+            // If the next event is the start of decel ( don't set this if the next accel event is accel end )
+            mt.next_accel_event= current_block->decelerate_after;
+        }
 
-        ok= true; // mark at least one motor is moving
-        // set direction bit here
+        active_motors |= (1 << m); // mark motor as moving
+        // set direction bit here and let motor know it is moving now
         // NOTE this would be at least 10us before first step pulse.
         // TODO does this need to be done sooner, if so how without delaying next tick
-        motor[m]->set_direction(current_block->direction_bits[m]);
-        motor[m]->start_moving(); // also let motor know it is moving now
+        start_motor(m, current_block->direction_bits[m]);
     }
+    start_arc();
+    start_advance();
 
     current_tick= 0;
 
-    if(ok) {
+    if(active_motors != 0) {
+        if(current_block->decel_tail) {
+            // the planner has not planned the entry of this block yet (see Planner::recalculate_decel_tail()), carry on
+            // from the rate the previous block ended at converted to this blocks primary axis and decelerate until the
+            // steps are done, the planner plans the blocks after this one from where it started
+            if(last_rate > 0) {
+                // 2.62 times 16.16 in two halves so it does not overflow, saturates at one step per tick
+                uint64_t hi= (uint64_t)(last_rate >> 32) * current_block->carry_scale;
+                uint64_t lo= ((uint64_t)(last_rate & 0xFFFFFFFF) * current_block->carry_scale) >> 16;
+                uint64_t r= hi >= (1ULL << 46) ? STEPTICKER_FPSCALE : (hi << 16) + lo;
+                if(r > STEPTICKER_FPSCALE) r= STEPTICKER_FPSCALE;
+                for (uint8_t m = 0; m < num_motors; m++) {
+                    if((active_motors & (1 << m)) == 0) continue;
+                    uint32_t scale= current_block->tick_info[m].rate_scale;
+                    motor_tick[m].steps_per_tick= (r >> 32) * scale + (((r & 0xFFFFFFFF) * scale) >> 32);
+                }
+                current_block->tick_info[primary_motor].steps_per_tick= r; // so the planner knows the speed it started at
+            }
+            for (uint8_t m = 0; m < num_motors; m++) {
+                motor_tick[m].acceleration_change= current_block->tick_info[m].deceleration_change;
+                motor_tick[m].next_accel_event= 0xFFFFFFFF;
+            }
+        }
+
+        speed_step= 0;
+        if(block_start_fnc) block_start_fnc(current_block);
+        if(speed_fnc) speed_changed();
+
         //SET_STEPTICKER_DEBUG_PIN(1);
         return true;
 
@@ -279,6 +659,262 @@ bool StepTicker::start_next_block()
     return false;
 }
 
+#endif
+
+// an arc block moves the actuators in its arc->motors around it, the first of them ticks the steps of the path. Not
+// an arc, arc_path never matches a motor
+void StepTicker::start_arc()
+{
+    arc_motors= 0;
+    arc_path= 0xFF;
+    if(!current_block->is_arc) return;
+
+    const Block::arc_t& arc= *current_block->arc;
+    arc_phase= 0;
+    arc_count= 0;
+    arc_motors= arc.motors;
+    arc_path= __builtin_ctz(arc.motors);
+    for (uint8_t m = 0; m < 3; m++) {
+        arc_position[m]= 0;
+        arc_target[m]= 0;
+        if((arc.motors & (1 << m)) == 0) continue;
+        start_motor(m, current_block->direction_bits[m]);
+    }
+}
+
+// the path of an arc made a step, works out where each actuator should be now. They step there in arc_follow(). The
+// path stops like the motor that ticks it would (probes, endstops etc)
+bool StepTicker::arc_step()
+{
+    const Block::arc_t& arc= *current_block->arc;
+    if(++arc_count >= arc.path_steps) {
+        // the last step is where the planner has them end
+        for (uint8_t m = 0; m < 3; m++) arc_target[m]= arc.end[m];
+
+    } else {
+        arc_phase += arc.phase_step;
+        uint32_t p= arc_phase >> 32;
+        int64_t c= fixed_cos(p), s= fixed_sin(p);
+        uint32_t bm= arc_motors;
+        while(bm != 0) {
+            uint8_t m= __builtin_ctz(bm);
+            bm &= bm - 1;
+            // 24.8 by 2.30 fixed point, rounded to a step
+            int64_t t= ((int64_t)arc.c[m] << 30) + arc.a[m] * c + arc.b[m] * s;
+            arc_target[m]= (t + (1LL << 37)) >> 38;
+        }
+    }
+    return motor[arc_path]->is_moving();
+}
+
+// steps the actuators moved around an arc towards where the path is, at most a step a tick each. One that turns round
+// is given its new direction on one tick and steps on the next so the driver sees the direction first. They stop when
+// they get to the end of the path
+void StepTicker::arc_follow()
+{
+    bool path_done= arc_count >= current_block->arc->path_steps;
+    if(!path_done && !motor[arc_path]->is_moving()) {
+        // the path was stopped externally, so are they
+        for (uint8_t m = 0; m < 3; m++) {
+            if(arc_motors & (1 << m)) motor[m]->stop_moving();
+        }
+        arc_motors= 0;
+        return;
+    }
+
+    uint32_t bm= arc_motors;
+    while(bm != 0) {
+        uint8_t m= __builtin_ctz(bm);
+        bm &= bm - 1;
+
+        if(!motor[m]->is_moving()) {
+            // the moving flag was set to false externally (probes, endstops etc)
+            arc_motors &= ~(1 << m);
+            continue;
+        }
+
+        int32_t d= arc_target[m] - arc_position[m];
+        if(d != 0) {
+            bool dir= d < 0;
+            if(dir != get_step_direction(m)) {
+                set_step_direction(m, dir);
+                continue;
+            }
+            step_motor(m);
+            arc_position[m] += dir ? -1 : 1;
+            d += dir ? 1 : -1;
+        }
+
+        if(path_done && d == 0) {
+            motor_done(m);
+            arc_motors &= ~(1 << m);
+        }
+    }
+}
+
+void StepTicker::set_input_shaper(uint8_t m, InputShaper *s)
+{
+    shaper[m]= s;
+    set_follower(m);
+}
+
+void StepTicker::set_pressure_advance(uint8_t m, PressureAdvance *pa)
+{
+    advance[m]= pa;
+    set_follower(m);
+}
+
+void StepTicker::set_follower(uint8_t m)
+{
+    if(shaper[m] != nullptr || advance[m] != nullptr) follow_motors |= (1 << m);
+    else follow_motors &= ~(1 << m);
+    follow_feeding &= ~(1 << m);
+}
+
+// the step generation starts moving a motor, a followed one is turned round by follow_steps() when its steps do
+void StepTicker::start_motor(uint8_t m, bool dir)
+{
+    set_step_direction(m, dir);
+    if(follow_motors & (1 << m)) follow_feeding |= (1 << m);
+    motor[m]->start_moving();
+}
+
+void StepTicker::set_step_direction(uint8_t m, bool dir)
+{
+    if((follow_motors & (1 << m)) == 0) {
+        motor[m]->set_direction(dir);
+    } else if(dir) {
+        follow_dir |= (1 << m);
+    } else {
+        follow_dir &= ~(1 << m);
+    }
+}
+
+bool StepTicker::get_step_direction(uint8_t m) const
+{
+    if(follow_motors & (1 << m)) return (follow_dir & (1 << m)) != 0;
+    return motor[m]->which_direction();
+}
+
+// the step generation steps a motor, a followed one gives the step to its shaper or pressure advance. Returns false if
+// the moving flag was set to false externally (probes, endstops etc)
+bool StepTicker::step_motor(uint8_t m)
+{
+    if(follow_motors & (1 << m)) {
+        bool dir= (follow_dir & (1 << m)) != 0;
+        if(shaper[m] != nullptr) shaper[m]->push(dir, follow_tick);
+        else advance[m]->push(dir);
+        return motor[m]->is_moving();
+    }
+
+    // stopped since the last tick, not even the step it was due is made so an endstop or probe stops it where it was
+    if(!motor[m]->is_moving()) return false;
+
+    bool moving= motor[m]->step();
+    // we stepped so schedule an unstep
+    unstep.set(m);
+    return moving;
+}
+
+// the step generation has made all the steps of a motor, a followed one moves on until it is where they put it
+void StepTicker::motor_done(uint8_t m)
+{
+    if(follow_motors & (1 << m)) follow_feeding &= ~(1 << m);
+    else motor[m]->stop_moving();
+}
+
+// pressure advance only pushes the filament on blocks that extrude while the head moves, not on retracts and primes
+void StepTicker::start_advance()
+{
+    advancing= 0;
+    for (uint8_t m = 0; m < num_motors; m++) {
+        if(advance[m] == nullptr || current_block->steps[m] == 0 || current_block->direction_bits[m]) continue;
+        for (uint8_t i = 0; i < num_motors; i++) {
+            if(i != m && current_block->steps[i] != 0 && !motor[i]->is_extruder()) {
+                advancing |= (1 << m);
+                break;
+            }
+        }
+    }
+}
+
+// steps each followed motor to where its shaper or pressure advance has it, at most a step a tick. As round an arc, one
+// that turns round is given its new direction on one tick and steps on the next. One stopped externally drops the steps
+// it still had to make
+void StepTicker::follow_steps()
+{
+    uint32_t bm= follow_motors;
+    while(bm != 0) {
+        uint8_t m= __builtin_ctz(bm);
+        bm &= bm - 1;
+        InputShaper *s= shaper[m];
+        PressureAdvance *pa= advance[m];
+
+        if(!motor[m]->is_moving()) {
+            if(s != nullptr) s->flush();
+            else pa->flush();
+            follow_feeding &= ~(1 << m);
+            continue;
+        }
+
+        int d;
+        if(s != nullptr) d= s->follow(follow_tick);
+        else d= pa->follow((advancing & (1 << m)) ? motor_rate(m) : 0);
+        if(d != 0) {
+            bool dir= d < 0;
+            if(dir != motor[m]->which_direction()) {
+                motor[m]->set_direction(dir);
+            } else {
+                motor[m]->step();
+                unstep.set(m);
+                if(s != nullptr) s->stepped(d);
+                else pa->stepped(d);
+            }
+        }
+
+        if((follow_feeding & (1 << m)) == 0 && !(s != nullptr ? s->is_pending() : pa->is_pending())) motor[m]->stop_moving();
+    }
+    ++follow_tick;
+}
+
+// the rate of the primary axis of the current block as 0.32 fixed point steps per tick
+uint32_t StepTicker::primary_rate() const
+{
+    if(current_block == nullptr) return 0;
+#ifdef STEPTICKER_FIXED32
+    return rate;
+#else
+    int64_t r= motor_tick[primary_motor].steps_per_tick >> 30; // 2.62 to 0.32
+    return r > 0xFFFFFFFF ? 0xFFFFFFFF : (r < 0 ? 0 : r);
+#endif
+}
+
+// the rate a motor is stepped at in the current block, 0.32 fixed point steps per tick. 0 once it has made its steps
+uint32_t StepTicker::motor_rate(uint8_t m) const
+{
+    if(current_block == nullptr) return 0;
+#ifdef STEPTICKER_FIXED32
+    if((active_motors & (1 << m)) == 0) return 0;
+    return ((uint64_t)rate * current_block->tick_info[m].rate_scale) >> 32;
+#else
+    if((active_motors & (1 << m)) == 0) return 0;
+    int64_t r= motor_tick[m].steps_per_tick >> 30; // 2.62 to 0.32
+    return r > 0xFFFFFFFF ? 0xFFFFFFFF : (r < 0 ? 0 : r);
+#endif
+}
+
+uint32_t StepTicker::get_primary_steps() const
+{
+    if(current_block == nullptr) return 0;
+    return motor_tick[primary_motor].step_count;
+}
+
+// tells the laser the speed, called from the step interrupt
+void StepTicker::speed_changed()
+{
+    speed_countdown= speed_ticks;
+    speed_fnc(primary_rate());
+}
 
 // returns index of the stepper motor in the array and bitset
 int StepTicker::register_motor(StepperMotor* m)
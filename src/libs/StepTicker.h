@@ -20,9 +20,16 @@
 
 class StepperMotor;
 class Block;
+class InputShaper;
+class PressureAdvance;
 
+#ifdef STEPTICKER_FIXED32
+// handle 0.32 Fixed point
+#define STEPTICKER_FPSCALE (1LL<<32)
+#else
 // handle 2.62 Fixed point
 #define STEPTICKER_FPSCALE (1LL<<62)
+#endif
 #define STEPTICKER_FROMFP(x) ((float)(x)/STEPTICKER_FPSCALE)
 
 class StepTicker{
@@ -35,6 +42,8 @@ class StepTicker{
         float get_frequency() const { return frequency; }
         void unstep_tick();
         const Block *get_current_block() const { return current_block; }
+        // current rate of the primary axis in steps per tick
+        float get_current_rate() const { return primary_rate() / 4294967296.0F; }
 
         void step_tick (void);
         void handle_finish (void);
@@ -43,12 +52,52 @@ class StepTicker{
         // whatever setup the block should register this to know when it is done
         std::function<void()> finished_fnc{nullptr};
 
+        // for the laser to follow the speed from the step interrupt. block_start_fnc is called when a block starts and
+        // with nullptr when there are no more, speed_fnc then with the primary axis rate in 0.32 fixed point steps per
+        // tick, when the block starts, every speed_ticks ticks and when it changes between accelerating, cruising and
+        // decelerating. Also on the tick the primary axis makes step number speed_step of the block, a raster sets
+        // this to where its next pixel starts
+        std::function<void(const Block *)> block_start_fnc{nullptr};
+        std::function<void(uint32_t)> speed_fnc{nullptr};
+        void set_speed_ticks(uint32_t ticks) { speed_ticks= speed_countdown= ticks < 1 ? 1 : ticks; }
+        void set_speed_step(uint32_t step) { speed_step= step; }
+        // steps the primary axis has made in the current block
+        uint32_t get_primary_steps() const;
+
+        // shape the steps of a motor, it steps after the step generation as the shaper has it (see InputShaper.h).
+        // Only set while nothing is moving, nullptr turns it off
+        void set_input_shaper(uint8_t m, InputShaper *shaper);
+        InputShaper *get_input_shaper(uint8_t m) const { return shaper[m]; }
+
+        // keep an extruder ahead of its steps by its speed (see PressureAdvance.h), not with a shaper on the same motor.
+        // Only set while nothing is moving, nullptr turns it off
+        void set_pressure_advance(uint8_t m, PressureAdvance *pa);
+        PressureAdvance *get_pressure_advance(uint8_t m) const { return advance[m]; }
+
         static StepTicker *getInstance() { return instance; }
 
     private:
         static StepTicker *instance;
 
         bool start_next_block();
+        uint32_t primary_rate() const;
+        uint32_t motor_rate(uint8_t m) const;
+        void speed_changed();
+        void start_arc();
+        bool arc_step();
+        void arc_follow();
+        void start_motor(uint8_t m, bool dir);
+        void set_step_direction(uint8_t m, bool dir);
+        bool get_step_direction(uint8_t m) const;
+        bool step_motor(uint8_t m);
+        void motor_done(uint8_t m);
+        void set_follower(uint8_t m);
+        void start_advance();
+        void follow_steps();
+#ifdef STEPTICKER_FIXED32
+        void accel_event();
+        void start_jerk_segment();
+#endif
 
         float frequency;
         uint32_t period;
@@ -57,6 +106,56 @@ class StepTicker{
 
         Block *current_block;
         uint32_t current_tick{0};
+        uint32_t speed_ticks{1};
+        uint32_t speed_countdown{1};
+        uint32_t speed_step{0};
+        uint8_t primary_motor;      // the motor with the most steps in the current block
+
+        // the current block is an arc (see Block::arc_t), the actuators moved around it follow the path
+        uint64_t arc_phase;
+        uint32_t arc_count;         // steps the path has made
+        int32_t arc_position[3];    // steps each actuator has made from where it started
+        int32_t arc_target[3];      // and where it should be for the steps the path has made
+        uint8_t arc_path{0xFF};     // the motor that ticks the path, 0xFF if not an arc
+        uint8_t arc_motors{0};      // bitmask of the actuators still following the path
+
+        // input shaping and pressure advance, the step generation of such a motor gives its steps to the shaper or the
+        // pressure advance and follow_steps() steps it
+        std::array<InputShaper*, k_max_actuators> shaper{};
+        std::array<PressureAdvance*, k_max_actuators> advance{};
+        uint32_t follow_motors{0};  // bitmask of the motors with a shaper or pressure advance
+        uint32_t follow_feeding{0}; // of those the ones the step generation is still making steps for
+        uint32_t follow_dir{0};     // the direction the step generation moves each one, set is negative
+        uint32_t advancing{0};      // the motors with pressure advance that extrude in the current block
+        uint16_t follow_tick{0};    // counts every tick
+
+#ifdef STEPTICKER_FIXED32
+        // primary axis state for the current block, the other motors follow it
+        uint32_t rate;              // 0.32 fixed point steps/tick
+        uint32_t rate_frac;
+        uint32_t accel;             // rate change per tick, signed for an s-curve
+        uint32_t accel_frac;
+        uint32_t next_accel_event;
+        enum : uint8_t { CRUISE, ACCELERATE, DECELERATE, SCURVE } phase;
+        int8_t jerk_dir;            // s-curve, 1 the acceleration is ramping up, -1 ramping down, 0 constant
+        uint8_t jerk_segment;       // s-curve, the segment of the blocks jerk schedule being applied
+
+        // per motor step state for the current block
+        struct {
+            uint32_t counter;       // 0.32 fixed point phase of the next step, a step is due when adding the rate carries
+            uint32_t step_count;
+        } motor_tick[k_max_actuators];
+#else
+        // per motor step state for the current block, it starts from the schedule in the blocks tick_info
+        struct {
+            int64_t steps_per_tick;         // 2.62 fixed point
+            int64_t counter;                // 2.62 fixed point
+            int64_t acceleration_change;    // 2.62 fixed point signed
+            uint32_t step_count;
+            uint32_t next_accel_event;
+        } motor_tick[k_max_actuators];
+#endif
+        uint32_t active_motors;     // bitmask of motors that still have steps to issue in this block
 
         struct {
             volatile bool running:1;
@@ -27,6 +27,7 @@ StepperMotor::StepperMotor(Pin &step, Pin &dir, Pin &en) : step_pin(step), dir_p
     current_position_steps= 0;
     moving= false;
     acceleration= NAN;
+    max_speed_change= NAN;
     selected= true;
     extruder= false;
 
@@ -64,10 +64,11 @@
  * just always use the Standard Capacity cards with a block size of 512 bytes.
  * This is set with CMD16.
  *
- * You can read and write single blocks (CMD17, CMD25) or multiple blocks
- * (CMD18, CMD25). For simplicity, I'll just use single block accesses. When
- * the card gets a read command, it responds with a response token, and then
- * a data token or an error.
+ * You can read and write single blocks (CMD17, CMD24) or multiple blocks
+ * (CMD18, CMD25). A multiple block access costs one command for all the
+ * blocks, so anything longer than a block uses them. When the card gets a
+ * read command, it responds with a response token, and then a data token or
+ * an error.
  *
  * SPI Command Format
  * ------------------
@@ -115,16 +116,28 @@
  * +------+---------+---------+- -  - -+---------+-----------+----------+
  * | 0xFE | data[0] | data[1] |        | data[n] | crc[15:8] | crc[7:0] |
  * +------+---------+---------+- -  - -+---------+-----------+----------+
+ *
+ * Multiple Block Read and Write
+ * -----------------------------
+ *
+ * After CMD18 the card sends block after block until it gets CMD12, the
+ * byte after CMD12 is a stuff byte and the R1b response follows.
+ * After CMD25 each block is sent with a 0xFC start token instead of 0xFE
+ * and each is acknowledged like a single block, the 0xFD stop token ends the
+ * transfer and the card is busy until the last block is programmed.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "SDCard.h"
 
 static const uint8_t OXFF = 0xFF;
 
 #define SD_COMMAND_TIMEOUT 5000
+// bytes clocked while waiting for a data token or for the card to finish programming, about 300ms at 2.5MHz
+#define SD_DATA_TIMEOUT 100000
 
 SDCard::SDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) :
   _spi(mosi, miso, sclk), _cs(cs) {
@@ -132,6 +145,12 @@ SDCard::SDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) :
     _cs = 1;
     busyflag = false;
     _sectors = 0;
+    cache_data = NULL;
+    cache_clock = 0;
+    for (auto &c : cache) {
+        c.valid = false;
+        c.dirty = false;
+    }
 }
 
 #define R1_IDLE_STATE           (1 << 0)
@@ -261,6 +280,12 @@ int SDCard::disk_initialize()
 
     _sectors = 0;
 
+    // it may be a different card
+    for (auto &c : cache) {
+        c.valid = false;
+        c.dirty = false;
+    }
+
     CARD_TYPE i = initialise_card();
 
     if (i == SDCARD_FAIL) {
@@ -289,21 +314,27 @@ int SDCard::disk_write(const char *buffer, uint32_t block_number)
     if (busyflag)
         return 0;
 
-    busyflag = true;
-
     if (cardtype == SDCARD_FAIL)
         return -1;
-    // set write address for single block (CMD24)
-    if(_cmd(SDCMD_WRITE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
-        return 1;
-    }
 
-    // send the data block
-    _write(buffer, 512);
+    busyflag = true;
+
+    int r = 0;
+    int i = cache_find(block_number);
+    if (i < 0) i = cache_slot();
+    if (i >= 0) {
+        // held until disk_sync() or it is evicted
+        memcpy(cache_data + i * 512, buffer, 512);
+        cache[i].block = block_number;
+        cache[i].valid = true;
+        cache[i].dirty = true;
+    } else {
+        r = _write_blocks(buffer, block_number, 1);
+    }
 
     busyflag = false;
 
-    return 0;
+    return r;
 }
 
 int SDCard::disk_read(char *buffer, uint32_t block_number)
@@ -311,27 +342,93 @@ int SDCard::disk_read(char *buffer, uint32_t block_number)
     if (busyflag)
         return 0;
 
+    if (cardtype == SDCARD_FAIL)
+        return -1;
+
     busyflag = true;
 
+    int r = 0;
+    int i = cache_find(block_number);
+    if (i >= 0) {
+        memcpy(buffer, cache_data + i * 512, 512);
+    } else {
+        r = _read_blocks(buffer, block_number, 1);
+        if (r == 0 && (i = cache_slot()) >= 0) {
+            memcpy(cache_data + i * 512, buffer, 512);
+            cache[i].block = block_number;
+            cache[i].valid = true;
+            cache[i].dirty = false;
+        }
+    }
+
+    busyflag = false;
+
+    return r;
+}
+
+int SDCard::disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count)
+{
+    if (busyflag)
+        return 0;
+
     if (cardtype == SDCARD_FAIL)
         return -1;
-    // set read address for single block (CMD17)
-    if(_cmd(SDCMD_READ_SINGLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
-        return 1;
+
+    busyflag = true;
+
+    int r = _write_blocks(buffer, block_number, count);
+
+    // the cached copies are now what is on the card
+    for (int i = 0; i < SD_CACHE_SECTORS; i++) {
+        if (cache[i].valid && cache[i].block - block_number < count) {
+            if (r == 0) {
+                memcpy(cache_data + i * 512, buffer + (cache[i].block - block_number) * 512, 512);
+                cache[i].dirty = false;
+            } else {
+                cache[i].valid = cache[i].dirty; // do not lose a write we have not made yet
+            }
+        }
     }
 
-    // receive the data
-    _read(buffer, 512);
+    busyflag = false;
+
+    return r;
+}
+
+int SDCard::disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count)
+{
+    if (busyflag)
+        return 0;
+
+    if (cardtype == SDCARD_FAIL)
+        return -1;
+
+    busyflag = true;
+
+    int r = _read_blocks(buffer, block_number, count);
+
+    // sectors written to the cache and not to the card yet
+    for (int i = 0; r == 0 && i < SD_CACHE_SECTORS; i++) {
+        if (cache[i].valid && cache[i].dirty && cache[i].block - block_number < count) {
+            memcpy(buffer + (cache[i].block - block_number) * 512, cache_data + i * 512, 512);
+        }
+    }
 
     busyflag = false;
 
-    return 0;
+    return r;
 }
 
 int SDCard::disk_status() { return (_sectors > 0)?0:1; }
 int SDCard::disk_sync() {
-    // TODO: wait for DMA, wait for card not busy
-    return 0;
+    if (busyflag)
+        return 0;
+
+    busyflag = true;
+    int r = cache_flush();
+    busyflag = false;
+
+    return r;
 }
 uint32_t SDCard::disk_sectors() { return _sectors; }
 uint64_t SDCard::disk_size() { return ((uint64_t) _sectors) << 9; }
@@ -441,7 +538,7 @@ int SDCard::_cmd8() {
         response[0] = _spi.write(0xFF);
         if(!(response[0] & 0x80)) {
                 for(int j=1; j<5; j++) {
-                    response[i] = _spi.write(0xFF);
+                    response[j] = _spi.write(0xFF);
                 }
                 _cs = 1;
                 _spi.write(0xFF);
@@ -479,34 +576,180 @@ int SDCard::_read(char *buffer, int length) {
     return 0;
 }
 
-int SDCard::_write(const char *buffer, int length) {
-    _cs = 0;
+void SDCard::_deselect() {
+    _cs = 1;
+    _spi.write(0xFF);
+}
 
-    // indicate start of block
-    _spi.write(0xFE);
+// waits for the start of a data block, returns the token or -1 on timeout
+int SDCard::_wait_token() {
+    for(int i=0; i<SD_DATA_TIMEOUT; i++) {
+        int r = _spi.write(0xFF);
+        if(r != 0xFF) return r;
+    }
+    return -1;
+}
 
-    // write the data
-    for(int i=0; i<length; i++) {
-        _spi.write(buffer[i]);
+// waits while the card holds the data line low, it is busy programming
+int SDCard::_wait_ready() {
+    for(int i=0; i<SD_DATA_TIMEOUT; i++) {
+        if(_spi.write(0xFF) == 0xFF) return 0;
     }
+    return -1;
+}
 
-    // write the checksum
+// receives one 512 byte data block, the card is selected
+int SDCard::_read_data(char *buffer) {
+    if(_wait_token() != 0xFE) return 1;
+
+    for(int i=0; i<512; i++) {
+        buffer[i] = _spi.write(0xFF);
+    }
+    _spi.write(0xFF); // checksum
     _spi.write(0xFF);
+    return 0;
+}
+
+// sends one 512 byte data block with the given start token and waits until it is programmed, the card is selected
+int SDCard::_write_data(int token, const char *buffer) {
+    _spi.write(token);
+
+    for(int i=0; i<512; i++) {
+        _spi.write(buffer[i]);
+    }
+    _spi.write(0xFF); // checksum
     _spi.write(0xFF);
 
-    // check the repsonse token
-    if((_spi.write(0xFF) & 0x1F) != 0x05) {
-        _cs = 1;
+    // check the response token
+    if((_spi.write(0xFF) & 0x1F) != 0x05) return 1;
+
+    return _wait_ready();
+}
+
+// CMD12 ends a multiple block read, the card is selected
+int SDCard::_stop_transmission() {
+    _spi.write(0x40 | SDCMD_STOP_TRANSMISSION);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x95);
+    _spi.write(0xFF); // stuff byte
+
+    for(int i=0; i<SD_COMMAND_TIMEOUT; i++) {
+        int response = _spi.write(0xFF);
+        if(!(response & 0x80)) {
+            if(response != 0) return 1;
+            return _wait_ready();
+        }
+    }
+    return -1;
+}
+
+int SDCard::_read_blocks(char *buffer, uint32_t block_number, uint32_t count) {
+    int r;
+    if(count == 1) {
+        // set read address for single block (CMD17)
+        r = (_cmdx(SDCMD_READ_SINGLE_BLOCK, BLOCK2ADDR(block_number)) == 0) ? _read_data(buffer) : 1;
+
+    } else if(_cmdx(SDCMD_READ_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) == 0) {
+        // the card streams blocks until it is stopped
+        r = 0;
+        for(uint32_t n=0; n<count && r == 0; n++) {
+            r = _read_data(buffer + n * 512);
+        }
+        if(_stop_transmission() != 0) r = 1;
+
+    } else {
+        r = 1;
+    }
+
+    _deselect();
+    return r;
+}
+
+int SDCard::_write_blocks(const char *buffer, uint32_t block_number, uint32_t count) {
+    int r;
+    if(count == 1) {
+        // set write address for single block (CMD24)
+        if(_cmdx(SDCMD_WRITE_BLOCK, BLOCK2ADDR(block_number)) == 0) {
+            _spi.write(0xFF);
+            r = _write_data(0xFE, buffer);
+        } else {
+            r = 1;
+        }
+
+    } else if(_cmdx(SDCMD_WRITE_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) == 0) {
         _spi.write(0xFF);
-        return 1;
+        r = 0;
+        for(uint32_t n=0; n<count && r == 0; n++) {
+            r = _write_data(0xFC, buffer + n * 512);
+        }
+        // the stop token, the card is busy until the last block is programmed
+        _spi.write(0xFD);
+        _spi.write(0xFF);
+        if(_wait_ready() != 0) r = 1;
+
+    } else {
+        r = 1;
     }
 
-    // wait for write to finish
-    while(_spi.write(0xFF) == 0);
+    _deselect();
+    return r;
+}
 
-    _cs = 1;
-    _spi.write(0xFF);
-    return 0;
+int SDCard::cache_find(uint32_t block_number) {
+    for (int i = 0; i < SD_CACHE_SECTORS; i++) {
+        if (cache[i].valid && cache[i].block == block_number) {
+            cache[i].used = ++cache_clock;
+            return i;
+        }
+    }
+    return -1;
+}
+
+// a free entry or the least recently used one, which is written to the card first if it is dirty
+// returns -1 if there is no cache or the dirty sector could not be written
+int SDCard::cache_slot() {
+    if (SD_CACHE_SECTORS == 0)
+        return -1;
+
+    if (cache_data == NULL) {
+        cache_data = (char *)malloc(SD_CACHE_SECTORS * 512);
+        if (cache_data == NULL)
+            return -1;
+    }
+
+    int lru = 0;
+    for (int i = 0; i < SD_CACHE_SECTORS; i++) {
+        if (!cache[i].valid) {
+            lru = i;
+            break;
+        }
+        if (cache[i].used < cache[lru].used) lru = i;
+    }
+
+    if (cache[lru].valid && cache[lru].dirty) {
+        if (_write_blocks(cache_data + lru * 512, cache[lru].block, 1) != 0)
+            return -1;
+    }
+    cache[lru].valid = false;
+    cache[lru].dirty = false;
+    cache[lru].used = ++cache_clock;
+    return lru;
+}
+
+int SDCard::cache_flush() {
+    int r = 0;
+    for (int i = 0; i < SD_CACHE_SECTORS; i++) {
+        if (cache[i].valid && cache[i].dirty) {
+            if (_write_blocks(cache_data + i * 512, cache[i].block, 1) == 0)
+                cache[i].dirty = false;
+            else
+                r = 1;
+        }
+    }
+    return r;
 }
 
 static int ext_bits(char *data, int msb, int lsb) {
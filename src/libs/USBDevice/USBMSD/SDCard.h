@@ -33,6 +33,11 @@
 
 // #include "DMA.h"
 
+// sectors held by the write-back cache for single sector accesses, 512 bytes of heap each, 0 for no cache
+#ifndef SD_CACHE_SECTORS
+#define SD_CACHE_SECTORS 4
+#endif
+
 /** Access the filesystem on an SD Card using SPI
  *
  * @code
@@ -71,6 +76,8 @@ public:
     virtual int disk_initialize();
     virtual int disk_write(const char *buffer, uint32_t block_number);
     virtual int disk_read(char *buffer, uint32_t block_number);
+    virtual int disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count);
+    virtual int disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count);
     virtual int disk_status();
     virtual int disk_sync();
     virtual uint32_t disk_sectors();
@@ -93,7 +100,18 @@ protected:
     CARD_TYPE initialise_card_v2();
 
     int _read(char *buffer, int length);
-    int _write(const char *buffer, int length);
+    int _read_data(char *buffer);
+    int _write_data(int token, const char *buffer);
+    int _wait_token();
+    int _wait_ready();
+    int _stop_transmission();
+    void _deselect();
+    int _read_blocks(char *buffer, uint32_t block_number, uint32_t count);
+    int _write_blocks(const char *buffer, uint32_t block_number, uint32_t count);
+
+    int cache_find(uint32_t block_number);
+    int cache_slot();
+    int cache_flush();
 
     uint32_t _sd_sectors();
     uint32_t _sectors;
@@ -104,6 +122,17 @@ protected:
     volatile bool busyflag;
 
     CARD_TYPE cardtype;
+
+    // the single sector accesses are FatFs moving its window over the FAT and directories, they are cached and
+    // writes are held until disk_sync() or the sector is evicted. Multi block accesses go to the card
+    struct {
+        uint32_t block;
+        uint32_t used;  // when it was last used, the least recently used one is evicted
+        bool valid:1;
+        bool dirty:1;
+    } cache[SD_CACHE_SECTORS > 0 ? SD_CACHE_SECTORS : 1];
+    char *cache_data;
+    uint32_t cache_clock;
 };
 
 #endif
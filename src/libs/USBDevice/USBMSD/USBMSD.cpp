@@ -191,7 +191,12 @@ bool USBMSD::connect()
     BlockSize = disk->disk_blocksize();
 
     if ((BlockCount > 0) && (BlockSize != 0)) {
-        page = (uint8_t*) AHB0.alloc(BlockSize);
+        page_blocks = MSD_PAGE_BLOCKS;
+        page = (uint8_t*) AHB0.alloc(BlockSize * page_blocks);
+        if (page == NULL) {
+            page_blocks = 1;
+            page = (uint8_t*) AHB0.alloc(BlockSize);
+        }
         if (page == NULL)
             return false;
     } else {
@@ -309,14 +314,18 @@ void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
         usb->stallEndpoint(MSC_BulkOut.bEndpointAddress);
     }
 
-    // we fill an array in RAM of 1 block before writing it in memory
+    // we fill an array in RAM of page_blocks blocks before writing it in memory
     for (int i = 0; i < size; i++)
-        page[addr_in_block + i] = buf[i];
+        page[page_index * BlockSize + addr_in_block + i] = buf[i];
 
-    // if the array is filled, write it in memory
+    // if the array is filled or this was the last block, write it in memory
     if ((addr_in_block + size) >= BlockSize) {
-        if (!(disk->disk_status() & WRITE_PROTECT)) {
-            disk->disk_write((const char *)page, lba);
+        page_index++;
+        if (page_index == page_blocks || length == size || stage != PROCESS_CBW) {
+            if (!(disk->disk_status() & WRITE_PROTECT)) {
+                disk->disk_write_blocks((const char *)page, lba + 1 - page_index, page_index);
+            }
+            page_index = 0;
         }
     }
 
@@ -647,17 +656,20 @@ void USBMSD::memoryRead (void) {
         stage = ERROR;
     }
 
-    // we read an entire block
-    if (addr_in_block == 0)
+    // we read as many of the blocks left as fit in the page
+    if (addr_in_block == 0 && page_index >= page_count)
     {
         iprintf("MSD:LBA %lu:", lba);
-        disk->disk_read((char *)page, lba);
+        uint32_t left = (length + BlockSize - 1) / BlockSize;
+        page_count = (left < page_blocks) ? (left > 0 ? left : 1) : page_blocks;
+        page_index = 0;
+        disk->disk_read_blocks((char *)page, lba, page_count);
     }
 
     iprintf(" %u", addr_in_block / MAX_PACKET_SIZE_EPBULK);
 
     // write data which are in RAM
-    usb->writeNB(MSC_BulkIn.bEndpointAddress, &page[addr_in_block], n, MAX_PACKET_SIZE_EPBULK);
+    usb->writeNB(MSC_BulkIn.bEndpointAddress, &page[page_index * BlockSize + addr_in_block], n, MAX_PACKET_SIZE_EPBULK);
 
     addr_in_block += n;
 
@@ -669,6 +681,7 @@ void USBMSD::memoryRead (void) {
         iprintf("\n");
         addr_in_block = 0;
         lba++;
+        page_index++;
     }
 
     if ( !length || (stage != PROCESS_CBW)) {
@@ -726,6 +739,8 @@ bool USBMSD::infoTransfer (void) {
     }
 
     addr_in_block = 0;
+    page_index = 0;
+    page_count = 0;
 
 //     iprintf("MSD:transferring %lu blocks from LBA %lu.\n", blocks, lba);
 
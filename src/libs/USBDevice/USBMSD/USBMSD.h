@@ -20,6 +20,11 @@
 #ifndef USBMSD_H
 #define USBMSD_H
 
+// blocks read or written to the disk at once, if there is not the memory for them it is done a block at a time
+#ifndef MSD_PAGE_BLOCKS
+#define MSD_PAGE_BLOCKS 4
+#endif
+
 #include "USB.h"
 
 /* These headers are included for child class. */
@@ -159,7 +164,11 @@ private:
     bool memOK;
 
     // cache in RAM before writing in memory. Useful also to read a block.
+    // it holds page_blocks blocks so the disk is read and written several blocks at a time
     uint8_t * page;
+    uint8_t page_blocks;
+    uint8_t page_index;     // the block of the page being transferred
+    uint8_t page_count;     // blocks read into the page
 
     // USB packet buffer
     uint8_t buffer[MAX_PACKET_SIZE_EPBULK];
@@ -23,6 +23,36 @@ public:
      */
     virtual int disk_write(const char * data, uint32_t block) { return 0; };
 
+    /*
+     * read consecutive blocks, a disk that can do it in one transfer overrides this
+     *
+     * @param data pointer where will be stored read data, count * blocksize bytes
+     * @param block first block number
+     * @param count number of blocks
+     * @returns 0 if successful
+     */
+    virtual int disk_read_blocks(char * data, uint32_t block, uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (disk_read(data + i * 512, block + i)) return 1;
+        }
+        return 0;
+    };
+
+    /*
+     * write consecutive blocks, a disk that can do it in one transfer overrides this
+     *
+     * @param data data to write, count * blocksize bytes
+     * @param block first block number
+     * @param count number of blocks
+     * @returns 0 if successful
+     */
+    virtual int disk_write_blocks(const char * data, uint32_t block, uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (disk_write(data + i * 512, block + i)) return 1;
+        }
+        return 0;
+    };
+
     /*
      * Disk initilization
      */
@@ -195,6 +195,14 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     for (uint8_t i = 0; i < size; i++) {
         char b= c[i];
 
+        // the bytes of a move frame are queued as they are
+        uint8_t f= move_frame.feed(b);
+        if(f != MoveFrameTracker::TEXT) {
+            rxbuf.iqueue(b);
+            if(f == MoveFrameTracker::FRAME_END) nl_in_rx++;
+            continue;
+        }
+
         // handle backspace and delete by deleting the last character in the buffer if there is one
         if(b == 0x08 || b == 0x7F) {
             if(!rxbuf.isEmpty()) rxbuf.ipop();
@@ -295,6 +303,8 @@ bool USBSerial::ready()
 
 void USBSerial::on_module_loaded()
 {
+    message.stream = this;
+    message.message.reserve(128);
     this->register_for_event(ON_MAIN_LOOP);
     this->register_for_event(ON_IDLE);
 }
@@ -311,6 +321,7 @@ void USBSerial::on_idle(void *argument)
         }
         rxbuf.flush(); // flush the recieve buffer, hopefully upstream has stopped sending
         nl_in_rx = 0;
+        move_frame.reset();
     }
 
     if(query_flag) {
@@ -341,6 +352,7 @@ void USBSerial::on_main_loop(void *argument)
             txbuf.flush();
             rxbuf.flush();
             nl_in_rx = 0;
+            move_frame.reset();
         }
     }
 
@@ -348,19 +360,33 @@ void USBSerial::on_main_loop(void *argument)
     //if(THEKERNEL->get_feed_hold()) return;
 
     if (nl_in_rx) {
-        string received;
+        message.message.clear();
+
+        uint8_t b;
+        rxbuf.peek(&b, 0);
+        if(b == MOVE_FRAME_SYNC) {
+            // a binary move frame, it is complete as it was counted, read it without _getc() as it may contain newlines
+            rxbuf.peek(&b, 1);
+            for (int n = b + 4; n > 0 && rxbuf.dequeue(&b); --n) {
+                message.message += (char)b;
+            }
+            nl_in_rx--;
+            if (rxbuf.free() >= MAX_PACKET_SIZE_EPBULK) {
+                usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+            }
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+            return;
+        }
+
         while (available()) {
             int c = _getc();
             if(c == -1) break;
             if( c == '\n' || c == '\r') {
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
                 iprintf("USBSerial Received: %s\n", message.message.c_str());
                 THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
                 return;
             } else {
-                received += c;
+                message.message += c;
             }
         }
     }
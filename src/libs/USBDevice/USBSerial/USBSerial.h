@@ -25,6 +25,8 @@
 
 #include "Module.h"
 #include "StreamOutput.h"
+#include "SerialMessage.h"
+#include "MoveFrame.h"
 
 class USBSerial_Receiver {
 protected:
@@ -67,6 +69,12 @@ protected:
     // this makes it trivial to detect if there's a new line available
     volatile int nl_in_rx;
 
+    // the line being dispatched, kept so its buffer is reused for every line
+    SerialMessage message;
+
+    // finds the binary move frames in the received bytes, a whole frame counts as a line in nl_in_rx
+    MoveFrameTracker move_frame;
+
 
     volatile struct {
         volatile bool attach:1;
@@ -0,0 +1,85 @@
+#include "fixed_sine.h"
+
+#define QUARTER_BITS 9 // the table has 2^QUARTER_BITS steps to a quarter turn
+
+// sin() from 0 to a quarter turn in 2.30 fixed point, const so it stays in flash
+static const int32_t quarter_sine[(1 << QUARTER_BITS) + 1] = {
+    0, 3294193, 6588356, 9882456, 13176464, 16470347, 19764076, 23057618,
+    26350943, 29644021, 32936819, 36229307, 39521455, 42813230, 46104602, 49395541,
+    52686014, 55975992, 59265442, 62554335, 65842639, 69130324, 72417357, 75703709,
+    78989349, 82274245, 85558366, 88841683, 92124163, 95405776, 98686491, 101966277,
+    105245103, 108522939, 111799753, 115075515, 118350194, 121623759, 124896179, 128167423,
+    131437462, 134706263, 137973796, 141240030, 144504935, 147768480, 151030634, 154291367,
+    157550647, 160808445, 164064728, 167319468, 170572633, 173824192, 177074115, 180322371,
+    183568930, 186813762, 190056834, 193298119, 196537583, 199775198, 203010932, 206244756,
+    209476638, 212706549, 215934457, 219160334, 222384147, 225605867, 228825464, 232042906,
+    235258165, 238471210, 241682010, 244890535, 248096755, 251300640, 254502159, 257701283,
+    260897982, 264092224, 267283981, 270473223, 273659918, 276844038, 280025552, 283204430,
+    286380643, 289554160, 292724951, 295892988, 299058239, 302220676, 305380268, 308536985,
+    311690799, 314841679, 317989595, 321134518, 324276419, 327415267, 330551034, 333683689,
+    336813204, 339939549, 343062693, 346182609, 349299266, 352412636, 355522689, 358629395,
+    361732726, 364832652, 367929144, 371022173, 374111709, 377197725, 380280190, 383359076,
+    386434353, 389505993, 392573967, 395638246, 398698801, 401755603, 404808624, 407857835,
+    410903207, 413944711, 416982319, 420016002, 423045732, 426071480, 429093217, 432110916,
+    435124548, 438134084, 441139496, 444140756, 447137835, 450130706, 453119340, 456103710,
+    459083786, 462059541, 465030947, 467997976, 470960600, 473918791, 476872522, 479821764,
+    482766489, 485706671, 488642281, 491573292, 494499676, 497421405, 500338453, 503250791,
+    506158392, 509061229, 511959275, 514852502, 517740883, 520624391, 523502998, 526376678,
+    529245404, 532109148, 534967884, 537821584, 540670223, 543513772, 546352205, 549185496,
+    552013618, 554836544, 557654248, 560466703, 563273883, 566075761, 568872310, 571663506,
+    574449320, 577229728, 580004702, 582774218, 585538248, 588296766, 591049748, 593797166,
+    596538995, 599275210, 602005783, 604730691, 607449906, 610163404, 612871159, 615573145,
+    618269338, 620959711, 623644239, 626322897, 628995660, 631662503, 634323400, 636978327,
+    639627258, 642270169, 644907034, 647537830, 650162530, 652781111, 655393548, 657999816,
+    660599890, 663193747, 665781362, 668362709, 670937767, 673506508, 676068911, 678624950,
+    681174602, 683717842, 686254647, 688784993, 691308855, 693826211, 696337036, 698841307,
+    701339000, 703830092, 706314559, 708792378, 711263525, 713727978, 716185713, 718636707,
+    721080937, 723518380, 725949013, 728372813, 730789757, 733199822, 735602987, 737999228,
+    740388522, 742770848, 745146182, 747514503, 749875788, 752230015, 754577161, 756917205,
+    759250125, 761575898, 763894504, 766205919, 768510122, 770807092, 773096806, 775379244,
+    777654384, 779922204, 782182683, 784435800, 786681534, 788919863, 791150767, 793374223,
+    795590213, 797798714, 799999706, 802193167, 804379079, 806557419, 808728167, 810891304,
+    813046808, 815194659, 817334838, 819467323, 821592095, 823709135, 825818421, 827919934,
+    830013654, 832099562, 834177638, 836247863, 838310216, 840364679, 842411232, 844449856,
+    846480531, 848503239, 850517961, 852524677, 854523370, 856514019, 858496606, 860471112,
+    862437520, 864395810, 866345964, 868287963, 870221790, 872147426, 874064853, 875974054,
+    877875009, 879767701, 881652112, 883528225, 885396022, 887255485, 889106597, 890949341,
+    892783698, 894609652, 896427186, 898236282, 900036924, 901829095, 903612776, 905387953,
+    907154608, 908912725, 910662286, 912403276, 914135678, 915859476, 917574653, 919281194,
+    920979082, 922668302, 924348837, 926020672, 927683790, 929338177, 930983817, 932620694,
+    934248793, 935868098, 937478595, 939080267, 940673101, 942257081, 943832191, 945398418,
+    946955747, 948504163, 950043650, 951574196, 953095785, 954608403, 956112036, 957606670,
+    959092290, 960568883, 962036435, 963494932, 964944360, 966384706, 967815955, 969238095,
+    970651112, 972054994, 973449725, 974835295, 976211688, 977578894, 978936898, 980285688,
+    981625251, 982955574, 984276646, 985588453, 986890984, 988184225, 989468165, 990742793,
+    992008094, 993264059, 994510675, 995747930, 996975812, 998194311, 999403415, 1000603111,
+    1001793390, 1002974239, 1004145648, 1005307605, 1006460100, 1007603122, 1008736660, 1009860704,
+    1010975242, 1012080264, 1013175761, 1014261721, 1015338134, 1016404991, 1017462281, 1018509994,
+    1019548121, 1020576651, 1021595575, 1022604883, 1023604567, 1024594615, 1025575020, 1026545772,
+    1027506862, 1028458280, 1029400018, 1030332067, 1031254418, 1032167062, 1033069992, 1033963197,
+    1034846671, 1035720404, 1036584389, 1037438617, 1038283080, 1039117770, 1039942680, 1040757802,
+    1041563127, 1042358649, 1043144360, 1043920252, 1044686319, 1045442553, 1046188946, 1046925492,
+    1047652185, 1048369016, 1049075980, 1049773069, 1050460278, 1051137599, 1051805027, 1052462555,
+    1053110176, 1053747885, 1054375676, 1054993543, 1055601479, 1056199480, 1056787540, 1057365653,
+    1057933813, 1058492016, 1059040255, 1059578527, 1060106826, 1060625146, 1061133483, 1061631833,
+    1062120190, 1062598550, 1063066909, 1063525261, 1063973603, 1064411931, 1064840240, 1065258526,
+    1065666786, 1066065015, 1066453210, 1066831367, 1067199483, 1067557554, 1067905576, 1068243547,
+    1068571464, 1068889322, 1069197120, 1069494854, 1069782521, 1070060120, 1070327646, 1070585099,
+    1070832474, 1071069770, 1071296985, 1071514117, 1071721163, 1071918122, 1072104991, 1072281769,
+    1072448455, 1072605046, 1072751542, 1072887940, 1073014240, 1073130440, 1073236540, 1073332538,
+    1073418433, 1073494225, 1073559913, 1073615496, 1073660973, 1073696345, 1073721611, 1073736771,
+    1073741824,
+};
+
+int32_t fixed_sin(uint32_t phase)
+{
+    // the quarter the phase is in and how far into it, mirrored for the second and fourth quarters
+    uint32_t x = phase & 0x3FFFFFFF;
+    if(phase & 0x40000000) x = 0x40000000 - x;
+    uint32_t i = x >> (30 - QUARTER_BITS);
+    uint32_t frac = x & ((1 << (30 - QUARTER_BITS)) - 1);
+
+    int32_t s = quarter_sine[i];
+    if(frac != 0) s += ((int64_t)(quarter_sine[i + 1] - s) * frac) >> (30 - QUARTER_BITS);
+    return (phase & 0x80000000) ? -s : s;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+
+// sine of a phase where 2^32 is a turn, in 2.30 fixed point. Interpolated from a quarter wave table so it is a few
+// instructions and no floating point, it is within 2e-6 of sinf()
+int32_t fixed_sin(uint32_t phase);
+
+// cosine is the sine a quarter turn on
+inline int32_t fixed_cos(uint32_t phase) { return fixed_sin(phase + 0x40000000); }
@@ -27,6 +27,9 @@
 #include "LPC17xx.h"
 #include "version.h"
 
+// counts every malloc, realloc and new, see mbed_custom.cpp
+extern volatile unsigned int g_heapAllocations;
+
 #define panel_display_message_checksum CHECKSUM("display_message")
 #define panel_checksum             CHECKSUM("panel")
 
@@ -42,8 +45,14 @@ static bool is_allowed_mcode(int m) {
 GcodeDispatch::GcodeDispatch()
 {
     uploading = false;
+    dispatching = false;
     currentline = -1;
     modal_group_1= 0;
+    line_allocations= {0, 0, 0, 0};
+
+    // sized for the longest usual line, a longer one grows them once
+    line_buffer.reserve(128);
+    command_buffer.reserve(128);
 }
 
 // Called when the module has just been loaded
@@ -55,8 +64,76 @@ void GcodeDispatch::on_module_loaded()
 // When a command is received, if it is a Gcode, dispatch it as an object via an event
 void GcodeDispatch::on_console_line_received(void *line)
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(line);
-    string possible_command = new_message.message;
+    SerialMessage &new_message = *static_cast<SerialMessage *>(line);
+
+    // lowercase and $ are simpleshell commands, they are not counted
+    if(!new_message.message.empty() && (islower(new_message.message[0]) || new_message.message[0] == '$')) return;
+
+    // a binary move frame instead of a line
+    if(!new_message.message.empty() && (uint8_t)new_message.message[0] == MOVE_FRAME_SYNC) {
+        dispatch_frame(new_message);
+        return;
+    }
+
+    unsigned int allocations= g_heapAllocations;
+    if(dispatching) {
+        // a line sent from within a gcode handler, the buffers are still in use by the line that sent it
+        string possible_command, single_command;
+        dispatch_line(new_message, possible_command, single_command);
+
+    } else {
+        // the line is parsed in buffers kept between lines and the Gcode comes from its pool so there is no allocation
+        dispatching= true;
+        dispatch_line(new_message, line_buffer, command_buffer);
+        dispatching= false;
+    }
+
+    allocations= g_heapAllocations - allocations;
+    line_allocations.lines++;
+    line_allocations.total += allocations;
+    line_allocations.last= allocations;
+    if(allocations > line_allocations.max) line_allocations.max= allocations;
+}
+
+// the moves of a frame go straight to the robot, a frame is answered like a line of G1s would be
+void GcodeDispatch::dispatch_frame(SerialMessage &new_message)
+{
+    if(THEKERNEL->is_halted()) {
+        // ignored until M999 like any other move
+        if(THEKERNEL->is_grbl_mode()) {
+            new_message.stream->printf("error:Alarm lock\n");
+        }else{
+            new_message.stream->printf("!!\n");
+        }
+        return;
+    }
+
+    const char *error;
+    if(uploading && upload_stream == new_message.stream) {
+        error= "move frames cannot be uploaded to a file";
+    } else {
+        error= frame_decoder.decode((const uint8_t *)new_message.message.data(), new_message.message.size());
+    }
+
+    if(error == nullptr) {
+        new_message.stream->printf("ok\n");
+        return;
+    }
+
+    if(THEKERNEL->is_grbl_mode()) {
+        new_message.stream->printf("error:%s\n", error);
+    }else{
+        new_message.stream->printf("Error: %s\n", error);
+    }
+
+    // moves are missing so we cannot continue safely
+    new_message.stream->printf("Entering Alarm/Halt state\n");
+    THEKERNEL->call_event(ON_HALT, nullptr);
+}
+
+void GcodeDispatch::dispatch_line(SerialMessage &new_message, string &possible_command, string &single_command)
+{
+    possible_command.assign(new_message.message);
 
     int ln = 0;
     int cs = 0;
@@ -103,7 +180,7 @@ try_again:
 
 			//Calculate checksum
             if ( chkpos != string::npos ) {
-				possible_command = possible_command.substr(0, chkpos);
+				possible_command.resize(chkpos);
                 for (auto c = possible_command.cbegin(); *c != '*' && c != possible_command.cend(); c++)
                     cs = cs ^ *c;
                 cs &= 0xff;  // Defensive programming...
@@ -113,7 +190,7 @@ try_again:
             //Strip line number value from possible_command
 			size_t lnsize = possible_command.find_first_not_of("N0123456789.,- ");
 			if(lnsize != string::npos) {
-				possible_command = possible_command.substr(lnsize);
+				possible_command.erase(0, lnsize);
 			}else{
 				// it is a blank line
 				possible_command.clear();
@@ -128,7 +205,7 @@ try_again:
         //Remove comments
         size_t comment = possible_command.find_first_of(";(");
         if( comment != string::npos ) {
-            possible_command = possible_command.substr(0, comment);
+            possible_command.resize(comment);
         }
 
         //If checksum passes then process message, else request resend
@@ -143,13 +220,12 @@ try_again:
                 if(!uploading || upload_stream != new_message.stream) {
                     // assumes G or M are always the first on the line
                     size_t nextcmd = possible_command.find_first_of("GM", 2);
-                    string single_command;
                     if(nextcmd == string::npos) {
-                        single_command = possible_command;
-                        possible_command = "";
+                        single_command.assign(possible_command);
+                        possible_command.clear();
                     } else {
-                        single_command = possible_command.substr(0, nextcmd);
-                        possible_command = possible_command.substr(nextcmd);
+                        single_command.assign(possible_command, 0, nextcmd);
+                        possible_command.erase(0, nextcmd);
                     }
 
                     // Prepare gcode for dispatch
@@ -198,7 +274,7 @@ try_again:
                                 delete gcode;
                                 // extract next G0/G1 from the rest of the line, ignore if it is not one of these
                                 gcode = new Gcode(possible_command, new_message.stream);
-                                possible_command= "";
+                                possible_command.clear();
                                 if(!gcode->has_g || gcode->g > 1) {
                                     // not G0 or G1 so ignore it as it is invalid
                                     delete gcode;
@@ -427,7 +503,7 @@ try_again:
 
                 } else {
                     // we are uploading and it is the upload stream so so save it
-                    if(possible_command.substr(0, 3) == "M29") {
+                    if(possible_command.compare(0, 3, "M29") == 0) {
                         // done uploading, close file
                         fclose(upload_fd);
                         upload_fd = NULL;
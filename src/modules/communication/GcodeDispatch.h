@@ -8,11 +8,13 @@
 #pragma once
 
 #include "libs/Module.h"
+#include "utils/MoveFrame.h"
 
 #include <stdio.h>
 #include <string>
 
 class StreamOutput;
+struct SerialMessage;
 
 class GcodeDispatch : public Module
 {
@@ -23,7 +25,26 @@ public:
     virtual void on_console_line_received(void *line);
 
     uint8_t get_modal_command() const { return modal_group_1<4 ? modal_group_1 : 0; }
+
+    // heap allocations made while dispatching gcode lines, shown by mem -v
+    struct line_allocations_t {
+        uint32_t lines;
+        uint32_t total;
+        uint32_t last;
+        uint32_t max;
+    };
+    const line_allocations_t& get_line_allocations() const { return line_allocations; }
+    uint32_t get_frame_moves() const { return frame_decoder.get_moves(); }
+
 private:
+    void dispatch_line(SerialMessage &new_message, std::string &possible_command, std::string &single_command);
+    void dispatch_frame(SerialMessage &new_message);
+
+    MoveFrameDecoder frame_decoder;
+
+    std::string line_buffer;
+    std::string command_buffer;
+    line_allocations_t line_allocations;
     int currentline;
     std::string upload_filename;
     FILE *upload_fd;
@@ -31,5 +52,6 @@ private:
     uint8_t modal_group_1;
     struct {
         bool uploading: 1;
+        bool dispatching: 1;
     };
 };
@@ -186,6 +186,8 @@ void SerialConsole::on_module_loaded()
     halt_flag = false;
     lf_count = 0;
     last_char_was_cr = false;
+    message.stream = this;
+    message.message.reserve(128);
 
     // We only call the command dispatcher in the main loop, nowhere else
     this->register_for_event(ON_MAIN_LOOP);
@@ -198,6 +200,14 @@ void SerialConsole::on_module_loaded()
 // Called on interrupt, meaning we have received a char
 void SerialConsole::on_serial_char_received(char received)
 {
+    // the bytes of a move frame are queued as they are
+    uint8_t f= move_frame.feed(received);
+    if(f != MoveFrameTracker::TEXT) {
+        this->buffer.put(received);
+        if(f == MoveFrameTracker::FRAME_END) ++lf_count;
+        return;
+    }
+
     if(received == '?') {
         query_flag = true;
         return;
@@ -236,6 +246,7 @@ void SerialConsole::on_idle(void * argument)
         char c;
         while(this->buffer.get(c)) ; // flush the recieve buffer, hopefully upstream has stopped sending
         lf_count= 0;
+        move_frame.reset();
 
         if(THEKERNEL->is_grbl_mode()) {
             puts("ALARM: Abort during cycle\r\n");
@@ -249,23 +260,30 @@ void SerialConsole::on_idle(void * argument)
 void SerialConsole::on_main_loop(void * argument)
 {
     if(lf_count > 0) {
-        string received;
-        received.reserve(20);
+        message.message.clear();
         while(1) {
             char c;
             if(!this->buffer.get(c)) {
                 lf_count= 0; // be safe as this should not happen anyway
                 return;
             }
+            if(message.message.empty() && (uint8_t)c == MOVE_FRAME_SYNC) {
+                // a binary move frame, it is complete as it was counted and may contain newlines
+                message.message += c;
+                if(this->buffer.get(c)) {
+                    message.message += c;
+                    for (int n = (uint8_t)c + 2; n > 0 && this->buffer.get(c); --n) message.message += c;
+                }
+                --lf_count;
+                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+                return;
+            }
             if(c == '\n') {
                 --lf_count;
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
                 THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
                 return;
             } else {
-                received += c;
+                message.message += c;
             }
         }
     }
@@ -15,6 +15,8 @@
 
 #include "libs/TSRingBuffer.h"
 #include "libs/StreamOutput.h"
+#include "libs/SerialMessage.h"
+#include "utils/MoveFrame.h"
 
 class SerialConsole : public Module, public StreamOutput {
     public:
@@ -32,6 +34,8 @@ class SerialConsole : public Module, public StreamOutput {
         int puts(const char*);
 
         TSRingBuffer<char, 256> buffer;   // Receive buffer
+        SerialMessage message;            // the line being dispatched, kept so its buffer is reused for every line
+        MoveFrameTracker move_frame;      // finds the binary move frames in the received bytes, a frame counts as a line
 
         struct {
           bool query_flag:1;
@@ -12,34 +12,77 @@
 #include "nist_float.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <algorithm>
 
 // This is a gcode object. It represents a GCode string/command, and caches some important values about that command for the sake of performance.
 // It gets passed around in events, and attached to the queue ( that'll change )
-Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
+Gcode::Gcode(const string &command, StreamOutput *stream, bool strip) : Gcode(command.c_str(), stream, strip)
 {
-    this->command= strdup(command.c_str());
+}
+
+Gcode::Gcode(const char *command, StreamOutput *stream, bool strip)
+{
+    set_command(command, strlen(command));
     this->m= 0;
     this->g= 0;
     this->subcode= 0;
     this->add_nl= false;
     this->is_error= false;
     this->stream= stream;
-    prepare_cached_values(strip);
     this->stripped= strip;
+    prepare_cached_values(strip);
 }
 
 Gcode::~Gcode()
 {
-    if(command != nullptr) {
-        // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    if(command != short_command) {
         free(command);
     }
 }
 
+void Gcode::set_command(const char *s, size_t len)
+{
+    if(len < sizeof(short_command)) {
+        command= short_command;
+    } else {
+        command= (char *)malloc(len + 1);
+    }
+    memcpy(command, s, len);
+    command[len]= '\0';
+}
+
+// Gcodes are made and deleted for every line dispatched, a handler can dispatch another while one is in use so there
+// are a couple of slots, if they are all in use the heap is used
+static const int gcode_pool_size= 2;
+static uint8_t gcode_pool[gcode_pool_size][sizeof(Gcode)] __attribute__ ((aligned (8)));
+static uint8_t gcode_pool_used= 0; // bit n is set when slot n is in use
+
+void *Gcode::operator new(size_t size)
+{
+    for (int i = 0; i < gcode_pool_size; ++i) {
+        if(!(gcode_pool_used & (1 << i))) {
+            gcode_pool_used |= (1 << i);
+            return gcode_pool[i];
+        }
+    }
+    return ::operator new(size);
+}
+
+void Gcode::operator delete(void *p)
+{
+    for (int i = 0; i < gcode_pool_size; ++i) {
+        if(p == gcode_pool[i]) {
+            gcode_pool_used &= ~(1 << i);
+            return;
+        }
+    }
+    ::operator delete(p);
+}
+
 Gcode::Gcode(const Gcode &to_copy)
 {
-    this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    set_command(to_copy.command, strlen(to_copy.command));
     this->has_m                 = to_copy.has_m;
     this->has_g                 = to_copy.has_g;
     this->m                     = to_copy.m;
@@ -47,14 +90,17 @@ Gcode::Gcode(const Gcode &to_copy)
     this->subcode               = to_copy.subcode;
     this->add_nl                = to_copy.add_nl;
     this->is_error              = to_copy.is_error;
+    this->stripped              = to_copy.stripped;
     this->stream                = to_copy.stream;
     this->txt_after_ok.assign( to_copy.txt_after_ok );
+    copy_table(to_copy);
 }
 
 Gcode &Gcode::operator= (const Gcode &to_copy)
 {
     if( this != &to_copy ) {
-        this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+        if(this->command != short_command) free(this->command);
+        set_command(to_copy.command, strlen(to_copy.command));
         this->has_m                 = to_copy.has_m;
         this->has_g                 = to_copy.has_g;
         this->m                     = to_copy.m;
@@ -62,71 +108,144 @@ Gcode &Gcode::operator= (const Gcode &to_copy)
         this->subcode               = to_copy.subcode;
         this->add_nl                = to_copy.add_nl;
         this->is_error              = to_copy.is_error;
+        this->stripped              = to_copy.stripped;
         this->stream                = to_copy.stream;
         this->txt_after_ok.assign( to_copy.txt_after_ok );
+        copy_table(to_copy);
     }
     return *this;
 }
 
+// the offsets are into the command which is an identical copy
+void Gcode::copy_table(const Gcode &to_copy)
+{
+    this->values                = to_copy.values;
+    this->letters               = to_copy.letters;
+    this->arg_letters           = to_copy.arg_letters;
+    this->num_args              = to_copy.num_args;
+    memcpy(this->offsets, to_copy.offsets, sizeof(offsets));
+}
 
-// Whether or not a Gcode has a letter
-bool Gcode::has_letter( char letter ) const
+// Parse the command once into the letter table, the first value of each letter is kept like the original scans found it
+void Gcode::tokenize()
 {
-    for (size_t i = 0; i < strlen(this->command); ++i) {
-        if( command[i] == letter ) {
-            return true;
+    values.clear();
+    letters= 0;
+    arg_letters= 0;
+    num_args= 0;
+    for (size_t i = 0; command[i] != '\0'; ++i) {
+        char c= command[i];
+        if(!LetterTable<float>::is_letter(c)) continue;
+
+        uint32_t bit= 1UL << (c - 'A');
+        letters |= bit;
+        // an unstripped command starts with its G or M which is not an argument, T is not considered an argument either
+        if((stripped || i > 0) && c != 'T') {
+            arg_letters |= bit;
+            num_args++;
+        }
+
+        if(!values.has(c)) {
+            const char *cs= &command[i+1];
+            char *cn;
+            float v= parse_float(cs, &cn);
+            if(cn > cs) {
+                values.set(c, v);
+                offsets[c - 'A']= i;
+            }
         }
     }
-    return false;
+}
+
+// Whether or not a Gcode has a letter
+bool Gcode::has_letter( char letter ) const
+{
+    if(LetterTable<float>::is_letter(letter)) return (letters & (1UL << (letter - 'A'))) != 0;
+    return scan(letter) != nullptr;
 }
 
 // Retrieve the value for a given letter
 float Gcode::get_value( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            float r = parse_float(cs, &cn);
+    if(!LetterTable<float>::is_letter(letter)) return scan_value(letter, ptr);
+
+    if(!values.has(letter)) {
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
+    }
+    if(ptr == nullptr) return values.at(letter);
+
+    // the caller wants to know where the value ends so parse it again
+    return parse_float(&command[offsets[letter - 'A'] + 1], ptr);
+}
+
+int Gcode::get_int( char letter, char **ptr ) const
+{
+    if(LetterTable<float>::is_letter(letter)) {
+        // an integer can only be where a float was found, a value like .5 is skipped by strtol so that needs a scan
+        if(!values.has(letter)) {
+            if(ptr != nullptr) *ptr= nullptr;
+            return 0;
+        }
+        const char *cs = &command[offsets[letter - 'A'] + 1];
+        char *cn;
+        int r = strtol(cs, &cn, 10);
+        if(cn > cs) {
             if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
+            return r;
         }
     }
-    if(ptr != nullptr) *ptr= nullptr;
-    return 0;
+    return scan_int(letter, ptr, false);
 }
 
-int Gcode::get_int( char letter, char **ptr ) const
+uint32_t Gcode::get_uint( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtol(cs, &cn, 10);
+    if(LetterTable<float>::is_letter(letter)) {
+        if(!values.has(letter)) {
+            if(ptr != nullptr) *ptr= nullptr;
+            return 0;
+        }
+        const char *cs = &command[offsets[letter - 'A'] + 1];
+        char *cn;
+        uint32_t r = strtoul(cs, &cn, 10);
+        if(cn > cs) {
             if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
+            return r;
         }
     }
+    return scan_int(letter, ptr, true);
+}
+
+// the first occurrence of a letter in the command, used for the letters that are not in the table
+char *Gcode::scan( char letter ) const
+{
+    if(letter == '\0') return nullptr;
+    return strchr(command, letter);
+}
+
+float Gcode::scan_value( char letter, char **ptr ) const
+{
+    char *cn = NULL;
+    for (const char *cs = scan(letter); cs != nullptr; cs = strchr(cs, letter)) {
+        cs++;
+        float r = parse_float(cs, &cn);
+        if(ptr != nullptr) *ptr= cn;
+        if (cn > cs)
+            return r;
+    }
     if(ptr != nullptr) *ptr= nullptr;
     return 0;
 }
 
-uint32_t Gcode::get_uint( char letter, char **ptr ) const
+long Gcode::scan_int( char letter, char **ptr, bool is_unsigned ) const
 {
-    const char *cs = command;
     char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtoul(cs, &cn, 10);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
-        }
+    for (const char *cs = scan(letter); cs != nullptr; cs = strchr(cs, letter)) {
+        cs++;
+        long r = is_unsigned ? (long)strtoul(cs, &cn, 10) : strtol(cs, &cn, 10);
+        if(ptr != nullptr) *ptr= cn;
+        if (cn > cs)
+            return r;
     }
     if(ptr != nullptr) *ptr= nullptr;
     return 0;
@@ -134,57 +253,43 @@ uint32_t Gcode::get_uint( char letter, char **ptr ) const
 
 int Gcode::get_num_args() const
 {
-    int count = 0;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        if( this->command[i] >= 'A' && this->command[i] <= 'Z' ) {
-            if(this->command[i] == 'T') continue;
-            count++;
-        }
-    }
-    return count;
+    return num_args;
 }
 
-std::map<char,float> Gcode::get_args() const
+LetterTable<float> Gcode::get_args() const
 {
-    std::map<char,float> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
-        if( c >= 'A' && c <= 'Z' ) {
-            if(c == 'T') continue;
-            m[c]= get_value(c);
-        }
+    LetterTable<float> a;
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        if(arg_letters & (1UL << (c - 'A'))) a.set(c, get_value(c));
     }
-    return m;
+    return a;
 }
 
-std::map<char,int> Gcode::get_args_int() const
+LetterTable<int> Gcode::get_args_int() const
 {
-    std::map<char,int> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
-        if( c >= 'A' && c <= 'Z' ) {
-            if(c == 'T') continue;
-            m[c]= get_int(c);
-        }
+    LetterTable<int> a;
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        if(arg_letters & (1UL << (c - 'A'))) a.set(c, get_int(c));
     }
-    return m;
+    return a;
 }
 
 // Cache some of this command's properties, so we don't have to parse the string every time we want to look at them
 void Gcode::prepare_cached_values(bool strip)
 {
+    // the G and M are at the start so scanning for them is quick, the table is made once the command is final
     char *p= nullptr;
-    if( this->has_letter('G') ) {
+    if( scan('G') != nullptr ) {
         this->has_g = true;
-        this->g = this->get_int('G', &p);
+        this->g = scan_int('G', &p, false);
 
     } else {
         this->has_g = false;
     }
 
-    if( this->has_letter('M') ) {
+    if( scan('M') != nullptr ) {
         this->has_m = true;
-        this->m = this->get_int('M', &p);
+        this->m = scan_int('M', &p, false);
 
     } else {
         this->has_m = false;
@@ -200,14 +305,13 @@ void Gcode::prepare_cached_values(bool strip)
         }
     }
 
-    if(!strip) return;
-
     // remove the Gxxx or Mxxx from string
-    if (p != nullptr) {
-        char *n= strdup(p); // create new string starting at end of the numeric value
-        free(command);
-        command= n;
+    if (strip && p != nullptr) {
+        // move the rest of the string down to the end of the numeric value, the few bytes this leaves unused are freed with the command
+        memmove(command, p, strlen(p) + 1);
     }
+
+    tokenize();
 }
 
 // strip off X Y Z I J K parameters if G0/1/2/3
@@ -236,9 +340,8 @@ void Gcode::strip_parameters()
         // strip whitespace to save even more, this causes problems so don't do it
         //newcmd.erase(std::remove_if(newcmd.begin(), newcmd.end(), ::isspace), newcmd.end());
 
-        // release the old one
-        free(command);
-        // copy the new shortened one
-        command= strdup(newcmd.c_str());
+        // copy the new shortened one over the old one
+        memcpy(command, newcmd.c_str(), newcmd.size() + 1);
+        tokenize();
     }
 }
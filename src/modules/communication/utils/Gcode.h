@@ -9,7 +9,10 @@
 #ifndef GCODE_H
 #define GCODE_H
 #include <string>
-#include <map>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "LetterTable.h"
 
 using std::string;
 
@@ -19,6 +22,7 @@ class StreamOutput;
 class Gcode {
     public:
         Gcode(const string&, StreamOutput*, bool strip=true);
+        Gcode(const char*, StreamOutput*, bool strip=true);
         Gcode(const Gcode& to_copy);
         Gcode& operator= (const Gcode& to_copy);
         ~Gcode();
@@ -29,10 +33,14 @@ class Gcode {
         int get_int ( char letter, char **ptr= nullptr ) const;
         uint32_t get_uint ( char letter, char **ptr= nullptr ) const;
         int get_num_args() const;
-        std::map<char,float> get_args() const;
-        std::map<char,int> get_args_int() const;
+        LetterTable<float> get_args() const;
+        LetterTable<int> get_args_int() const;
         void strip_parameters();
 
+        // a Gcode made with new comes from a small pool so dispatching a line does not use the heap
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
+
         // FIXME these should be private
         unsigned int m;
         unsigned int g;
@@ -50,7 +58,21 @@ class Gcode {
         string txt_after_ok;
 
     private:
+        void set_command(const char *s, size_t len);
         void prepare_cached_values(bool strip=true);
+        void tokenize();
+        void copy_table(const Gcode& to_copy);
+        char *scan(char letter) const;
+        float scan_value ( char letter, char **ptr ) const;
+        long scan_int ( char letter, char **ptr, bool is_unsigned ) const;
         char *command;
+        char short_command[64];     // the command is kept here when it fits, longer ones are allocated
+
+        // the command is parsed once into a table indexed by letter, so lookups do not rescan it
+        LetterTable<float> values;  // the first value given for each letter
+        uint32_t letters;           // bit n is set when 'A'+n is anywhere in the command
+        uint32_t arg_letters;       // the letters get_args() returns
+        uint16_t offsets[26];       // where in the command the letter of each value is
+        uint16_t num_args;
 };
 #endif
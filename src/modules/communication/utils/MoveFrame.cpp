@@ -0,0 +1,97 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MoveFrame.h"
+
+#include "libs/Kernel.h"
+#include "Robot.h"
+
+#include <math.h>
+
+MoveFrameDecoder::MoveFrameDecoder()
+{
+    position[0]= position[1]= position[2]= 0;
+    moves= 0;
+}
+
+uint16_t MoveFrameDecoder::crc16(const uint8_t *data, size_t size)
+{
+    uint16_t crc= 0xFFFF;
+    while(size-- > 0) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; ++i) {
+            crc= (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+// reads a zigzag LEB128 varint, returns false if it runs past the end
+static bool read_varint(const uint8_t *&p, const uint8_t *end, int32_t &value)
+{
+    uint32_t v= 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if(p >= end) return false;
+        uint8_t b= *p++;
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if(!(b & 0x80)) {
+            value= (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *MoveFrameDecoder::decode(const uint8_t *frame, size_t size)
+{
+    if(size < 4 || frame[0] != MOVE_FRAME_SYNC) return "bad move frame";
+
+    size_t length= frame[1];
+    if(length == 0 || length > MOVE_FRAME_MAX_PAYLOAD || size != length + 4) return "bad move frame length";
+
+    uint16_t crc= frame[length + 2] | (frame[length + 3] << 8);
+    if(crc != crc16(frame + 1, length + 1)) return "move frame checksum mismatch";
+
+    const uint8_t *p= frame + 2;
+    const uint8_t *end= p + length;
+    while(p < end) {
+        uint8_t header= *p++;
+        if((header & 0x3F) == 0) return "empty move in frame";
+
+        float xyz[3] {NAN, NAN, NAN};
+        for (int i = 0; i < 3; ++i) {
+            if(!(header & (1 << i))) continue;
+            int32_t v;
+            if(!read_varint(p, end, v)) return "truncated move frame";
+            position[i]= (header & 0x80) ? v : position[i] + v;
+            xyz[i]= (float)position[i] / MOVE_FRAME_UNITS_PER_MM;
+        }
+
+        float e= NAN, f= NAN;
+        int32_t v;
+        if(header & 0x08) {
+            if(!read_varint(p, end, v)) return "truncated move frame";
+            e= (float)v / MOVE_FRAME_UNITS_PER_MM;
+        }
+        if(header & 0x10) {
+            if(!read_varint(p, end, v)) return "truncated move frame";
+            f= (float)v / MOVE_FRAME_F_PER_MM_MIN;
+        }
+        if(header & 0x20) {
+            if(!read_varint(p, end, v)) return "truncated move frame";
+            THEROBOT->set_s_value((float)v / MOVE_FRAME_S_SCALE);
+        }
+
+        const char *error= THEROBOT->append_frame_move(xyz, e, f, header & 0x40);
+        if(error != nullptr) return error;
+        ++moves;
+
+        if(THEKERNEL->is_halted()) break;
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,89 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+    Binary move frames, a compact alternative to G0/G1 lines for jobs made of many short segments.
+    A host that opts in sends frames in place of lines, text lines can still be sent between frames.
+
+    frame:  0xFE, length, payload (length bytes), crc16 of length and payload (CCITT 0x1021 init 0xFFFF, low byte first)
+    The 0xFE is only a frame when it is the first byte of a line, it is never valid in UTF-8 text.
+    The payload is a sequence of moves, each is a header byte followed by a varint for each field it has:
+
+    bit 0-2  X, Y, Z in 1/10000 mm, the change from the previous position or the position if bit 7 is set
+    bit 3    E in 1/10000 mm, always relative
+    bit 4    F in 1/100 mm/min
+    bit 5    S in 1/1000
+    bit 6    G0, otherwise it is a G1
+    bit 7    XYZ are positions in the current WCS, the host sets this on the first move after a text line
+
+    varints are LEB128 of the zigzag encoded value, coordinates are always millimeters.
+    Each frame is answered with an ok, or an error and HALT if it is corrupt, or sent while G91 or G20 is active as
+    the moves are absolute millimeters whatever the gcode mode is.
+*/
+
+#define MOVE_FRAME_SYNC             0xFE
+#define MOVE_FRAME_MAX_PAYLOAD      120
+#define MOVE_FRAME_UNITS_PER_MM     10000
+#define MOVE_FRAME_F_PER_MM_MIN     100
+#define MOVE_FRAME_S_SCALE          1000
+
+// tells the bytes of a frame apart from text as they are received, this runs in the receive interrupt so a byte
+// that is part of a frame is queued as is and never taken as a control character like ? or ^X
+class MoveFrameTracker {
+    public:
+        enum { TEXT, FRAME, FRAME_END };
+
+        MoveFrameTracker() { reset(); }
+        void reset() { remaining= 0; need_length= false; line_start= true; }
+
+        uint8_t feed(uint8_t c)
+        {
+            if(need_length) {
+                need_length= false;
+                remaining= c + 2; // payload and crc
+                return FRAME;
+            }
+            if(remaining > 0) {
+                if(--remaining > 0) return FRAME;
+                line_start= true;
+                return FRAME_END;
+            }
+            if(line_start && c == MOVE_FRAME_SYNC) {
+                need_length= true;
+                return FRAME;
+            }
+            line_start= (c == '\n' || c == '\r');
+            return TEXT;
+        }
+
+    private:
+        uint16_t remaining;
+        bool need_length;
+        bool line_start;
+};
+
+// decodes a frame into Robot moves, it remembers the position the host sent last as the moves are deltas from it
+class MoveFrameDecoder {
+    public:
+        MoveFrameDecoder();
+
+        // the frame from the sync byte to the crc, returns nullptr or why the frame was not executed
+        const char *decode(const uint8_t *frame, size_t size);
+
+        static uint16_t crc16(const uint8_t *data, size_t size);
+
+        uint32_t get_moves() const { return moves; }
+
+    private:
+        int32_t position[3];
+        uint32_t moves;
+};
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <string>
 #include "Block.h"
+#include "SCurve.h"
 #include "Planner.h"
 #include "Conveyor.h"
 #include "Gcode.h"
@@ -26,7 +27,12 @@ using std::string;
 #define STEP_TICKER_FREQUENCY THEKERNEL->step_ticker->get_frequency()
 
 uint8_t Block::n_actuators= 0;
+#ifdef STEPTICKER_FIXED32
+float Block::inv_frequency= 0;
+float Block::inv_frequency_2= 0;
+#else
 double Block::fp_scale= 0;
+#endif
 
 // A block represents a movement, it's length for each stepper motor, and the corresponding acceleration curves.
 // It's stacked on a queue, and that queue is then executed in order, to move the motors.
@@ -35,14 +41,22 @@ double Block::fp_scale= 0;
 
 Block::Block()
 {
+#ifndef STEPTICKER_FIXED32
     tick_info= nullptr;
+#endif
+    arc= nullptr;
     clear();
 }
 
 void Block::init(uint8_t n)
 {
     n_actuators= n;
+#ifdef STEPTICKER_FIXED32
+    inv_frequency= 1.0F / STEP_TICKER_FREQUENCY;
+    inv_frequency_2= inv_frequency * inv_frequency;
+#else
     fp_scale= (double)STEPTICKER_FPSCALE / pow((double)STEP_TICKER_FREQUENCY, 2.0); // we scale up by fixed point offset first to avoid tiny values
+#endif
 }
 
 void Block::clear()
@@ -58,6 +72,7 @@ void Block::clear()
     entry_speed         = 0.0F;
     exit_speed          = 0.0F;
     acceleration        = 100.0F; // we don't want to get divide by zeroes if this is not set
+    jerk                = 0.0F;
     initial_rate        = 0.0F;
     accelerate_until    = 0;
     decelerate_after    = 0;
@@ -68,9 +83,35 @@ void Block::clear()
     is_ticking          = false;
     is_g123             = false;
     locked              = false;
+    decel_tail          = false;
+    is_arc              = false;
     s_value             = 0.0F;
+    raster_start        = 0;
+    raster_pixels       = 0;
+    laser_rate_scale    = 0;
 
     total_move_ticks= 0;
+    decel_offset= 0;
+    carry_scale= 0;
+
+#ifdef STEPTICKER_FIXED32
+    rate_info.initial_rate= 0;
+    rate_info.initial_rate_frac= 0;
+    rate_info.acceleration= 0;
+    rate_info.acceleration_frac= 0;
+    rate_info.deceleration= 0;
+    rate_info.deceleration_frac= 0;
+    rate_info.initial_accel= 0;
+    rate_info.initial_accel_frac= 0;
+    rate_info.plateau_rate= 0;
+    jerk_signs= 0;
+    jerk_segments= 0;
+    entry_acceleration= 0;
+
+    for(int i = 0; i < n_actuators; ++i) {
+        tick_info[i].rate_scale= 0;
+    }
+#else
     if(tick_info == nullptr) {
         // we create this once for this block
         tick_info= new tickinfo_t[n_actuators]; //(tickinfo_t *)malloc(sizeof(tickinfo_t) * n_actuators);
@@ -82,23 +123,12 @@ void Block::clear()
 
     for(int i = 0; i < n_actuators; ++i) {
         tick_info[i].steps_per_tick= 0;
-        tick_info[i].counter= 0;
         tick_info[i].acceleration_change= 0;
         tick_info[i].deceleration_change= 0;
         tick_info[i].plateau_rate= 0;
-        tick_info[i].steps_to_move= 0;
-        tick_info[i].step_count= 0;
-        tick_info[i].next_accel_event= 0;
-    }
-}
-
-// Only used for continuous mode to reuse the same block over and over
-void Block::reset(tickinfo_t *saved)
-{
-    for(int i = 0; i < n_actuators; ++i) {
-        if(saved[i].steps_to_move == 0) continue;
-        tick_info[i]= saved[i];
+        tick_info[i].rate_scale= 0;
     }
+#endif
 }
 
 void Block::debug() const
@@ -148,6 +178,23 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
 
     float initial_rate = this->nominal_rate * (entryspeed / this->nominal_speed); // steps/sec
     float final_rate = this->nominal_rate * (exitspeed / this->nominal_speed);
+
+    // nothing changed since it was last calculated, this is common as the planner walks blocks that are cruising
+    if(this->total_move_ticks > 0 && initial_rate == this->initial_rate && exitspeed == this->exit_speed) {
+        this->decel_tail= false;
+        return;
+    }
+
+#ifdef STEPTICKER_FIXED32
+    if(this->jerk > 0.0F) {
+        // jerk limited, on its own the block starts and ends with no acceleration (see Planner::recalculate_s_curve())
+        SCurve curve;
+        curve.plan(entryspeed, 0.0F, exitspeed, this->nominal_speed, this->millimeters, this->acceleration, this->jerk);
+        calculate_s_curve(curve, 0.0F);
+        return;
+    }
+#endif
+
     //printf("Initial rate: %f, final_rate: %f\n", initial_rate, final_rate);
     // How many steps ( can be fractions of steps, we need very precise values ) to accelerate and decelerate
     // This is a simplification to get rid of rate_delta and get the steps/s² accel directly from the mm/s² accel
@@ -162,6 +209,10 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     // allowed to achieve
     this->maximum_rate = std::min(maximum_possible_rate, this->nominal_rate);
 
+    // a block that only just decelerates from its entry to its exit can have the rounding put the maximum under the
+    // initial rate, the accelerate ticks would then underflow and it would hold the entry rate to the end
+    this->maximum_rate = std::max(this->maximum_rate, std::max(initial_rate, final_rate));
+
     // Now figure out how long it takes to accelerate in seconds
     float time_to_accelerate = ( this->maximum_rate - initial_rate ) / acceleration_per_second;
 
@@ -230,14 +281,21 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     // prepare the block for stepticker
     this->prepare(acceleration_in_steps, deceleration_in_steps);
 
+    // the entry speed is planned now
+    this->decel_tail= false;
+
     this->locked= false;
 }
 
 // Calculates the maximum allowable speed at this point when you must be able to reach target_velocity using the
 // acceleration within the allotted distance.
-float Block::max_allowable_speed(float acceleration, float target_velocity, float distance)
+float Block::max_allowable_speed(float acceleration, float target_velocity, float distance) const
 {
-    return sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance);
+    if(this->jerk <= 0.0F) {
+        return sqrtf(target_velocity * target_velocity - 2.0F * acceleration * distance);
+    }
+
+    return SCurve::max_entry_speed(target_velocity, distance, fabsf(acceleration), this->jerk);
 }
 
 // Called by Planner::recalculate() when scanning the plan from last to first entry.
@@ -284,6 +342,7 @@ float Block::forward_pass(float prev_max_exit_speed)
         // since we're now acceleration or cruise limited
         // we don't need to recalculate our entry speed anymore
         recalculate_flag = false;
+
     }
     // else
     // // decel limited, do nothing
@@ -310,6 +369,120 @@ float Block::max_exit_speed()
     return min(max, nominal_speed);
 }
 
+#ifdef STEPTICKER_FIXED32
+
+// convert steps/tick to 0.64 fixed point, saturates at one step per tick
+static uint64_t to_fixed_rate(float v)
+{
+    if(v >= 1.0F) return 0xFFFFFFFFFFFFFFFFULL;
+    if(v <= 0.0F) return 0;
+    return (uint64_t)(v * 18446744073709551616.0F); // * 2^64
+}
+
+// the 0.32 fixed point rate plus a 0.32 fraction, for the rates that are added to every tick
+static void to_fixed_rate(float v, uint32_t& rate, uint32_t& frac)
+{
+    uint64_t f= to_fixed_rate(v);
+    rate= f >> 32;
+    frac= f & 0xFFFFFFFF;
+}
+
+// prepare block for the step ticker, called everytime the block changes
+// this is done during planning so does not delay tick generation and step ticker can simply grab the next block during the interrupt
+// only the primary axis rate schedule is needed, each motor gets its ratio of the primary axis steps
+// no doubles are needed as the fraction keeps the small per tick acceleration values exact enough
+void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
+{
+    to_fixed_rate(this->initial_rate * inv_frequency, rate_info.initial_rate, rate_info.initial_rate_frac);
+    to_fixed_rate(acceleration_in_steps * inv_frequency_2, rate_info.acceleration, rate_info.acceleration_frac);
+    to_fixed_rate(deceleration_in_steps * inv_frequency_2, rate_info.deceleration, rate_info.deceleration_frac);
+    // the plateau rate is only ever set, never accumulated, so it has no fraction
+    rate_info.plateau_rate= to_fixed_rate(this->maximum_rate * inv_frequency) >> 32;
+
+    for (uint8_t m = 0; m < n_actuators; m++) {
+        uint32_t steps = this->steps[m];
+        if(steps == 0) continue;
+
+        uint64_t scale = ((uint64_t)steps << 32) / this->steps_event_count;
+        this->tick_info[m].rate_scale = scale > 0xFFFFFFFF ? 0xFFFFFFFF : scale;
+    }
+}
+
+/* Takes the part of an s-curve profile from start to start + millimeters for this block. The step ticker carries on
+// from the speed and acceleration the profile has at the start of the block and applies the jerk of each piece of the
+// profile that falls on the block until the tick it ends at, then holds the exit rate until the steps are done
+//              ___________
+//            /             \  <- one profile planned over a run of blocks, the acceleration carries on from block
+//   ________/               \_   to block and only goes back to zero where a junction limits the speed
+//          |   |   |   |   |
+//                time -->
+*/
+void Block::calculate_s_curve(const SCurve& curve, float start)
+{
+    // if block is currently executing, don't touch anything!
+    if (is_ticking) return;
+
+    uint8_t p0, p1;
+    float t0, t1, v0, a0, v1, a1;
+    curve.locate(start, p0, t0);
+    curve.locate(start + this->millimeters, p1, t1);
+    curve.get_state(p0, t0, v0, a0);
+    curve.get_state(p1, t1, v1, a1);
+
+    // the tick each piece ends at, a piece that rounds to no ticks is dropped
+    uint32_t until[7];
+    uint16_t signs= 0;
+    uint8_t n= 0;
+    float time= 0.0F;
+    for (uint8_t p = p0; p <= p1 && curve.n_pieces > 0; ++p) {
+        time += (p == p1 ? t1 : curve.pieces[p].t) - (p == p0 ? t0 : 0.0F);
+        uint32_t tick= roundf(time * STEP_TICKER_FREQUENCY);
+        if(tick == 0 || (n > 0 && tick <= until[n - 1])) continue;
+        const SCurve::piece_t& piece= curve.pieces[p];
+        signs |= (piece.j > 0.0F ? 1 : piece.j < 0.0F ? 2 : piece.a == 0.0F ? 3 : 0) << (2 * n);
+        until[n++]= tick;
+    }
+    if(n == 0) {
+        until[0]= 1;
+        n= 1;
+    }
+
+    float steps_per_mm= this->steps_event_count / this->millimeters;
+    // we have a potential race condition here as we could get interrupted anywhere in the middle of this call, we need to lock
+    // the updates to the blocks to get around it
+    this->locked= true;
+
+    this->entry_speed= v0;
+    this->entry_acceleration= a0;
+    this->exit_speed= v1;
+    this->initial_rate= v0 * steps_per_mm;
+    this->maximum_rate= v1 * steps_per_mm; // the step ticker holds the exit rate once the schedule is done
+
+    this->total_move_ticks= until[n - 1];
+    this->accelerate_until= 0;
+    this->decelerate_after= this->total_move_ticks;
+    for (uint8_t i = 0; i < n; i++) {
+        this->jerk_until[i]= until[i];
+    }
+    this->jerk_signs= signs;
+    this->jerk_segments= n;
+
+    // the jerk in steps/sec³ goes where the acceleration of a trapezoid does
+    this->prepare(this->jerk * steps_per_mm * inv_frequency, 0.0F);
+
+    uint64_t accel= to_fixed_rate(fabsf(a0) * steps_per_mm * inv_frequency_2);
+    if(a0 < 0.0F) accel= -accel;
+    rate_info.initial_accel= accel >> 32;
+    rate_info.initial_accel_frac= accel & 0xFFFFFFFF;
+
+    // the entry speed is planned now
+    this->decel_tail= false;
+
+    this->locked= false;
+}
+
+#else
+
 // prepare block for the step ticker, called everytime the block changes
 // this is done during planning so does not delay tick generation and step ticker can simply grab the next block during the interrupt
 void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
@@ -327,35 +500,20 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
 
     for (uint8_t m = 0; m < n_actuators; m++) {
         uint32_t steps = this->steps[m];
-        this->tick_info[m].steps_to_move = steps;
         if(steps == 0) continue;
 
         float aratio = inv * steps;
 
         this->tick_info[m].steps_per_tick = (int64_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE); // steps/sec / tick frequency to get steps per tick in 2.62 fixed point
-        this->tick_info[m].counter = 0; // 2.62 fixed point
-        this->tick_info[m].step_count = 0;
-        this->tick_info[m].next_accel_event = this->total_move_ticks + 1;
-
-        double acceleration_change = 0;
-        if(this->accelerate_until != 0) { // If the next accel event is the end of accel
-            this->tick_info[m].next_accel_event = this->accelerate_until;
-            acceleration_change = acceleration_per_tick;
-
-        } else if(this->decelerate_after == 0 /*&& this->accelerate_until == 0*/) {
-            // we start off decelerating
-            acceleration_change = -deceleration_per_tick;
-
-        } else if(this->decelerate_after != this->total_move_ticks /*&& this->accelerate_until == 0*/) {
-            // If the next event is the start of decel ( don't set this if the next accel event is accel end )
-            this->tick_info[m].next_accel_event = this->decelerate_after;
-        }
 
-        // already converted to fixed point just needs scaling by ratio
+        // already converted to fixed point just needs scaling by ratio, the step ticker starts with whichever of these
+        // the block starts with (see StepTicker::start_next_block())
         //#define STEPTICKER_TOFP(x) ((int64_t)round((double)(x)*STEPTICKER_FPSCALE))
-        this->tick_info[m].acceleration_change= (int64_t)round(acceleration_change * aratio);
+        this->tick_info[m].acceleration_change= (int64_t)round(acceleration_per_tick * aratio);
         this->tick_info[m].deceleration_change= -(int64_t)round(deceleration_per_tick * aratio);
         this->tick_info[m].plateau_rate= (int64_t)round(((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        uint64_t scale = ((uint64_t)steps << 32) / this->steps_event_count;
+        this->tick_info[m].rate_scale = scale > 0xFFFFFFFF ? 0xFFFFFFFF : scale;
 
         #if 0
         THEKERNEL->streams->printf("spt: %08lX %08lX, ac: %08lX %08lX, dc: %08lX %08lX, pr: %08lX %08lX\n",
@@ -372,10 +530,27 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
     }
 }
 
+#endif
+
 // returns current rate (steps/sec) for the given actuator
 float Block::get_trapezoid_rate(int i) const
 {
-    // convert steps per tick from fixed point to float and convert to steps/sec
-    // FIXME steps_per_tick can change at any time, potential race condition if it changes while being read here
-    return STEPTICKER_FROMFP(tick_info[i].steps_per_tick) * STEP_TICKER_FREQUENCY;
+    // the rate is only tracked for the primary axis of the executing block
+    const StepTicker *st= THEKERNEL->step_ticker;
+    if(st->get_current_block() != this || this->steps_event_count == 0) return 0;
+    return st->get_current_rate() * STEP_TICKER_FREQUENCY * ((float)this->steps[i] / this->steps_event_count);
+}
+
+// the primary axis rate in steps/tick the step ticker started this block at, for a decel_tail block it is the rate
+// the previous block ended at (see StepTicker::start_next_block())
+float Block::get_started_rate() const
+{
+#ifdef STEPTICKER_FIXED32
+    return STEPTICKER_FROMFP(rate_info.initial_rate);
+#else
+    for (uint8_t m = 0; m < n_actuators; m++) {
+        if(this->steps[m] == this->steps_event_count) return STEPTICKER_FROMFP(tick_info[m].steps_per_tick);
+    }
+    return 0;
+#endif
 }
@@ -10,6 +10,8 @@
 #include <bitset>
 #include "ActuatorCoordinates.h"
 
+class SCurve;
+
 class Block {
     public:
         Block();
@@ -17,6 +19,7 @@ class Block {
         static void init(uint8_t);
 
         void calculate_trapezoid( float entry_speed, float exit_speed );
+        void calculate_s_curve( const SCurve& curve, float start );
 
         float reverse_pass(float exit_speed);
         float forward_pass(float next_entry_speed);
@@ -25,12 +28,18 @@ class Block {
         void ready() { is_ready= true; }
         void clear();
         float get_trapezoid_rate(int i) const;
+        float get_started_rate() const;
+        float max_allowable_speed( float acceleration, float target_velocity, float distance) const;
 
     private:
-        float max_allowable_speed( float acceleration, float target_velocity, float distance);
         void prepare(float acceleration_in_steps, float deceleration_in_steps);
 
+#ifdef STEPTICKER_FIXED32
+        static float inv_frequency; // optimize to store these as they do not change
+        static float inv_frequency_2;
+#else
         static double fp_scale; // optimize to store this as it does not change
+#endif
 
     public:
         std::array<uint32_t, k_max_actuators> steps; // Number of steps for each axis for this block
@@ -41,6 +50,7 @@ class Block {
         float entry_speed;
         float exit_speed;
         float acceleration;       // the acceleration for this block
+        float jerk;               // the jerk for this block in mm/s³, 0 is a trapezoid
         float initial_rate;       // Initial rate in steps per second
         float maximum_rate;
 
@@ -52,21 +62,71 @@ class Block {
         uint32_t total_move_ticks;
         std::bitset<k_max_actuators> direction_bits;     // Direction for each axis in bit form, relative to the direction port's mask
 
-        // this is the data needed to determine when each motor needs to be issued a step
+#ifdef STEPTICKER_FIXED32
+        // the acceleration schedule of the primary axis, the step ticker generates the primary axis rate from this
+        // and each motor steps at its share of it. 0.32 fixed point steps/tick with a 0.32 fraction of that
+        struct {
+            uint32_t initial_rate;
+            uint32_t initial_rate_frac;
+            uint32_t acceleration;      // rate added every tick while accelerating, or the jerk for an s-curve
+            uint32_t acceleration_frac;
+            uint32_t deceleration;      // rate subtracted every tick while decelerating
+            uint32_t deceleration_frac;
+            uint32_t initial_accel;     // s-curve, the acceleration at the start, signed (two's complement)
+            uint32_t initial_accel_frac;
+            uint32_t plateau_rate;      // or the exit rate for an s-curve
+        } rate_info;
+
+        // s-curve, the jerk changes at the tick each segment ends at. Bits 2i and 2i+1 of jerk_signs are the jerk of
+        // segment i, 1 adds the jerk to the acceleration every tick, 2 subtracts it, 0 holds the acceleration and 3 cruises
+        // with none, which also drops what rounding the ramps to whole ticks left of it
+        uint32_t jerk_until[7];
+        uint16_t jerk_signs;
+        uint8_t jerk_segments;
+
+        float entry_acceleration;       // planner, s-curve acceleration in mm/s² at the start of the block
+
+        // this is the data needed to determine when each motor needs to be issued a step, the step counters are kept
+        // in the step ticker as only the executing block needs them
+        using tickinfo_t= struct {
+            uint32_t rate_scale; // 0.32 fixed point steps of this motor per primary axis step
+        };
+#else
+        // this is the data needed to determine when each motor needs to be issued a step, the step counters and the
+        // rate as it changes are kept in the step ticker as only the executing block needs them
         using tickinfo_t= struct {
-            int64_t steps_per_tick; // 2.62 fixed point
-            int64_t counter; // 2.62 fixed point
-            int64_t acceleration_change; // 2.62 fixed point signed
-            int64_t deceleration_change; // 2.62 fixed point
+            int64_t steps_per_tick; // 2.62 fixed point, at the start of the block
+            int64_t acceleration_change; // 2.62 fixed point, added every tick until accelerate_until
+            int64_t deceleration_change; // 2.62 fixed point signed, added every tick from decelerate_after
             int64_t plateau_rate; // 2.62 fixed point
-            uint32_t steps_to_move;
-            uint32_t step_count;
-            uint32_t next_accel_event;
+            uint32_t rate_scale; // 0.32 fixed point steps of this motor per primary axis step, for a decel_tail block
         };
-        void reset(tickinfo_t *saved);
+#endif
+
+        float decel_offset;             // planner, the deceleration tail sum when this block was added (see Planner::recalculate_decel_tail())
+        uint32_t carry_scale;           // 16.16 fixed point primary axis steps per mm of this block over the previous ones
 
+#ifdef STEPTICKER_FIXED32
+        // held in the block so each block is a single small allocation
+        std::array<tickinfo_t, k_max_actuators> tick_info;
+#else
         // need info for each active motor
         tickinfo_t *tick_info;
+#endif
+
+        // an arc run as one block (see Robot::append_arc()). Those of the first three actuators that it moves around
+        // the arc are stepped to c + a * cos(phase) + b * sin(phase) steps from where they started, the others step as
+        // for a line. The first of them ticks the steps of the path, each one moves the phase on by phase_step
+        using arc_t= struct {
+            int32_t a[3];           // 24.8 fixed point steps
+            int32_t b[3];
+            int32_t c[3];
+            int32_t end[3];         // steps from where it started to where it ends, set by the planner
+            uint64_t phase_step;    // 2^64 is a turn
+            uint32_t path_steps;
+            uint8_t motors;         // bitmask of the actuators moved around the arc
+        };
+        arc_t *arc;                 // created the first time this block is an arc
 
         static uint8_t n_actuators;
 
@@ -78,6 +138,18 @@ class Block {
             bool is_g123:1;                      // set if this is a G1, G2 or G3
             volatile bool is_ticking:1;          // set when this block is being actively ticked by the stepticker
             volatile bool locked:1;              // set to true when the critical data is being updated, stepticker will have to skip if this is set
+            bool decel_tail:1;                   // entry speed not planned yet, stepticker decelerates on from where the previous block ended
+            bool is_arc:1;                       // the actuators in arc->motors are moved around an arc
             uint16_t s_value:12;                 // for laser 1.11 Fixed point
         };
+
+        // for a laser raster, the pixels the power is scaled by along the primary axis, where they start in the
+        // lasers pixel buffer and how many
+        uint16_t raster_start;
+        uint16_t raster_pixels;
+
+        // for a laser that follows the speed, 2^16 steps per tick over the nominal rate, so a primary axis rate in 0.32
+        // fixed point steps per tick times this over 2^32 is its 16.16 fixed point fraction of the nominal rate. 0 if
+        // there is no nominal rate
+        uint32_t laser_rate_scale;
 };
@@ -20,10 +20,27 @@ BlockQueue::BlockQueue(unsigned int length)
 {
     head_i = tail_i = 0;
     isr_tail_i = tail_i;
-    void *v= AHB0.alloc(sizeof(Block) * length);
-    ring = new(v) Block[length];
-    // TODO: handle allocation failure
-    this->length = length;
+    ring = allocate(length);
+    this->length = ring != nullptr ? length : 0;
+}
+
+/*
+ * the ring is allocated in AHB0, if it does not fit there it goes in AHB1 so a large queue can be configured.
+ * The index ring follows the blocks in the same allocation
+ */
+Block* BlockQueue::allocate(unsigned int length)
+{
+    size_t size= (sizeof(Block) + sizeof(uint16_t)) * length;
+    void *v= AHB0.alloc(size);
+    if(v == nullptr) v= AHB1.alloc(size);
+    if(v == nullptr) return nullptr;
+    return new(v) Block[length];
+}
+
+void BlockQueue::deallocate(Block* r)
+{
+    if(AHB0.has(r)) AHB0.dealloc(r);
+    else AHB1.dealloc(r);
 }
 
 /*
@@ -35,7 +52,7 @@ BlockQueue::~BlockQueue()
     head_i = tail_i = length = 0;
     isr_tail_i = tail_i;
     if(ring != nullptr)
-        AHB0.dealloc(ring); // delete [] ring;
+        deallocate(ring); // delete [] ring;
     ring = nullptr;
 }
 
@@ -65,6 +82,11 @@ unsigned int BlockQueue::prev(unsigned int item) const
         return (item - 1);
 }
 
+uint16_t* BlockQueue::index_ring() const
+{
+    return reinterpret_cast<uint16_t*>(ring + length);
+}
+
 /*
  * reference accessors
  */
@@ -156,7 +178,7 @@ bool BlockQueue::resize(unsigned int length)
                 __enable_irq();
 
                 if (ring != nullptr)
-                    AHB0.dealloc(ring); // delete [] ring;
+                    deallocate(ring); // delete [] ring;
                 ring = nullptr;
 
                 return true;
@@ -168,8 +190,7 @@ bool BlockQueue::resize(unsigned int length)
         }
 
         // Note: we don't use realloc so we can fall back to the existing ring if allocation fails
-        void *v= AHB0.alloc(sizeof(Block) * length);
-        Block* newring = new(v) Block[length];
+        Block* newring = allocate(length);
 
         if (newring != nullptr)
         {
@@ -186,14 +207,14 @@ bool BlockQueue::resize(unsigned int length)
                 __enable_irq();
 
                 if (oldring != nullptr)
-                    AHB0.dealloc(oldring); // delete [] oldring;
+                    deallocate(oldring); // delete [] oldring;
 
                 return true;
             }
 
             __enable_irq();
 
-            AHB0.dealloc(newring); // delete [] newring;
+            deallocate(newring); // delete [] newring;
         }
     }
 
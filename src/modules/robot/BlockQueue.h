@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 class Block;
 
 class BlockQueue {
@@ -53,6 +55,9 @@ protected:
     unsigned int next(unsigned int) const;
     unsigned int prev(unsigned int) const;
 
+    // one block index per slot, allocated after the ring for the planner (see Planner::push_candidate())
+    uint16_t* index_ring() const;
+
     /*
      * buffer variables
      */
@@ -63,5 +68,8 @@ protected:
     volatile unsigned int isr_tail_i;
 
 private:
+    static Block* allocate(unsigned int);
+    static void deallocate(Block*);
+
     Block* ring;
 };
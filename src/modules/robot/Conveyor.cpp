@@ -65,6 +65,7 @@ Conveyor::Conveyor()
     flush= false;
     continuous_mode = 0;
     hold_queue= false;
+    fetched= false;
 }
 
 void Conveyor::on_module_loaded()
@@ -82,7 +83,11 @@ void Conveyor::on_module_loaded()
 void Conveyor::start(uint8_t n)
 {
     Block::init(n); // set the number of motors which determines how big the tick info vector is
-    queue.resize(queue_size);
+    if(!queue.resize(queue_size)) {
+        THEKERNEL->streams->printf("ERROR: planner_queue_size %u does not fit in AHB0 or AHB1, using 32\n", (unsigned)queue_size);
+        queue_size= 32;
+        queue.resize(queue_size);
+    }
     running = true;
 }
 
@@ -102,8 +107,9 @@ void Conveyor::on_idle(void*)
         check_queue();
     }
 
-    // we can garbage collect the block queue here
-    if (queue.tail_i != queue.isr_tail_i) {
+    // we can garbage collect the block queue here, all the blocks finished since the last time so a main loop that
+    // feeds several lines (eg Player) finds room for all of them
+    while (queue.tail_i != queue.isr_tail_i) {
         if (queue.is_empty()) {
             __debugbreak();
         } else {
@@ -203,25 +209,12 @@ bool Conveyor::set_continuous_mode(bool f)
     if(f) {
         if(queue.is_empty() || !hold_queue) return false;
 
-        // copy the tickinfo of the second block on the queue
-        auto n_actuators= THEROBOT->get_number_registered_motors();
-        Block* b= queue.item_ref(queue.next(queue.tail_i));
-        Block::tickinfo_t *saved= new Block::tickinfo_t[n_actuators];
-        if(saved == nullptr) return false;
-        for(int i = 0; i < n_actuators; ++i) {
-            saved[i]= b->tick_info[i];
-        }
-
-        saved_block= saved;
+        // the step ticker keeps the step counters of the block, so the second block on the queue can be run again as
+        // it is
         continuous_mode= 1;
 
     }else{
         continuous_mode= 0;
-        if(saved_block != nullptr) {
-            Block::tickinfo_t *saved= static_cast<Block::tickinfo_t *>(saved_block);
-            delete [] saved;
-            saved_block= nullptr;
-        }
     }
     return true;
 }
@@ -245,13 +238,18 @@ bool Conveyor::get_next_block(Block **block)
     // default the feedrate to zero if there is no block available
     this->current_feedrate= 0;
 
-    if(THEKERNEL->is_halted() || queue.isr_tail_i == queue.head_i) return false; // we do not have anything to give
+    if(THEKERNEL->is_halted() || queue.isr_tail_i == queue.head_i) {
+        // we do not have anything to give, count it once each time the queue runs dry after handing out blocks
+        if(fetched) {
+            fetched= false;
+            ++queue_empty_count;
+        }
+        return false;
+    }
 
     if(continuous_mode > 1){
         // keep feeding the second in the queue
         Block *b= queue.item_ref(queue.isr_tail_i);
-        // reset variable parts of the block
-        b->reset(static_cast<Block::tickinfo_t*>(saved_block));
         b->is_ticking= true;
         b->recalculate_flag= false;
         this->current_feedrate= b->nominal_speed;
@@ -271,6 +269,7 @@ bool Conveyor::get_next_block(Block **block)
         b->recalculate_flag= false;
         this->current_feedrate= b->nominal_speed;
         *block= b;
+        fetched= true;
         return true;
     }
 
@@ -304,6 +303,23 @@ void Conveyor::flush_queue()
 }
 
 // Debug function
+float Conveyor::get_queued_millimeters()
+{
+    float mm = 0;
+    for (unsigned int index = queue.isr_tail_i; index != queue.head_i; index = queue.next(index)) {
+        mm += queue.item_ref(index)->millimeters;
+    }
+    return mm;
+}
+
+const Block *Conveyor::get_queued_block(unsigned int n)
+{
+    for (unsigned int index = queue.tail_i; index != queue.head_i; index = queue.next(index)) {
+        if(n-- == 0) return queue.item_ref(index);
+    }
+    return nullptr;
+}
+
 void Conveyor::dump_queue()
 {
     int i = 0;
@@ -37,6 +37,14 @@ public:
     void force_queue() { check_queue(true); }
     bool set_continuous_mode(bool f);
     void set_hold(bool f) { hold_queue= f; }
+    // times the step ticker finished a block and found the queue empty, each one is a stop the gcode did not ask for
+    // unless the queue was meant to drain (end of a job, M400, G4...)
+    uint32_t get_queue_empty_count() const { return queue_empty_count; }
+    // the length of the moves from the one being stepped to the last one queued, the planner can only reach a speed it
+    // can stop from within this
+    float get_queued_millimeters();
+    // the nth block from the oldest one still queued, nullptr past the newest, for debugging and the unit tests
+    const Block *get_queued_block(unsigned int n);
 
     friend class Planner; // for queue
 
@@ -46,11 +54,11 @@ private:
 
     using  Queue_t= BlockQueue;
     Queue_t queue;  // Queue of Blocks
-    void *saved_block;
 
     uint32_t queue_delay_time_ms;
     size_t queue_size;
     float current_feedrate{0}; // actual nominal feedrate that current block is running at in mm/sec
+    volatile uint32_t queue_empty_count{0};
 
     volatile struct {
         volatile bool running:1;
@@ -58,6 +66,7 @@ private:
         volatile bool flush:1;
         volatile bool hold_queue:1;
         volatile uint8_t continuous_mode:2;
+        volatile bool fetched:1;           // the last get_next_block() handed out a block
     };
 
 };
@@ -14,6 +14,7 @@ using namespace std;
 #include "Module.h"
 #include "Kernel.h"
 #include "Block.h"
+#include "SCurve.h"
 #include "Planner.h"
 #include "Conveyor.h"
 #include "StepperMotor.h"
@@ -21,6 +22,8 @@ using namespace std;
 #include "checksumm.h"
 #include "Robot.h"
 #include "ConfigValue.h"
+#include "StepTicker.h"
+#include "fixed_sine.h"
 
 #include <math.h>
 #include <algorithm>
@@ -28,6 +31,7 @@ using namespace std;
 #define junction_deviation_checksum    CHECKSUM("junction_deviation")
 #define z_junction_deviation_checksum  CHECKSUM("z_junction_deviation")
 #define minimum_planner_speed_checksum CHECKSUM("minimum_planner_speed")
+#define max_speed_change_checksum      CHECKSUM("max_speed_change")
 
 // The Planner does the acceleration math for the queue of Blocks ( movements ).
 // It makes sure the speed stays within the configured constraints ( acceleration, junction_deviation, etc )
@@ -36,6 +40,14 @@ using namespace std;
 Planner::Planner()
 {
     memset(this->previous_unit_vec, 0, sizeof this->previous_unit_vec);
+    memset(this->previous_actuator_vec, 0, sizeof this->previous_actuator_vec);
+    this->has_frontier = false;
+    this->frontier_i = 0;
+    this->decel_tail_i = 0;
+    this->decel_tail_sum = 0.0F;
+    this->candidates = nullptr;
+    this->candidates_first = 0;
+    this->candidates_count = 0;
     config_load();
 }
 
@@ -45,18 +57,23 @@ void Planner::config_load()
     this->junction_deviation = THEKERNEL->config->value(junction_deviation_checksum)->by_default(0.05F)->as_number();
     this->z_junction_deviation = THEKERNEL->config->value(z_junction_deviation_checksum)->by_default(NAN)->as_number(); // disabled by default
     this->minimum_planner_speed = THEKERNEL->config->value(minimum_planner_speed_checksum)->by_default(0.0f)->as_number();
+    this->max_speed_change = THEKERNEL->config->value(max_speed_change_checksum)->by_default(0.0f)->as_number(); // 0 uses junction deviation
 }
 
 
 // Append a block to the queue, compute it's speed factors
-bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123)
+bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float jerk, float s_value, bool g123, uint16_t raster_start, uint16_t raster_pixels, const Block::arc_t *arc, const float *exit_unit_vec)
 {
     // Create ( recycle ) a new block
     Block* block = THECONVEYOR->queue.head_ref();
 
     // Direction bits
     bool has_steps = false;
+    float actuator_vec[k_max_actuators], exit_actuator_vec[k_max_actuators];
     for (size_t i = 0; i < n_motors; i++) {
+        // how fast each actuator goes for the speed along the path
+        actuator_vec[i] = exit_actuator_vec[i] = (actuator_pos[i] - THEROBOT->actuators[i]->get_last_milestone()) / distance;
+
         int32_t steps = THEROBOT->actuators[i]->steps_to_target(actuator_pos[i]);
         // Update current position
         if(steps != 0) {
@@ -70,6 +87,34 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
         block->steps[i] = labs(steps);
     }
 
+    if(arc != nullptr) {
+        // the step ticker moves the actuators around the arc to where they end, the first of them ticks the path
+        if(block->arc == nullptr) block->arc = new Block::arc_t;
+        *block->arc = *arc;
+        for (size_t i = 0; i < 3; i++) {
+            if((arc->motors & (1 << i)) == 0) continue;
+            block->arc->end[i] = block->direction_bits[i] ? -(int32_t)block->steps[i] : block->steps[i];
+            // the way it starts off round the arc
+            block->direction_bits[i] = (arc->b[i] < 0 || (arc->b[i] == 0 && arc->a[i] > 0)) ? 1 : 0;
+            block->steps[i] = 0;
+        }
+
+        // the actuators round the arc start and end going along the tangent at phase 0 and the end phase
+        uint32_t p = (arc->phase_step * arc->path_steps) >> 32; // a full circle wraps round to 0
+        float k = (float)arc->phase_step * arc->path_steps / 18446744073709551616.0F * 6.28318531F / distance; // radians per mm of the path
+        int32_t s = fixed_sin(p), c = fixed_cos(p);
+        for (size_t i = 0; i < 3; i++) {
+            if((arc->motors & (1 << i)) == 0) continue;
+            float per_step = k / (256 * THEROBOT->actuators[i]->get_steps_per_mm());
+            actuator_vec[i] = arc->b[i] * per_step;
+            exit_actuator_vec[i] = (arc->b[i] * (c / 1073741824.0F) - arc->a[i] * (s / 1073741824.0F)) * per_step;
+        }
+        block->steps[__builtin_ctz(arc->motors)] = arc->path_steps;
+        block->is_arc = true;
+        // a full circle ends where it started
+        has_steps = true;
+    }
+
     // sometimes even though there is a detectable movement it turns out there are no steps to be had from such a small move
     if(!has_steps) {
         block->clear();
@@ -80,6 +125,8 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     // info needed by laser
     block->s_value = roundf(s_value*(1<<11)); // 1.11 fixed point
     block->is_g123 = g123;
+    block->raster_start = raster_start;
+    block->raster_pixels = raster_pixels;
 
     // use default JD
     float junction_deviation = this->junction_deviation;
@@ -107,6 +154,7 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     }
 
     block->acceleration = acceleration; // save in block
+    block->jerk = jerk; // always 0 unless built with STEPTICKER_FIXED32, see Robot::load_config()
 
     // Max number of steps, for all axes
     auto mi = std::max_element(block->steps.begin(), block->steps.end());
@@ -123,6 +171,14 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
         block->nominal_rate  = 0;
     }
 
+    // the laser scales its power by the speed from the step interrupt, the divide is done here so it does not have to.
+    // Below about 1.5 steps/s it does not fit and is held at the largest float under 2^32
+    if(g123 && block->nominal_rate > 0) {
+        block->laser_rate_scale = std::min(65536.0F * THEKERNEL->step_ticker->get_frequency() / block->nominal_rate, 4294967040.0F);
+    } else {
+        block->laser_rate_scale = 0;
+    }
+
     // Compute the acceleration rate for the trapezoid generator. Depending on the slope of the line
     // average travel per step event changes. For a line along one axis the travel per step event
     // is equal to the travel/step in the particular axis. For a 45 degree line the steppers of both
@@ -140,6 +196,7 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
 
     // NOTE however it does not take into account independent axis, in most cartesian X and Y and Z are totally independent
     // and this allows one to stop with little to no decleration in many cases. This is particualrly bad on leadscrew based systems that will skip steps.
+    // max_speed_change limits each actuator instead.
     float vmax_junction = minimum_planner_speed; // Set default max junction speed
 
     // if unit_vec was null then it was not a primary axis move so we skip the junction deviation stuff
@@ -147,7 +204,24 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
         Block *prev_block = THECONVEYOR->queue.item_ref(THECONVEYOR->queue.prev(THECONVEYOR->queue.head_i));
         float previous_nominal_speed = prev_block->primary_axis ? prev_block->nominal_speed : 0;
 
-        if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F) {
+        if (max_speed_change > 0.0F && previous_nominal_speed > 0.0F) {
+            // limit how much each actuator changes speed going from the previous block into this one instead, for
+            // the angle at the junction and the actuators own limit so the weakest axis does not set every corner.
+            // The global limit is for XYZ, the others (extruders) are only limited by one of their own
+            vmax_junction = std::min(previous_nominal_speed, block->nominal_speed);
+            for (size_t i = 0; i < n_motors; i++) {
+                float change = fabsf(actuator_vec[i] - this->previous_actuator_vec[i]);
+                float limit = THEROBOT->actuators[i]->get_max_speed_change();
+                if(isnan(limit)) {
+                    if(i > Z_AXIS) continue;
+                    limit = max_speed_change;
+                }
+                if(change * vmax_junction > limit) vmax_junction = limit / change;
+            }
+            // a reversal would stop dead, keep the floor the junction deviation has
+            vmax_junction = std::max(minimum_planner_speed, vmax_junction);
+
+        } else if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F) {
             // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
             // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
             float cos_theta = - this->previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
@@ -174,7 +248,7 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     block->max_entry_speed = vmax_junction;
 
     // Initialize block entry speed. Compute based on deceleration to user-defined minimum_planner_speed.
-    float v_allowable = max_allowable_speed(-acceleration, minimum_planner_speed, block->millimeters);
+    float v_allowable = block->max_allowable_speed(-acceleration, minimum_planner_speed, block->millimeters);
     block->entry_speed = std::min(vmax_junction, v_allowable);
 
     // Initialize planner efficiency flags
@@ -193,9 +267,12 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
 
     // Update previous path unit_vector and nominal speed
     if(unit_vec != nullptr) {
-        memcpy(previous_unit_vec, unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
+        // an arc ends going another way to how it started
+        memcpy(previous_unit_vec, exit_unit_vec != nullptr ? exit_unit_vec : unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
+        memcpy(previous_actuator_vec, exit_actuator_vec, n_motors * sizeof(float));
     } else {
         memset(previous_unit_vec, 0, sizeof(previous_unit_vec));
+        memset(previous_actuator_vec, 0, sizeof(previous_actuator_vec));
     }
 
     // Math-heavy re-computing of the whole queue to take the new
@@ -210,90 +287,447 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
 }
 
 void Planner::recalculate()
+{
+#ifdef STEPTICKER_FIXED32
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+
+    if(queue.head_ref()->jerk > 0.0F) {
+        // s-curve blocks are planned over runs of blocks, that plans the blocks in the deceleration tail as well
+        validate_decel_tail();
+        sync_decel_tail(queue.head_i);
+        recalculate_s_curve();
+
+        // everything is planned, the next trapezoid block starts a new deceleration tail
+        has_frontier = true;
+        frontier_i = queue.head_i;
+        decel_tail_i = queue.next(queue.head_i);
+        decel_tail_sum = 0.0F;
+        candidates_count = 0;
+        return;
+    }
+#endif
+
+    recalculate_decel_tail();
+}
+
+/*
+ * Incremental planning of trapezoid blocks, possible as the step generation can execute a block whose entry speed
+ * has not been planned.
+ *
+ * Any block that is not limited by its max entry speed, or by how fast the block before it can accelerate to, ends
+ * up decelerating all the way to minimum_planner_speed at the head of the queue. Those blocks are the deceleration
+ * tail and their entry speed is implied by the distance left to the head:
+ *
+ *     entry_speed² = minimum_planner_speed² + sum of 2 * acceleration * millimeters of the block and the ones after it
+ *
+ * decel_tail_sum is that sum for every block added to the tail, each block saves the sum from before it was added
+ * in decel_offset, so adding a block raises the implied entry speed of the whole tail without touching it.
+ *
+ * A tail block gets planned when its implied entry speed reaches its max entry speed, which plans the tail blocks
+ * before it too, or when the frontier (the newest planned block) can not accelerate to it. Either way a block is
+ * only planned once, so adding a block costs O(1) amortized instead of a walk back over the whole tail, which with
+ * short segments is most of the queue. The only block replanned every time is the frontier, as its exit speed is
+ * the implied entry speed of the first tail block.
+ *
+ * Tail blocks get the trapezoid of decelerating from the entry speed they were added with, if the step ticker gets
+ * to one before it is planned it decelerates on from the speed the previous block ended at instead,
+ * see StepTicker::start_next_block().
+ */
+void Planner::recalculate_decel_tail()
 {
     Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    const unsigned int end_i = queue.next(queue.head_i);
+    Block *block = queue.head_ref();
+
+    validate_decel_tail();
+
+    // add the new block to the tail
+    block->decel_offset = decel_tail_sum;
+    decel_tail_sum += 2.0F * block->acceleration * block->millimeters;
+    push_candidate(queue.head_i);
+
+    sync_decel_tail(end_i);
+
+    // find the newest block that reached its max entry speed, that and the blocks before it get planned
+    bool reached = false;
+    unsigned int index = 0;
+    while(candidates_count > 0 && decel_tail_threshold(queue.item_ref(candidates[candidates_first])) <= decel_tail_sum) {
+        index = candidates[candidates_first];
+        reached = true;
+        candidates_first = queue.next(candidates_first);
+        --candidates_count;
+    }
+
+    if(reached) {
+        Block *b = queue.item_ref(index);
+        b->entry_speed = b->max_entry_speed;
+        float entry_speed = b->entry_speed;
+        for(unsigned int i = index; i != decel_tail_i; ) {
+            i = queue.prev(i);
+            entry_speed = queue.item_ref(i)->reverse_pass(entry_speed);
+        }
+        plan_decel_tail_to(index);
+    }
+
+    // the tail blocks the frontier can not accelerate to are accel limited, they are planned from the frontier
+    while(decel_tail_i != end_i) {
+        Block *frontier = queue.item_ref(frontier_i);
+        Block *b = queue.item_ref(decel_tail_i);
+        float max_exit = std::min(frontier->max_exit_speed(), std::min(b->nominal_speed, b->max_entry_speed));
+        float entry_speed = decel_tail_entry_speed(b);
+        if(max_exit > entry_speed) break;
+
+        b->entry_speed = entry_speed;
+        plan_decel_tail_to(decel_tail_i);
+    }
+
+    // the frontier exits at the entry speed of the tail
+    Block *frontier = queue.item_ref(frontier_i);
+    frontier->calculate_trapezoid(frontier->entry_speed, decel_tail_i == end_i ? minimum_planner_speed : decel_tail_entry_speed(queue.item_ref(decel_tail_i)));
 
-    unsigned int block_index;
-
-    Block* previous;
-    Block* current;
-
-    /*
-     * a newly added block is decel limited
-     *
-     * we find its max entry speed given its exit speed
-     *
-     * for each block, walking backwards in the queue:
-     *
-     * if max entry speed == current entry speed
-     * then we can set recalculate to false, since clearly adding another block didn't allow us to enter faster
-     * and thus we don't need to check entry speed for this block any more
-     *
-     * once we find an accel limited block, we must find the max exit speed and walk the queue forwards
-     *
-     * for each block, walking forwards in the queue:
-     *
-     * given the exit speed of the previous block and our own max entry speed
-     * we can tell if we're accel or decel limited (or coasting)
-     *
-     * if prev_exit > max_entry
-     *     then we're still decel limited. update previous trapezoid with our max entry for prev exit
-     * if max_entry >= prev_exit
-     *     then we're accel limited. set recalculate to false, work out max exit speed
-     *
-     * finally, work out trapezoid for the final (and newest) block.
-     */
-
-    /*
-     * Step 1:
-     * For each block, given the exit speed and acceleration, find the maximum entry speed
-     */
-
-    float entry_speed = minimum_planner_speed;
-
-    block_index = queue.head_i;
-    current     = queue.item_ref(block_index);
-
-    if (!queue.is_empty()) {
-        while ((block_index != queue.tail_i) && current->recalculate_flag) {
-            entry_speed = current->reverse_pass(entry_speed);
-
-            block_index = queue.prev(block_index);
-            current     = queue.item_ref(block_index);
+    if(decel_tail_i == end_i) {
+        // the tail is empty, restart the sum so it stays small
+        decel_tail_sum = 0.0F;
+        return;
+    }
+
+    // the new block is in the tail, give the step ticker the deceleration to use and how to convert the rate the
+    // previous block ends at to this blocks primary axis
+    block->calculate_trapezoid(block->entry_speed, minimum_planner_speed);
+    Block *previous = queue.item_ref(queue.prev(queue.head_i));
+    float scale = (previous->millimeters * block->steps_event_count) / (block->millimeters * previous->steps_event_count);
+    block->carry_scale = scale >= 65535.0F ? 0xFFFFFFFF : (uint32_t)(scale * 65536.0F);
+    block->decel_tail = true;
+
+    if(decel_tail_sum > 1.0E6F) {
+        // a long run of short segments keeps the tail going, rebase the sums so they do not lose precision
+        float base = queue.item_ref(decel_tail_i)->decel_offset;
+        for(unsigned int i = decel_tail_i; i != end_i; i = queue.next(i)) {
+            queue.item_ref(i)->decel_offset -= base;
+        }
+        decel_tail_sum -= base;
+    }
+}
+
+#ifdef STEPTICKER_FIXED32
+// blocks planned as one s-curve profile need the same acceleration, jerk and nominal speed
+static bool same_s_curve(const Block *a, const Block *b)
+{
+    return a->jerk > 0.0F && a->jerk == b->jerk && a->acceleration == b->acceleration && a->nominal_speed == b->nominal_speed;
+}
+
+/*
+ * Planning of s-curve blocks. Ramping the acceleration up and back down at the jerk takes acceleration / jerk each,
+ * which is longer than a lot of blocks take, so rather than each block starting and ending with no acceleration a
+ * profile is planned over a run of blocks and each block gets the part of it that falls on it (see SCurve.h). The
+ * acceleration only goes back to zero at a junction where the max entry speed limits the speed.
+ *
+ * The reverse pass finds the highest speed each junction can be entered at with no acceleration and still stop at
+ * the end of the queue. A junction whose max entry speed could limit the speed, as it is lower than the trapezoid
+ * reverse pass would allow, starts over the distance that speed has to be reached within.
+ *
+ * The forward pass plans a profile from where the first block that has not been started starts, to the end of the
+ * queue or a change of acceleration, jerk or nominal speed. If that goes over the max entry speed of a junction, it is
+ * planned up to that junction to enter it at the speed the reverse pass found instead and carries on from there.
+ *
+ * A block entered at its max entry speed with no acceleration stays as it is and so do the ones before it, the
+ * passes start from the newest one.
+ */
+void Planner::recalculate_s_curve()
+{
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    const unsigned int end_i = queue.next(queue.head_i);
+
+    // the blocks the step ticker has started can not be planned anymore
+    unsigned int first_i = queue.tail_i;
+    while(first_i != queue.head_i && is_started(first_i)) first_i = queue.next(first_i);
+
+    unsigned int start_i = first_i;
+    for(unsigned int i = queue.head_i; i != first_i; ) {
+        i = queue.prev(i);
+        const Block *b = queue.item_ref(i);
+        if(b->jerk > 0.0F && b->entry_speed == b->max_entry_speed && b->entry_acceleration == 0.0F) {
+            start_i = i;
+            break;
         }
+    }
+
+    // where planning starts from
+    float v, a;
+    if(start_i != queue.head_i) {
+        v = queue.item_ref(start_i)->entry_speed;
+        a = queue.item_ref(start_i)->entry_acceleration;
+    } else {
+        // the new block follows on from where the one before it ends
+        unsigned int prev_i = queue.prev(start_i);
+        v = is_queued(prev_i) ? queue.item_ref(prev_i)->exit_speed : minimum_planner_speed;
+        a = 0.0F;
+    }
 
-        /*
-         * Step 2:
-         * now current points to either tail or first non-recalculate block
-         * and has not had its reverse_pass called
-         * or its calculate_trapezoid
-         * entry_speed is set to the *exit* speed of current.
-         * each block from current to head has its entry speed set to its max entry speed- limited by decel or nominal_rate
-         */
+    // reverse pass, the entry speeds are kept in entry_speed for the forward pass. The trapezoid reverse pass speed is
+    // the highest any profile can have at a junction
+    float end_speed = minimum_planner_speed;
+    float distance = 0.0F;
+    float trapezoid_speed = minimum_planner_speed;
+    for(unsigned int i = queue.head_i; i != start_i; i = queue.prev(i)) {
+        Block *b = queue.item_ref(i);
+        distance += b->millimeters;
+        float u = b->jerk > 0.0F ? SCurve::max_entry_speed(end_speed, distance, b->acceleration, b->jerk) : sqrtf(end_speed * end_speed + 2.0F * b->acceleration * distance);
+        b->entry_speed = std::min(u, b->max_entry_speed);
+
+        trapezoid_speed = sqrtf(trapezoid_speed * trapezoid_speed + 2.0F * b->acceleration * b->millimeters);
+        if(b->max_entry_speed < trapezoid_speed || !same_s_curve(queue.item_ref(queue.prev(i)), b)) {
+            end_speed = b->entry_speed;
+            distance = 0.0F;
+        }
+        trapezoid_speed = std::min(trapezoid_speed, b->max_entry_speed);
+    }
 
-        float exit_speed = current->max_exit_speed();
+    // forward pass. A run is cut short at a junction it would go over the max entry speed of and has to stop
+    // accelerating there, which can take longer than the reverse pass allowed for. If it then can not slow down to
+    // its exit speed in time the entry speed of its first block is lowered to what fits and the runs are planned
+    // again from the start, from the first block not started if it is the first run. Only a run from where the
+    // running block ends can not be replanned, it carries on from where it got to at the end of its distance
+    // With the queue full the block planning starts from is the one after the head, so the end is checked after each
+    // block rather than before the first
+    SCurve curve;
+    float v_start = v, a_start = a;
+    unsigned int replans = 0;
+    unsigned int i = start_i;
+    bool more = true;
+    while(more) {
+        Block *b = queue.item_ref(i);
+        unsigned int next_i = queue.next(i);
+
+        if(b->jerk == 0.0F) {
+            // a trapezoid block between s-curve blocks
+            float exit_speed = next_i == end_i ? minimum_planner_speed : queue.item_ref(next_i)->entry_speed;
+            exit_speed = std::min(exit_speed, std::min(b->nominal_speed, sqrtf(v * v + 2.0F * b->acceleration * b->millimeters)));
+            b->entry_speed = v;
+            b->calculate_trapezoid(v, exit_speed);
+            v = exit_speed;
+            a = 0.0F;
+            i = next_i;
+            more = i != end_i;
+            continue;
+        }
 
-        while (block_index != queue.head_i) {
-            previous    = current;
-            block_index = queue.next(block_index);
-            current     = queue.item_ref(block_index);
+        // the run of blocks this profile is planned over
+        unsigned int stop_i = next_i;
+        float length = b->millimeters;
+        while(stop_i != end_i && same_s_curve(b, queue.item_ref(stop_i))) {
+            length += queue.item_ref(stop_i)->millimeters;
+            stop_i = queue.next(stop_i);
+        }
+        float exit_speed = stop_i == end_i ? minimum_planner_speed : queue.item_ref(stop_i)->entry_speed;
+
+        for(;;) {
+            curve.plan(v, a, exit_speed, b->nominal_speed, length, b->acceleration, b->jerk);
+
+            // stop at the first junction it goes over the max entry speed of
+            bool over = false;
+            float x = 0.0F;
+            for(unsigned int j = i; ; ) {
+                x += queue.item_ref(j)->millimeters;
+                j = queue.next(j);
+                if(j == stop_i) break;
+                const Block *c = queue.item_ref(j);
+                if(curve.speed_at(x) > c->max_entry_speed * 1.0001F) {
+                    stop_i = j;
+                    length = x;
+                    exit_speed = c->entry_speed;
+                    over = true;
+                    break;
+                }
+            }
+            if(!over) break;
+        }
 
-            // we pass the exit speed of the previous block
-            // so this block can decide if it's accel or decel limited and update its fields as appropriate
-            exit_speed = current->forward_pass(exit_speed);
+        if(!curve.fits() && (i != start_i || start_i != first_i) && replans < 16) {
+            b->entry_speed = std::min(b->entry_speed, SCurve::max_entry_speed(exit_speed, length, b->acceleration, b->jerk));
+            ++replans;
+            if(i == start_i) {
+                start_i = first_i;
+                v_start = queue.item_ref(start_i)->entry_speed;
+                a_start = queue.item_ref(start_i)->entry_acceleration;
+            }
+            v = v_start;
+            a = a_start;
+            i = start_i;
+            continue;
+        }
 
-            previous->calculate_trapezoid(previous->entry_speed, current->entry_speed);
+        float x = 0.0F;
+        unsigned int j = i;
+        do {
+            queue.item_ref(j)->calculate_s_curve(curve, x);
+            x += queue.item_ref(j)->millimeters;
+            j = queue.next(j);
+        } while(j != stop_i);
+
+        // the next run starts where this one ends, if it could not slow down in time it carries on from where it got to
+        if(curve.fits()) {
+            v = curve.get_exit_speed();
+            a = 0.0F;
+        } else {
+            uint8_t piece;
+            float t;
+            curve.locate(length, piece, t);
+            curve.get_state(piece, t, v, a);
         }
+        i = stop_i;
+        more = i != end_i;
     }
+}
 
-    /*
-     * Step 3:
-     * work out trapezoid for final (and newest) block
-     */
+#endif
 
-    // now current points to the head item
-    // which has not had calculate_trapezoid run yet
-    current->calculate_trapezoid(current->entry_speed, minimum_planner_speed);
+// check the planner state still matches the queue, the step ticker may have finished blocks that were in the tail
+void Planner::validate_decel_tail()
+{
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+
+    if(candidates != queue.index_ring() || queue.is_empty()) {
+        // a resized queue is always empty and has a new index ring
+        candidates = queue.index_ring();
+        has_frontier = false;
+        decel_tail_i = queue.head_i;
+        decel_tail_sum = 0.0F;
+        candidates_first = 0;
+        candidates_count = 0;
+        return;
+    }
+
+    if(has_frontier && !is_queued(frontier_i)) {
+        has_frontier = false;
+    }
+
+    if(decel_tail_i != queue.head_i && !is_queued(decel_tail_i)) {
+        // the step ticker went through tail blocks that have been released since, what is left is all tail
+        decel_tail_i = queue.tail_i;
+        candidates_count = 0;
+        for(unsigned int i = decel_tail_i; i != queue.head_i; i = queue.next(i)) {
+            push_candidate(i);
+        }
+    }
+}
+
+// the blocks the step ticker has started can not be planned anymore, move the frontier up to the executing block and
+// plan the one after it from where that ends
+void Planner::sync_decel_tail(unsigned int end_i)
+{
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+
+    while(has_frontier && is_queued(frontier_i) && is_started(frontier_i)) {
+        Block *frontier = queue.item_ref(frontier_i);
+        if(frontier->decel_tail) {
+            // the step ticker carried on into it, work out its speeds from the rate it started at
+            float entry_speed = frontier->get_started_rate() * THEKERNEL->step_ticker->get_frequency() * frontier->millimeters / frontier->steps_event_count;
+            frontier->entry_speed = entry_speed;
+            frontier->exit_speed = sqrtf(std::max(0.0F, entry_speed * entry_speed - 2.0F * frontier->acceleration * frontier->millimeters));
+        }
+
+        if(decel_tail_i == end_i) break;
+
+        Block *b = queue.item_ref(decel_tail_i);
+        if(!is_started(decel_tail_i) && !is_finished(frontier_i)) {
+            b->entry_speed = frontier->exit_speed;
+        }
+        // else either started, or the step ticker is idle and will start it at the entry speed it was added with
+
+        frontier_i = decel_tail_i;
+        decel_tail_i = queue.next(decel_tail_i);
+    }
+
+    if(!has_frontier && decel_tail_i != end_i) {
+        // nothing before the tail to follow on from, the step ticker is idle or starts the first block as it is
+        has_frontier = true;
+        frontier_i = decel_tail_i;
+        decel_tail_i = queue.next(decel_tail_i);
+        sync_decel_tail(end_i);
+    }
+
+    drop_candidates();
+}
+
+// plan the tail blocks up to and including index from the frontier, index becomes the frontier
+void Planner::plan_decel_tail_to(unsigned int index)
+{
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    Block *previous = queue.item_ref(frontier_i);
+    float exit_speed = previous->max_exit_speed();
+
+    for(;;) {
+        Block *current = queue.item_ref(decel_tail_i);
+        exit_speed = current->forward_pass(exit_speed);
+        previous->calculate_trapezoid(previous->entry_speed, current->entry_speed);
+
+        previous = current;
+        frontier_i = decel_tail_i;
+        decel_tail_i = queue.next(decel_tail_i);
+        if(frontier_i == index) break;
+    }
+
+    drop_candidates();
+}
+
+// the candidates are the tail blocks in the order they will reach their max entry speed, a block that reaches it no
+// sooner than a newer block does never needs checking as the newer one plans it
+void Planner::push_candidate(unsigned int index)
+{
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    float threshold = decel_tail_threshold(queue.item_ref(index));
+
+    while(candidates_count > 0) {
+        unsigned int last = (candidates_first + candidates_count - 1) % queue.length;
+        if(decel_tail_threshold(queue.item_ref(candidates[last])) < threshold) break;
+        --candidates_count;
+    }
+    candidates[(candidates_first + candidates_count) % queue.length] = index;
+    ++candidates_count;
+}
+
+// remove the candidates that are not in the tail anymore, they are always the oldest
+void Planner::drop_candidates()
+{
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    const unsigned int tail_length = (queue.next(queue.head_i) + queue.length - decel_tail_i) % queue.length;
+
+    while(candidates_count > 0 && (candidates[candidates_first] + queue.length - decel_tail_i) % queue.length >= tail_length) {
+        candidates_first = queue.next(candidates_first);
+        --candidates_count;
+    }
+}
+
+float Planner::decel_tail_entry_speed(const Block *block) const
+{
+    return sqrtf(std::max(0.0F, minimum_planner_speed * minimum_planner_speed + decel_tail_sum - block->decel_offset));
+}
+
+// the implied entry speed reaches the max entry speed when decel_tail_sum reaches this
+float Planner::decel_tail_threshold(const Block *block) const
+{
+    return block->max_entry_speed * block->max_entry_speed - minimum_planner_speed * minimum_planner_speed + block->decel_offset;
+}
+
+// added to the queue and not released yet
+bool Planner::is_queued(unsigned int index) const
+{
+    const Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    return (index + queue.length - queue.tail_i) % queue.length < (queue.head_i + queue.length - queue.tail_i) % queue.length;
+}
+
+// the new block at the head has not been added yet so can not have been started
+bool Planner::is_started(unsigned int index) const
+{
+    return index != THECONVEYOR->queue.head_i && (!is_queued(index) || THECONVEYOR->queue.item_ref(index)->is_ticking);
+}
+
+bool Planner::is_finished(unsigned int index) const
+{
+    const Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    unsigned int isr_tail_i = queue.isr_tail_i;
+    return !is_queued(index) || (index + queue.length - queue.tail_i) % queue.length < (isr_tail_i + queue.length - queue.tail_i) % queue.length;
 }
 
 
@@ -9,7 +9,9 @@
 #define PLANNER_H
 
 #include "ActuatorCoordinates.h"
-class Block;
+#include "Block.h"
+
+#include <stdint.h>
 
 class Planner
 {
@@ -20,13 +22,39 @@ public:
     friend class Robot; // for acceleration, junction deviation, minimum_planner_speed
 
 private:
-    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123);
+    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float jerk, float s_value, bool g123, uint16_t raster_start, uint16_t raster_pixels, const Block::arc_t *arc= nullptr, const float *exit_unit_vec= nullptr);
     void recalculate();
     void config_load();
+    void recalculate_decel_tail();
+#ifdef STEPTICKER_FIXED32
+    void recalculate_s_curve();
+#endif
+    void validate_decel_tail();
+    void sync_decel_tail(unsigned int end_i);
+    void plan_decel_tail_to(unsigned int index);
+    void push_candidate(unsigned int index);
+    void drop_candidates();
+    float decel_tail_entry_speed(const Block *block) const;
+    float decel_tail_threshold(const Block *block) const;
+    bool is_queued(unsigned int index) const;
+    bool is_started(unsigned int index) const;
+    bool is_finished(unsigned int index) const;
     float previous_unit_vec[N_PRIMARY_AXIS];
     float junction_deviation;    // Setting
     float z_junction_deviation;  // Setting
     float minimum_planner_speed; // Setting
+    float max_speed_change;      // Setting, mm/sec XYZ may change speed by at a junction, 0 uses junction deviation
+    float previous_actuator_vec[k_max_actuators]; // actuator mm per mm of the path at the end of the previous block
+
+    // the blocks from decel_tail_i to the head only decelerate, their entry speeds are implied by decel_tail_sum
+    unsigned int frontier_i;          // the newest block with a planned entry speed
+    unsigned int decel_tail_i;        // the oldest block in the deceleration tail
+    bool has_frontier;
+    float decel_tail_sum;             // sum of 2 * acceleration * distance of the blocks added to the tail
+    uint16_t *candidates;             // ring of the tail blocks that can reach their max entry speed next, oldest first,
+                                      // the index ring of the queue (see BlockQueue::index_ring())
+    unsigned int candidates_first;
+    unsigned int candidates_count;
 };
 
 
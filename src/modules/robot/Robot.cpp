@@ -25,6 +25,7 @@
 #include "arm_solutions/CoreXZSolution.h"
 #include "arm_solutions/MorganSCARASolution.h"
 #include "StepTicker.h"
+#include "InputShaper.h"
 #include "checksumm.h"
 #include "utils.h"
 #include "ConfigValue.h"
@@ -46,9 +47,11 @@
 #define  default_feed_rate_checksum          CHECKSUM("default_feed_rate")
 #define  mm_per_line_segment_checksum        CHECKSUM("mm_per_line_segment")
 #define  delta_segments_per_second_checksum  CHECKSUM("delta_segments_per_second")
+#define  segment_max_error_checksum          CHECKSUM("segment_max_error")
 #define  mm_per_arc_segment_checksum         CHECKSUM("mm_per_arc_segment")
 #define  mm_max_arc_error_checksum           CHECKSUM("mm_max_arc_error")
 #define  arc_correction_checksum             CHECKSUM("arc_correction")
+#define  native_arcs_checksum                CHECKSUM("native_arcs")
 #define  x_axis_max_speed_checksum           CHECKSUM("x_axis_max_speed")
 #define  y_axis_max_speed_checksum           CHECKSUM("y_axis_max_speed")
 #define  z_axis_max_speed_checksum           CHECKSUM("z_axis_max_speed")
@@ -57,6 +60,11 @@
 #define  save_g54_checksum                   CHECKSUM("save_g54")
 #define  set_g92_checksum                    CHECKSUM("set_g92")
 
+// with segment_max_error a line is split in halves, the ends of its segments are fractions of this, and it is cut into
+// at most this many segments when neither delta_segments_per_second nor mm_per_line_segment is set
+#define ROBOT_SEGMENT_SPAN 65536
+#define ROBOT_MAX_SEGMENTS 256
+
 // arm solutions
 #define  arm_solution_checksum               CHECKSUM("arm_solution")
 #define  cartesian_checksum                  CHECKSUM("cartesian")
@@ -81,6 +89,7 @@
 #define  max_speed_checksum                  CHECKSUM("max_speed")
 #define  acceleration_checksum               CHECKSUM("acceleration")
 #define  z_acceleration_checksum             CHECKSUM("z_acceleration")
+#define  jerk_checksum                       CHECKSUM("jerk")
 
 #define  alpha_checksum                      CHECKSUM("alpha")
 #define  beta_checksum                       CHECKSUM("beta")
@@ -125,6 +134,8 @@ Robot::Robot()
     this->disable_segmentation = false;
     this->disable_arm_solution = false;
     this->n_motors = 0;
+    this->raster_start = this->raster_pixels = 0;
+    this->segment_raster_start = this->segment_raster_pixels = 0;
 }
 
 //Called when the module has just been loaded
@@ -142,7 +153,11 @@ void Robot::on_module_loaded()
     CHECKSUM(X "_en_pin"),          \
     CHECKSUM(X "_steps_per_mm"),    \
     CHECKSUM(X "_max_rate"),        \
-    CHECKSUM(X "_acceleration")     \
+    CHECKSUM(X "_acceleration"),    \
+    CHECKSUM(X "_max_speed_change"),       \
+    CHECKSUM(X "_input_shaper"),           \
+    CHECKSUM(X "_input_shaper_frequency"), \
+    CHECKSUM(X "_input_shaper_damping")    \
 }
 
 void Robot::load_config()
@@ -183,9 +198,11 @@ void Robot::load_config()
     this->seek_rate           = THEKERNEL->config->value(default_seek_rate_checksum   )->by_default(  100.0F)->as_number();
     this->mm_per_line_segment = THEKERNEL->config->value(mm_per_line_segment_checksum )->by_default(    0.0F)->as_number();
     this->delta_segments_per_second = THEKERNEL->config->value(delta_segments_per_second_checksum )->by_default(0.0f   )->as_number();
+    this->segment_max_error   = THEKERNEL->config->value(segment_max_error_checksum   )->by_default(    0.0F)->as_number();
     this->mm_per_arc_segment  = THEKERNEL->config->value(mm_per_arc_segment_checksum  )->by_default(    0.0f)->as_number();
     this->mm_max_arc_error    = THEKERNEL->config->value(mm_max_arc_error_checksum    )->by_default(   0.01f)->as_number();
     this->arc_correction      = THEKERNEL->config->value(arc_correction_checksum      )->by_default(    5   )->as_number();
+    this->native_arcs         = THEKERNEL->config->value(native_arcs_checksum         )->by_default(false)->as_bool();
 
     // in mm/sec but specified in config as mm/min
     this->max_speeds[X_AXIS]  = THEKERNEL->config->value(x_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
@@ -209,7 +226,7 @@ void Robot::load_config()
     this->s_value = THEKERNEL->config->value(laser_module_default_power_checksum)->by_default(0.8F)->as_number();
 
     // Make our Primary XYZ StepperMotors, and potentially A B C
-    uint16_t const motor_checksums[][6] = {
+    uint16_t const motor_checksums[][10] = {
         ACTUATOR_CHECKSUMS("alpha"), // X
         ACTUATOR_CHECKSUMS("beta"),  // Y
         ACTUATOR_CHECKSUMS("gamma"), // Z
@@ -226,6 +243,14 @@ void Robot::load_config()
 
     // default acceleration setting, can be overriden with newer per axis settings
     this->default_acceleration = THEKERNEL->config->value(acceleration_checksum)->by_default(100.0F )->as_number(); // Acceleration is in mm/s^2
+    // s-curve acceleration is used if jerk is set
+    this->default_jerk = THEKERNEL->config->value(jerk_checksum)->by_default(0.0F )->as_number(); // Jerk is in mm/s^3
+#ifndef STEPTICKER_FIXED32
+    if(this->default_jerk > 0.0F) {
+        THEKERNEL->streams->printf("ERROR: jerk needs firmware built with STEPTICKER_FIXED32=1, it is ignored\n");
+        this->default_jerk = 0.0F;
+    }
+#endif
 
     // make each motor
     for (size_t a = 0; a < MAX_ROBOT_ACTUATORS; a++) {
@@ -255,6 +280,25 @@ void Robot::load_config()
         actuators[a]->change_steps_per_mm(THEKERNEL->config->value(motor_checksums[a][3])->by_default(a == 2 ? 2560.0F : 80.0F)->as_number());
         actuators[a]->set_max_rate(THEKERNEL->config->value(motor_checksums[a][4])->by_default(30000.0F)->as_number() / 60.0F); // it is in mm/min and converted to mm/sec
         actuators[a]->set_acceleration(THEKERNEL->config->value(motor_checksums[a][5])->by_default(NAN)->as_number()); // mm/secs²
+        actuators[a]->set_max_speed_change(THEKERNEL->config->value(motor_checksums[a][6])->by_default(NAN)->as_number()); // mm/sec, only used if the planner max_speed_change is set, XYZ use that if it is not set
+
+        // input shaping cancels the ringing of the axis at a frequency, on corexy and delta like machines all the
+        // motors that move the head should be given the same shaper
+        InputShaper::TYPE shaper_type = InputShaper::type_from_string(THEKERNEL->config->value(motor_checksums[a][7])->by_default("none")->as_string());
+        if(shaper_type != InputShaper::NONE) {
+            float shaper_frequency = THEKERNEL->config->value(motor_checksums[a][8])->by_default(40.0F)->as_number(); // Hz
+            float shaper_damping = THEKERNEL->config->value(motor_checksums[a][9])->by_default(0.1F)->as_number();
+            float tick_frequency = THEKERNEL->step_ticker->get_frequency();
+            // the motor steps at most once a tick
+            float max_step_rate = std::min(actuators[a]->get_max_rate() * actuators[a]->get_steps_per_mm(), tick_frequency);
+            InputShaper *shaper = new InputShaper();
+            if(shaper->configure(shaper_type, shaper_frequency, shaper_damping, tick_frequency, max_step_rate)) {
+                THEKERNEL->step_ticker->set_input_shaper(a, shaper);
+            } else {
+                THEKERNEL->streams->printf("ERROR: motor %c input shaper could not be set up, it is too long or there is no memory for it\n", 'X' + a);
+                delete shaper;
+            }
+        }
     }
 
     check_max_actuator_speeds(); // check the configs are sane
@@ -827,13 +871,25 @@ void Robot::on_gcode_received(void *argument)
                 }
                 break;
 
-            case 204: // M204 Snnn - set default acceleration to nnn, Xnnn Ynnn Znnn sets axis specific acceleration
+            case 204: // M204 Snnn - set default acceleration to nnn, Xnnn Ynnn Znnn sets axis specific acceleration, Jnnn sets jerk
                 if (gcode->has_letter('S')) {
                     float acc = gcode->get_value('S'); // mm/s^2
                     // enforce minimum
                     if (acc < 1.0F) acc = 1.0F;
                     this->default_acceleration = acc;
                 }
+                if (gcode->has_letter('J')) {
+                    float jerk = gcode->get_value('J'); // mm/s^3
+                    // 0 disables s-curve acceleration
+                    if (jerk < 0.0F) jerk = 0.0F;
+#ifndef STEPTICKER_FIXED32
+                    if (jerk > 0.0F) {
+                        gcode->stream->printf("ERROR: jerk needs firmware built with STEPTICKER_FIXED32=1, it is ignored\n");
+                        jerk = 0.0F;
+                    }
+#endif
+                    this->default_jerk = jerk;
+                }
                 for (int i = 0; i < n_motors; ++i) {
                     if(actuators[i]->is_extruder()) continue; //extruders handle this themselves
                     char axis = (i <= Z_AXIS ? 'X' + i : 'A' + (i - A_AXIS));
@@ -846,7 +902,7 @@ void Robot::on_gcode_received(void *argument)
                 }
                 break;
 
-            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed
+            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed, Vnnn - set max actuator speed change
                 if (gcode->has_letter('X')) {
                     float jd = gcode->get_value('X');
                     // enforce minimum
@@ -868,6 +924,13 @@ void Robot::on_gcode_received(void *argument)
                         mps = 0.0F;
                     THEKERNEL->planner->minimum_planner_speed = mps;
                 }
+                if (gcode->has_letter('V')) {
+                    float v = gcode->get_value('V');
+                    // 0 goes back to junction deviation
+                    if (v < 0.0F)
+                        v = 0.0F;
+                    THEKERNEL->planner->max_speed_change = v;
+                }
                 break;
 
             case 211: // M211 Sn turns soft endstops on/off
@@ -922,6 +985,7 @@ void Robot::on_gcode_received(void *argument)
 
                 // only print if not NAN
                 gcode->stream->printf(";Acceleration mm/sec^2:\nM204 S%1.5f ", default_acceleration);
+                if(default_jerk > 0.0F) gcode->stream->printf("J%1.5f ", default_jerk);
                 for (int i = 0; i < n_motors; ++i) {
                     if(actuators[i]->is_extruder()) continue; // extruders handle this themselves
                     char axis = (i <= Z_AXIS ? 'X' + i : 'A' + (i - A_AXIS));
@@ -929,7 +993,7 @@ void Robot::on_gcode_received(void *argument)
                 }
                 gcode->stream->printf("\n");
 
-                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec:\nM205 X%1.5f Z%1.5f S%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation) ? -1 : THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed);
+                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec, V - Max actuator speed change mm/sec:\nM205 X%1.5f Z%1.5f S%1.5f V%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation) ? -1 : THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed, THEKERNEL->planner->max_speed_change);
 
                 gcode->stream->printf(";Max cartesian feedrates in mm/sec:\nM203 X%1.5f Y%1.5f Z%1.5f S%1.5f\n", this->max_speeds[X_AXIS], this->max_speeds[Y_AXIS], this->max_speeds[Z_AXIS], this->max_speed);
 
@@ -1163,6 +1227,52 @@ void Robot::process_move(Gcode *gcode, enum MOTION_MODE_T motion_mode)
     }
 }
 
+// a G0/G1 decoded from a binary move frame (see MoveFrame.h), xyz is the target in mm in the current WCS with NAN for the
+// axis that do not move, e is relative and f is mm/min or NAN to keep the modal rate.
+// returns nullptr or the same error the G0/G1 handler reports
+const char *Robot::append_frame_move(const float xyz[3], float e, float f, bool rapid)
+{
+    // a frame is always absolute millimeters, a host that switched modes would move somewhere else than it meant
+    if(!this->absolute_mode) return "move frame while in G91";
+    if(this->inch_mode) return "move frame while in G20";
+
+    if(!isnan(f)) {
+        if(rapid) this->seek_rate = f;
+        else this->feed_rate = f;
+    }
+
+    float rate_mm_s = (rapid ? this->seek_rate : this->feed_rate) / seconds_per_minute;
+    if(rate_mm_s <= 0.0F) {
+        return rate_mm_s == 0 ? "Undefined feed rate" : "feed rate < 0";
+    }
+
+    float target[n_motors];
+    memcpy(target, machine_position, n_motors * sizeof(float));
+
+    // same as an absolute G0/G1, apply wcs offsets and g92 offset and tool offset
+    if(!isnan(xyz[X_AXIS])) target[X_AXIS] = xyz[X_AXIS] + std::get<X_AXIS>(wcs_offsets[current_wcs]) - std::get<X_AXIS>(g92_offset) + std::get<X_AXIS>(tool_offset);
+    if(!isnan(xyz[Y_AXIS])) target[Y_AXIS] = xyz[Y_AXIS] + std::get<Y_AXIS>(wcs_offsets[current_wcs]) - std::get<Y_AXIS>(g92_offset) + std::get<Y_AXIS>(tool_offset);
+    if(!isnan(xyz[Z_AXIS])) target[Z_AXIS] = xyz[Z_AXIS] + std::get<Z_AXIS>(wcs_offsets[current_wcs]) - std::get<Z_AXIS>(g92_offset) + std::get<Z_AXIS>(tool_offset);
+
+    float delta_e = NAN;
+#if MAX_ROBOT_ACTUATORS > 3
+    if(!isnan(e)) {
+        int selected_extruder = get_active_extruder();
+        if(selected_extruder > 0) {
+            delta_e = e;
+            target[selected_extruder] = delta_e + machine_position[selected_extruder];
+        }
+    }
+#endif
+
+    is_g123 = !rapid;
+    if(append_line(target, rate_mm_s, delta_e, !isnan(xyz[X_AXIS]) || !isnan(xyz[Y_AXIS]), !rapid)) {
+        memcpy(machine_position, target, n_motors * sizeof(float));
+    }
+
+    return nullptr;
+}
+
 // reset the machine position for all axis. Used for homing.
 // after homing we supply the cartesian coordinates that the head is at when homed,
 // however for Z this is the compensated machine position (if enabled)
@@ -1272,9 +1382,7 @@ void Robot::reset_compensated_machine_position()
 // all transforms and is what we actually convert to actuator positions
 bool Robot::append_milestone(const float target[], float rate_mm_s)
 {
-    float deltas[n_motors];
     float transformed_target[n_motors]; // adjust target for bed compensation
-    float unit_vec[N_PRIMARY_AXIS];
 
     // unity transform by default
     memcpy(transformed_target, target, n_motors * sizeof(float));
@@ -1285,6 +1393,16 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         compensationTransform(transformed_target, false);
     }
 
+    return append_transformed_milestone(transformed_target, rate_mm_s, nullptr);
+}
+
+// the rest of append_milestone() once the target is compensated, solved is the actuator position of XYZ if the arm
+// solution already worked it out, as splitting a line to an error does
+bool Robot::append_transformed_milestone(const float transformed_target[], float rate_mm_s, const ActuatorCoordinates *solved)
+{
+    float deltas[n_motors];
+    float unit_vec[N_PRIMARY_AXIS];
+
     // check soft endstops only for homed axis that are enabled
     if(soft_endstop_enabled) {
         for (int i = 0; i <= Z_AXIS; ++i) {
@@ -1374,7 +1492,12 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
 
     // find actuator position given the machine position, use actual adjusted target
     ActuatorCoordinates actuator_pos;
-    if(!disable_arm_solution) {
+    if(solved != nullptr) {
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            actuator_pos[i] = (*solved)[i];
+        }
+
+    } else if(!disable_arm_solution) {
         arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
         // some arm solutions can indicate a halt if the calcs go bad
         if(THEKERNEL->is_halted()) return false;
@@ -1413,22 +1536,50 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
 
     // use default acceleration to start with
     float acceleration = default_acceleration;
+    float jerk = default_jerk;
+
+    // check per-actuator speed and acceleration limits
+    float moves[n_motors];
+    for (size_t actuator = 0; actuator < n_motors; actuator++) {
+        moves[actuator] = fabsf(actuator_pos[actuator] - actuators[actuator]->get_last_milestone());
+    }
+    limit_actuators(moves, distance, rate_mm_s, acceleration, jerk);
+
+    // if we are in feed hold wait here until it is released, this means that even segmented lines will pause
+    while(THEKERNEL->get_feed_hold()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+        // if we also got a HALT then break out of this
+        if(THEKERNEL->is_halted()) return false;
+    }
 
-    float isecs = rate_mm_s / distance;
+    // Append the block to the planner
+    // NOTE that distance here should be either the distance travelled by the XYZ axis, or the E mm travel if a solo E move
+    // NOTE this call will bock until there is room in the block queue, on_idle will continue to be called
+    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, jerk, s_value, is_g123, segment_raster_start, segment_raster_pixels)) {
+        // this is the new compensated machine position
+        memcpy(this->compensated_machine_position, transformed_target, n_motors * sizeof(float));
+        return true;
+    }
+
+    // no actual move, should never happen
+    return false;
+}
 
-    // check per-actuator speed limits
+// slows the move down so no actuator goes faster than its max rate, and lowers the acceleration (and the jerk with it)
+// so none accelerates faster than its own acceleration. moves[] is how far each actuator goes over the distance
+void Robot::limit_actuators(const float moves[], float distance, float& rate_mm_s, float& acceleration, float& jerk) const
+{
     for (size_t actuator = 0; actuator < n_motors; actuator++) {
-        float d = fabsf(actuator_pos[actuator] - actuators[actuator]->get_last_milestone());
+        float d = moves[actuator];
         if(d < 0.00001F || !actuators[actuator]->is_selected()) continue; // no realistic movement for this actuator
 
-        float actuator_rate = d * isecs;
+        float actuator_rate = d * rate_mm_s / distance;
         if (actuator_rate > actuators[actuator]->get_max_rate()) {
             rate_mm_s *= (actuators[actuator]->get_max_rate() / actuator_rate);
-            isecs = rate_mm_s / distance;
             DEBUG_PRINTF("new rate: %f - %d\n", rate_mm_s, actuator);
         }
 
-        DEBUG_PRINTF("act: %d, d: %f, distance: %f, actrate: %f, rate: %f, secs: %f, acc: %f\n", actuator, d, distance, actuator_rate, rate_mm_s, 1 / isecs, acceleration);
+        DEBUG_PRINTF("act: %d, d: %f, distance: %f, actrate: %f, rate: %f, acc: %f\n", actuator, d, distance, actuator_rate, rate_mm_s, acceleration);
 
         // adjust acceleration to lowest found, for all actuators as this also corrects
         // the math for a tiny X move and large A move
@@ -1437,29 +1588,11 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
             float ca = (d / distance) * acceleration;
             if (ca > ma) {
                 acceleration *= ( ma / ca );
+                jerk *= ( ma / ca ); // keep the same shape of s-curve
                 DEBUG_PRINTF("new acceleration: %f\n", acceleration);
             }
         }
     }
-
-    // if we are in feed hold wait here until it is released, this means that even segmented lines will pause
-    while(THEKERNEL->get_feed_hold()) {
-        THEKERNEL->call_event(ON_IDLE, this);
-        // if we also got a HALT then break out of this
-        if(THEKERNEL->is_halted()) return false;
-    }
-
-    // Append the block to the planner
-    // NOTE that distance here should be either the distance travelled by the XYZ axis, or the E mm travel if a solo E move
-    // NOTE this call will bock until there is room in the block queue, on_idle will continue to be called
-    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123)) {
-        // this is the new compensated machine position
-        memcpy(this->compensated_machine_position, transformed_target, n_motors * sizeof(float));
-        return true;
-    }
-
-    // no actual move, should never happen
-    return false;
 }
 
 // Used to plan a single move used by things like endstops when homing, zprobe, extruder firmware retracts etc.
@@ -1501,6 +1634,12 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
         return false;
     }
 
+    return append_line(target, rate_mm_s, delta_e, gcode->has_letter('X') || gcode->has_letter('Y'), gcode->has_g && gcode->g == 1);
+}
+
+// xy_move is set if X or Y was given, is_g1 if the extruder may limit the volumetric rate
+bool Robot::append_line(const float target[], float rate_mm_s, float delta_e, bool xy_move, bool is_g1)
+{
     // Find out the distance for this move in XYZ in MCS
     float millimeters_of_travel = sqrtf(powf( target[X_AXIS] - machine_position[X_AXIS], 2 ) +  powf( target[Y_AXIS] - machine_position[Y_AXIS], 2 ) +  powf( target[Z_AXIS] - machine_position[Z_AXIS], 2 ));
 
@@ -1515,7 +1654,7 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
         We ask Extruder to do all the work but we need to pass in the relevant data.
         NOTE we need to do this before we segment the line (for deltas)
     */
-    if(!isnan(delta_e) && gcode->has_g && gcode->g == 1) {
+    if(!isnan(delta_e) && is_g1) {
         float data[2] = {delta_e, rate_mm_s / millimeters_of_travel};
         if(PublicData::set_value(extruder_checksum, target_checksum, data)) {
             rate_mm_s *= data[1]; // adjust the feedrate
@@ -1527,7 +1666,7 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
     // The latter is more efficient and avoids splitting fast long lines into very small segments, like initial z move to 0, it is what Johanns Marlin delta port does
     uint16_t segments;
 
-    if(this->disable_segmentation || (!segment_z_moves && !gcode->has_letter('X') && !gcode->has_letter('Y'))) {
+    if(this->disable_segmentation || (!segment_z_moves && !xy_move)) {
         segments = 1;
 
     } else if(this->delta_segments_per_second > 1.0F) {
@@ -1541,14 +1680,28 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
 
     } else {
         if(this->mm_per_line_segment == 0.0F) {
-            segments = 1; // don't split it up
+            segments = this->segment_max_error > 0.0F ? ROBOT_MAX_SEGMENTS : 1; // don't split it up unless it needs it
         } else {
             segments = ceilf( millimeters_of_travel / this->mm_per_line_segment);
         }
     }
 
+    // a laser raster G1 takes the pixels queued for it, each segment gets its share by length
+    uint16_t pixels = 0;
+    if(is_g1 && is_g123 && raster_pixels > 0) {
+        pixels = raster_pixels;
+        raster_pixels = 0;
+    }
+
     bool moved = false;
-    if (segments > 1) {
+    if (segments > 1 && this->segment_max_error > 0.0F && !disable_arm_solution) {
+        // split only where the arm solution needs it, the segments above are the shortest it splits to
+        moved = append_adaptive_line(target, rate_mm_s, pixels, segments);
+        segment_raster_pixels = 0;
+        this->next_command_is_MCS = false; // always reset this
+        return moved;
+
+    } else if (segments > 1) {
         // A vector to keep track of the endpoint of each segment
         float segment_delta[n_motors];
         float segment_end[n_motors];
@@ -1565,6 +1718,11 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
             for (int j = 0; j < n_motors; j++)
                 segment_end[j] += segment_delta[j];
 
+            if(pixels > 0) {
+                segment_raster_start = raster_start + (uint32_t)pixels * (i - 1) / segments;
+                segment_raster_pixels = (uint32_t)pixels * i / segments - (uint32_t)pixels * (i - 1) / segments;
+            }
+
             // Append the end of this segment to the queue
             // this can block waiting for free block queue or if in feed hold
             bool b = this->append_milestone(segment_end, rate_mm_s);
@@ -1572,14 +1730,98 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
         }
     }
 
+    if(pixels > 0) {
+        segment_raster_start = raster_start + (uint32_t)pixels * (segments - 1) / segments;
+        segment_raster_pixels = pixels - (uint32_t)pixels * (segments - 1) / segments;
+    }
+
     // Append the end of this full move to the queue
     if(this->append_milestone(target, rate_mm_s)) moved = true;
+    segment_raster_pixels = 0;
 
     this->next_command_is_MCS = false; // always reset this
 
     return moved;
 }
 
+struct Robot::adaptive_line_t {
+    const float *start;             // the uncompensated start of the line
+    float delta[k_max_actuators];   // and how far it goes
+    float rate_mm_s;
+    uint32_t min_span;              // the shortest segment, of ROBOT_SEGMENT_SPAN
+    uint16_t pixels;                // laser raster pixels of the line
+};
+
+// Splits the line until no actuator is more than segment_max_error steps from where it would be moving straight between
+// segment ends, checked at the middle of each segment. Where the arm solution is close to linear the line is cut into
+// few segments, near the edges of a delta or a SCARA into many, no shorter than max_segments would make them
+bool Robot::append_adaptive_line(const float target[], float rate_mm_s, uint16_t pixels, uint16_t max_segments)
+{
+    adaptive_line_t line;
+    line.start = machine_position;
+    for (int i = 0; i < n_motors; i++) {
+        line.delta[i] = target[i] - machine_position[i];
+    }
+    line.rate_mm_s = rate_mm_s;
+    line.min_span = ROBOT_SEGMENT_SPAN / max_segments;
+    line.pixels = pixels;
+
+    // the actuators are where the last milestone put them
+    ActuatorCoordinates from_pos;
+    for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+        from_pos[i] = actuators[i]->get_last_milestone();
+    }
+
+    float to_target[n_motors];
+    memcpy(to_target, target, n_motors * sizeof(float));
+    if(compensationTransform) compensationTransform(to_target, false);
+    ActuatorCoordinates to_pos;
+    arm_solution->cartesian_to_actuator(to_target, to_pos);
+    if(THEKERNEL->is_halted()) return false;
+
+    return append_adaptive_segment(line, 0, ROBOT_SEGMENT_SPAN, from_pos, to_target, to_pos);
+}
+
+// from and to are where the segment starts and ends along the line, to_target is the compensated end and the actuator
+// positions at both ends are known. The halves are appended in order, so the stack is as deep as the line is split
+bool Robot::append_adaptive_segment(const adaptive_line_t& line, uint32_t from, uint32_t to, const ActuatorCoordinates& from_pos, float to_target[], const ActuatorCoordinates& to_pos)
+{
+    if(THEKERNEL->is_halted()) return false; // don't queue any more segments
+
+    if(to - from >= 2 * line.min_span) {
+        uint32_t middle = (from + to) / 2;
+        float middle_target[n_motors];
+        for (int i = 0; i < n_motors; i++) {
+            middle_target[i] = line.start[i] + line.delta[i] * ((float)middle / ROBOT_SEGMENT_SPAN);
+        }
+        if(compensationTransform) compensationTransform(middle_target, false);
+        ActuatorCoordinates middle_pos;
+        arm_solution->cartesian_to_actuator(middle_target, middle_pos);
+        if(THEKERNEL->is_halted()) return false;
+
+        float error = 0;
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            float e = fabsf(middle_pos[i] - (from_pos[i] + to_pos[i]) * 0.5F) * actuators[i]->get_steps_per_mm();
+            if(e > error) error = e;
+        }
+
+        if(error > this->segment_max_error) {
+            bool moved = append_adaptive_segment(line, from, middle, from_pos, middle_target, middle_pos);
+            return append_adaptive_segment(line, middle, to, middle_pos, to_target, to_pos) || moved;
+        }
+    }
+
+    if(line.pixels > 0) {
+        uint32_t first = (uint32_t)line.pixels * from / ROBOT_SEGMENT_SPAN;
+        segment_raster_start = raster_start + first;
+        segment_raster_pixels = (uint32_t)line.pixels * to / ROBOT_SEGMENT_SPAN - first;
+    }
+
+    // Append the end of this segment to the queue
+    // this can block waiting for free block queue or if in feed hold
+    return append_transformed_milestone(to_target, line.rate_mm_s, &to_pos);
+}
+
 
 // Append an arc to the queue ( cutting it into segments as needed )
 bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[], float radius, bool is_clockwise )
@@ -1657,6 +1899,15 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
     uint16_t segments = floorf(millimeters_of_travel / arc_segment);
     bool moved = false;
 
+    // on a cartesian like machine the step ticker can move the actuators around the arc itself, there is no bed
+    // compensation to follow and the soft endstops are checked on each chord
+    if(segments > 1 && this->native_arcs && arm_solution->is_linear() && !compensationTransform && !disable_arm_solution && !soft_endstop_enabled) {
+        Block::arc_t arc;
+        if(arc_actuators(target, r_axis0, r_axis1, angular_travel, linear_travel, arc)) {
+            return append_arc_block(target, rate_mm_s, arc, r_axis0, r_axis1, angular_travel, linear_travel, millimeters_of_travel);
+        }
+    }
+
     if(segments > 1) {
         float theta_per_segment = angular_travel / segments;
         float linear_per_segment = linear_travel / segments;
@@ -1748,6 +1999,148 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
     return moved;
 }
 
+// Works out how the first three actuators move around an arc from the machine position to target (see Block::arc_t).
+// r is the radius vector from the center to the start. Returns false if one would move around the arc and along the
+// linear travel, the target is not on the arc or the arc is too small to be worth it, then it is split into chords
+bool Robot::arc_actuators(const float target[], float r_axis0, float r_axis1, float angular_travel, float linear_travel, Block::arc_t& arc) const
+{
+    // the center, the start, a quarter turn on from the start and the center moved by the linear travel
+    float turn = angular_travel < 0 ? -1 : 1;
+    float p[4][3];
+    for (int k = 0; k < 4; ++k) {
+        memcpy(p[k], machine_position, sizeof(p[k]));
+        if(k == 1) continue;
+        p[k][plane_axis_0] -= r_axis0;
+        p[k][plane_axis_1] -= r_axis1;
+    }
+    p[2][plane_axis_0] -= turn * r_axis1;
+    p[2][plane_axis_1] += turn * r_axis0;
+    p[3][plane_axis_2] += linear_travel;
+
+    ActuatorCoordinates q[4], end;
+    for (int k = 0; k < 4; ++k) {
+        arm_solution->cartesian_to_actuator(p[k], q[k]);
+    }
+    arm_solution->cartesian_to_actuator(target, end);
+
+    float theta = fabsf(angular_travel);
+    float cos_T = cosf(theta);
+    float sin_T = sinf(theta);
+    float path = 0;
+    arc.motors = 0;
+    for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+        arc.a[i] = arc.b[i] = arc.c[i] = arc.end[i] = 0;
+        float steps_per_mm = actuators[i]->get_steps_per_mm();
+        float a = (q[1][i] - q[0][i]) * steps_per_mm;
+        float b = (q[2][i] - q[0][i]) * steps_per_mm;
+        float r = hypotf(a, b);
+        // less than half a step round the arc, it steps as for a line
+        if(r < 0.5F) continue;
+        if(fabsf(q[3][i] - q[0][i]) * steps_per_mm >= 0.5F || r > (1 << 22)) return false;
+
+        // where it is in steps, the steps it made to get there are rounded
+        float start = actuators[i]->get_last_milestone() * steps_per_mm - actuators[i]->get_last_milestone_steps();
+        // the gcode can have the end off the circle, the step ticker would go straight there at the end
+        float end_steps = lroundf(end[i] * steps_per_mm) - actuators[i]->get_last_milestone_steps();
+        if(fabsf(start + a * (cos_T - 1) + b * sin_T - end_steps) > 2) return false;
+        arc.a[i] = lroundf(a * 256);
+        arc.b[i] = lroundf(b * 256);
+        arc.c[i] = lroundf((start - a) * 256);
+        arc.motors |= (1 << i);
+        path = std::max(path, r * theta);
+    }
+
+    // the path has as many steps as the actuator that moves the most around the arc so none steps more than it
+    arc.path_steps = ceilf(path);
+    if(arc.motors == 0 || arc.path_steps < 2) return false;
+    arc.phase_step = (double)theta / (2 * PI) * 18446744073709551616.0 / arc.path_steps; // 2^64 is a turn
+    return true;
+}
+
+// Append an arc as one block, the step ticker moves the actuators in arc.motors around it and the others as for a line
+bool Robot::append_arc_block(const float target[], float rate_mm_s, const Block::arc_t& arc, float r_axis0, float r_axis1, float angular_travel, float linear_travel, float distance)
+{
+    float radius = hypotf(r_axis0, r_axis1);
+    float theta = fabsf(angular_travel);
+
+#if MAX_ROBOT_ACTUATORS > 3
+    // the extruder may limit the volumetric rate, as for a line (see append_line())
+    int selected_extruder = get_active_extruder();
+    if(selected_extruder > 0 && target[selected_extruder] != machine_position[selected_extruder]) {
+        float data[2] = {target[selected_extruder] - machine_position[selected_extruder], rate_mm_s / distance};
+        if(PublicData::set_value(extruder_checksum, target_checksum, data)) {
+            rate_mm_s *= data[1]; // adjust the feedrate
+        }
+    }
+#endif
+
+    // the way it starts off and ends up going, round the arc and along the linear travel
+    float unit_vec[N_PRIMARY_AXIS], exit_unit_vec[N_PRIMARY_AXIS];
+    memset(unit_vec, 0, sizeof(unit_vec));
+    memset(exit_unit_vec, 0, sizeof(exit_unit_vec));
+    float k = (angular_travel < 0 ? -theta : theta) / distance;
+    float cos_T = cosf(angular_travel);
+    float sin_T = sinf(angular_travel);
+    unit_vec[plane_axis_0] = -r_axis1 * k;
+    unit_vec[plane_axis_1] = r_axis0 * k;
+    unit_vec[plane_axis_2] = linear_travel / distance;
+    exit_unit_vec[plane_axis_0] = -(r_axis0 * sin_T + r_axis1 * cos_T) * k;
+    exit_unit_vec[plane_axis_1] = (r_axis0 * cos_T - r_axis1 * sin_T) * k;
+    exit_unit_vec[plane_axis_2] = unit_vec[plane_axis_2];
+
+    // the axes in the plane each go as fast as the path round the arc at some point
+    for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+        float f = (i == plane_axis_2 ? fabsf(linear_travel) : radius * theta) / distance;
+        if(max_speeds[i] > 0 && f * rate_mm_s > max_speeds[i]) {
+            rate_mm_s = max_speeds[i] / f;
+        }
+    }
+    if(this->max_speed > 0 && rate_mm_s > this->max_speed) {
+        rate_mm_s = this->max_speed;
+    }
+
+    ActuatorCoordinates actuator_pos;
+    arm_solution->cartesian_to_actuator(target, actuator_pos);
+#if MAX_ROBOT_ACTUATORS > 3
+    for (size_t i = E_AXIS; i < n_motors; i++) {
+        actuator_pos[i] = target[i];
+        if(actuators[i]->is_extruder() && get_e_scale_fnc) {
+            actuator_pos[i] *= get_e_scale_fnc();
+        }
+    }
+#endif
+
+    float acceleration = default_acceleration;
+    float jerk = default_jerk;
+
+    // check per-actuator speed and acceleration limits, one moved round the arc goes as fast as its radius around it
+    // at some point
+    float moves[n_motors];
+    for (size_t actuator = 0; actuator < n_motors; actuator++) {
+        moves[actuator] = fabsf(actuator_pos[actuator] - actuators[actuator]->get_last_milestone());
+        if(actuator <= Z_AXIS && (arc.motors & (1 << actuator))) {
+            moves[actuator] = hypotf(arc.a[actuator], arc.b[actuator]) / 256 / actuators[actuator]->get_steps_per_mm() * theta;
+        }
+    }
+    limit_actuators(moves, distance, rate_mm_s, acceleration, jerk);
+
+    // going round the arc is an acceleration towards the center
+    rate_mm_s = std::min(rate_mm_s, sqrtf(acceleration * radius));
+
+    // if we are in feed hold wait here until it is released
+    while(THEKERNEL->get_feed_hold()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+        if(THEKERNEL->is_halted()) return false;
+    }
+
+    if(THEKERNEL->planner->append_block(actuator_pos, n_motors, rate_mm_s, distance, unit_vec, acceleration, jerk, s_value, is_g123, 0, 0, &arc, exit_unit_vec)) {
+        memcpy(this->compensated_machine_position, target, n_motors * sizeof(float));
+        return true;
+    }
+
+    return false;
+}
+
 // Do the math for an arc and add it to the queue
 bool Robot::compute_arc(Gcode * gcode, const float offset[], const float target[], enum MOTION_MODE_T motion_mode)
 {
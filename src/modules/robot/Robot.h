@@ -17,6 +17,7 @@ using std::string;
 
 #include "libs/Module.h"
 #include "ActuatorCoordinates.h"
+#include "Block.h"
 #include "nuts_bolts.h"
 
 class Gcode;
@@ -46,6 +47,10 @@ class Robot : public Module {
         float get_feed_rate() const;
         float get_s_value() const { return s_value; }
         void set_s_value(float s) { s_value= s; }
+        // pixels the laser has queued in its raster buffer, they go with the next G1 that moves
+        void add_raster_pixels(uint16_t start, uint16_t n) { if(raster_pixels == 0) raster_start= start; raster_pixels+= n; }
+        uint16_t get_raster_pixels() const { return raster_pixels; }
+        void clear_raster_pixels() { raster_pixels= 0; }
         void  push_state();
         void  pop_state();
         void check_max_actuator_speeds();
@@ -61,6 +66,7 @@ class Robot : public Module {
         std::tuple<float, float, float, uint8_t> get_last_probe_position() const { return last_probe_position; }
         void set_last_probe_position(std::tuple<float, float, float, uint8_t> p) { last_probe_position = p; }
         bool delta_move(const float delta[], float rate_mm_s, uint8_t naxis);
+        const char *append_frame_move(const float xyz[3], float e, float f, bool rapid);
         uint8_t register_motor(StepperMotor*);
         uint8_t get_number_registered_motors() const {return n_motors; }
 
@@ -93,6 +99,7 @@ class Robot : public Module {
             bool is_g123:1;
             bool soft_endstop_enabled:1;
             bool soft_endstop_halt:1;
+            bool native_arcs:1;                               // Setting : arcs are one block each on a cartesian like machine
             uint8_t plane_axis_0:2;                           // Current plane ( XY, XZ, YZ )
             uint8_t plane_axis_1:2;
             uint8_t plane_axis_2:2;
@@ -110,8 +117,16 @@ class Robot : public Module {
 
         void load_config();
         bool append_milestone(const float target[], float rate_mm_s);
+        bool append_transformed_milestone(const float transformed_target[], float rate_mm_s, const ActuatorCoordinates *solved);
+        void limit_actuators(const float moves[], float distance, float& rate_mm_s, float& acceleration, float& jerk) const;
+        struct adaptive_line_t;
+        bool append_adaptive_line(const float target[], float rate_mm_s, uint16_t pixels, uint16_t max_segments);
+        bool append_adaptive_segment(const adaptive_line_t& line, uint32_t from, uint32_t to, const ActuatorCoordinates& from_pos, float to_target[], const ActuatorCoordinates& to_pos);
         bool append_line( Gcode* gcode, const float target[], float rate_mm_s, float delta_e);
+        bool append_line( const float target[], float rate_mm_s, float delta_e, bool xy_move, bool is_g1);
         bool append_arc( Gcode* gcode, const float target[], const float offset[], float radius, bool is_clockwise );
+        bool arc_actuators(const float target[], float r_axis0, float r_axis1, float angular_travel, float linear_travel, Block::arc_t& arc) const;
+        bool append_arc_block(const float target[], float rate_mm_s, const Block::arc_t& arc, float r_axis0, float r_axis1, float angular_travel, float linear_travel, float distance);
         bool compute_arc(Gcode* gcode, const float offset[], const float target[], enum MOTION_MODE_T motion_mode);
         void process_move(Gcode *gcode, enum MOTION_MODE_T);
         bool is_homed(uint8_t i) const;
@@ -138,9 +153,13 @@ class Robot : public Module {
         float mm_per_arc_segment;                            // Setting : Used to split arcs into segments
         float mm_max_arc_error;                              // Setting : Used to limit total arc segments to max error
         float delta_segments_per_second;                     // Setting : Used to split lines into segments for delta based on speed
+        float segment_max_error;                             // Setting : if set lines are split until the actuators are within this many steps of the line
         float seconds_per_minute;                            // for realtime speed change
         float default_acceleration;                          // the defualt accleration if not set for each axis
+        float default_jerk;                                  // jerk in mm/s³ for s-curve acceleration, 0 is trapezoidal
         float s_value;                                       // modal S value
+        uint16_t raster_start, raster_pixels;                // laser raster pixels queued for the next G1
+        uint16_t segment_raster_start, segment_raster_pixels; // the share of them for the segment being appended
 
         // Number of arc generation iterations by small angle approximation before exact arc trajectory
         // correction. This parameter may be decreased if there are issues with the accuracy of the arc
@@ -0,0 +1,238 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SCurve.h"
+
+#include <cmath>
+#include <algorithm>
+
+// distance covered in time t from the start of a piece
+static inline float piece_distance(const SCurve::piece_t& p, float t)
+{
+    return t * (p.v + t * (p.a / 2.0F + t * p.j / 6.0F));
+}
+
+void SCurve::plan(float v0, float a0, float v1, float vmax, float distance, float acceleration, float jerk)
+{
+    this->acceleration = acceleration;
+    this->jerk = jerk;
+
+    // the speed it gets to by just ramping the acceleration to zero
+    float v_stop = std::max(0.0F, v0 + a0 * fabsf(a0) / (2.0F * jerk));
+
+    // the distance only grows with the plateau speed, find the highest one that fits by bisection
+    float lo, hi;
+    if(v_stop <= vmax && profile(v0, a0, v_stop, v1, distance, false) <= distance) {
+        // accelerate to a plateau
+        lo = v_stop;
+        hi = vmax;
+    } else {
+        // it has to slow down below where it is heading first, at most down to the exit speed. If even that does not
+        // fit a lower exit speed is looked for below
+        lo = std::min(v1, std::min(v_stop, vmax));
+        hi = std::min(v_stop, vmax);
+    }
+
+    if(profile(v0, a0, hi, v1, distance, false) <= distance) {
+        lo = hi;
+    } else if(profile(v0, a0, lo, v1, distance, false) <= distance) {
+        for (int i = 0; i < 16; ++i) {
+            float mid = (lo + hi) / 2.0F;
+            if(profile(v0, a0, mid, v1, distance, false) <= distance) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+    }
+
+    if(profile(v0, a0, lo, v1, distance, false) > distance) {
+        // any exit speed up to v1 will do, and slowing down to one with no acceleration left can take longer the closer
+        // it is to the start speed. Find the exit that takes the least distance, then the highest that fits
+        float e_lo = 0.0F, e_hi = lo;
+        for (int i = 0; i < 16; ++i) {
+            float m1 = e_lo + (e_hi - e_lo) / 3.0F;
+            float m2 = e_hi - (e_hi - e_lo) / 3.0F;
+            if(ramp(v0, a0, m1, false) < ramp(v0, a0, m2, false)) {
+                e_hi = m2;
+            } else {
+                e_lo = m1;
+            }
+        }
+        if(ramp(v0, a0, e_lo, false) <= distance) {
+            e_hi = lo;
+            for (int i = 0; i < 16; ++i) {
+                float mid = (e_lo + e_hi) / 2.0F;
+                if(ramp(v0, a0, mid, false) <= distance) {
+                    e_lo = mid;
+                } else {
+                    e_hi = mid;
+                }
+            }
+            lo = v1 = e_lo;
+        }
+    }
+
+    n_pieces = 0;
+    end_x = 0.0F;
+    end_v = v0;
+    end_a = a0;
+    fit = profile(v0, a0, lo, v1, distance, true) <= distance;
+}
+
+// ramp to the plateau vp, cruise for what is left of the distance and ramp down to v1 if that is lower, returns the
+// distance of the ramps
+float SCurve::profile(float v0, float a0, float vp, float v1, float distance, bool build)
+{
+    float ve = std::min(vp, v1);
+    float d = ramp(v0, a0, vp, false) + ramp(vp, 0.0F, ve, false);
+    if(build) {
+        ramp(v0, a0, vp, true);
+        if(distance > d && vp > 0.0F) add_piece(0.0F, (distance - d) / vp);
+        ramp(vp, 0.0F, ve, true);
+    }
+    return d;
+}
+
+// change from v0 and a0 to v1 with no acceleration, returns the distance it takes.
+// The acceleration ramps towards the change (s = 1 up, s = -1 down) to at most the acceleration, holds there if it
+// reached it and ramps back to zero. With b0 = s * a0 and the peak bp the speed changes by
+//     (2 * bp² - b0²) / (2 * jerk) + bp * hold_time
+float SCurve::ramp(float v0, float a0, float v1, bool build)
+{
+    float s = (v1 - v0 >= a0 * fabsf(a0) / (2.0F * jerk)) ? 1.0F : -1.0F;
+    float b0 = s * a0;
+    float dv = s * (v1 - v0);
+
+    float bp = sqrtf(std::max(0.0F, jerk * dv + b0 * b0 / 2.0F));
+    float hold = 0.0F;
+    float amax = std::max(acceleration, b0);
+    if(bp > amax) {
+        bp = amax;
+        hold = std::max(0.0F, (dv - (2.0F * bp * bp - b0 * b0) / (2.0F * jerk)) / bp);
+    }
+
+    const float t[3] = { (bp - b0) / jerk, hold, bp / jerk };
+    const float j[3] = { s * jerk, 0.0F, -s * jerk };
+    piece_t p{0.0F, v0, a0, 0.0F, 0.0F};
+    float d = 0.0F;
+    for (int i = 0; i < 3; ++i) {
+        if(t[i] <= 0.0F) continue;
+        if(build) add_piece(j[i], t[i]);
+        p.j = j[i];
+        d += piece_distance(p, t[i]);
+        p.v += t[i] * (p.a + t[i] * p.j / 2.0F);
+        p.a += t[i] * p.j;
+    }
+    if(build) {
+        // exactly where it was going, rather than with the rounding of adding up the pieces
+        end_v = v1;
+        end_a = 0.0F;
+    }
+    return d;
+}
+
+void SCurve::add_piece(float j, float t)
+{
+    if(n_pieces >= sizeof(pieces) / sizeof(pieces[0])) return;
+    piece_t& p = pieces[n_pieces++];
+    p.x = end_x;
+    p.v = end_v;
+    p.a = end_a;
+    p.j = j;
+    p.t = t;
+    end_x += piece_distance(p, t);
+    end_v += t * (end_a + t * j / 2.0F);
+    end_a += t * j;
+}
+
+void SCurve::locate(float distance, uint8_t& piece, float& t) const
+{
+    piece = 0;
+    t = 0.0F;
+    if(n_pieces == 0) return;
+
+    while(piece + 1 < n_pieces && pieces[piece + 1].x <= distance) ++piece;
+    const piece_t& p = pieces[piece];
+    float d = distance - p.x;
+    float length = piece_distance(p, p.t);
+    if(d <= 0.0F) return;
+    if(d >= length) {
+        t = p.t;
+        return;
+    }
+
+    // the distance only grows with the time, so Newton's method is kept in a shrinking bracket
+    float lo = 0.0F, hi = p.t;
+    float x = p.t * d / length;
+    for (int i = 0; i < 12; ++i) {
+        float f = piece_distance(p, x) - d;
+        if(f > 0.0F) hi = x;
+        else lo = x;
+        float v = p.v + x * (p.a + x * p.j / 2.0F);
+        float n = v > 0.0F ? x - f / v : (lo + hi) / 2.0F;
+        // converged, x is an end of the bracket by now so it has to be checked before the bracket is
+        if(n == x) break;
+        if(!(n > lo && n < hi)) n = (lo + hi) / 2.0F;
+        x = n;
+    }
+    t = x;
+}
+
+void SCurve::get_state(uint8_t piece, float t, float& v, float& a) const
+{
+    if(n_pieces == 0) {
+        v = end_v;
+        a = end_a;
+        return;
+    }
+    const piece_t& p = pieces[piece];
+    v = p.v + t * (p.a + t * p.j / 2.0F);
+    a = p.a + t * p.j;
+}
+
+float SCurve::speed_at(float distance) const
+{
+    uint8_t piece;
+    float t, v, a;
+    locate(distance, piece, t);
+    get_state(piece, t, v, a);
+    return v;
+}
+
+float SCurve::get_distance() const
+{
+    return end_x;
+}
+
+float SCurve::get_exit_speed() const
+{
+    return end_v;
+}
+
+float SCurve::max_entry_speed(float v1, float distance, float acceleration, float jerk)
+{
+    // the distance to change speed from v0 to v1 is (v0 + v1) / 2 * time as the ramps are symmetrical
+    float a = acceleration;
+    float c = a * a / jerk; // speed change needed to reach the full acceleration
+
+    // when the full acceleration is reached distance = (v0² - v1²) / 2a + (v0 + v1) * c / 2a, solve for v0
+    float v0 = sqrtf((v1 - c / 2.0F) * (v1 - c / 2.0F) + 2.0F * a * distance) - c / 2.0F;
+    if(v0 - v1 >= c) return v0;
+
+    // otherwise distance = (v0 + v1) * sqrt((v0 - v1) / jerk), find v0 by bisection
+    float lo = 0.0F, hi = c;
+    for (int i = 0; i < 16; ++i) {
+        float dv = (lo + hi) / 2.0F;
+        if((2.0F * v1 + dv) * sqrtf(dv / jerk) > distance) {
+            hi = dv;
+        } else {
+            lo = dv;
+        }
+    }
+    return v1 + lo;
+}
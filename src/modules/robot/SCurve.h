@@ -0,0 +1,57 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// A jerk limited speed profile over a distance, made of up to 7 pieces of constant jerk. It starts at a speed and
+// acceleration, ramps the acceleration up and back down to change to a plateau speed, cruises, and ramps down to the
+// exit speed ending with no acceleration. The planner plans one over a run of blocks and each block gets the part
+// that falls on it (see Planner::recalculate_s_curve() and Block::calculate_s_curve()).
+// Speeds are in mm/s, distances in mm, times in seconds.
+class SCurve {
+    public:
+        SCurve() : n_pieces(0), end_x(0), end_v(0), end_a(0), fit(true) {}
+
+        // plan from speed v0 and acceleration a0 to exit at no more than v1 over distance, not faster than vmax
+        void plan(float v0, float a0, float v1, float vmax, float distance, float acceleration, float jerk);
+
+        // the piece the given distance falls on and the time into that piece
+        void locate(float distance, uint8_t& piece, float& t) const;
+        void get_state(uint8_t piece, float t, float& v, float& a) const;
+        float speed_at(float distance) const;
+
+        float get_distance() const;
+        float get_exit_speed() const;
+        // false if it could not slow down to any exit speed up to v1 within the distance, it then runs on past it
+        bool fits() const { return fit; }
+
+        // the highest speed with no acceleration that can change to v1 with no acceleration within distance
+        static float max_entry_speed(float v1, float distance, float acceleration, float jerk);
+
+        using piece_t= struct {
+            float x;    // distance from the start of the profile to the start of the piece
+            float v;    // speed at the start of the piece
+            float a;    // acceleration at the start of the piece
+            float j;    // jerk, constant over the piece
+            float t;    // duration
+        };
+        piece_t pieces[7];
+        uint8_t n_pieces;
+
+    private:
+        float profile(float v0, float a0, float vp, float v1, float distance, bool build);
+        float ramp(float v0, float a0, float v1, bool build);
+        void add_piece(float j, float t);
+
+        float acceleration;
+        float jerk;
+        // the end of the pieces built so far
+        float end_x, end_v, end_a;
+        bool fit;
+};
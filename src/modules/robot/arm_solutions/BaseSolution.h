@@ -2,8 +2,8 @@
 #ifndef BASESOLUTION_H
 #define BASESOLUTION_H
 
-#include <map>
 #include "ActuatorCoordinates.h"
+#include "LetterTable.h"
 
 class Config;
 
@@ -14,7 +14,12 @@ class BaseSolution {
         virtual ~BaseSolution() {};
         virtual void cartesian_to_actuator(const float[], ActuatorCoordinates &) const = 0;
         virtual void actuator_to_cartesian(const ActuatorCoordinates &, float[]) const = 0;
-        typedef std::map<char, float> arm_options_t;
+
+        // the actuator positions are a linear function of X, Y and Z, so an arc moves each of them on an ellipse and
+        // the step ticker can move them around it as one block (see Robot::append_arc())
+        virtual bool is_linear() const { return false; }
+
+        typedef LetterTable<float> arm_options_t;
         virtual bool set_optional(const arm_options_t& options) { return false; };
         virtual bool get_optional(arm_options_t& options, bool force_all= false) const { return false; };
 };
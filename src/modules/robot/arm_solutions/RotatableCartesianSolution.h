@@ -14,6 +14,7 @@ class RotatableCartesianSolution : public BaseSolution {
         RotatableCartesianSolution(Config*);
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
+        bool is_linear() const override { return true; }
 
     private:
         void rotate(const float in[], float out[], float sin, float cos) const;
@@ -29,6 +29,7 @@
 #include "StepTicker.h"
 #include "BaseSolution.h"
 #include "SerialMessage.h"
+#include "EdgeTrigger.h"
 
 #include <ctype.h>
 #include <algorithm>
@@ -87,6 +88,7 @@ enum DEFNS {MIN_PIN, MAX_PIN, MAX_TRAVEL, FAST_RATE, SLOW_RATE, RETRACT, DIRECTI
 #define max_travel_checksum                CHECKSUM("max_travel")
 #define retract_checksum                   CHECKSUM("retract")
 #define limit_checksum                     CHECKSUM("limit_enable")
+#define interrupt_checksum                 CHECKSUM("interrupt")
 
 #define STEPPER THEROBOT->actuators
 #define STEPS_PER_MM(a) (STEPPER[a]->get_steps_per_mm())
@@ -190,6 +192,7 @@ bool Endstops::load_old_config()
             if((hinfo.home_direction && j == MIN_PIN) || (!hinfo.home_direction && j == MAX_PIN)) hinfo.pin_info= info;
 
             // init struct
+            info->edge= nullptr;
             info->debounce= 0;
             info->axis= 'X'+i;
             info->axis_index= i;
@@ -288,10 +291,21 @@ bool Endstops::load_config()
         if(i > max_index) max_index= i;
 
         // init pin struct
+        pin_info->edge= nullptr;
         pin_info->debounce= 0;
         pin_info->axis= toupper(axis[0]);
         pin_info->axis_index= i;
 
+        // stop the motor from the pin's edge interrupt when homing rather than when it is next polled, no debounce
+        if(THEKERNEL->config->value(endstop_checksum, cs, interrupt_checksum)->by_default(false)->as_bool()) {
+            pin_info->edge= new EdgeTrigger();
+            if(!pin_info->edge->attach(&pin_info->pin)) {
+                printf("WARNING: endstop pin %d.%d can not interrupt, only pins on ports 0 and 2 can, it is polled\n", pin_info->pin.port_number, pin_info->pin.pin);
+                delete pin_info->edge;
+                pin_info->edge= nullptr;
+            }
+        }
+
         // are limits enabled
         pin_info->limit_enable= THEKERNEL->config->value(endstop_checksum, cs, limit_checksum)->by_default(false)->as_bool();
         limit_enabled |= pin_info->limit_enable;
@@ -620,7 +634,11 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
                     e.pin_info->debounce++;
 
                 } else {
-                    if(is_corexy && (m == X_AXIS || m == Y_AXIS)) {
+                    if(e.pin_info->edge != nullptr) {
+                        // stop the motors it was armed for the way the edge interrupt does, nothing if that did already
+                        e.pin_info->edge->trigger();
+
+                    } else if(is_corexy && (m == X_AXIS || m == Y_AXIS)) {
                         // corexy when moving in X or Y we need to stop both the X and Y motors
                         STEPPER[X_AXIS]->stop_moving();
                         STEPPER[Y_AXIS]->stop_moving();
@@ -642,6 +660,33 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
     return 0;
 }
 
+// the homing endstops with an edge interrupt stop their motors from it, polling still checks them too in case the pin
+// was already active or an edge was missed and then triggers the edge itself
+void Endstops::arm_edges()
+{
+    for(auto& e : homing_axis) {
+        if(e.pin_info == nullptr || e.pin_info->edge == nullptr) continue;
+        int m= e.axis_index;
+
+        if(is_corexy && (m == X_AXIS || m == Y_AXIS)) {
+            // corexy homes one of X or Y at a time and both motors move for either
+            if(axis_to_home[m]) e.pin_info->edge->arm((1 << X_AXIS) | (1 << Y_AXIS));
+        } else {
+            e.pin_info->edge->arm(1 << m);
+        }
+    }
+}
+
+// an endstop that stopped its motor from the interrupt is triggered as if polling had seen it
+void Endstops::disarm_edges()
+{
+    for(auto& e : homing_axis) {
+        if(e.pin_info == nullptr || e.pin_info->edge == nullptr) continue;
+        e.pin_info->edge->disarm();
+        if(e.pin_info->edge->is_triggered()) e.pin_info->triggered= true;
+    }
+}
+
 void Endstops::home_xy()
 {
     if(axis_to_home[X_AXIS] && axis_to_home[Y_AXIS]) {
@@ -685,6 +730,7 @@ void Endstops::home(axis_bitmap_t a)
 
     // Start moving the axes to the origin
     this->status = MOVING_TO_ENDSTOP_FAST;
+    arm_edges();
 
     THEROBOT->disable_segmentation= true; // we must disable segmentation as this won't work with it enabled
 
@@ -717,6 +763,8 @@ void Endstops::home(axis_bitmap_t a)
         }
     }
 
+    disarm_edges();
+
     // check that the endstops were hit and it did not stop short for some reason
     // if the endstop is not triggered then enter ALARM state
     // with deltas we check all three axis were triggered, but at least one of XYZ must be set to home
@@ -772,6 +820,7 @@ void Endstops::home(axis_bitmap_t a)
 
     // Start moving the axes towards the endstops slowly
     this->status = MOVING_TO_ENDSTOP_SLOW;
+    arm_edges();
     for (auto& i : homing_axis) {
         int c= i.axis_index;
         if(axis_to_home[c]) {
@@ -784,6 +833,7 @@ void Endstops::home(axis_bitmap_t a)
     THEROBOT->delta_move(delta, feed_rate, homing_axis.size());
     // wait until finished
     THECONVEYOR->wait_for_idle();
+    disarm_edges();
 
     // we did not complete movement the full distance if we hit the endstops
     // TODO Maybe only reset axis involved in the homing cycle
@@ -17,6 +17,7 @@
 class StepperMotor;
 class Gcode;
 class Pin;
+class EdgeTrigger;
 
 class Endstops : public Module{
     public:
@@ -40,6 +41,8 @@ class Endstops : public Module{
         void process_home_command(Gcode* gcode);
         void set_homing_offset(Gcode* gcode);
         uint32_t read_endstops(uint32_t dummy);
+        void arm_edges();
+        void disarm_edges();
         void handle_park();
         void on_idle(void*);
 
@@ -54,6 +57,7 @@ class Endstops : public Module{
         // per endstop settings
         using endstop_info_t = struct {
             Pin pin;
+            EdgeTrigger *edge; // stops the motor from the pin's edge interrupt, nullptr if it is only polled
             struct {
                 uint16_t debounce:16;
                 char axis:8; // one of XYZABC
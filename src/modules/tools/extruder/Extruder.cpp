@@ -14,6 +14,7 @@
 #include "modules/robot/Block.h"
 #include "StepperMotor.h"
 #include "SlowTicker.h"
+#include "StepTicker.h"
 #include "Config.h"
 #include "StepperMotor.h"
 #include "Robot.h"
@@ -35,6 +36,7 @@
 #define dir_pin_checksum                     CHECKSUM("dir_pin")
 #define en_pin_checksum                      CHECKSUM("en_pin")
 #define max_speed_checksum                   CHECKSUM("max_speed")
+#define max_speed_change_checksum            CHECKSUM("max_speed_change")
 #define x_offset_checksum                    CHECKSUM("x_offset")
 #define y_offset_checksum                    CHECKSUM("y_offset")
 #define z_offset_checksum                    CHECKSUM("z_offset")
@@ -46,6 +48,9 @@
 #define retract_zlift_length_checksum        CHECKSUM("retract_zlift_length")
 #define retract_zlift_feedrate_checksum      CHECKSUM("retract_zlift_feedrate")
 
+#define pressure_advance_checksum            CHECKSUM("pressure_advance")
+#define pressure_advance_smooth_time_checksum CHECKSUM("pressure_advance_smooth_time")
+
 #define PI 3.14159265358979F
 
 
@@ -118,9 +123,23 @@ void Extruder::config_load()
 
     stepper_motor->set_max_rate(THEKERNEL->config->value(extruder_checksum, this->identifier, max_speed_checksum)->by_default(1000)->as_number());
     stepper_motor->set_acceleration(acceleration);
+    // mm/sec, only used if the planner max_speed_change is set, the extruder is not limited at junctions without it
+    stepper_motor->set_max_speed_change(THEKERNEL->config->value(extruder_checksum, this->identifier, max_speed_change_checksum)->by_default(NAN)->as_number());
     stepper_motor->change_steps_per_mm(steps_per_millimeter);
     stepper_motor->set_selected(false); // not selected by default
     stepper_motor->set_extruder(true);  // indicates it is an extruder
+
+    // pressure advance in seconds, the extruder is ahead by its speed times this, smoothed with a time constant
+    float advance     = THEKERNEL->config->value(extruder_checksum, this->identifier, pressure_advance_checksum)->by_default(0)->as_number();
+    float smooth_time = THEKERNEL->config->value(extruder_checksum, this->identifier, pressure_advance_smooth_time_checksum)->by_default(0.02F)->as_number();
+    set_pressure_advance(advance, smooth_time);
+}
+
+// only called when nothing is moving
+void Extruder::set_pressure_advance(float advance, float smooth_time)
+{
+    this->pressure_advance.configure(advance, smooth_time, THEKERNEL->step_ticker->get_frequency());
+    THEKERNEL->step_ticker->set_pressure_advance(motor_id, advance > 0 ? &this->pressure_advance : nullptr);
 }
 
 void Extruder::select()
@@ -312,6 +331,19 @@ void Extruder::on_gcode_received(void *argument)
             if(gcode->has_letter('S')) retract_recover_length = gcode->get_value('S');
             if(gcode->has_letter('F')) retract_recover_feedrate = gcode->get_value('F') / 60.0F; // specified in mm/min converted to mm/sec
 
+        } else if (gcode->m == 900 && ( (this->selected && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
+            // M900 - set pressure advance K[seconds, 0 is off] S[smoothing time constant seconds]
+            if(gcode->has_letter('K') || gcode->has_letter('S')) {
+                float advance = gcode->has_letter('K') ? gcode->get_value('K') : pressure_advance.get_advance();
+                float smooth_time = gcode->has_letter('S') ? gcode->get_value('S') : pressure_advance.get_smooth_time();
+                THEKERNEL->conveyor->wait_for_idle();
+                set_pressure_advance(advance, smooth_time);
+
+            } else {
+                gcode->stream->printf("K:%g S:%g", pressure_advance.get_advance(), pressure_advance.get_smooth_time());
+                gcode->add_nl = true;
+            }
+
         } else if (gcode->m == 221 && this->selected) { // M221 S100 change flow rate by percentage
             if(gcode->has_letter('S')) {
                 float last_scale = this->extruder_multiplier;
@@ -334,6 +366,7 @@ void Extruder::on_gcode_received(void *argument)
             gcode->stream->printf(";E retract recover length, feedrate:\nM208 S%1.4f F%1.4f P%d\n", this->retract_recover_length, this->retract_recover_feedrate * 60.0F, this->identifier);
             gcode->stream->printf(";E acceleration mm/sec²:\nM204 E%1.4f P%d\n", stepper_motor->get_acceleration(), this->identifier);
             gcode->stream->printf(";E max feed rate mm/sec:\nM203 E%1.4f P%d\n", stepper_motor->get_max_rate(), this->identifier);
+            gcode->stream->printf(";E pressure advance secs, smoothing secs:\nM900 K%1.4f S%1.4f P%d\n", pressure_advance.get_advance(), pressure_advance.get_smooth_time(), this->identifier);
             if(this->max_volumetric_rate > 0) {
                 gcode->stream->printf(";E max volumetric rate mm³/sec:\nM203 V%1.4f P%d\n", this->max_volumetric_rate, this->identifier);
             }
@@ -11,6 +11,7 @@
 
 #include "Tool.h"
 #include "Pin.h"
+#include "PressureAdvance.h"
 
 #include <tuple>
 
@@ -36,6 +37,7 @@ class Extruder : public Tool {
         float check_max_speeds(float target, float isecs);
         void save_position();
         void restore_position();
+        void set_pressure_advance(float advance, float smooth_time);
 
         StepperMotor *stepper_motor;
 
@@ -44,6 +46,9 @@ class Extruder : public Tool {
         float volumetric_multiplier;
         float max_volumetric_rate;      // used for calculating volumetric rate in mm³/sec
 
+        // keeps the extruder ahead of its steps by its speed, in the step ticker when the advance is set
+        PressureAdvance pressure_advance;
+
         // for firmware retract
         float retract_length;               // firmware retract length
         float retract_feedrate;
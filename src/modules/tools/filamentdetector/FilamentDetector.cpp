@@ -80,7 +80,6 @@ void FilamentDetector::on_module_loaded()
     if (this->encoder_pin != nullptr) {
         // set interrupt on rising edge
         this->encoder_pin->rise(this, &FilamentDetector::on_pin_rise);
-        NVIC_SetPriority(EINT3_IRQn, 16); // set to low priority
     }
 
 
@@ -118,7 +117,10 @@ void FilamentDetector::on_console_line_received( void *argument )
 {
     if(!active) return;
 
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
+    SerialMessage &new_message = *static_cast<SerialMessage *>(argument);
+    // only resume matters, checked before the line is copied
+    if(new_message.message.compare(0, 6, "resume") != 0) return;
+
     string possible_command = new_message.message;
     string cmd = shift_parameter(possible_command);
     if(cmd == "resume") {
@@ -18,13 +18,17 @@
 #include "Block.h"
 #include "SlowTicker.h"
 #include "Robot.h"
+#include "Conveyor.h"
 #include "utils.h"
 #include "Pin.h"
 #include "Gcode.h"
 #include "PwmOut.h" // mbed.h lib
+#include "LPC17xx.h"
 #include "PublicDataRequest.h"
 
 #include <algorithm>
+#include <functional>
+#include <math.h>
 
 #define laser_checksum                          CHECKSUM("laser")
 #define laser_module_enable_checksum            CHECKSUM("laser_module_enable")
@@ -38,6 +42,8 @@
 #define laser_module_max_power_checksum         CHECKSUM("laser_module_max_power")
 #define laser_module_maximum_s_value_checksum   CHECKSUM("laser_module_maximum_s_value")
 #define laser_module_proportional_power_checksum   CHECKSUM("laser_module_proportional_power")
+#define laser_module_update_frequency_checksum  CHECKSUM("laser_module_update_frequency")
+#define laser_module_raster_buffer_size_checksum CHECKSUM("laser_module_raster_buffer_size")
 
 
 Laser::Laser()
@@ -46,6 +52,16 @@ Laser::Laser()
     scale = 1;
     manual_fire = false;
     fire_duration = 0;
+    follow_steps = false;
+    following = false;
+    follow_rate = false;
+    block_duty = 0;
+    rate_scale = 0;
+    raster_buffer = nullptr;
+    raster_mask = 0;
+    raster_head = raster_tail = 0;
+    raster_file = nullptr;
+    raster_pixels = 0;
 }
 
 void Laser::on_module_loaded()
@@ -76,6 +92,17 @@ void Laser::on_module_loaded()
 
     this->pwm_inverting = dummy_pin->is_inverting();
 
+    // the PWM1 channel of the pin as mbed maps it, P2.n is channel n+1
+    if(dummy_pin->port_number == 2) {
+        pwm_channel = dummy_pin->pin + 1;
+    } else if(dummy_pin->port_number == 3) {
+        pwm_channel = dummy_pin->pin - 23;
+    } else {
+        static const uint8_t port1_channels[] = {1, 0, 2, 3, 0, 4, 5, 0, 6}; // P1.18 to P1.26
+        pwm_channel = port1_channels[dummy_pin->pin - 18];
+    }
+    pwm_match = pwm_channel <= 3 ? &LPC_PWM1->MR0 + pwm_channel : &LPC_PWM1->MR4 + pwm_channel - 4;
+
     delete dummy_pin;
     dummy_pin = NULL;
 
@@ -107,6 +134,7 @@ void Laser::on_module_loaded()
 
     // S value that represents maximum (default 1)
     this->laser_maximum_s_value = THEKERNEL->config->value(laser_module_maximum_s_value_checksum)->by_default(1.0f)->as_number() ;
+    set_duty_scale();
 
     set_laser_power(0);
 
@@ -117,8 +145,33 @@ void Laser::on_module_loaded()
     this->register_for_event(ON_GET_PUBLIC_DATA);
 
     // no point in updating the power more than the PWM frequency, but not faster than 1KHz
-    ms_per_tick = 1000 / std::min(1000UL, (uint32_t)pwm_frequency);
-    THEKERNEL->slow_ticker->attach(std::min(1000UL, 1000000 / period), this, &Laser::set_proportional_power);
+    ms_per_tick = 1000 / std::min((uint32_t)1000, (uint32_t)pwm_frequency);
+    THEKERNEL->slow_ticker->attach(std::min((uint32_t)1000, 1000000 / period), this, &Laser::set_proportional_power);
+
+    // the power follows the speed from the step interrupt, the slow ticker then only times the manual fire
+    update_frequency = THEKERNEL->config->value(laser_module_update_frequency_checksum)->by_default(0)->as_number();
+    if(update_frequency > 0) {
+        follow_steps = true;
+        set_update_ticks();
+        THEKERNEL->step_ticker->block_start_fnc = std::bind(&Laser::on_block_start, this, std::placeholders::_1);
+        THEKERNEL->step_ticker->speed_fnc = std::bind(&Laser::on_speed_change, this, std::placeholders::_1);
+
+        // rasters need the power set from the step interrupt, the ring is a power of 2 pixels
+        uint32_t size = THEKERNEL->config->value(laser_module_raster_buffer_size_checksum)->by_default(1024)->as_number();
+        if(size > 0) {
+            uint32_t n = 16;
+            while(n < size && n < 32768) n <<= 1;
+            raster_buffer = new uint8_t[n];
+            raster_mask = n - 1;
+        }
+    }
+}
+
+// step ticks between power updates, no point in updating the power more than the PWM frequency
+void Laser::set_update_ticks()
+{
+    float f = std::min(update_frequency, pwm_frequency);
+    THEKERNEL->step_ticker->set_speed_ticks(floorf(THEKERNEL->step_ticker->get_frequency() / f));
 }
 
 void Laser::on_console_line_received( void *argument )
@@ -126,13 +179,14 @@ void Laser::on_console_line_received( void *argument )
     if(THEKERNEL->is_halted()) return; // if in halted state ignore any commands
 
     SerialMessage *msgp = static_cast<SerialMessage *>(argument);
-    string possible_command = msgp->message;
 
-    // ignore anything that is not lowercase or a letter
-    if(possible_command.empty() || !islower(possible_command[0]) || !isalpha(possible_command[0])) {
+    // ignore anything that is not lowercase or a letter, checked before the line is copied
+    if(msgp->message.empty() || !islower(msgp->message[0]) || !isalpha(msgp->message[0])) {
         return;
     }
 
+    string possible_command = msgp->message;
+
     string cmd = shift_parameter(possible_command);
 
     // Act depending on command
@@ -178,6 +232,20 @@ void Laser::on_console_line_received( void *argument )
     }
 }
 
+void Laser::set_scale(float s)
+{
+    scale = s / 100;
+    set_duty_scale();
+}
+
+// works out the fixed point power the step interrupt sets from the floats, when the scale or settings change
+void Laser::set_duty_scale()
+{
+    minimum_duty = roundf(confine(laser_minimum_power, 0.0F, 1.0F) * 65536);
+    float d = (laser_maximum_power - laser_minimum_power) * scale / laser_maximum_s_value * (1 << 21); // 2^16 * 2^16 / 2^11
+    duty_per_s = d > 0 ? std::min(d, 4294967040.0F) : 0;
+}
+
 // returns instance
 void Laser::on_get_public_data(void* argument)
 {
@@ -197,11 +265,11 @@ void Laser::on_gcode_received(void *argument)
     if (gcode->has_m) {
         if (gcode->m == 221) { // M221 S100 change laser power by percentage S
             if(gcode->get_num_args() == 0) {
-                gcode->stream->printf("Laser power: %6.2f %%, disable auto power: %d, PWM frequency: %f Hz\n", this->scale * 100.0F, disable_auto_power, pwm_frequency);
+                gcode->stream->printf("Laser power: %6.2f %%, disable auto power: %d, PWM frequency: %f Hz, update frequency: %f Hz\n", this->scale * 100.0F, disable_auto_power, pwm_frequency, update_frequency);
                 return;
             }
             if(gcode->has_letter('S')) {
-                this->scale = gcode->get_value('S') / 100.0F;
+                set_scale(gcode->get_value('S'));
             }
             if(gcode->has_letter('P')) {
                 this->disable_auto_power= gcode->get_uint('P') > 0;
@@ -209,8 +277,130 @@ void Laser::on_gcode_received(void *argument)
             if(gcode->has_letter('R')) {
                 pwm_frequency= gcode->get_value('R');
                 pwm_pin->period(1.0F/pwm_frequency);
+                if(follow_steps) set_update_ticks();
+            }
+
+        } else if (gcode->m == 650) { // M650 hex pixels, or M650 Pn from the M651 file, queue pixels for the next G1
+            queue_raster(gcode);
+
+        } else if (gcode->m == 651) { // M651 file, open the file M650 P reads pixels from, M651 on its own closes it
+            open_raster_file(gcode);
+        }
+    }
+}
+
+// queues the pixels of a raster, the next G1 that moves scales its power by them along the primary axis, 0 is the
+// minimum power and 255 the power of the S value. Inline they are two hex digits each, the line length limits them to
+// about 60 a line so a G1 can take several M650s
+void Laser::queue_raster(Gcode *gcode)
+{
+    if(raster_buffer == nullptr) {
+        gcode->is_error = true;
+        gcode->txt_after_ok = "raster needs laser_module_update_frequency and laser_module_raster_buffer_size";
+        return;
+    }
+
+    uint16_t start = raster_head;
+    uint32_t n = 0;
+    if(gcode->has_letter('P')) {
+        if(raster_file == nullptr) {
+            gcode->is_error = true;
+            gcode->txt_after_ok = "no raster file open, use M651";
+            return;
+        }
+        uint32_t count = gcode->get_uint('P');
+        if(count > (uint32_t)raster_mask + 1) {
+            gcode->is_error = true;
+            gcode->txt_after_ok = "raster count is more than laser_module_raster_buffer_size";
+            return;
+        }
+        if(!wait_for_raster_space(count)) {
+            gcode->is_error = true;
+            gcode->txt_after_ok = "raster buffer full";
+            return;
+        }
+        // the ring wraps, read up to its end at a time
+        while(n < count) {
+            uint16_t i = (start + n) & raster_mask;
+            size_t chunk = std::min(count - n, (uint32_t)raster_mask + 1 - i);
+            size_t got = fread(raster_buffer + i, 1, chunk, raster_file);
+            n += got;
+            if(got < chunk) {
+                // a short line would burn what was read and leave the rest unpowered, the pixels already queued for
+                // the G1 are dropped with these so it has none to run with
+                raster_head -= THEROBOT->get_raster_pixels();
+                THEROBOT->clear_raster_pixels();
+                gcode->is_error = true;
+                gcode->txt_after_ok = "raster file ended";
+                return;
             }
         }
+
+    } else {
+        string args = get_arguments(gcode->get_command());
+        uint32_t digits = 0;
+        for(char c : args) {
+            if(isxdigit(c)) {
+                ++digits;
+            } else if(!is_whitespace(c)) {
+                gcode->is_error = true;
+                gcode->txt_after_ok = "raster pixels must be hex";
+                return;
+            }
+        }
+        if(digits % 2 != 0) {
+            gcode->is_error = true;
+            gcode->txt_after_ok = "raster pixels must be two hex digits each";
+            return;
+        }
+        if(!wait_for_raster_space(digits / 2)) {
+            gcode->is_error = true;
+            gcode->txt_after_ok = "raster buffer full";
+            return;
+        }
+        uint8_t v = 0;
+        digits = 0;
+        for(char c : args) {
+            if(!isxdigit(c)) continue;
+            v = (v << 4) | (isdigit(c) ? c - '0' : (c | 0x20) - 'a' + 10);
+            if(++digits % 2 == 0) raster_buffer[(start + n++) & raster_mask] = v;
+        }
+    }
+
+    raster_head = start + n;
+    THEROBOT->add_raster_pixels(start, n);
+}
+
+// waits for the blocks using the ring to finish until n more pixels fit, false if they never will
+bool Laser::wait_for_raster_space(uint32_t n)
+{
+    while((uint16_t)(raster_head - raster_tail) + n > (uint32_t)raster_mask + 1) {
+        if(THECONVEYOR->is_idle()) {
+            // nothing is running, only the pixels not taken by a G1 yet are needed, those of a G1 that did not move are not
+            raster_tail = raster_head - THEROBOT->get_raster_pixels();
+            if((uint16_t)(raster_head - raster_tail) + n > (uint32_t)raster_mask + 1) return false;
+            break;
+        }
+        THEKERNEL->call_event(ON_IDLE, this);
+        if(THEKERNEL->is_halted()) return false;
+    }
+    return true;
+}
+
+void Laser::open_raster_file(Gcode *gcode)
+{
+    if(raster_file != nullptr) {
+        fclose(raster_file);
+        raster_file = nullptr;
+    }
+
+    string args = get_arguments(gcode->get_command());
+    if(args.empty()) return;
+
+    string filename = "/sd/" + args;
+    raster_file = fopen(filename.c_str(), "r");
+    if(raster_file == nullptr) {
+        gcode->stream->printf("raster file open failed: %s\r\n", filename.c_str());
     }
 }
 
@@ -273,6 +463,9 @@ uint32_t Laser::set_proportional_power(uint32_t dummy)
         return 0;
     }
 
+    // the step interrupt sets the power
+    if(follow_steps) return 0;
+
     float power;
     if(get_laser_power(power)) {
         // adjust power to maximum power and actual velocity
@@ -286,6 +479,98 @@ uint32_t Laser::set_proportional_power(uint32_t dummy)
     return 0;
 }
 
+// called from the step interrupt when a block starts, nullptr when there are no more. The power is worked out here for
+// the speed the block is planned at, so following the speed on each update is a multiply of the primary axis rate
+void Laser::on_block_start(const Block *block)
+{
+    // the pixels of the block that finished can be queued over
+    if(raster_pixels > 0) {
+        raster_tail = raster_start + raster_pixels;
+        raster_pixels = 0;
+    }
+
+    following = false;
+    if(block != nullptr && block->raster_pixels > 0 && raster_buffer != nullptr) {
+        raster_start = block->raster_start;
+        raster_pixels = block->raster_pixels;
+        raster_pixel = 0;
+        raster_step_whole = block->steps_event_count / raster_pixels;
+        raster_step_frac = block->steps_event_count % raster_pixels;
+        raster_next_step = raster_step_whole;
+        raster_step_rem = raster_step_frac;
+    }
+
+    if(manual_fire) return;
+
+    if(block == nullptr || !block->is_g123) {
+        if(laser_on) set_laser_duty(0);
+        return;
+    }
+
+    block_duty = std::min(((uint64_t)block->s_value * duty_per_s) >> 16, (uint64_t)65536);
+    rate_scale = block->laser_rate_scale;
+    follow_rate = !disable_auto_power && rate_scale > 0;
+    if(!follow_rate && raster_pixels == 0) {
+        set_laser_duty(minimum_duty + block_duty);
+        return;
+    }
+
+    following = true;
+}
+
+// called from the step interrupt with the primary axis rate in 0.32 fixed point steps per tick, for a raster also when
+// the primary axis gets to the next pixel
+void Laser::on_speed_change(uint32_t rate)
+{
+    if(!following || manual_fire) return;
+
+    uint32_t duty = block_duty;
+    if(follow_rate) {
+        // the rate as a 16.16 fixed point fraction of the nominal rate
+        uint32_t ratio = ((uint64_t)rate * rate_scale) >> 32;
+        duty = std::min(((uint64_t)duty * ratio) >> 16, (uint64_t)65536);
+    }
+    if(raster_pixels > 0) {
+        // move on to the pixel the primary axis is in, pixels shorter than a step are skipped
+        uint32_t steps = THEKERNEL->step_ticker->get_primary_steps();
+        while(raster_pixel + 1 < raster_pixels && steps >= raster_next_step + (raster_step_rem != 0 ? 1 : 0)) {
+            ++raster_pixel;
+            raster_next_step += raster_step_whole;
+            raster_step_rem += raster_step_frac;
+            if(raster_step_rem >= raster_pixels) {
+                raster_step_rem -= raster_pixels;
+                ++raster_next_step;
+            }
+        }
+        THEKERNEL->step_ticker->set_speed_step(raster_next_step + (raster_step_rem != 0 ? 1 : 0));
+        duty = duty * raster_buffer[(raster_start + raster_pixel) & raster_mask] / 255;
+    }
+
+    set_laser_duty(minimum_duty + duty);
+}
+
+// sets a 0.16 fixed point duty cycle from the step interrupt, it writes the match register as PwmOut::write() does
+// but with no floating point
+void Laser::set_laser_duty(uint32_t duty)
+{
+    if(duty > 65536) duty = 65536;
+    bool on = duty > 0;
+    if(pwm_inverting) duty = 65536 - duty;
+
+    uint32_t period = LPC_PWM1->MR0;
+    uint32_t v = ((uint64_t)period * duty) >> 16;
+    if(v == period) v++; // as mbed does, a match at the period drops the output for a cycle
+    *pwm_match = v;
+    LPC_PWM1->LER |= 1 << pwm_channel;
+
+    if(on) {
+        if(!laser_on && this->ttl_used) this->ttl_pin->set(true);
+    } else if(this->ttl_used) {
+        this->ttl_pin->set(false);
+    }
+    laser_on = on;
+}
+
 bool Laser::set_laser_power(float power)
 {
     // Ensure power is >=0 and <= 1
@@ -310,6 +595,16 @@ void Laser::on_halt(void *argument)
     if(argument == nullptr) {
         set_laser_power(0);
         manual_fire = false;
+
+        // the blocks are gone, and the pixels with them
+        following = false;
+        raster_pixels = 0;
+        raster_head = raster_tail = 0;
+        THEROBOT->clear_raster_pixels();
+        if(raster_file != nullptr) {
+            fclose(raster_file);
+            raster_file = nullptr;
+        }
     }
 }
 
@@ -10,12 +10,14 @@
 #include "libs/Module.h"
 
 #include <stdint.h>
+#include <stdio.h>
 
 namespace mbed {
     class PwmOut;
 }
 class Pin;
 class Block;
+class Gcode;
 
 class Laser : public Module{
     public:
@@ -27,17 +29,28 @@ class Laser : public Module{
         void on_console_line_received(void *argument);
         void on_get_public_data(void* argument);
 
-        void set_scale(float s) { scale= s/100; }
+        void set_scale(float s);
         float get_scale() const { return scale*100; }
         bool set_laser_power(float p);
         float get_current_power() const;
+        uint8_t get_raster_pixel(uint16_t i) const { return raster_buffer[i & raster_mask]; }
 
     private:
         uint32_t set_proportional_power(uint32_t dummy);
         bool get_laser_power(float& power) const;
+        void set_duty_scale();
+        void set_laser_duty(uint32_t duty);
         float current_speed_ratio(const Block *block) const;
+        void set_update_ticks();
+        void on_block_start(const Block *block);
+        void on_speed_change(uint32_t rate);
+        void queue_raster(Gcode *gcode);
+        bool wait_for_raster_space(uint32_t n);
+        void open_raster_file(Gcode *gcode);
 
         mbed::PwmOut *pwm_pin;    // PWM output to regulate the laser power
+        volatile uint32_t *pwm_match; // its match register, the step interrupt writes the duty cycle to it directly
+        uint8_t pwm_channel;      // and its PWM1 channel
         Pin *ttl_pin;				// TTL output to fire laser
         float laser_maximum_power; // maximum allowed laser power to be output on the pwm pin
         float laser_minimum_power; // value used to tickle the laser on moves.  Also minimum value for auto-scaling
@@ -46,6 +59,29 @@ class Laser : public Module{
         int32_t fire_duration; // manual fire command duration
         int32_t ms_per_tick; // ms between each ticks, depends on PWM frequency
         float pwm_frequency;
+        float update_frequency; // power updates per second from the step interrupt, 0 to update from the slow ticker
+
+        // the step interrupt only does integer math, duty cycles are 0.16 fixed point
+        uint32_t minimum_duty;  // the duty cycle of laser_minimum_power
+        uint32_t duty_per_s;    // 16.16 fixed point duty cycle over the minimum per 1.11 fixed point S value, with the scale
+        uint32_t block_duty;    // of the running block over the minimum at its nominal speed
+        uint32_t rate_scale;    // and its Block::laser_rate_scale
+
+        // raster, the pixels are queued ahead of the G1s that use them in a ring the blocks index into
+        uint8_t *raster_buffer;
+        uint16_t raster_mask;           // the size of the ring less one
+        uint16_t raster_head;           // where the next pixel queued goes
+        volatile uint16_t raster_tail;  // the first pixel a block that has not finished may use
+        FILE *raster_file;              // M651, M650 P queues pixels from it
+
+        // the raster of the running block, pixel n starts at primary axis step ceil(n * steps / pixels)
+        uint16_t raster_start;
+        uint16_t raster_pixels;
+        uint16_t raster_pixel;
+        uint32_t raster_next_step;      // the step the next pixel starts at
+        uint32_t raster_step_rem;       // with this remainder over raster_pixels
+        uint32_t raster_step_whole;     // steps per pixel
+        uint32_t raster_step_frac;      // and the remainder of that
 
         struct {
             bool laser_on:1;      // set if the laser is on
@@ -54,5 +90,8 @@ class Laser : public Module{
             bool ttl_inverting:1;   // stores whether the TTL output should be inverted
             bool manual_fire:1;     // set when manually firing
             bool disable_auto_power:1; // true to disable auto power
+            bool follow_steps:1;    // set if the power is updated from the step interrupt
+            bool following:1;       // set while the running block has its power follow the speed
+            bool follow_rate:1;     // set if the running block has its power scaled by the speed
         };
 };
@@ -96,7 +96,6 @@ void PWMSpindleControl::on_module_loaded()
             PinName pinname = port_pin((PortName)smoothie_pin->port_number, smoothie_pin->pin);
             feedback_pin = new mbed::InterruptIn(pinname);
             feedback_pin->rise(this, &PWMSpindleControl::on_pin_rise);
-            NVIC_SetPriority(EINT3_IRQn, 16);
         } else {
             THEKERNEL->streams->printf("Error: Spindle feedback pin has to be on P0 or P2.\n");
             delete this;
@@ -54,6 +54,10 @@
         "Two corners"" is not absolutely the correct name for this mode, because it uses only one corner and rectangle size.
         It can be turned off with G32 R0 and turned on with G32 R1.
 
+    The grid is interpolated bilinearly between the four points around a position by default, a bicubic surface through
+    the sixteen points around it follows a curved bed more closely and so needs fewer points for the same accuracy...
+       leveling-strategy.rectangular-grid.bicubic  true
+
     Display mode of current grid can be changed to human readable mode (table with coordinates) by using
        leveling-strategy.rectangular-grid.human_readable  true
 
@@ -125,6 +129,7 @@
 #define dampening_start_checksum     CHECKSUM("dampening_start")
 #define before_probe_gcode_checksum  CHECKSUM("before_probe_gcode")
 #define after_probe_gcode_checksum   CHECKSUM("after_probe_gcode")
+#define bicubic_checksum             CHECKSUM("bicubic")
 
 #define GRIDFILE "/sd/cartesian.grid"
 #define GRIDFILE_NM "/sd/cartesian_nm.grid"
@@ -132,11 +137,13 @@
 CartGridStrategy::CartGridStrategy(ZProbe *zprobe) : LevelingStrategy(zprobe)
 {
     grid = nullptr;
+    coefficients = nullptr;
 }
 
 CartGridStrategy::~CartGridStrategy()
 {
     if(grid != nullptr) AHB0.dealloc(grid);
+    if(coefficients != nullptr) AHB0.dealloc(coefficients);
 }
 
 bool CartGridStrategy::handleConfig()
@@ -155,6 +162,7 @@ bool CartGridStrategy::handleConfig()
     only_by_two_corners = THEKERNEL->config->value(leveling_strategy_checksum, cart_grid_leveling_strategy_checksum, only_by_two_corners_checksum)->by_default(false)->as_bool();
     human_readable = THEKERNEL->config->value(leveling_strategy_checksum, cart_grid_leveling_strategy_checksum, human_readable_checksum)->by_default(false)->as_bool();
     do_manual_attach = THEKERNEL->config->value(leveling_strategy_checksum, cart_grid_leveling_strategy_checksum, m_attach_checksum)->by_default(false)->as_bool();
+    bicubic = THEKERNEL->config->value(leveling_strategy_checksum, cart_grid_leveling_strategy_checksum, bicubic_checksum)->by_default(false)->as_bool();
 
     this->height_limit = THEKERNEL->config->value(leveling_strategy_checksum, cart_grid_leveling_strategy_checksum, height_limit_checksum)->by_default(NAN)->as_number();
     this->dampening_start = THEKERNEL->config->value(leveling_strategy_checksum, cart_grid_leveling_strategy_checksum, dampening_start_checksum)->by_default(NAN)->as_number();
@@ -222,6 +230,11 @@ bool CartGridStrategy::handleConfig()
         return false;
     }
 
+    // the bilinear coefficients of each cell, without them they are worked out from the grid when a move enters a cell
+    if(!bicubic) {
+        coefficients = (float *)AHB0.alloc((configured_grid_x_size - 1) * (configured_grid_y_size - 1) * 4 * sizeof(float));
+    }
+
     reset_bed_level();
 
     return true;
@@ -497,9 +510,8 @@ void CartGridStrategy::setAdjustFunction(bool on)
 {
     if(on) {
         // set the compensationTransform in robot
-        using std::placeholders::_1;
-        using std::placeholders::_2;
-        THEROBOT->compensationTransform = std::bind(&CartGridStrategy::doCompensation, this, _1, _2); // [this](float *target, bool inverse) { doCompensation(target, inverse); };
+        prepare_compensation();
+        THEROBOT->compensationTransform = [this](float *target, bool inverse) { doCompensation(target, inverse); };
     } else {
         // clear it
         THEROBOT->compensationTransform = nullptr;
@@ -713,9 +725,94 @@ bool CartGridStrategy::doProbe(Gcode *gc)
     return true;
 }
 
+// works out what every segment would otherwise, the grid does not change while compensation is on
+void CartGridStrategy::prepare_compensation()
+{
+    // handle the case where size is negative (assuming this is possible? Legacy code supported this)
+    min_x = std::min(this->x_start, this->x_start + this->x_size);
+    max_x = std::max(this->x_start, this->x_start + this->x_size);
+    min_y = std::min(this->y_start, this->y_start + this->y_size);
+    max_y = std::max(this->y_start, this->y_start + this->y_size);
+    x_cells_per_mm = (this->current_grid_x_size - 1) / this->x_size;
+    y_cells_per_mm = (this->current_grid_y_size - 1) / this->y_size;
+
+    if(coefficients != nullptr) {
+        float *c = coefficients;
+        for (int y = 0; y < current_grid_y_size - 1; y++) {
+            for (int x = 0; x < current_grid_x_size - 1; x++) {
+                float z1 = grid_at(x, y);
+                float z2 = grid_at(x, y + 1);
+                float z3 = grid_at(x + 1, y);
+                float z4 = grid_at(x + 1, y + 1);
+                *c++ = z1;
+                *c++ = z3 - z1;
+                *c++ = z2 - z1;
+                *c++ = z1 - z2 - z3 + z4;
+            }
+        }
+    }
+
+    cell.x = cell.y = -1;
+}
+
+// the grid point, one point beyond an edge is extrapolated from the two inside it
+float CartGridStrategy::grid_at(int x, int y) const
+{
+    if(x < 0) return 2 * grid_at(0, y) - grid_at(1, y);
+    if(x >= current_grid_x_size) return 2 * grid_at(current_grid_x_size - 1, y) - grid_at(current_grid_x_size - 2, y);
+    if(y < 0) return 2 * grid_at(x, 0) - grid_at(x, 1);
+    if(y >= current_grid_y_size) return 2 * grid_at(x, current_grid_y_size - 1) - grid_at(x, current_grid_y_size - 2);
+    return grid[x + (current_grid_x_size * y)];
+}
+
+// Catmull-Rom spline through p1 at 0 and p2 at 1, row i has the weights of p0..p3 for the power i coefficient
+static const float catmull_rom[4][4] = {
+    {  0.0F,  1.0F,  0.0F,  0.0F },
+    { -0.5F,  0.0F,  0.5F,  0.0F },
+    {  1.0F, -2.5F,  2.0F, -0.5F },
+    { -0.5F,  1.5F, -1.5F,  0.5F },
+};
+
+void CartGridStrategy::load_cell(int x, int y)
+{
+    cell.x = x;
+    cell.y = y;
+
+    if(!bicubic) {
+        if(coefficients != nullptr) {
+            memcpy(cell.c, &coefficients[(x + (current_grid_x_size - 1) * y) * 4], 4 * sizeof(float));
+        } else {
+            float z1 = grid_at(x, y);
+            float z2 = grid_at(x, y + 1);
+            float z3 = grid_at(x + 1, y);
+            float z4 = grid_at(x + 1, y + 1);
+            cell.c[0] = z1;
+            cell.c[1] = z3 - z1;
+            cell.c[2] = z2 - z1;
+            cell.c[3] = z1 - z2 - z3 + z4;
+        }
+        return;
+    }
+
+    // a spline along X through each of the four rows of points around the cell, then along Y through those
+    float rows[4][4];
+    for (int j = 0; j < 4; j++) {
+        float p[4];
+        for (int k = 0; k < 4; k++) p[k] = grid_at(x - 1 + k, y - 1 + j);
+        for (int i = 0; i < 4; i++) {
+            rows[j][i] = catmull_rom[i][0] * p[0] + catmull_rom[i][1] * p[1] + catmull_rom[i][2] * p[2] + catmull_rom[i][3] * p[3];
+        }
+    }
+    for (int j = 0; j < 4; j++) {
+        for (int i = 0; i < 4; i++) {
+            cell.c[i + 4 * j] = catmull_rom[j][0] * rows[0][i] + catmull_rom[j][1] * rows[1][i] + catmull_rom[j][2] * rows[2][i] + catmull_rom[j][3] * rows[3][i];
+        }
+    }
+}
+
 void CartGridStrategy::doCompensation(float *target, bool inverse)
 {
-    // Adjust print surface height by linear interpolation over the bed_level array.
+    // Adjust print surface height by interpolation over the bed_level array.
     // offset scale: 1 for default (use offset as is)
     float scale = 1.0F;
     if (!isnan(this->damping_interval)) {
@@ -730,31 +827,31 @@ void CartGridStrategy::doCompensation(float *target, bool inverse)
         }
     }
 
-    // find min/maxes, and handle the case where size is negative (assuming this is possible? Legacy code supported this)
-    float min_x = std::min(this->x_start, this->x_start + this->x_size);
-    float max_x = std::max(this->x_start, this->x_start + this->x_size);
-    float min_y = std::min(this->y_start, this->y_start + this->y_size);
-    float max_y = std::max(this->y_start, this->y_start + this->y_size);
-
     // clamp the input to the bounds of the compensation grid
     // if a point is beyond the bounds of the grid, it will get the offset of the closest grid point
     float x_target = std::min(std::max(target[X_AXIS], min_x), max_x);
     float y_target = std::min(std::max(target[Y_AXIS], min_y), max_y);
 
-    // we need to make sure that floor_x and floor_y are always < grid_size-1
-    float grid_x = std::max(0.001F, std::min(this->current_grid_x_size - 1.001F, (x_target - this->x_start) / (this->x_size / (this->current_grid_x_size - 1))));
-    float grid_y = std::max(0.001F, std::min(this->current_grid_y_size - 1.001F, (y_target - this->y_start) / (this->y_size / (this->current_grid_y_size - 1))));
-    int floor_x = floorf(grid_x);
-    int floor_y = floorf(grid_y);
-    float ratio_x = grid_x - floor_x;
-    float ratio_y = grid_y - floor_y;
-    float z1 = grid[(floor_x) + ((floor_y) * this->current_grid_x_size)];
-    float z2 = grid[(floor_x) + ((floor_y + 1) * this->current_grid_x_size)];
-    float z3 = grid[(floor_x + 1) + ((floor_y) * this->current_grid_x_size)];
-    float z4 = grid[(floor_x + 1) + ((floor_y + 1) * this->current_grid_x_size)];
-    float left = (1 - ratio_y) * z1 + ratio_y * z2;
-    float right = (1 - ratio_y) * z3 + ratio_y * z4;
-    float offset = (1 - ratio_x) * left + ratio_x * right;
+    // the position in cells is never negative, the last point is in the last cell
+    float grid_x = (x_target - this->x_start) * x_cells_per_mm;
+    float grid_y = (y_target - this->y_start) * y_cells_per_mm;
+    int cell_x = std::min((int)grid_x, this->current_grid_x_size - 2);
+    int cell_y = std::min((int)grid_y, this->current_grid_y_size - 2);
+    if(cell_x != cell.x || cell_y != cell.y) load_cell(cell_x, cell_y);
+    float u = grid_x - cell_x;
+    float v = grid_y - cell_y;
+
+    const float *c = cell.c;
+    float offset;
+    if(bicubic) {
+        float r0 = ((c[3] * u + c[2]) * u + c[1]) * u + c[0];
+        float r1 = ((c[7] * u + c[6]) * u + c[5]) * u + c[4];
+        float r2 = ((c[11] * u + c[10]) * u + c[9]) * u + c[8];
+        float r3 = ((c[15] * u + c[14]) * u + c[13]) * u + c[12];
+        offset = ((r3 * v + r2) * v + r1) * v + r0;
+    } else {
+        offset = c[0] + u * (c[1] + v * c[3]) + v * c[2];
+    }
 
     // handle case where the grid was incomplete (should never happen)
     if(isnan(offset)) return;
@@ -769,16 +866,10 @@ void CartGridStrategy::doCompensation(float *target, bool inverse)
     THEKERNEL->streams->printf("//DEBUG: TARGET: %f, %f, %f\n", target[0], target[1], target[2]);
     THEKERNEL->streams->printf("//DEBUG: grid_x= %f\n", grid_x);
     THEKERNEL->streams->printf("//DEBUG: grid_y= %f\n", grid_y);
-    THEKERNEL->streams->printf("//DEBUG: floor_x= %d\n", floor_x);
-    THEKERNEL->streams->printf("//DEBUG: floor_y= %d\n", floor_y);
-    THEKERNEL->streams->printf("//DEBUG: ratio_x= %f\n", ratio_x);
-    THEKERNEL->streams->printf("//DEBUG: ratio_y= %f\n", ratio_y);
-    THEKERNEL->streams->printf("//DEBUG: z1= %f\n", z1);
-    THEKERNEL->streams->printf("//DEBUG: z2= %f\n", z2);
-    THEKERNEL->streams->printf("//DEBUG: z3= %f\n", z3);
-    THEKERNEL->streams->printf("//DEBUG: z4= %f\n", z4);
-    THEKERNEL->streams->printf("//DEBUG: left= %f\n", left);
-    THEKERNEL->streams->printf("//DEBUG: right= %f\n", right);
+    THEKERNEL->streams->printf("//DEBUG: cell_x= %d\n", cell_x);
+    THEKERNEL->streams->printf("//DEBUG: cell_y= %d\n", cell_y);
+    THEKERNEL->streams->printf("//DEBUG: u= %f\n", u);
+    THEKERNEL->streams->printf("//DEBUG: v= %f\n", v);
     THEKERNEL->streams->printf("//DEBUG: offset= %f\n", offset);
     THEKERNEL->streams->printf("//DEBUG: scale= %f\n", scale);
     THEKERNEL->streams->printf("//DEBUG: adjustment= %f\n", offset*scale);
@@ -2,7 +2,9 @@
 
 #include "LevelingStrategy.h"
 
+#include <stdint.h>
 #include <string.h>
+#include <string>
 #include <tuple>
 
 #define cart_grid_leveling_strategy_checksum CHECKSUM("rectangular-grid")
@@ -26,6 +28,9 @@ private:
     void setAdjustFunction(bool on);
     void print_bed_level(StreamOutput *stream);
     void doCompensation(float *target, bool inverse);
+    void prepare_compensation();
+    void load_cell(int x, int y);
+    float grid_at(int x, int y) const;
     void reset_bed_level();
     void save_grid(StreamOutput *stream);
     bool load_grid(StreamOutput *stream);
@@ -39,11 +44,21 @@ private:
     std::string before_probe, after_probe;
 
     float *grid;
+    float *coefficients; // bilinear, four for each cell, nullptr if there was no room for them
     std::tuple<float, float, float> probe_offsets;
     float *m_attach;
     float x_start,y_start;
     float x_size,y_size;
 
+    // set when compensation is turned on so each segment only multiplies, the cell the last segment was in is kept
+    // as the coefficients of its surface in the cell's own 0 to 1 coordinates, c[u power + 4 * v power]
+    float min_x, max_x, min_y, max_y;
+    float x_cells_per_mm, y_cells_per_mm;
+    struct {
+        float c[16];
+        int16_t x, y; // -1 when there is none
+    } cell;
+
     struct {
         uint8_t configured_grid_x_size:8;
         uint8_t configured_grid_y_size:8;
@@ -58,5 +73,6 @@ private:
         bool only_by_two_corners:1;
         bool human_readable:1;
         bool new_file_format:1;
+        bool bicubic:1;
     };
 };
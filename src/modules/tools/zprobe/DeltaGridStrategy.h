@@ -2,6 +2,7 @@
 
 #include "LevelingStrategy.h"
 
+#include <stdint.h>
 #include <string.h>
 #include <tuple>
 
@@ -36,6 +36,7 @@
 #define enable_checksum          CHECKSUM("enable")
 #define probe_pin_checksum       CHECKSUM("probe_pin")
 #define debounce_ms_checksum     CHECKSUM("debounce_ms")
+#define probe_interrupt_checksum CHECKSUM("probe_interrupt")
 #define slow_feedrate_checksum   CHECKSUM("slow_feedrate")
 #define fast_feedrate_checksum   CHECKSUM("fast_feedrate")
 #define return_feedrate_checksum CHECKSUM("return_feedrate")
@@ -57,6 +58,9 @@
 #define STEPS_PER_MM(a) (STEPPER[a]->get_steps_per_mm())
 #define Z_STEPS_PER_MM STEPS_PER_MM(Z_AXIS)
 
+// the probe stops all the motors as it may be a delta
+static uint32_t all_motors() { return (1 << THEROBOT->actuators.size()) - 1; }
+
 void ZProbe::on_module_loaded()
 {
     // if the module is disabled -> do nothing
@@ -81,6 +85,13 @@ void ZProbe::config_load()
     this->pin.from_string( THEKERNEL->config->value(zprobe_checksum, probe_pin_checksum)->by_default("nc" )->as_string())->as_input();
     this->debounce_ms    = THEKERNEL->config->value(zprobe_checksum, debounce_ms_checksum)->by_default(0  )->as_number();
 
+    // stop the motors from the pin's edge interrupt rather than when it is next polled, there is no debounce
+    if(THEKERNEL->config->value(zprobe_checksum, probe_interrupt_checksum)->by_default(false)->as_bool() && this->pin.connected()) {
+        if(!this->trigger.attach(&this->pin)) {
+            printf("WARNING: zprobe pin %d.%d can not interrupt, only pins on ports 0 and 2 can, it is polled\n", this->pin.port_number, this->pin.pin);
+        }
+    }
+
     // get strategies to load
     vector<uint16_t> modules;
     THEKERNEL->config->get_module_list( &modules, leveling_strategy_checksum);
@@ -152,6 +163,12 @@ uint32_t ZProbe::read_probe(uint32_t dummy)
 {
     if(!probing || probe_detected) return 0;
 
+    if(trigger.is_triggered()) {
+        // the edge interrupt stopped them
+        probe_detected= true;
+        return 0;
+    }
+
     // we check all axis as it maybe a G38.2 X10 for instance, not just a probe in Z
     if(STEPPER[X_AXIS]->is_moving() || STEPPER[Y_AXIS]->is_moving() || STEPPER[Z_AXIS]->is_moving()) {
         // if it is moving then we check the probe, and debounce it
@@ -161,7 +178,7 @@ uint32_t ZProbe::read_probe(uint32_t dummy)
             } else {
                 // we signal the motors to stop, which will preempt any moves on that axis
                 // we do all motors as it may be a delta
-                for(auto &a : THEROBOT->actuators) a->stop_moving();
+                trigger.trigger();
                 probe_detected= true;
                 debounce= 0;
             }
@@ -194,6 +211,7 @@ bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
 
     // save current actuator position so we can report how far we moved
     float z_start_pos= THEROBOT->actuators[Z_AXIS]->get_current_position();
+    trigger.arm(all_motors());
 
     // move Z down
     bool dir= (!reverse_z != reverse); // xor
@@ -203,11 +221,14 @@ bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
 
     // wait until finished
     THECONVEYOR->wait_for_idle();
+    trigger.disarm();
     if(THEKERNEL->is_halted()) return false;
+    if(trigger.is_triggered()) probe_detected= true;
 
-    // now see how far we moved, get delta in z we moved
+    // now see how far we moved, get delta in z we moved, to the step it stopped on if it triggered
     // NOTE this works for deltas as well as all three actuators move the same amount in Z
-    mm= z_start_pos - THEROBOT->actuators[Z_AXIS]->get_current_position();
+    float z_end_pos= probe_detected ? trigger.get_steps(Z_AXIS) / Z_STEPS_PER_MM : THEROBOT->actuators[Z_AXIS]->get_current_position();
+    mm= z_start_pos - z_end_pos;
 
     // set the last probe position to the actuator units moved during this home
     // TODO maybe we should store current actuator position rather than the delta?
@@ -457,11 +478,13 @@ void ZProbe::probe_XYZ(Gcode *gcode)
     probing= true;
     probe_detected= false;
     debounce= 0;
+    trigger.arm(all_motors());
 
     // do a delta move which will stop as soon as the probe is triggered, or the distance is reached
     float delta[3]= {x, y, z};
     if(!THEROBOT->delta_move(delta, rate, 3)) {
         gcode->stream->printf("error:No move detected or too small\n");
+        trigger.disarm();
         probing= false;
         return;
     }
@@ -469,6 +492,8 @@ void ZProbe::probe_XYZ(Gcode *gcode)
     THEKERNEL->conveyor->wait_for_idle();
 
     // disable probe checking
+    trigger.disarm();
+    if(trigger.is_triggered()) probe_detected= true;
     probing= false;
 
     // if the probe stopped the move we need to correct the last_milestone as it did not reach where it thought
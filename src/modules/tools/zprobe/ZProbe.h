@@ -10,6 +10,7 @@
 
 #include "Module.h"
 #include "Pin.h"
+#include "EdgeTrigger.h"
 
 #include <vector>
 
@@ -58,6 +59,7 @@ private:
     float dwell_before_probing;
 
     Pin pin;
+    EdgeTrigger trigger;
     std::vector<LevelingStrategy*> strategies;
     uint16_t debounce_ms, debounce;
 
@@ -31,9 +31,10 @@
 #pragma once
 
 #include <functional>
-#include <map>
 #include <bitset>
 
+#include "LetterTable.h"
+
 class StreamOutput;
 
 /*!
@@ -404,7 +405,7 @@ public:
     bool setRawRegister(StreamOutput *stream, uint32_t reg, uint32_t val);
     bool checkAlarm();
 
-    using options_t= std::map<char,int>;
+    using options_t= LetterTable<int>;
 
     bool set_options(const options_t& options);
 
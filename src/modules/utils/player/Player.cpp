@@ -29,10 +29,12 @@
 #include "TemperatureControlPublicAccess.h"
 #include "TemperatureControlPool.h"
 #include "ExtruderPublicAccess.h"
+#include "platform_memory.h"
 
 #include <cstddef>
 #include <cmath>
 #include <algorithm>
+#include <string.h>
 
 #include "mbed.h"
 
@@ -42,6 +44,13 @@
 #define before_resume_gcode_checksum      CHECKSUM("before_resume_gcode")
 #define leave_heaters_on_suspend_checksum CHECKSUM("leave_heaters_on_suspend")
 
+// the file is read this many bytes at a time, a multiple of the sector size, the read buffer holds two of these
+#define PLAYER_READ_CHUNK 1024
+// lines upto 128 characters are allowed, anything longer is discarded
+#define PLAYER_MAX_LINE 128
+// most lines played per main loop while the queue has room, so the other modules still get to run
+#define PLAYER_LINES_PER_LOOP 8
+
 extern SDFAT mounter;
 
 Player::Player()
@@ -54,6 +63,13 @@ Player::Player()
     this->suspended= false;
     this->suspend_loops= 0;
     this->abort_flag= false;
+    this->read_buffer= nullptr;
+    this->read_pos= 0;
+    this->read_end= 0;
+    this->read_eof= false;
+    this->discard_line= false;
+    memset(&this->stats, 0, sizeof(this->stats));
+    this->message.message.reserve(PLAYER_MAX_LINE);
 }
 
 void Player::on_module_loaded()
@@ -128,13 +144,8 @@ void Player::on_gcode_received(void *argument)
             this->filename = "/sd/" + args; // filename is whatever is in args
             this->current_stream = nullptr;
 
-            if(this->current_file_handler != NULL) {
-                this->playing_file = false;
-                fclose(this->current_file_handler);
-            }
-            this->current_file_handler = fopen( this->filename.c_str(), "r");
-
-            if(this->current_file_handler == NULL) {
+            this->playing_file = false;
+            if(!open_file(this->filename.c_str())) {
                 gcode->stream->printf("file.open failed: %s\r\n", this->filename.c_str());
                 return;
 
@@ -177,9 +188,7 @@ void Player::on_gcode_received(void *argument)
 
                 if(!currentfn.empty()) {
                     // reload the last file opened
-                    this->current_file_handler = fopen(currentfn.c_str() , "r");
-
-                    if(this->current_file_handler == NULL) {
+                    if(!open_file(currentfn.c_str())) {
                         gcode->stream->printf("file.open failed: %s\r\n", currentfn.c_str());
                     } else {
                         this->filename = currentfn;
@@ -199,13 +208,8 @@ void Player::on_gcode_received(void *argument)
             this->filename = "/sd/" + args; // filename is whatever is in args including spaces
             this->current_stream = nullptr;
 
-            if(this->current_file_handler != NULL) {
-                this->playing_file = false;
-                fclose(this->current_file_handler);
-            }
-
-            this->current_file_handler = fopen( this->filename.c_str(), "r");
-            if(this->current_file_handler == NULL) {
+            this->playing_file = false;
+            if(!open_file(this->filename.c_str())) {
                 gcode->stream->printf("file.open failed: %s\r\n", this->filename.c_str());
             } else {
                 this->playing_file = true;
@@ -249,15 +253,15 @@ void Player::on_console_line_received( void *argument )
 {
     if(THEKERNEL->is_halted()) return; // if in halted state ignore any commands
 
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
-
-    string possible_command = new_message.message;
+    SerialMessage &new_message = *static_cast<SerialMessage *>(argument);
 
-    // ignore anything that is not lowercase or a letter
-    if(possible_command.empty() || !islower(possible_command[0]) || !isalpha(possible_command[0])) {
+    // ignore anything that is not lowercase or a letter, checked before the line is copied
+    if(new_message.message.empty() || !islower(new_message.message[0]) || !isalpha(new_message.message[0])) {
         return;
     }
 
+    string possible_command = new_message.message;
+
     string cmd = shift_parameter(possible_command);
 
     //new_message.stream->printf("Received %s\r\n", possible_command.c_str());
@@ -289,12 +293,8 @@ void Player::play_command( string parameters, StreamOutput *stream )
         return;
     }
 
-    if(this->current_file_handler != NULL) { // must have been a paused print
-        fclose(this->current_file_handler);
-    }
-
-    this->current_file_handler = fopen( this->filename.c_str(), "r");
-    if(this->current_file_handler == NULL) {
+    // closes a paused print
+    if(!open_file(this->filename.c_str())) {
         stream->printf("File not found: %s\r\n", this->filename.c_str());
         return;
     }
@@ -344,6 +344,10 @@ void Player::progress_command( string parameters, StreamOutput *stream )
             stream->printf("Suspended\n");
         }else{
             stream->printf("Not currently playing\n");
+            if(!sdprinting && stats.played > 0) {
+                stream->printf("last file: ");
+                print_stats(stream);
+            }
         }
         return;
     }
@@ -364,6 +368,7 @@ void Player::progress_command( string parameters, StreamOutput *stream )
                 stream->printf(", est time: %02lu:%02lu:%02lu",  est / 3600, (est % 3600) / 60, est % 60);
             }
             stream->printf("\r\n");
+            print_stats(stream);
         } else {
             stream->printf("SD printing byte %lu/%lu\r\n", played_cnt, file_size);
         }
@@ -398,13 +403,13 @@ void Player::abort_command( string parameters, StreamOutput *stream )
         THEKERNEL->streams->printf("Suspend cleared\n");
     }
 
+    print_stats(nullptr); // keep them for the progress command
     playing_file = false;
     played_cnt = 0;
     file_size = 0;
     this->filename = "";
     this->current_stream = NULL;
-    fclose(current_file_handler);
-    current_file_handler = NULL;
+    close_file();
     if(parameters.empty()) {
         // clear out the block queue, will wait until queue is empty
         // MUST be called in on_main_loop to make sure there are no blocked main loops waiting to put something on the queue
@@ -449,61 +454,167 @@ void Player::on_main_loop(void *argument)
             return;
         }
 
-        char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
-        bool discard = false;
+        if(THECONVEYOR->is_queue_full()) {
+            // nothing can be queued until a block finishes, read ahead while it runs
+            read_ahead();
+            return;
+        }
 
-        while(fgets(buf, sizeof(buf), this->current_file_handler) != NULL) {
-            int len = strlen(buf);
-            if(len == 0) continue; // empty line? should not be possible
-            if(buf[len - 1] == '\n' || feof(this->current_file_handler)) {
-                if(discard) { // we are discarding a long line
-                    discard = false;
-                    continue;
-                }
-                if(len == 1) continue; // empty line
-                if(buf[len - 2] == '\r') {
-                    // \r\n terminated ignore \r
-                    len -=1;
-                    if(len == 1) continue; // empty line
-                }
-                if(this->current_stream != nullptr) {
-                    this->current_stream->printf("%s", buf);
-                }
+        // feed lines while the queue has room, a line may also stop the play (M25, M600, abort...)
+        for (int n = 0; n < PLAYER_LINES_PER_LOOP && this->playing_file && !THECONVEYOR->is_queue_full(); ++n) {
+            char *line;
+            size_t len;
+            if(!next_line(line, len)) {
+                end_of_file();
+                return;
+            }
 
-                struct SerialMessage message;
-                if(buf[len-1] == '\n' || buf[len-1] == '\r') {
-                    message.message.assign(buf, len-1); // we do not want to include the \n
-                }else{
-                    message.message.assign(buf, len);
-                }
-                message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+            if(this->current_stream != nullptr) {
+                this->current_stream->printf("%s\n", line);
+            }
 
-                // waits for the queue to have enough room
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
-                played_cnt += len;
-                return; // we feed one line per main loop
+            message.message.assign(line, len);
+            message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
 
-            } else {
-                // discard long line
-                if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
-                discard = true;
-            }
+            // waits for the queue to have enough room
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+            if(THEKERNEL->is_halted()) return;
         }
+    }
+}
 
-        this->playing_file = false;
-        this->filename = "";
-        played_cnt = 0;
-        file_size = 0;
+// opens a file to play, it is read unbuffered a chunk at a time into our own buffer so the card gets multi sector
+// reads instead of the stdio buffer being refilled between lines
+bool Player::open_file(const char *fn)
+{
+    close_file();
+    this->current_file_handler = fopen(fn, "r");
+    if(this->current_file_handler == NULL) return false;
+    setvbuf(this->current_file_handler, NULL, _IONBF, 0);
+
+    // AHB0 is mostly free, the heap is used if it is not
+    this->read_buffer = (char *)AHB0.alloc(2 * PLAYER_READ_CHUNK + 1);
+    if(this->read_buffer == nullptr) this->read_buffer = (char *)malloc(2 * PLAYER_READ_CHUNK + 1);
+    if(this->read_buffer == nullptr) {
+        close_file();
+        return false;
+    }
+
+    this->read_pos = this->read_end = 0;
+    this->read_eof = false;
+    this->discard_line = false;
+    memset(&this->stats, 0, sizeof(this->stats));
+    this->stats.queue_empty_start = THECONVEYOR->get_queue_empty_count();
+    return true;
+}
+
+void Player::close_file()
+{
+    if(this->current_file_handler != NULL) {
         fclose(this->current_file_handler);
-        current_file_handler = NULL;
-        this->current_stream = NULL;
+        this->current_file_handler = NULL;
+    }
+    if(this->read_buffer != nullptr) {
+        if(AHB0.has(this->read_buffer)) AHB0.dealloc(this->read_buffer);
+        else free(this->read_buffer);
+        this->read_buffer = nullptr;
+    }
+}
+
+// once less than a chunk is left to play the unplayed part is moved to the start of the buffer and the next chunk is
+// read after it, so the chunk being played and the one read ahead are the two halves of the buffer
+void Player::read_ahead()
+{
+    if(this->read_eof || this->read_buffer == nullptr || this->read_end - this->read_pos >= PLAYER_READ_CHUNK) return;
+
+    uint16_t n = this->read_end - this->read_pos;
+    memmove(this->read_buffer, this->read_buffer + this->read_pos, n);
+    this->read_pos = 0;
+    this->read_end = n;
+
+    uint32_t t = us_ticker_read();
+    size_t got = fread(this->read_buffer + n, 1, PLAYER_READ_CHUNK, this->current_file_handler);
+    this->stats.read_us += us_ticker_read() - t;
+    this->stats.read_bytes += got;
+    this->read_end += got;
+    if(got < PLAYER_READ_CHUNK) this->read_eof = true;
+}
+
+// returns the next line to play in place in the read buffer, without the line ending and null terminated. empty and
+// long lines are skipped. returns false at the end of the file
+bool Player::next_line(char *&line, size_t &len)
+{
+    for(;;) {
+        read_ahead();
+
+        char *start = this->read_buffer + this->read_pos;
+        size_t avail = this->read_end - this->read_pos;
+        char *nl = (char *)memchr(start, '\n', avail);
+        size_t consumed;
+        if(nl != nullptr) {
+            consumed = nl - start + 1;
+        } else if(this->read_eof) {
+            if(avail == 0) return false;
+            nl = start + avail; // the last line has no newline
+            consumed = avail;
+        } else {
+            // no newline in a whole chunk, drop what we have and the rest of the line
+            this->discard_line = true;
+            this->read_pos = this->read_end;
+            this->played_cnt += avail;
+            continue;
+        }
+
+        this->read_pos += consumed;
+        this->played_cnt += consumed;
+
+        len = nl - start;
+        if(len > 0 && start[len - 1] == '\r') --len; // \r\n terminated ignore \r
 
-        if(this->reply_stream != NULL) {
-            // if we were printing from an M command from pronterface we need to send this back
-            this->reply_stream->printf("Done printing file\r\n");
-            this->reply_stream = NULL;
+        if(this->discard_line || len > PLAYER_MAX_LINE) {
+            if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
+            this->discard_line = false;
+            continue;
         }
+        if(len == 0) continue; // empty line
+
+        start[len] = '\0';
+        line = start;
+        return true;
+    }
+}
+
+void Player::end_of_file()
+{
+    print_stats(nullptr); // keep them for the progress command
+    this->playing_file = false;
+    this->filename = "";
+    played_cnt = 0;
+    file_size = 0;
+    close_file();
+    this->current_stream = NULL;
+
+    if(this->reply_stream != NULL) {
+        // if we were printing from an M command from pronterface we need to send this back
+        this->reply_stream->printf("Done printing file\r\n");
+        this->reply_stream = NULL;
+    }
+}
+
+// updates the statistics while playing and prints them if there is a stream
+void Player::print_stats(StreamOutput *stream)
+{
+    if(this->playing_file) {
+        this->stats.played = this->played_cnt;
+        this->stats.secs = this->elapsed_secs;
+        this->stats.queue_empty = THECONVEYOR->get_queue_empty_count() - this->stats.queue_empty_start;
     }
+    if(stream == nullptr) return;
+
+    unsigned long read_rate = this->stats.read_us > 0 ? (uint64_t)this->stats.read_bytes * 1000000 / this->stats.read_us : 0;
+    unsigned long play_rate = this->stats.secs > 0 ? this->stats.played / this->stats.secs : 0;
+    stream->printf("SD read %lu bytes/s, played %lu bytes/s, planner queue ran empty %lu times\r\n",
+                   read_rate, play_rate, (unsigned long)this->stats.queue_empty);
 }
 
 void Player::on_get_public_data(void *argument)
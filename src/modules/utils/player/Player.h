@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Module.h"
+#include "SerialMessage.h"
 
 #include <stdio.h>
 #include <string>
@@ -39,6 +40,12 @@ class Player : public Module {
         void resume_command( string parameters, StreamOutput* stream );
         string extract_options(string& args);
         void suspend_part2();
+        bool open_file(const char *fn);
+        void close_file();
+        void read_ahead();
+        bool next_line(char *&line, size_t &len);
+        void end_of_file();
+        void print_stats(StreamOutput* stream);
 
         string filename;
         string after_suspend_gcode;
@@ -51,9 +58,29 @@ class Player : public Module {
         long file_size;
         unsigned long played_cnt;
         unsigned long elapsed_secs;
+
+        // the file is read unbuffered into two halves of read_buffer, lines are split in place and the next half is
+        // read while the one before is played, see next_line()
+        char *read_buffer;
+        uint16_t read_pos;          // start of the next line
+        uint16_t read_end;          // end of the data read so far
+        SerialMessage message;      // reused for each line played
+
+        // playback statistics, kept after the file ends for the progress command
+        struct {
+            uint32_t read_bytes;
+            uint32_t read_us;       // time spent reading the card
+            uint32_t queue_empty;   // times the planner queue ran empty while playing
+            uint32_t queue_empty_start;
+            unsigned long played;
+            unsigned long secs;
+        } stats;
+
         float saved_position[3]; // only saves XYZ
         std::map<uint16_t, float> saved_temperatures;
         struct {
+            bool read_eof:1;
+            bool discard_line:1;
             bool on_boot_gcode_enable:1;
             bool booted:1;
             bool playing_file:1;
@@ -35,6 +35,7 @@
 #include "EndstopsPublicAccess.h"
 #include "NetworkPublicAccess.h"
 #include "platform_memory.h"
+#include "SlowTicker.h"
 #include "SwitchPublicAccess.h"
 #include "SDFAT.h"
 #include "Thermistor.h"
@@ -78,6 +79,7 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"?",        SimpleShell::help_command},
     {"version",  SimpleShell::version_command},
     {"mem",      SimpleShell::mem_command},
+    {"ticker",   SimpleShell::ticker_command},
     {"get",      SimpleShell::get_command},
     {"set_temp", SimpleShell::set_temp_command},
     {"switch",   SimpleShell::switch_command},
@@ -204,14 +206,15 @@ bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stre
 // When a new line is received, check if it is a command, and if it is, act upon it
 void SimpleShell::on_console_line_received( void *argument )
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
-    string possible_command = new_message.message;
+    SerialMessage &new_message = *static_cast<SerialMessage *>(argument);
 
-    // ignore anything that is not lowercase or a $ as it is not a command
-    if(possible_command.size() == 0 || (!islower(possible_command[0]) && possible_command[0] != '$')) {
+    // ignore anything that is not lowercase or a $ as it is not a command, checked before the line is copied
+    if(new_message.message.size() == 0 || (!islower(new_message.message[0]) && new_message.message[0] != '$')) {
         return;
     }
 
+    string possible_command = new_message.message;
+
     // it is a grbl compatible command
     if(possible_command[0] == '$' && possible_command.size() >= 2) {
         switch(possible_command[1]) {
@@ -619,9 +622,27 @@ void SimpleShell::mem_command( string parameters, StreamOutput *stream)
     if (verbose) {
         AHB0.debug(stream);
         AHB1.debug(stream);
+
+        const GcodeDispatch::line_allocations_t& la = THEKERNEL->gcode_dispatch->get_line_allocations();
+        stream->printf("Heap allocations per gcode line: last %lu, max %lu, %lu in %lu lines\r\n", la.last, la.max, la.total, la.lines);
     }
 
+#ifdef STEPTICKER_FIXED32
+    stream->printf("Block size: %u bytes, Tickinfo is in the block\n", sizeof(Block));
+#else
     stream->printf("Block size: %u bytes, Tickinfo size: %u bytes\n", sizeof(Block), sizeof(Block::tickinfo_t) * Block::n_actuators);
+#endif
+}
+
+// time spent in each slow ticker hook, -r starts counting again
+void SimpleShell::ticker_command( string parameters, StreamOutput *stream)
+{
+    if(shift_parameter( parameters ) == "-r") {
+        THEKERNEL->slow_ticker->reset_stats();
+        stream->printf("ticker stats reset\n");
+        return;
+    }
+    THEKERNEL->slow_ticker->print_stats(stream);
 }
 
 static uint32_t getDeviceType()
@@ -1434,6 +1455,7 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("Commands:\r\n");
     stream->printf("version\r\n");
     stream->printf("mem [-v]\r\n");
+    stream->printf("ticker [-r] - time spent in the slow ticker hooks, -r resets it\r\n");
     stream->printf("ls [-s] [folder]\r\n");
     stream->printf("cd folder\r\n");
     stream->printf("pwd\r\n");
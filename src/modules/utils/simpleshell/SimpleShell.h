@@ -55,6 +55,7 @@ private:
 
     static void switch_command(string parameters, StreamOutput *stream );
     static void mem_command(string parameters, StreamOutput *stream );
+    static void ticker_command(string parameters, StreamOutput *stream );
 
     static void net_command( string parameters, StreamOutput *stream);
 
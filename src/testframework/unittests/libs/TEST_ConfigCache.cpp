@@ -0,0 +1,127 @@
+#include "ConfigCache.h"
+#include "ConfigValue.h"
+#include "FirmConfigSource.h"
+#include "checksumm.h"
+#include "utils.h"
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+static void load(ConfigCache& cache, const char *config)
+{
+    FirmConfigSource source("test", config, config + strlen(config));
+    source.transfer_values_to_cache(&cache);
+}
+
+static ConfigValue *lookup(ConfigCache& cache, const char *key)
+{
+    uint16_t check_sums[3];
+    get_checksums(check_sums, key);
+    return cache.lookup(check_sums);
+}
+
+TEST(ConfigCache,lookup_after_build_index)
+{
+    ConfigCache cache;
+    load(cache, "\
+acceleration 3000\n\
+alpha_steps_per_mm 80\n\
+extruder.hotend.steps_per_mm 140\n\
+temperature_control.bed.enable true\n\
+");
+    cache.build_index();
+
+    ASSERT_EQUALS_V(4, (int)cache.size());
+    ASSERT_TRUE(lookup(cache, "acceleration") != NULL);
+    ASSERT_EQUALS_DELTA_V(3000.0F, lookup(cache, "acceleration")->as_number(), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(80.0F, lookup(cache, "alpha_steps_per_mm")->as_number(), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(140.0F, lookup(cache, "extruder.hotend.steps_per_mm")->as_number(), 0.0001F);
+    ASSERT_TRUE(lookup(cache, "temperature_control.bed.enable")->as_bool());
+    ASSERT_TRUE(lookup(cache, "extruder.hotend.acceleration") == NULL);
+    ASSERT_TRUE(lookup(cache, "beta_steps_per_mm") == NULL);
+}
+
+TEST(ConfigCache,many_values_are_all_found)
+{
+    // check sums made up so no two are the same and they are added out of order
+    ConfigCache cache;
+    std::vector<ConfigValue *> values;
+    for (int i = 0; i < 600; ++i) {
+        uint16_t check_sums[3] = { (uint16_t)((i * 7919) % 601), (uint16_t)(i % 3), (uint16_t)(i % 5) };
+        ConfigValue *v = new ConfigValue(check_sums);
+        values.push_back(v);
+        cache.add(v);
+    }
+    cache.build_index();
+
+    ASSERT_EQUALS_V(600, (int)cache.size());
+    bool all = true;
+    for (int i = 0; i < 600; ++i) {
+        uint16_t check_sums[3] = { (uint16_t)((i * 7919) % 601), (uint16_t)(i % 3), (uint16_t)(i % 5) };
+        if(cache.lookup(check_sums) != values[i] || cache.at(i) != values[i]) all = false;
+    }
+    ASSERT_TRUE(all);
+    uint16_t missing[3] = { 600, 0, 0 };
+    ASSERT_TRUE(cache.lookup(missing) == NULL);
+    // the first check sum of a value with the others different
+    uint16_t partial[3] = { (7919 % 601), 1, 2 };
+    ASSERT_TRUE(cache.lookup(partial) == NULL);
+}
+
+TEST(ConfigCache,duplicate_replaces_the_first_in_place)
+{
+    ConfigCache cache;
+    load(cache, "\
+acceleration 3000\n\
+junction_deviation 0.05\n\
+acceleration 1000\n\
+");
+    cache.build_index();
+
+    // the value read again takes the place of the first one
+    ASSERT_EQUALS_V(2, (int)cache.size());
+    ASSERT_TRUE(cache.at(0) == lookup(cache, "acceleration"));
+    ASSERT_EQUALS_DELTA_V(1000.0F, lookup(cache, "acceleration")->as_number(), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(0.05F, lookup(cache, "junction_deviation")->as_number(), 0.0001F);
+}
+
+TEST(ConfigCache,lookup_indexes_values_added_since)
+{
+    ConfigCache cache;
+    load(cache, "acceleration 3000\n");
+    ASSERT_TRUE(lookup(cache, "acceleration") != NULL);
+
+    // a value added after the index was built, as config-override does, is found without building it again
+    load(cache, "junction_deviation 0.02\nacceleration 500\n");
+    ASSERT_EQUALS_DELTA_V(0.02F, lookup(cache, "junction_deviation")->as_number(), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(500.0F, lookup(cache, "acceleration")->as_number(), 0.0001F);
+    ASSERT_EQUALS_V(2, (int)cache.size());
+}
+
+TEST(ConfigCache,collect_keeps_the_config_order)
+{
+    ConfigCache cache;
+    load(cache, "\
+extruder.zeta.enable true\n\
+temperature_control.bed.enable true\n\
+extruder.alpha.enable true\n\
+extruder.beta.enable false\n\
+extruder.gamma.enable true\n\
+extruder.gamma.steps_per_mm 100\n\
+");
+
+    std::vector<uint16_t> modules;
+    cache.collect(CHECKSUM("extruder"), CHECKSUM("enable"), &modules);
+
+    // disabled modules are collected too, the caller checks enable
+    ASSERT_EQUALS_V(4, (int)modules.size());
+    uint16_t zeta = CHECKSUM("zeta"), alpha = CHECKSUM("alpha"), beta = CHECKSUM("beta"), gamma = CHECKSUM("gamma");
+    ASSERT_EQUALS_V(zeta, modules[0]);
+    ASSERT_EQUALS_V(alpha, modules[1]);
+    ASSERT_EQUALS_V(beta, modules[2]);
+    ASSERT_EQUALS_V(gamma, modules[3]);
+}
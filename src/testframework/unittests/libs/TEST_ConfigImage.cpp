@@ -0,0 +1,140 @@
+#include "ConfigCache.h"
+#include "ConfigValue.h"
+#include "FileConfigSource.h"
+#include "utils.h"
+
+#include <string>
+#include <stdio.h>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+// needs the sd card mounted, the image is only written for a config on it. Each test has its own config file and
+// starts without an image, as the image is only checked against the size and the modified time of the file, to the
+// second
+
+static void write_file(const char *name, const std::string& data)
+{
+    FILE *fp = fopen(name, "w");
+    fwrite(data.data(), 1, data.size(), fp);
+    fclose(fp);
+}
+
+static std::string read_file(const char *name)
+{
+    std::string data;
+    FILE *fp = fopen(name, "r");
+    if(fp == NULL) return data;
+    char buf[256];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), fp)) > 0) data.append(buf, n);
+    fclose(fp);
+    return data;
+}
+
+// an empty image is one that does not load
+static void write_config(const char *name, const std::string& data)
+{
+    write_file(name, data);
+    write_file((std::string(name) + ".img").c_str(), "");
+}
+
+static float load_acceleration(const char *config_file)
+{
+    ConfigCache cache;
+    FileConfigSource source(config_file, "test");
+    source.transfer_values_to_cache(&cache);
+    uint16_t check_sums[3];
+    get_checksums(check_sums, "acceleration");
+    ConfigValue *v = cache.lookup(check_sums);
+    return v == NULL ? -1.0F : v->as_number();
+}
+
+// the standard CRC-32, as zlib has it
+static uint32_t crc32(const std::string& data)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (unsigned char c : data) {
+        crc ^= c;
+        for (int i = 0; i < 8; ++i) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+// changes the value of acceleration in the image, and the CRC at the end to match if fix_crc is set
+static bool patch_image(std::string& image, float from, float to, bool fix_crc)
+{
+    size_t at = image.find(std::string((const char *)&from, 4));
+    if(at == std::string::npos || image.size() < 4) return false;
+    image.replace(at, 4, std::string((const char *)&to, 4));
+    if(fix_crc) {
+        uint32_t crc = crc32(image.substr(0, image.size() - 4));
+        image.replace(image.size() - 4, 4, std::string((const char *)&crc, 4));
+    }
+    return true;
+}
+
+TEST(ConfigImage,written_with_a_crc_of_its_contents)
+{
+    write_config("/sd/config1", "acceleration 3000\njunction_deviation 0.05\n");
+    ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config1"), 0.0001F);
+
+    std::string image = read_file("/sd/config1.img");
+    ASSERT_TRUE(image.size() > 8);
+    ASSERT_TRUE(image.compare(0, 4, "SCI1") == 0);
+    uint32_t crc;
+    memcpy(&crc, image.data() + image.size() - 4, 4);
+    ASSERT_EQUALS_V(crc32(image.substr(0, image.size() - 4)), crc);
+}
+
+TEST(ConfigImage,values_are_read_from_the_image)
+{
+    write_config("/sd/config2", "acceleration 3000\n");
+    ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config2"), 0.0001F);
+
+    // an image with another value and a good CRC is what the value is read from
+    std::string image = read_file("/sd/config2.img");
+    ASSERT_TRUE(patch_image(image, 3000.0F, 1234.0F, true));
+    write_file("/sd/config2.img", image);
+    ASSERT_EQUALS_DELTA_V(1234.0F, load_acceleration("/sd/config2"), 0.0001F);
+}
+
+TEST(ConfigImage,bad_crc_reads_the_config_again)
+{
+    write_config("/sd/config3", "acceleration 3000\n");
+    ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config3"), 0.0001F);
+    std::string good = read_file("/sd/config3.img");
+
+    std::string image = good;
+    ASSERT_TRUE(patch_image(image, 3000.0F, 1234.0F, false));
+    write_file("/sd/config3.img", image);
+    ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config3"), 0.0001F);
+
+    // and writes the image again
+    ASSERT_TRUE(read_file("/sd/config3.img") == good);
+}
+
+TEST(ConfigImage,short_image_reads_the_config_again)
+{
+    write_config("/sd/config4", "acceleration 3000\njunction_deviation 0.05\n");
+    ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config4"), 0.0001F);
+    std::string good = read_file("/sd/config4.img");
+
+    // cut short before the CRC, and before the last value
+    const size_t cut[] = { 4, 10 };
+    for (size_t n : cut) {
+        write_file("/sd/config4.img", good.substr(0, good.size() - n));
+        ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config4"), 0.0001F);
+        ASSERT_TRUE(read_file("/sd/config4.img") == good);
+    }
+}
+
+TEST(ConfigImage,changed_config_reads_the_config_again)
+{
+    write_config("/sd/config5", "acceleration 3000\n");
+    ASSERT_EQUALS_DELTA_V(3000.0F, load_acceleration("/sd/config5"), 0.0001F);
+
+    // a different size
+    write_file("/sd/config5", "acceleration 500\n");
+    ASSERT_EQUALS_DELTA_V(500.0F, load_acceleration("/sd/config5"), 0.0001F);
+}
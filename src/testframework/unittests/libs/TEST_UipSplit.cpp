@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "uip.h"
+void uip_split_output(void);
+}
+
+#include "easyunit/test.h"
+
+// uip_split_output() sends a full segment as two frames, the second as its headers and its data from the buffer of the
+// first. The frames sent are kept here as the wire would see them
+
+static std::vector<std::string> frames;
+
+extern "C" void tcpip_output()
+{
+    frames.push_back(std::string((const char *)uip_buf, uip_len));
+}
+
+extern "C" void tcpip_output_tail(u8_t *hdr, u16_t hdrlen, u8_t *data, u16_t datalen)
+{
+    frames.push_back(std::string((const char *)hdr, hdrlen) + std::string((const char *)data, datalen));
+}
+
+#define BUF ((struct uip_tcpip_hdr *)&uip_buf[UIP_LLH_LEN])
+
+static uint32_t get32(const u8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// a segment of len bytes of random data from random addresses and ports, with the checksums uIP gives it
+static std::string make_segment(u16_t len)
+{
+    memset(uip_buf, 0, UIP_LLH_LEN + UIP_TCPIP_HLEN);
+    struct uip_tcpip_hdr *h = BUF;
+    u16_t ip_len = UIP_TCPIP_HLEN + len;
+    h->vhl = 0x45;
+    h->len[0] = ip_len >> 8;
+    h->len[1] = ip_len & 0xff;
+    h->ttl = 64;
+    h->proto = UIP_PROTO_TCP;
+    uip_ipaddr(h->srcipaddr, 192, 168, rand() & 0xff, rand() & 0xff);
+    uip_ipaddr(h->destipaddr, 10, rand() & 0xff, rand() & 0xff, rand() & 0xff);
+    h->srcport = rand();
+    h->destport = rand();
+    for (int i = 0; i < 4; ++i) {
+        h->seqno[i] = rand();
+        h->ackno[i] = rand();
+    }
+    h->tcpoffset = 5 << 4;
+    h->flags = 0x18; // ACK PSH
+    h->wnd[0] = rand();
+    h->wnd[1] = rand();
+    for (u16_t i = 0; i < len; ++i) uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN + i] = rand();
+    h->ipchksum = 0;
+    h->ipchksum = ~(uip_ipchksum());
+    h->tcpchksum = 0;
+    h->tcpchksum = ~(uip_tcpchksum());
+    uip_len = UIP_LLH_LEN + ip_len;
+    return std::string((const char *)uip_buf, uip_len);
+}
+
+// the checksums are good the way uip_input() checks them on the other end
+static bool checksums_good(const std::string& frame)
+{
+    memcpy(uip_buf, frame.data(), frame.size());
+    uip_len = frame.size();
+    return uip_ipchksum() == 0xffff && uip_tcpchksum() == 0xffff;
+}
+
+TEST(UipSplit,full_segment_is_sent_as_two_good_frames)
+{
+    // the frame, not the segment, is checked against the MSS so ones a little shorter and of odd lengths are split too
+    srand(1);
+    for (int n = 0; n < 500; ++n) {
+        u16_t len = UIP_TCP_MSS - rand() % (UIP_LLH_LEN + 1);
+        std::string segment = make_segment(len);
+        const struct uip_tcpip_hdr *s = (const struct uip_tcpip_hdr *)&segment[UIP_LLH_LEN];
+        frames.clear();
+        uip_split_output();
+        ASSERT_EQUALS_V(2, (int)frames.size());
+
+        // the data is split at an even length and follows on in the second frame
+        const struct uip_tcpip_hdr *h1 = (const struct uip_tcpip_hdr *)&frames[0][UIP_LLH_LEN];
+        const struct uip_tcpip_hdr *h2 = (const struct uip_tcpip_hdr *)&frames[1][UIP_LLH_LEN];
+        u16_t len1 = frames[0].size() - UIP_LLH_LEN - UIP_TCPIP_HLEN;
+        u16_t len2 = frames[1].size() - UIP_LLH_LEN - UIP_TCPIP_HLEN;
+        ASSERT_EQUALS_V(0, (len1 & 1));
+        ASSERT_EQUALS_V(len, (len1 + len2));
+        ASSERT_EQUALS_V(UIP_TCPIP_HLEN + len1, ((h1->len[0] << 8) | h1->len[1]));
+        ASSERT_EQUALS_V(UIP_TCPIP_HLEN + len2, ((h2->len[0] << 8) | h2->len[1]));
+        ASSERT_EQUALS_V(get32(s->seqno), get32(h1->seqno));
+        ASSERT_EQUALS_V(get32(s->seqno) + len1, (get32(h2->seqno)));
+        ASSERT_TRUE(frames[0].substr(UIP_LLH_LEN + UIP_TCPIP_HLEN) + frames[1].substr(UIP_LLH_LEN + UIP_TCPIP_HLEN) ==
+                    segment.substr(UIP_LLH_LEN + UIP_TCPIP_HLEN));
+
+        ASSERT_TRUE(checksums_good(frames[0]));
+        ASSERT_TRUE(checksums_good(frames[1]));
+    }
+}
+
+TEST(UipSplit,short_segment_is_sent_as_it_is)
+{
+    srand(2);
+    std::string segment = make_segment(536);
+    frames.clear();
+    uip_split_output();
+    ASSERT_EQUALS_V(1, (int)frames.size());
+    ASSERT_TRUE(frames[0] == segment);
+}
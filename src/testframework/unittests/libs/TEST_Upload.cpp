@@ -0,0 +1,123 @@
+#include "upload.h"
+#include "md5.h"
+
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+// needs the sd card mounted. The data comes in segments of the sizes a browser sends them in, which do not line up with
+// the sectors the upload writes. ASSERT_EQUALS_V evaluates what it is given twice so the calls are made first
+
+static std::string read_file(const char *name)
+{
+    std::string data;
+    FILE *fp = fopen(name, "r");
+    if(fp == NULL) return data;
+    char buf[256];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), fp)) > 0) data.append(buf, n);
+    fclose(fp);
+    return data;
+}
+
+static bool file_exists(const char *name)
+{
+    FILE *fp = fopen(name, "r");
+    if(fp == NULL) return false;
+    fclose(fp);
+    return true;
+}
+
+static std::string make_data(size_t size)
+{
+    std::string data(size, 0);
+    for (size_t i = 0; i < size; ++i) data[i] = rand();
+    return data;
+}
+
+// writes data in segments of a full and a short one in turn, 0 if a write failed
+static int write_segments(void *u, const std::string& data)
+{
+    const unsigned int segments[] = { 1460, 536 };
+    size_t at = 0;
+    for (int i = 0; at < data.size(); ++i) {
+        unsigned int n = segments[i % 2];
+        if(n > data.size() - at) n = data.size() - at;
+        if(!upload_write(u, (const uint8_t *)data.data() + at, n)) return 0;
+        at += n;
+    }
+    return 1;
+}
+
+TEST(Upload,short_final_sector_is_written)
+{
+    // less than a sector, a buffer exactly, and buffers with a short sector at the end
+    const size_t sizes[] = { 100, 4096, 2 * 4096 + 1000, 3 * 4096 + 511 };
+    srand(1);
+    for (size_t size : sizes) {
+        std::string data = make_data(size);
+        void *u = upload_open("upload1");
+        ASSERT_TRUE(u != NULL);
+        int written = write_segments(u, data);
+        int closed = upload_close(u, MD5(data).hexdigest().c_str());
+        ASSERT_EQUALS_V(1, written);
+        ASSERT_EQUALS_V(1, closed);
+
+        // the result starts with the MD5 and the size
+        char start[64];
+        snprintf(start, sizeof(start), "%s %lu bytes", MD5(data).hexdigest().c_str(), (unsigned long)size);
+        ASSERT_TRUE(strncmp(upload_result(u), start, strlen(start)) == 0);
+        upload_free(u);
+
+        ASSERT_TRUE(read_file("/sd/upload1") == data);
+    }
+}
+
+TEST(Upload,no_md5_keeps_the_file)
+{
+    srand(2);
+    std::string data = make_data(5000);
+    void *u = upload_open("upload2");
+    ASSERT_TRUE(u != NULL);
+    int written = write_segments(u, data);
+    int closed = upload_close(u, "");
+    ASSERT_EQUALS_V(1, written);
+    ASSERT_EQUALS_V(1, closed);
+    upload_free(u);
+    ASSERT_TRUE(read_file("/sd/upload2") == data);
+}
+
+TEST(Upload,bad_md5_removes_the_file)
+{
+    srand(3);
+    std::string data = make_data(2 * 4096 + 1000);
+    std::string md5 = MD5(data).hexdigest();
+    md5[0] = md5[0] == '0' ? '1' : '0';
+
+    void *u = upload_open("upload3");
+    ASSERT_TRUE(u != NULL);
+    int written = write_segments(u, data);
+    int closed = upload_close(u, md5.c_str());
+    ASSERT_EQUALS_V(1, written);
+    ASSERT_EQUALS_V(0, closed);
+    ASSERT_TRUE(strstr(upload_result(u), "MD5 mismatch") != NULL);
+    upload_free(u);
+    ASSERT_TRUE(!file_exists("/sd/upload3"));
+}
+
+TEST(Upload,disconnect_removes_the_file)
+{
+    // the client goes away after some buffers have been written to the card, the upload is freed without a close
+    srand(4);
+    std::string data = make_data(3 * 4096 + 1000);
+    void *u = upload_open("upload4");
+    ASSERT_TRUE(u != NULL);
+    int written = write_segments(u, data.substr(0, 2 * 4096 + 100));
+    ASSERT_EQUALS_V(1, written);
+    ASSERT_TRUE(read_file("/sd/upload4").size() == 2 * 4096);
+    upload_free(u);
+    ASSERT_TRUE(!file_exists("/sd/upload4"));
+}
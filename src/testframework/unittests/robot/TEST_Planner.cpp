@@ -0,0 +1,135 @@
+#include "Kernel.h"
+#include "Conveyor.h"
+#include "Block.h"
+#include "Gcode.h"
+#include "StreamOutput.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "easyunit/test.h"
+
+// needs a kernel with the robot, planner and conveyor, with nothing stepping so the blocks stay queued
+
+static void send(const char *line)
+{
+    Gcode gc(line, &StreamOutput::NullStream);
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gc);
+}
+
+// releases the blocks as if the step ticker had run them all
+static void empty_queue()
+{
+    Block *b;
+    THECONVEYOR->flush_queue();
+    THECONVEYOR->get_next_block(&b);
+    THEKERNEL->call_event(ON_IDLE, nullptr);
+}
+
+static std::vector<const Block *> queued_blocks()
+{
+    std::vector<const Block *> blocks;
+    for (const Block *b; (b = THECONVEYOR->get_queued_block(blocks.size())) != nullptr; ) blocks.push_back(b);
+    return blocks;
+}
+
+// the entry speeds the planner has given the queued blocks. A block in the deceleration tail of the incremental
+// planner has its entry speed implied by the distance left to the end of the queue
+static std::vector<float> planned_entry_speeds(float minimum_planner_speed)
+{
+    std::vector<const Block *> blocks = queued_blocks();
+    std::vector<float> speeds;
+    for (size_t k = 0; k < blocks.size(); ++k) {
+        const Block *b = blocks[k];
+        if(b->decel_tail) {
+            float sum = minimum_planner_speed * minimum_planner_speed;
+            for (size_t j = k; j < blocks.size(); ++j) {
+                sum += 2.0F * blocks[j]->acceleration * blocks[j]->millimeters;
+            }
+            speeds.push_back(sqrtf(sum));
+        } else {
+            speeds.push_back(b->entry_speed);
+        }
+    }
+    return speeds;
+}
+
+// the entry speeds a full reverse and forward pass over the whole queue gives
+static std::vector<float> optimal_entry_speeds(float minimum_planner_speed)
+{
+    std::vector<const Block *> blocks = queued_blocks();
+
+    size_t n = blocks.size();
+    std::vector<float> speeds(n);
+    float exit_speed = minimum_planner_speed;
+    for(size_t k = n; k-- > 0; ) {
+        const Block *b = blocks[k];
+        speeds[k] = std::min(b->max_entry_speed, sqrtf(exit_speed * exit_speed + 2.0F * b->acceleration * b->millimeters));
+        exit_speed = speeds[k];
+    }
+    for(size_t k = 1; k < n; ++k) {
+        const Block *b = blocks[k - 1];
+        speeds[k] = std::min(speeds[k], sqrtf(speeds[k - 1] * speeds[k - 1] + 2.0F * b->acceleration * b->millimeters));
+    }
+    return speeds;
+}
+
+// appends moves of random lengths, directions and feedrates, after each one the planned speeds must be the optimal
+// ones. Short moves after long ones and sharp corners after shallow ones make tail blocks that reach their max entry
+// speed in a different order to the one they were added in, which is what the candidate list keeps track of
+static bool check_random_moves(unsigned int seed, int count, float min_length, float max_length)
+{
+    float minimum_planner_speed = THEKERNEL->config->value(CHECKSUM("minimum_planner_speed"))->by_default(0.0F)->as_number();
+    srand(seed);
+    empty_queue();
+    send("G91");
+
+    bool ok = true;
+    float angle = 0.0F;
+    for (int i = 0; ok && i < count; ++i) {
+        float r = (float)rand() / RAND_MAX;
+        float length = min_length + (max_length - min_length) * r * r;
+        angle += ((float)rand() / RAND_MAX - 0.5F) * (i % 5 == 0 ? 3.0F : 0.6F);
+        int feedrate = 1200 + (rand() % 4) * 1200;
+        char line[64];
+        snprintf(line, sizeof(line), "G1 X%1.4f Y%1.4f F%d", length * cosf(angle), length * sinf(angle), feedrate);
+        send(line);
+
+        std::vector<float> planned = planned_entry_speeds(minimum_planner_speed);
+        std::vector<float> optimal = optimal_entry_speeds(minimum_planner_speed);
+        ok = planned.size() == optimal.size();
+        for (size_t k = 0; ok && k < planned.size(); ++k) {
+            if(fabsf(planned[k] - optimal[k]) > 0.01F + optimal[k] * 0.002F) {
+                printf("move %d block %u: entry speed %1.4f, optimal %1.4f\n", i, (unsigned)k, planned[k], optimal[k]);
+                ok = false;
+            }
+        }
+    }
+
+    send("G90");
+    empty_queue();
+    return ok;
+}
+
+TEST(Planner,entry_speeds_of_long_moves)
+{
+    ASSERT_TRUE(check_random_moves(1, 30, 1.0F, 20.0F));
+}
+
+TEST(Planner,entry_speeds_of_short_moves)
+{
+    // the whole queue is deceleration tail with short segments
+    ASSERT_TRUE(check_random_moves(2, 30, 0.02F, 0.5F));
+}
+
+TEST(Planner,entry_speeds_of_mixed_moves)
+{
+    for (unsigned int seed = 3; seed < 23; ++seed) {
+        ASSERT_TRUE(check_random_moves(seed, 30, 0.02F, 10.0F));
+    }
+}
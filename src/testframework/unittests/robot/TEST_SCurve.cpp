@@ -0,0 +1,150 @@
+#include "SCurve.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "easyunit/test.h"
+
+// the pieces follow on from each other and never go over the acceleration
+static bool check_pieces(const SCurve& curve, float acceleration)
+{
+    for (int i = 0; i < curve.n_pieces; ++i) {
+        const SCurve::piece_t& p = curve.pieces[i];
+        float a_end = p.a + p.j * p.t;
+        if(p.t < 0.0F || fabsf(p.a) > acceleration * 1.001F || fabsf(a_end) > acceleration * 1.001F) return false;
+        if(i + 1 < curve.n_pieces) {
+            const SCurve::piece_t& n = curve.pieces[i + 1];
+            float v_end = p.v + p.t * (p.a + p.t * p.j / 2.0F);
+            float x_end = p.x + p.t * (p.v + p.t * (p.a / 2.0F + p.t * p.j / 6.0F));
+            if(fabsf(n.v - v_end) > 0.01F || fabsf(n.a - a_end) > 1.0F || fabsf(n.x - x_end) > 0.0001F) return false;
+        }
+    }
+    return true;
+}
+
+TEST(SCurve,plan_rest_to_rest_reaches_the_plateau)
+{
+    SCurve curve;
+    curve.plan(0.0F, 0.0F, 0.0F, 100.0F, 50.0F, 3000.0F, 100000.0F);
+
+    ASSERT_TRUE(curve.fits());
+    ASSERT_TRUE(check_pieces(curve, 3000.0F));
+    // ramps up and down at full acceleration, and a cruise
+    ASSERT_EQUALS_V(7, (int)curve.n_pieces);
+    ASSERT_EQUALS_DELTA_V(50.0F, curve.get_distance(), 0.001F);
+    ASSERT_EQUALS_DELTA_V(0.0F, curve.get_exit_speed(), 0.001F);
+    ASSERT_EQUALS_DELTA_V(100.0F, curve.speed_at(25.0F), 0.01F);
+    ASSERT_EQUALS_DELTA_V(0.0F, curve.speed_at(0.0F), 0.001F);
+}
+
+TEST(SCurve,plan_short_distance_stays_under_vmax)
+{
+    SCurve curve;
+    curve.plan(10.0F, 0.0F, 10.0F, 100.0F, 1.0F, 3000.0F, 5000.0F);
+
+    ASSERT_TRUE(curve.fits());
+    ASSERT_TRUE(check_pieces(curve, 3000.0F));
+    ASSERT_EQUALS_DELTA_V(1.0F, curve.get_distance(), 0.001F);
+    ASSERT_EQUALS_DELTA_V(10.0F, curve.get_exit_speed(), 0.001F);
+    float peak = curve.speed_at(0.5F);
+    ASSERT_TRUE(peak > 10.0F && peak < 100.0F);
+}
+
+TEST(SCurve,plan_carries_on_the_start_acceleration)
+{
+    // already accelerating, it has to ramp the acceleration down before it can cruise
+    SCurve curve;
+    curve.plan(20.0F, 2000.0F, 20.0F, 60.0F, 20.0F, 3000.0F, 100000.0F);
+
+    ASSERT_TRUE(curve.fits());
+    ASSERT_TRUE(check_pieces(curve, 3000.0F));
+    ASSERT_EQUALS_DELTA_V(2000.0F, curve.pieces[0].a, 0.001F);
+    ASSERT_EQUALS_DELTA_V(20.0F, curve.get_distance(), 0.001F);
+    ASSERT_EQUALS_DELTA_V(60.0F, curve.speed_at(10.0F), 0.01F);
+}
+
+TEST(SCurve,locate_finds_the_piece_and_time)
+{
+    SCurve curve;
+    curve.plan(0.0F, 0.0F, 0.0F, 100.0F, 50.0F, 3000.0F, 100000.0F);
+
+    // the end of each piece is where the next one starts
+    for (int i = 1; i < curve.n_pieces; ++i) {
+        uint8_t piece;
+        float t;
+        curve.locate(curve.pieces[i].x + 0.00001F, piece, t);
+        ASSERT_EQUALS_V(i, (int)piece);
+        ASSERT_TRUE(t >= 0.0F && t < 0.001F);
+    }
+
+    // the time found covers the distance asked for, and the speed only goes up while accelerating
+    float last_v = 0.0F;
+    for (float x = 0.01F; x < 3.0F; x += 0.01F) {
+        uint8_t piece;
+        float t, v, a;
+        curve.locate(x, piece, t);
+        const SCurve::piece_t& p = curve.pieces[piece];
+        float d = p.x + t * (p.v + t * (p.a / 2.0F + t * p.j / 6.0F));
+        ASSERT_EQUALS_DELTA_V(x, d, 0.0001F);
+        curve.get_state(piece, t, v, a);
+        ASSERT_TRUE(v >= last_v);
+        last_v = v;
+    }
+
+    // past the end it stays at the end of the last piece
+    uint8_t piece;
+    float t;
+    curve.locate(60.0F, piece, t);
+    ASSERT_EQUALS_V(curve.n_pieces - 1, (int)piece);
+    ASSERT_EQUALS_DELTA_V(curve.pieces[piece].t, t, 0.000001F);
+}
+
+TEST(SCurve,max_entry_speed_fits_the_distance)
+{
+    // without reaching the full acceleration, then reaching it
+    const float distances[] = { 0.1F, 1.0F, 20.0F };
+    for (float d : distances) {
+        float v0 = SCurve::max_entry_speed(5.0F, d, 3000.0F, 20000.0F);
+        ASSERT_TRUE(v0 > 5.0F);
+
+        SCurve curve;
+        curve.plan(v0, 0.0F, 5.0F, 1000.0F, d, 3000.0F, 20000.0F);
+        ASSERT_TRUE(curve.fits());
+        ASSERT_TRUE(check_pieces(curve, 3000.0F));
+        ASSERT_EQUALS_DELTA_V(5.0F, curve.get_exit_speed(), 0.01F);
+        ASSERT_TRUE(curve.get_distance() <= d * 1.001F);
+
+        // any faster and it can not slow down to the exit speed in time, it overruns or exits slower
+        SCurve faster;
+        faster.plan(v0 * 1.01F, 0.0F, 5.0F, 1000.0F, d, 3000.0F, 20000.0F);
+        ASSERT_TRUE(!faster.fits() || faster.get_exit_speed() < 4.99F);
+    }
+}
+
+TEST(SCurve,plan_takes_a_lower_exit_that_fits)
+{
+    // from 100mm/s slowing to 30mm/s takes 15.4mm but stopping takes 14.1mm, the ramp distance is not monotonic in
+    // the exit speed below a third of the start speed
+    SCurve curve;
+    curve.plan(100.0F, 0.0F, 30.0F, 200.0F, 14.5F, 3000.0F, 5000.0F);
+
+    ASSERT_TRUE(curve.fits());
+    ASSERT_TRUE(check_pieces(curve, 3000.0F));
+    ASSERT_TRUE(curve.get_exit_speed() < 30.0F);
+    ASSERT_TRUE(curve.get_distance() <= 14.5F * 1.001F);
+}
+
+TEST(SCurve,plan_overruns_when_nothing_fits)
+{
+    // stopping takes 14.1mm at the least
+    SCurve curve;
+    curve.plan(100.0F, 0.0F, 30.0F, 200.0F, 10.0F, 3000.0F, 5000.0F);
+
+    ASSERT_TRUE(!curve.fits());
+    ASSERT_TRUE(check_pieces(curve, 3000.0F));
+    ASSERT_TRUE(curve.get_distance() > 10.0F);
+
+    // the speed it has at the end of the distance is what the planner carries on from
+    float v = curve.speed_at(10.0F);
+    ASSERT_TRUE(v > 0.0F && v < 100.0F);
+}